@@ -17,7 +17,11 @@ in one of C++ files that include this header, BEFORE the include, like this:
 #define FAST_MATH_H
 
 #include <stdint.h>
+#include <stddef.h>
 #include <cmath>
+#include <string.h>
+#include <span>
+#include <type_traits>
 
 #ifndef FM_USE_SSE2_INSTEAD_OF_SSE4
 #include <smmintrin.h>
@@ -25,17 +29,70 @@ in one of C++ files that include this header, BEFORE the include, like this:
 #include <emmintrin.h>
 #endif
 
+// NOTE: 8 wide packets (v3x8, v4x8) are available when the translation unit is compiled with AVX enabled
+#ifdef __AVX__
+#include <immintrin.h>
+#endif
+
 #ifdef _MSC_VER
 __pragma(warning(push))
 __pragma(warning(disable : 4201))
 __pragma(warning(disable : 4146))
 #endif
 
-// TODO: make FM_SINL work on all compilers
+// NOTE: Every macro below can be predefined before including the header to override it
 
+#ifndef FM_INL
+#if defined(_MSC_VER)
 #define FM_INL __forceinline
-#define FM_SINL static __forceinline
+#elif defined(__GNUC__) || defined(__clang__)
+#define FM_INL inline __attribute__((always_inline))
+#else
+#define FM_INL inline
+#endif
+#endif
+
+#ifndef FM_SINL
+#define FM_SINL static FM_INL
+#endif
+
+// NOTE: FM_FLATTEN inlines everything called from a not inlined function body (GCC and Clang only)
+#ifndef FM_FLATTEN
+#if !defined(_MSC_VER) && (defined(__GNUC__) || defined(__clang__))
+#define FM_FLATTEN __attribute__((flatten))
+#else
+#define FM_FLATTEN
+#endif
+#endif
+
+// NOTE: The System V x86-64 ABI already passes __m128 and structs wrapping a single __m128 in xmm registers,
+// so there is no calling convention to request on Linux. On Windows __vectorcall does the same job.
+#ifndef FM_CALL
+#if defined(_MSC_VER) || (defined(__clang__) && defined(_WIN32) && !defined(__arm__) && !defined(__aarch64__))
 #define FM_CALL __vectorcall
+#else
+#define FM_CALL
+#endif
+#endif
+
+// NOTE: Inlined functions use fused multiply-add when the translation unit is compiled with FMA (-mfma, /arch:AVX2).
+//       Results then differ from separate multiplies and adds in the last bit, define FM_NO_FMA to keep them identical.
+#if !defined(FM_USE_FMA) && !defined(FM_NO_FMA) && (defined(__FMA__) || (defined(_MSC_VER) && defined(__AVX2__)))
+#define FM_USE_FMA
+#endif
+
+// NOTE: Storage of aligned_array and soa_array, Alignment is always 64
+#ifndef FM_ALIGNED_ALLOC
+#define FM_ALIGNED_ALLOC(_Size, _Alignment) _mm_malloc(_Size, _Alignment)
+#endif
+#ifndef FM_ALIGNED_FREE
+#define FM_ALIGNED_FREE(_Ptr) _mm_free(_Ptr)
+#endif
+
+// NOTE: Bytes reserved by the first ThreadFrameArena call on every thread
+#ifndef FM_THREAD_FRAME_ARENA_SIZE
+#define FM_THREAD_FRAME_ARENA_SIZE (4 * 1024 * 1024)
+#endif
 
 #define FM_FUN auto
 #define FM_FUN_T template<t> auto
@@ -44,7 +101,8 @@ __pragma(warning(disable : 4146))
 #define FM_FUN_TI template<class t> FM_INL auto
 #define FM_FUN_IC FM_INL auto FM_CALL
 #define FM_FUN_SI static FM_INL auto
-#define FM_FUN_TSI template<class t> static FM_INL auto
+#define FM_FUN_SIE static FM_INL constexpr auto
+#define FM_FUN_TSI template<class t> static FM_INL constexpr auto
 #define FM_FUN_2T template<class t> template<class u> auto
 #define FM_FUN_SIC static FM_INL auto FM_CALL
 
@@ -59,11 +117,11 @@ Macro(i8, int8_t) Macro(u8, uint8_t)
 
 #ifdef NDEBUG
 #ifdef _MSC_VER
-#define FM_ASSERT(expression) if(!expression)__debugbreak()
+#define FM_ASSERT(expression) if(!(expression))__debugbreak()
 #define FM_ERROR() __debugbreak()
 #else
-#define FM_ASSERT(expression) if(!expression){*(int32_t*)0 = 0}
-#define FM_ERROR() {*(int32_t*)0 = 0}
+#define FM_ASSERT(expression) if(!(expression))__builtin_trap()
+#define FM_ERROR() __builtin_trap()
 #endif
 #else
 #define FM_ASSERT(expression) 
@@ -96,12 +154,12 @@ namespace fm {
         struct { t Left, Right; };
         t Elements[2];
         
-        v2_base(t X, t Y) :X(X), Y(Y) {}
-        explicit v2_base(t XY) :X(XY), Y(XY) {}
-        explicit v2_base(const t* Mem) :X(Mem[0]), Y(Mem[1]) {}
+        constexpr v2_base(t X, t Y) :X(X), Y(Y) {}
+        constexpr explicit v2_base(t XY) :X(XY), Y(XY) {}
+        constexpr explicit v2_base(const t* Mem) :X(Mem[0]), Y(Mem[1]) {}
         v2_base() = default;
         
-        template<class u> explicit v2_base(v2_base<u> V)
+        template<class u> constexpr explicit v2_base(v2_base<u> V)
             :X((t)V.X), Y((t)V.Y) {}
         
         FM_FUN_I operator[](uint32_t Index) -> t&; 
@@ -140,14 +198,14 @@ namespace fm {
         struct { t Placeholder3_; v2_base<t> GB; };
         t Elements[3];
         
-        v3_base(t X, t Y, t Z) :X(X), Y(Y), Z(Z) {}
-        v3_base(v2_base<t> XY_, t Z_ = 0){ XY = XY_; Z = Z_; }
-        v3_base(t X, v2_base<t> YZ) :X(X), YZ(YZ) {}
-        explicit v3_base(t XYZ) :X(XYZ), Y(XYZ), Z(XYZ) {}
-        explicit v3_base(const t* Mem) :X(Mem[0]), Y(Mem[1]), Z(Mem[2]) {}
+        constexpr v3_base(t X, t Y, t Z) :X(X), Y(Y), Z(Z) {}
+        constexpr v3_base(v2_base<t> XY, t Z = 0) :X(XY.X), Y(XY.Y), Z(Z) {}
+        constexpr v3_base(t X, v2_base<t> YZ) :X(X), Y(YZ.X), Z(YZ.Y) {}
+        constexpr explicit v3_base(t XYZ) :X(XYZ), Y(XYZ), Z(XYZ) {}
+        constexpr explicit v3_base(const t* Mem) :X(Mem[0]), Y(Mem[1]), Z(Mem[2]) {}
         v3_base() = default;
         
-        template<class u> explicit v3_base(v3_base<u> V)
+        template<class u> constexpr explicit v3_base(v3_base<u> V)
             :X((t)V.X), Y((t)V.Y), Z((t)V.Z) {}
         
         FM_FUN_I operator[](uint32_t Index) -> t&; 
@@ -205,16 +263,16 @@ namespace fm {
         
         t Elements[4];
         
-        v4_base(t X, t Y, t Z, t W) :X(X), Y(Y), Z(Z), W(W) {}
-        v4_base(v2_base<t> XY, v2_base<t> ZW = {}) :XY(XY), ZW(ZW) {}
-        v4_base(v2_base<t> XY_, t Z_ = 0, t W_ = 0) { XY = XY_; Z = Z_; W = W_; }
-        v4_base(v3_base<t> XYZ_, t W_ = 0) { XYZ = XYZ_; W = W_; }
-        v4_base(t X, v3_base<t> YZW) :X(X), YZ(YZW.XY), W(YZW.Z) {}
-        explicit v4_base(t XYZW) :X(XYZW), Y(XYZW), Z(XYZW), W(XYZW) {}
-        explicit v4_base(const t* Mem) :X(Mem[0]), Y(Mem[1]), Z(Mem[2]), W(Mem[3]) {}
+        constexpr v4_base(t X, t Y, t Z, t W) :X(X), Y(Y), Z(Z), W(W) {}
+        constexpr v4_base(v2_base<t> XY, v2_base<t> ZW = {}) :X(XY.X), Y(XY.Y), Z(ZW.X), W(ZW.Y) {}
+        constexpr v4_base(v2_base<t> XY, t Z = 0, t W = 0) :X(XY.X), Y(XY.Y), Z(Z), W(W) {}
+        constexpr v4_base(v3_base<t> XYZ, t W = 0) :X(XYZ.X), Y(XYZ.Y), Z(XYZ.Z), W(W) {}
+        constexpr v4_base(t X, v3_base<t> YZW) :X(X), Y(YZW.X), Z(YZW.Y), W(YZW.Z) {}
+        constexpr explicit v4_base(t XYZW) :X(XYZW), Y(XYZW), Z(XYZW), W(XYZW) {}
+        constexpr explicit v4_base(const t* Mem) :X(Mem[0]), Y(Mem[1]), Z(Mem[2]), W(Mem[3]) {}
         v4_base() = default;
         
-        template<class u> explicit v4_base(v4_base<u> V)
+        template<class u> constexpr explicit v4_base(v4_base<u> V)
             :X((t)V.X), Y((t)V.Y), Z((t)V.Z), W((t)V.W) {}
         
         FM_FUN_I operator[](uint32_t Index) -> t&; 
@@ -232,6 +290,11 @@ namespace fm {
     using v4i8 = v4_base<int8_t>;
     using v4u8 = v4_base<uint8_t>;
     
+    // NOTE: IEEE 754 half precision storage (binary16 bit patterns), convert to v2/v3/v4 or vec4 for math
+    struct v2h { uint16_t X, Y; };
+    struct v3h { uint16_t X, Y, Z; };
+    struct v4h { uint16_t X, Y, Z, W; };
+    
     struct alignas(16) vec2
     {
         __m128 M;
@@ -489,7 +552,7 @@ namespace fm {
         v2_base<t> Min, Max;
         
         rect2_base() = default;
-        template<class u> rect2_base(rect2_base<u>); 
+        template<class u> constexpr rect2_base(rect2_base<u>); 
         
         constexpr void IsFastMathRect2() {}
     };
@@ -504,6 +567,19 @@ namespace fm {
     using rect2i8 = rect2_base<int8_t>;
     using rect2u8 = rect2_base<uint8_t>;
     
+    // NOTE: rect2 in one register, M is MinX, MinY, MaxX, MaxY
+    struct alignas(16) rect2s
+    {
+        __m128 M;
+        
+        FM_INL float FM_CALL MinX() const;
+        FM_INL float FM_CALL MinY() const;
+        FM_INL float FM_CALL MaxX() const;
+        FM_INL float FM_CALL MaxY() const;
+        FM_INL v2 FM_CALL Min() const;
+        FM_INL v2 FM_CALL Max() const;
+    };
+    
     struct alignas(16) mat4
     {
         __m128 Columns[4];
@@ -531,6 +607,188 @@ namespace fm {
         FM_FUN_I operator[](uint32_t Index) -> float&; 
     };
     
+    // NOTE: Column-major scalars of a mat4 that can be built in constant expressions, load it with Mat4FromConstant
+    struct alignas(16) mat4_constant
+    {
+        v4 Columns[4];
+    };
+    
+    // NOTE: Affine matrix with an implicit (0, 0, 0, 1) last row, rows are stored with the translation in W
+    struct alignas(16) mat3x4
+    {
+        __m128 Rows[3];
+        
+        FM_FUN_IC GetRowV4(uint32_t Index) -> v4;
+        FM_FUN_IC GetRowVec4(uint32_t Index) -> vec4;
+        FM_FUN_IC GetTranslationV3() -> v3;
+        FM_FUN_IC GetTranslationVec3() -> vec3;
+        
+        FM_FUN_I operator[](uint32_t Index) -> float&; // NOTE: Row-major index
+    };
+    
+    // NOTE: (X, Y, Z) is the vector part and W the scalar part, rotations expect unit quaternions
+    struct alignas(16) quat
+    {
+        __m128 M;
+        
+        FM_FUN_IC X() const -> float;
+        FM_FUN_IC Y() const -> float;
+        FM_FUN_IC Z() const -> float;
+        FM_FUN_IC W() const -> float;
+        
+        FM_FUN_I operator[](uint32_t Index) -> float&;
+    };
+    
+    // NOTE: Rotation followed by a translation, Real is the rotation and Dual is 0.5 * Translation * Real
+    struct alignas(16) dual_quat
+    {
+        quat Real;
+        quat Dual;
+    };
+    
+    // NOTE: Records transform steps as Translation * Linear * Scale * Rotation and builds the mat4 once.
+    //       Linear is only used after shears or non uniform scales of a rotated transform.
+    struct alignas(16) transform_builder
+    {
+        __m128 Translation;
+        __m128 Scale;
+        quat Rotation;
+        __m128 Linear[3];
+        bool HasRotation;
+        bool HasLinear;
+    };
+    
+    // NOTE: Vector packets keep N vectors transposed, one register per component (structure of arrays)
+    namespace priv {
+        template<uint32_t n> struct packet_register;
+        template<> struct packet_register<4> { using type = __m128; };
+#ifdef __AVX__
+        template<> struct packet_register<8> { using type = __m256; };
+#endif
+    }
+    template<uint32_t n> using packet_float = typename priv::packet_register<n>::type;
+    
+    template<uint32_t n> struct v3x_base;
+    template<uint32_t n> struct v4x_base;
+    namespace priv {
+        template<class t, uint32_t n> struct soa_packet;
+        template<uint32_t n> struct soa_packet<v3, n> { using type = v3x_base<n>; };
+        template<uint32_t n> struct soa_packet<v4, n> { using type = v4x_base<n>; };
+    }
+    
+    template<uint32_t n>
+        struct v3x_base
+    {
+        packet_float<n> X, Y, Z;
+        
+        FM_FUN_IC GetV3(uint32_t Index) -> v3;
+        FM_FUN_IC GetVec3(uint32_t Index) -> vec3;
+        FM_FUN_IC Set(uint32_t Index, v3 V) -> void;
+        FM_FUN_IC Set(uint32_t Index, vec3 V) -> void;
+    };
+    using v3x4 = v3x_base<4>;
+    
+    template<uint32_t n>
+        struct v4x_base
+    {
+        packet_float<n> X, Y, Z, W;
+        
+        FM_FUN_IC GetV4(uint32_t Index) -> v4;
+        FM_FUN_IC GetVec4(uint32_t Index) -> vec4;
+        FM_FUN_IC Set(uint32_t Index, v4 V) -> void;
+        FM_FUN_IC Set(uint32_t Index, vec4 V) -> void;
+    };
+    using v4x4 = v4x_base<4>;
+    
+#ifdef __AVX__
+    using v3x8 = v3x_base<8>;
+    using v4x8 = v4x_base<8>;
+#endif
+    
+    // NOTE: Fixed size owning arrays on 64 byte aligned storage. The size is rounded up to whole cache lines
+    //       and the padding is zeroed, so packet loops can cover the last partial packet without a scalar tail.
+    template<class t>
+        struct aligned_array
+    {
+        t* Data;
+        size_t Count;
+        size_t Capacity;
+        
+        aligned_array() :Data(nullptr), Count(0), Capacity(0) {}
+        explicit aligned_array(size_t Count);
+        aligned_array(aligned_array&& Other) noexcept;
+        aligned_array(const aligned_array&) = delete;
+        ~aligned_array();
+        
+        FM_FUN_I operator=(aligned_array&& Other) noexcept -> aligned_array&;
+        aligned_array& operator=(const aligned_array&) = delete;
+        
+        FM_FUN_I operator[](size_t Index) -> t&;
+        FM_FUN_I begin() -> t* { return Data; }
+        FM_FUN_I end() -> t* { return Data + Count; }
+        
+        // NOTE: Packets are only available for arrays of floats
+        template<uint32_t n> FM_FUN_I PacketCount() const -> size_t;
+        template<uint32_t n> FM_FUN_I Packet(size_t Index) -> packet_float<n>&;
+        template<uint32_t n, class f> FM_FUN_I ForEachPacket(f Function) -> void;
+    };
+    
+    // NOTE: v2, v3 or v4 stored as one float array per component, every component array starts on a cache line.
+    //       ForEachPacket passes one packet_float<n>& per component, GetPacket returns v3x_base<n> or v4x_base<n>.
+    template<class t>
+        struct soa_array
+    {
+        static constexpr uint32_t Components = sizeof(t) / sizeof(float);
+        
+        float* Data;
+        size_t Count;
+        size_t Capacity; // NOTE: Floats per component
+        
+        soa_array() :Data(nullptr), Count(0), Capacity(0) {}
+        explicit soa_array(size_t Count);
+        soa_array(soa_array&& Other) noexcept;
+        soa_array(const soa_array&) = delete;
+        ~soa_array();
+        
+        FM_FUN_I operator=(soa_array&& Other) noexcept -> soa_array&;
+        soa_array& operator=(const soa_array&) = delete;
+        
+        FM_FUN_I Get(size_t Index) const -> t;
+        FM_FUN_I Set(size_t Index, t V) -> void;
+        
+        FM_FUN_I Component(uint32_t Index) -> std::span<float>;
+        FM_FUN_I X() -> std::span<float> { return Component(0); }
+        FM_FUN_I Y() -> std::span<float> { return Component(1); }
+        FM_FUN_I Z() -> std::span<float> { return Component(2); }
+        FM_FUN_I W() -> std::span<float> { return Component(3); }
+        
+        template<uint32_t n> FM_FUN_I PacketCount() const -> size_t;
+        template<uint32_t n> FM_FUN_I GetPacket(size_t Index) const -> typename priv::soa_packet<t, n>::type;
+        template<uint32_t n> FM_FUN_I SetPacket(size_t Index, typename priv::soa_packet<t, n>::type P) -> void;
+        template<uint32_t n, class f> FM_FUN_I ForEachPacket(f Function) -> void;
+    };
+    
+    // NOTE: Bump allocator over one 64 byte aligned block, Reset releases every allocation at once
+    struct frame_arena
+    {
+        uint8_t* Base;
+        size_t Size;
+        size_t Used;
+        bool OwnsMemory;
+    };
+    
+    // NOTE: Fixed number of equally sized slots, free slots are linked through their own memory
+    template<class t>
+        struct pool
+    {
+        t* Slots;
+        uint32_t Capacity;
+        uint32_t Used;
+        uint32_t FirstFree;
+    };
+    using mat4_pool = pool<mat4>;
+    using quat_pool = pool<quat>;
+    
     ///////////////
     // constants //
     ///////////////
@@ -753,39 +1011,39 @@ namespace fm {
     FM_FUN_TSI ClampAboveZero(t* Value) -> void {
         *Value = ClampAboveZero(*Value);
     }
-    FM_FUN_SI RadiansToDegrees(float Radians) -> float {
+    FM_FUN_SIE RadiansToDegrees(float Radians) -> float {
         return Radians * 180.f / Pi32;
     }
-    FM_FUN_SI RadiansToDegrees(double Radians) -> double {
+    FM_FUN_SIE RadiansToDegrees(double Radians) -> double {
         return Radians * 180.0 / Pi64;
     }
-    FM_FUN_SI DegreesToRadians(float Degrees) -> float {
+    FM_FUN_SIE DegreesToRadians(float Degrees) -> float {
         return Degrees * Pi32 / 180.f;
     }
-    FM_FUN_SI DegreesToRadians(double Degrees) -> double {
+    FM_FUN_SIE DegreesToRadians(double Degrees) -> double {
         return Degrees * Pi64 / 180.0;
     }
-    FM_FUN_SI PeriodicClampRotationDegrees(float Degrees) -> float {
+    FM_FUN_SIE PeriodicClampRotationDegrees(float Degrees) -> float {
         if(Degrees > 360)
             Degrees -= 360;
         else if(Degrees < 0)
             Degrees += 360;
         return Degrees;
     }
-    FM_FUN_SI PeriodicClampRotationDegrees(double Degrees) -> double {
+    FM_FUN_SIE PeriodicClampRotationDegrees(double Degrees) -> double {
         if(Degrees > 360)
             Degrees -= 360;
         else if(Degrees < 0)
             Degrees += 360;
         return Degrees;
     }
-    FM_FUN_SI PeriodicClampRotationDegrees(float* Degrees) -> void {
+    FM_FUN_SIE PeriodicClampRotationDegrees(float* Degrees) -> void {
         *Degrees = PeriodicClampRotationDegrees(*Degrees);
     }
-    FM_FUN_SI PeriodicClampRotationDegrees(double* Degrees) -> void {
+    FM_FUN_SIE PeriodicClampRotationDegrees(double* Degrees) -> void {
         *Degrees = PeriodicClampRotationDegrees(*Degrees);
     }
-    FM_FUN_SI DifferenceBetweenDegrees(float A, float B) -> float {
+    FM_FUN_SIE DifferenceBetweenDegrees(float A, float B) -> float {
         FM_ASSERT(A >= 0 && B >= 0);
         float Diff = Abs(B - A);
         if(Diff > 180)
@@ -803,23 +1061,31 @@ namespace fm {
     FM_FUN_TSI SafeDiv0(t Numerator, t Divisor) -> t {
         return SafeDivN<t>(Numerator, Divisor, 0);
     }
-    FM_FUN_SI Lerp(float Source, float Dest, float T) -> float {
+    FM_FUN_SIE Lerp(float Source, float Dest, float T) -> float {
+#ifdef FM_USE_FMA
+        if(!std::is_constant_evaluated())
+            return fmaf(1.f - T, Source, T * Dest);
+#endif
         return ((1.f - T) * Source) + (T * Dest);
     }
-    FM_FUN_SI Lerp(double Source, double Dest, double T) -> double {
+    FM_FUN_SIE Lerp(double Source, double Dest, double T) -> double {
         return ((1.0 - T) * Source) + (T * Dest);
     }
-    FM_FUN_SI FastLerp(float Source, float Dest, float T) -> float {
+    FM_FUN_SIE FastLerp(float Source, float Dest, float T) -> float {
+#ifdef FM_USE_FMA
+        if(!std::is_constant_evaluated())
+            return fmaf(Dest - Source, T, Source);
+#endif
         return Source + (Dest - Source) * T;
     }
-    FM_FUN_SI FastLerp(double Source, double Dest, double T) -> double {
+    FM_FUN_SIE FastLerp(double Source, double Dest, double T) -> double {
         return Source + (Dest - Source) * T;
     }
-    FM_FUN_SI Equal(float A, float B, float Epsilon = 0.0001f) -> bool {
+    FM_FUN_SIE Equal(float A, float B, float Epsilon = 0.0001f) -> bool {
         float Difference = Abs(A - B);
         return Difference < Epsilon;
     }
-    FM_FUN_SI Equal(double A, double B, double Epsilon = 0.0001) -> bool {
+    FM_FUN_SIE Equal(double A, double B, double Epsilon = 0.0001) -> bool {
         double Difference = Abs(A - B);
         return Difference < Epsilon;
     }
@@ -861,6 +1127,65 @@ namespace fm {
         FM_SINL float FM_CALL SumOfElements(__m128 m) {
             return GetX(m) + GetY(m) + GetZ(m) + GetW(m);
         }
+        // NOTE: A * B + C, with a single rounding when FM_USE_FMA is defined
+        FM_SINL float FM_CALL MulAdd(float A, float B, float C) {
+#ifdef FM_USE_FMA
+            return fmaf(A, B, C);
+#else
+            return A * B + C;
+#endif
+        }
+        FM_SINL __m128 FM_CALL MulAdd(__m128 A, __m128 B, __m128 C) {
+#ifdef FM_USE_FMA
+            return _mm_fmadd_ps(A, B, C);
+#else
+            return _mm_add_ps(_mm_mul_ps(A, B), C);
+#endif
+        }
+        // NOTE: Lanes of B where the bit of Mask is set and lanes of A everywhere else
+        template<int Mask> FM_INL __m128 FM_CALL Blend(__m128 A, __m128 B) {
+#ifndef FM_USE_SSE2_INSTEAD_OF_SSE4
+            return _mm_blend_ps(A, B, Mask);
+#else
+            __m128 M = _mm_castsi128_ps(_mm_setr_epi32(Mask & 1 ? -1 : 0, Mask & 2 ? -1 : 0, Mask & 4 ? -1 : 0, Mask & 8 ? -1 : 0));
+            return _mm_or_ps(_mm_and_ps(M, B), _mm_andnot_ps(M, A));
+#endif
+        }
+        // NOTE: Sum of the first Count lanes broadcasted to every lane.
+        //       Shuffles and adds were measured faster than dpps in throughput, so SSE4 builds use them too.
+        template<uint32_t Count> FM_INL __m128 FM_CALL SplatSum(__m128 V) {
+            if constexpr(Count == 2)
+            {
+                V = _mm_add_ps(V, _mm_shuffle_ps(V, V, _MM_SHUFFLE(2, 3, 0, 1)));
+                return _mm_shuffle_ps(V, V, _MM_SHUFFLE(0, 0, 0, 0));
+            }
+            else if constexpr(Count == 3)
+            {
+                __m128 R = _mm_add_ps(V, _mm_shuffle_ps(V, V, _MM_SHUFFLE(1, 1, 1, 1)));
+                R = _mm_add_ps(R, _mm_shuffle_ps(V, V, _MM_SHUFFLE(2, 2, 2, 2)));
+                return _mm_shuffle_ps(R, R, _MM_SHUFFLE(0, 0, 0, 0));
+            }
+            else
+            {
+                V = _mm_add_ps(V, _mm_shuffle_ps(V, V, _MM_SHUFFLE(2, 3, 0, 1)));
+                return _mm_add_ps(V, _mm_shuffle_ps(V, V, _MM_SHUFFLE(1, 0, 3, 2)));
+            }
+        }
+        template<uint32_t Count> FM_INL __m128 FM_CALL SplatDot(__m128 A, __m128 B) {
+            return SplatSum<Count>(_mm_mul_ps(A, B));
+        }
+        // NOTE: rsqrt gives 12 bits, one Newton-Raphson step brings it to about 22 bits
+        FM_SINL __m128 FM_CALL ReciprocalSqrt(__m128 X) {
+            __m128 R = _mm_rsqrt_ps(X);
+            return _mm_mul_ps(_mm_mul_ps(_mm_set1_ps(0.5f), R), _mm_sub_ps(_mm_set1_ps(3.f), _mm_mul_ps(_mm_mul_ps(X, R), R)));
+        }
+        // NOTE: Fallback is used when the squared length is NaN, infinite or below the smallest normal float
+        FM_SINL __m128 FM_CALL NormalizeOrFallback(__m128 V, __m128 LengthSquared, __m128 Fallback) {
+            __m128 Valid = _mm_and_ps(_mm_cmpge_ps(LengthSquared, _mm_set1_ps(1.17549435e-38f)),
+                                      _mm_cmplt_ps(LengthSquared, _mm_set1_ps(INFINITY)));
+            __m128 R = _mm_div_ps(V, _mm_sqrt_ps(LengthSquared));
+            return _mm_or_ps(_mm_and_ps(Valid, R), _mm_andnot_ps(Valid, Fallback));
+        }
     }
     
     //////////////////
@@ -1044,9 +1369,10 @@ namespace fm {
         return (v2_base<t>)(R);
     }
     FM_FUN_TSI FastLerp(v2_base<t> Source, v2_base<t> Dest, float T) -> v2_base<t> {
-        v2 fSource = (v2)Source;
-        v2 fDest = (v2)Dest;
-        return (v2_base<t>)(fSource + T * (fDest - fSource));
+        v2 R;
+        R.X = FastLerp((float)Source.X, (float)Dest.X, T);
+        R.Y = FastLerp((float)Source.Y, (float)Dest.Y, T);
+        return (v2_base<t>)(R);
     }
     FM_FUN_TSI operator==(v2_base<t> A, v2_base<t> B) -> bool {
         return A.X == B.X && A.Y == B.Y;
@@ -1268,7 +1594,11 @@ namespace fm {
         return V;
     }
     FM_FUN_TSI Cross(v3_base<t> A, v3_base<t> B) -> v3_base<t> {
-        return v3_base<t>(HadamardMul(A.ZXY(), B) - HadamardMul(A, B.ZXY())).ZXY();
+        v3_base<t> R;
+        R.X = A.Y * B.Z - A.Z * B.Y;
+        R.Y = A.Z * B.X - A.X * B.Z;
+        R.Z = A.X * B.Y - A.Y * B.X;
+        return R;
     }
     FM_FUN_TSI Dot(v3_base<t> A, v3_base<t> B) -> t {
         return A.X * B.X + A.Y * B.Y + A.Z * B.Z;
@@ -1343,9 +1673,11 @@ namespace fm {
         return (v3_base<t>)(R);
     }
     FM_FUN_TSI FastLerp(v3_base<t> Source, v3_base<t> Dest, float T) -> v3_base<t> {
-        v3 fSource = (v3)Source;
-        v3 fDest = (v3)Dest;
-        return (v3_base<t>)(fSource + T * (fDest - fSource));
+        v3 R;
+        R.X = FastLerp((float)Source.X, (float)Dest.X, T);
+        R.Y = FastLerp((float)Source.Y, (float)Dest.Y, T);
+        R.Z = FastLerp((float)Source.Z, (float)Dest.Z, T);
+        return (v3_base<t>)(R);
     }
     FM_FUN_TSI operator==(v3_base<t> A, v3_base<t> B) -> bool {
         return A.X == B.X && A.Y == B.Y && A.Z == B.Z;
@@ -1671,9 +2003,12 @@ namespace fm {
         return (v4_base<t>)(R);
     }
     FM_FUN_TSI FastLerp(v4_base<t> Source, v4_base<t> Dest, float T) -> v4_base<t> {
-        v4 fSource = (v4)Source;
-        v4 fDest = (v4)Dest;
-        return (v4_base<t>)(fSource + T * (fDest - fSource));
+        v4 R;
+        R.X = FastLerp((float)Source.X, (float)Dest.X, T);
+        R.Y = FastLerp((float)Source.Y, (float)Dest.Y, T);
+        R.Z = FastLerp((float)Source.Z, (float)Dest.Z, T);
+        R.W = FastLerp((float)Source.W, (float)Dest.W, T);
+        return (v4_base<t>)(R);
     }
     FM_FUN_TSI operator==(v4_base<t> A, v4_base<t> B) -> bool {
         return A.X == B.X && A.Y == B.Y && A.Z == B.Z && A.W == B.W;
@@ -1851,7 +2186,7 @@ namespace fm {
         Mem[1] = V.Y();
     } 
     FM_SINL void FM_CALL Store16ByteAligned(float* Mem, vec2 V) {
-        FM_ASSERT(Mem % 16 == 0);
+        FM_ASSERT((uintptr_t)Mem % 16 == 0);
         _mm_store_ps(Mem, V.M);
     }
     FM_SINL vec2 FM_CALL operator+(vec2 A, vec2 B) {
@@ -1906,7 +2241,7 @@ namespace fm {
         return V.X() + V.Y();
     }
     FM_SINL float FM_CALL Dot(vec2 A, vec2 B) {
-        return SumOfElements(HadamardMul(A, B));
+        return _mm_cvtss_f32(priv::SplatDot<2>(A.M, B.M));
     }
     FM_SINL vec2 FM_CALL Min(vec2 A, vec2 B) {
         A.M = _mm_min_ps(A.M, B.M);
@@ -1927,17 +2262,52 @@ namespace fm {
     FM_SINL float FM_CALL LengthSquared(vec2 V) {
         return Dot(V, V);
     }
+    // NOTE: The splat versions return the result in every lane, so it can feed vector math without leaving the register
+    FM_SINL vec2 FM_CALL SumSplat(vec2 V) {
+        V.M = priv::SplatSum<2>(V.M);
+        return V;
+    }
+    FM_SINL vec2 FM_CALL DotSplat(vec2 A, vec2 B) {
+        A.M = priv::SplatDot<2>(A.M, B.M);
+        return A;
+    }
+    FM_SINL vec2 FM_CALL LengthSquaredSplat(vec2 V) {
+        V.M = priv::SplatDot<2>(V.M, V.M);
+        return V;
+    }
+    FM_SINL vec2 FM_CALL LengthSplat(vec2 V) {
+        V.M = _mm_sqrt_ps(priv::SplatDot<2>(V.M, V.M));
+        return V;
+    }
     FM_SINL vec2 FM_CALL Normalize(vec2 V) {
-        return V / Length(V);
+        return HadamardDiv(V, LengthSplat(V));
     }
     FM_SINL void Normalize(vec2* V) {
-        *V = *V / Length(*V);
+        *V = Normalize(*V);
+    }
+    // NOTE: NormalizeFast has a relative error below 1e-6 and returns NaN for zero length.
+    //       NormalizeSafe returns Fallback, or a zero vector, when V is too short or too long to normalize.
+    FM_SINL vec2 FM_CALL NormalizeFast(vec2 V) {
+        V.M = _mm_mul_ps(V.M, priv::ReciprocalSqrt(priv::SplatDot<2>(V.M, V.M)));
+        return V;
+    }
+    FM_SINL void NormalizeFast(vec2* V) {
+        *V = NormalizeFast(*V);
+    }
+    FM_SINL vec2 FM_CALL NormalizeSafe(vec2 V, vec2 Fallback) {
+        V.M = priv::NormalizeOrFallback(V.M, priv::SplatDot<2>(V.M, V.M), Fallback.M);
+        return V;
+    }
+    FM_SINL vec2 FM_CALL NormalizeSafe(vec2 V) {
+        V.M = priv::NormalizeOrFallback(V.M, priv::SplatDot<2>(V.M, V.M), _mm_setzero_ps());
+        return V;
     }
     FM_SINL vec2 FM_CALL Clamp(vec2 V, vec2 MinV, vec2 MaxV) {
         return Min(Max(V, MinV), MaxV);
     }
     FM_SINL vec2 FM_CALL Lerp(vec2 A, vec2 B, float T) {
-        return A + (B-A)*T;
+        A.M = priv::MulAdd(_mm_sub_ps(B.M, A.M), _mm_set1_ps(T), A.M);
+        return A;
     }
     FM_SINL vec2 FM_CALL EqualsMask(vec2 A, vec2 B) {
         A.M = _mm_cmpeq_ps(A.M, B.M);
@@ -2046,7 +2416,7 @@ namespace fm {
         _mm_storeu_pd(Mem, V.M); 
     } 
     FM_SINL void FM_CALL Store16ByteAligned(double* Mem, vec2d V) {
-        FM_ASSERT(Mem % 16 == 0);
+        FM_ASSERT((uintptr_t)Mem % 16 == 0);
         _mm_store_pd(Mem, V.M); 
     }
     FM_SINL vec2d FM_CALL operator+(vec2d A, vec2d B) {
@@ -2335,13 +2705,13 @@ namespace fm {
         return Min(Max(V, MinV), MaxV);
     } 
 #else // SSE 2 implementations 
-    FM_SINL void FM_CALL vec2i::SetX(int32_t X) {
+    FM_INL void FM_CALL vec2i::SetX(int32_t X) {
         int32_t Arr[4];
         _mm_store_si128((__m128i*)Arr, M);
         Arr[0] = X;
         M = _mm_load_si128((__m128i*)Arr);
     }
-    FM_SINL void FM_CALL vec2i::SetY(int32_t Y) {
+    FM_INL void FM_CALL vec2i::SetY(int32_t Y) {
         int32_t Arr[4];
         _mm_store_si128((__m128i*)Arr, M);
         Arr[1] = Y;
@@ -2354,17 +2724,17 @@ namespace fm {
         _mm_store_si128((__m128i*)BArr, B.M);
         AArr[0] = AArr[0] * BArr[0]; 
         AArr[1] = AArr[1] * BArr[1]; 
-        return Vec2i(AArr);
+        return Vec2iFromMemory(AArr);
     }
     FM_SINL vec2i FM_CALL operator*(vec2i V, int32_t Scalar) {
         int32_t VArr[4];
         _mm_store_si128((__m128i*)VArr, V.M);
         VArr[0] *= Scalar;
         VArr[1] *= Scalar;
-        return Vec2i(VArr);
+        return Vec2iFromMemory(VArr);
         // TODO: This code is repeated. Make helper function or write it somehow using SSE2!
     }
-    FM_SINL vec2i FM_CALL operator*(int32_t Scalar, vec2i v) {
+    FM_SINL vec2i FM_CALL operator*(int32_t Scalar, vec2i V) {
         return V * Scalar; 
     }
     FM_SINL vec2i FM_CALL Min(vec2i A, vec2i B) {
@@ -2373,7 +2743,7 @@ namespace fm {
         _mm_store_si128((__m128i*)BArr, B.M);
         AArr[0] = Min(AArr[0], BArr[0]);
         AArr[1] = Min(AArr[1], BArr[1]);
-        return Vec2i(AArr);
+        return Vec2iFromMemory(AArr);
     }
     FM_SINL vec2i FM_CALL Max(vec2i A, vec2i B) {
         int32_t AArr[4], BArr[4];
@@ -2381,22 +2751,25 @@ namespace fm {
         _mm_store_si128((__m128i*)BArr, B.M);
         AArr[0] = Max(AArr[0], BArr[0]);
         AArr[1] = Max(AArr[1], BArr[1]);
-        return Vec2i(AArr);
+        return Vec2iFromMemory(AArr);
         // TODO: This code is repeated. Make helper function or write it somehow using SSE2!
     }
-    FM_SINL vec2i FM_CALL abs(vec2i v) {
+    FM_SINL vec2i FM_CALL Abs(vec2i V) {
         int32_t VArr[4];
         _mm_store_si128((__m128i*)VArr, V.M);
-        VArr[0] = abs(VArr[0]);
-        VArr[1] = abs(VArr[1]);
-        return Vec2i(VArr);
+        VArr[0] = Abs(VArr[0]);
+        VArr[1] = Abs(VArr[1]);
+        return Vec2iFromMemory(VArr);
     }
-    FM_SINL void FM_CALL vec2i::MulX(int32_t XMultiplier) {
+    FM_INL void FM_CALL vec2i::MulX(int32_t XMultiplier) {
         SetX(X() * XMultiplier);
     }
-    FM_SINL void FM_CALL vec2i::MulY(int32_t YMultiplier) {
+    FM_INL void FM_CALL vec2i::MulY(int32_t YMultiplier) {
         SetY(Y() * YMultiplier);
     }
+    FM_SINL vec2i FM_CALL Clamp(vec2i V, vec2i MinV, vec2i MaxV) {
+        return Min(Max(V, MinV), MaxV);
+    } 
 #endif
     FM_SINL vec2i& FM_CALL operator*=(vec2i& V, int32_t Scalar) {
         V = V * Scalar;
@@ -2564,16 +2937,16 @@ namespace fm {
         return A;
     }
 #else // SSE 2 implementations
-    FM_INL void FM_CALL vec2u::SetX(uint32_t x) {
+    FM_INL void FM_CALL vec2u::SetX(uint32_t X) {
         uint32_t Arr[4];
-        _mm_store_si128((__m128i*)Arr, m);
-        Arr[0] = x;
-        m = _mm_load_si128((__m128i*)Arr);
+        _mm_store_si128((__m128i*)Arr, M);
+        Arr[0] = X;
+        M = _mm_load_si128((__m128i*)Arr);
     }
-    FM_INL void FM_CALL vec2u::SetY(uint32_t y) {
+    FM_INL void FM_CALL vec2u::SetY(uint32_t Y) {
         uint32_t Arr[4];
-        _mm_store_si128((__m128i*)Arr, m);
-        Arr[1] = y;
+        _mm_store_si128((__m128i*)Arr, M);
+        Arr[1] = Y;
         M = _mm_load_si128((__m128i*)Arr);
         // TODO: This code is repeated. Make utility function!
     }
@@ -2583,14 +2956,14 @@ namespace fm {
         _mm_store_si128((__m128i*)BArr, B.M);
         AArr[0] = AArr[0] * BArr[0]; 
         AArr[1] = AArr[1] * BArr[1]; 
-        return Vec2u(AArr);
+        return Vec2uFromMemory(AArr);
     }
     FM_SINL vec2u FM_CALL operator*(vec2u V, uint32_t Scalar) {
         uint32_t VArr[4];
         _mm_store_si128((__m128i*)VArr, V.M);
         VArr[0] *= Scalar;
         VArr[1] *= Scalar;
-        return Vec2u(VArr);
+        return Vec2uFromMemory(VArr);
     }
     FM_SINL vec2u FM_CALL operator*(uint32_t Scalar, vec2u V) {
         return V * Scalar;
@@ -2601,7 +2974,7 @@ namespace fm {
         _mm_store_si128((__m128i*)BArr, B.M);
         AArr[0] = Min(AArr[0], BArr[0]);
         AArr[1] = Min(AArr[1], BArr[1]);
-        return Vec2u(AArr);
+        return Vec2uFromMemory(AArr);
     }
     FM_SINL vec2u FM_CALL Max(vec2u A, vec2u B) {
         uint32_t AArr[4], BArr[4];
@@ -2609,7 +2982,7 @@ namespace fm {
         _mm_store_si128((__m128i*)BArr, B.M);
         AArr[0] = Max(AArr[0], BArr[0]);
         AArr[1] = Max(AArr[1], BArr[1]);
-        return Vec2u(AArr);
+        return Vec2uFromMemory(AArr);
     }
 #endif
     FM_SINL vec2u& FM_CALL operator*=(vec2u& V, uint32_t Scalar) {
@@ -2774,7 +3147,7 @@ namespace fm {
         return V.X() + V.Y() + V.Z();
     }
     FM_SINL float FM_CALL Dot(vec3 A, vec3 B) {
-        return SumOfElements(HadamardMul(A, B));
+        return _mm_cvtss_f32(priv::SplatDot<3>(A.M, B.M));
     }
     FM_SINL vec3 FM_CALL Cross(vec3 A, vec3 B) {
         return vec3(HadamardMul(A.ZXY(), B) - HadamardMul(A, B.ZXY())).ZXY(); 
@@ -2798,17 +3171,49 @@ namespace fm {
     FM_SINL float FM_CALL LengthSquared(vec3 V) {
         return Dot(V, V);
     }
+    FM_SINL vec3 FM_CALL SumSplat(vec3 V) {
+        V.M = priv::SplatSum<3>(V.M);
+        return V;
+    }
+    FM_SINL vec3 FM_CALL DotSplat(vec3 A, vec3 B) {
+        A.M = priv::SplatDot<3>(A.M, B.M);
+        return A;
+    }
+    FM_SINL vec3 FM_CALL LengthSquaredSplat(vec3 V) {
+        V.M = priv::SplatDot<3>(V.M, V.M);
+        return V;
+    }
+    FM_SINL vec3 FM_CALL LengthSplat(vec3 V) {
+        V.M = _mm_sqrt_ps(priv::SplatDot<3>(V.M, V.M));
+        return V;
+    }
     FM_SINL vec3 FM_CALL Normalize(vec3 V) {
-        return V / Length(V);
+        return HadamardDiv(V, LengthSplat(V));
     }
     FM_SINL void Normalize(vec3* V) {
-        *V = *V / Length(*V);
+        *V = Normalize(*V);
+    }
+    FM_SINL vec3 FM_CALL NormalizeFast(vec3 V) {
+        V.M = _mm_mul_ps(V.M, priv::ReciprocalSqrt(priv::SplatDot<3>(V.M, V.M)));
+        return V;
+    }
+    FM_SINL void NormalizeFast(vec3* V) {
+        *V = NormalizeFast(*V);
+    }
+    FM_SINL vec3 FM_CALL NormalizeSafe(vec3 V, vec3 Fallback) {
+        V.M = priv::NormalizeOrFallback(V.M, priv::SplatDot<3>(V.M, V.M), Fallback.M);
+        return V;
+    }
+    FM_SINL vec3 FM_CALL NormalizeSafe(vec3 V) {
+        V.M = priv::NormalizeOrFallback(V.M, priv::SplatDot<3>(V.M, V.M), _mm_setzero_ps());
+        return V;
     }
     FM_SINL vec3 FM_CALL Clamp(vec3 V, vec3 MinV, vec3 MaxV) {
         return Min(Max(V, MinV), MaxV);
     }
     FM_SINL vec3 FM_CALL Lerp(vec3 A, vec3 B, float T) {
-        return A + (B-A)*T;
+        A.M = priv::MulAdd(_mm_sub_ps(B.M, A.M), _mm_set1_ps(T), A.M);
+        return A;
     } 
     FM_SINL vec3 FM_CALL EqualsMask(vec3 A, vec3 B) {
         A.M = _mm_cmpeq_ps(A.M, B.M);
@@ -2966,7 +3371,7 @@ namespace fm {
         _mm_storeu_ps(Mem, V.M);
     }
     FM_SINL void FM_CALL Store16ByteAligned(float* Mem, vec4 V) {
-        FM_ASSERT(Mem % 16 == 0);
+        FM_ASSERT((uintptr_t)Mem % 16 == 0);
         _mm_store_ps(Mem, V.M);
     }
     FM_SINL vec4 FM_CALL operator+(vec4 A, vec4 B) {
@@ -3020,7 +3425,7 @@ namespace fm {
         return V.X() + V.Y() + V.Z() + V.W();
     }
     FM_SINL float FM_CALL Dot(vec4 A, vec4 B) {
-        return SumOfElements(HadamardMul(A, B));
+        return _mm_cvtss_f32(priv::SplatDot<4>(A.M, B.M));
     }
     FM_SINL vec4 FM_CALL Min(vec4 A, vec4 B) {
         A.M = _mm_min_ps(A.M, B.M);
@@ -3041,17 +3446,49 @@ namespace fm {
     FM_SINL float FM_CALL LengthSquared(vec4 V) {
         return Dot(V, V);
     }
+    FM_SINL vec4 FM_CALL SumSplat(vec4 V) {
+        V.M = priv::SplatSum<4>(V.M);
+        return V;
+    }
+    FM_SINL vec4 FM_CALL DotSplat(vec4 A, vec4 B) {
+        A.M = priv::SplatDot<4>(A.M, B.M);
+        return A;
+    }
+    FM_SINL vec4 FM_CALL LengthSquaredSplat(vec4 V) {
+        V.M = priv::SplatDot<4>(V.M, V.M);
+        return V;
+    }
+    FM_SINL vec4 FM_CALL LengthSplat(vec4 V) {
+        V.M = _mm_sqrt_ps(priv::SplatDot<4>(V.M, V.M));
+        return V;
+    }
     FM_SINL vec4 FM_CALL Normalize(vec4 V) {
-        return V / Length(V);
+        return HadamardDiv(V, LengthSplat(V));
     }
     FM_SINL void Normalize(vec4* V) {
-        *V = *V / Length(*V);
+        *V = Normalize(*V);
+    }
+    FM_SINL vec4 FM_CALL NormalizeFast(vec4 V) {
+        V.M = _mm_mul_ps(V.M, priv::ReciprocalSqrt(priv::SplatDot<4>(V.M, V.M)));
+        return V;
+    }
+    FM_SINL void NormalizeFast(vec4* V) {
+        *V = NormalizeFast(*V);
+    }
+    FM_SINL vec4 FM_CALL NormalizeSafe(vec4 V, vec4 Fallback) {
+        V.M = priv::NormalizeOrFallback(V.M, priv::SplatDot<4>(V.M, V.M), Fallback.M);
+        return V;
+    }
+    FM_SINL vec4 FM_CALL NormalizeSafe(vec4 V) {
+        V.M = priv::NormalizeOrFallback(V.M, priv::SplatDot<4>(V.M, V.M), _mm_setzero_ps());
+        return V;
     }
     FM_SINL vec4 FM_CALL Clamp(vec4 V, vec4 MinV, vec4 MaxV) {
         return Min(Max(V, MinV), MaxV);
     }
     FM_SINL vec4 FM_CALL Lerp(vec4 A, vec4 B, float T) {
-        return A + (B-A)*T;
+        A.M = priv::MulAdd(_mm_sub_ps(B.M, A.M), _mm_set1_ps(T), A.M);
+        return A;
     } 
     FM_SINL vec4 FM_CALL EqualsMask(vec4 A, vec4 B) {
         A.M = _mm_cmpeq_ps(A.M, B.M);
@@ -3105,1451 +3542,6189 @@ namespace fm {
         return Vec4FromMemory(V.Elements);
     }
     
-    /////////////////////
-    // rect2 functions //
-    /////////////////////
-    template<class t> template<class u> rect2_base<t>::rect2_base(rect2_base<u> A) {
-        Min = (v2_base<t>)A.Min;
-        Max = (v2_base<t>)A.Max;
+    //////////////////////////////
+    // half precision functions //
+    //////////////////////////////
+    namespace priv {
+        // NOTE: Round to nearest even like F16C, overflow goes to infinity and NaNs become quiet NaNs.
+        //       The 4 halves are returned sign extended in 32 bit lanes, so _mm_packs_epi32 keeps their bits.
+        FM_SINL __m128i FM_CALL HalfFromFloat4(__m128 F) {
+            __m128 Sign = _mm_and_ps(F, _mm_castsi128_ps(_mm_set1_epi32((int32_t)0x80000000)));
+            __m128 AbsF = _mm_xor_ps(F, Sign);
+            __m128i AbsI = _mm_castps_si128(AbsF);
+            
+            __m128i IsNaN = _mm_castps_si128(_mm_cmpunord_ps(AbsF, AbsF));
+            __m128i InfOrNaN = _mm_or_si128(_mm_and_si128(IsNaN, _mm_set1_epi32(0x200)), _mm_set1_epi32(0x7C00));
+            __m128i IsRegular = _mm_cmpgt_epi32(_mm_set1_epi32((127 + 16) << 23), AbsI);
+            __m128i IsSubnormal = _mm_cmpgt_epi32(_mm_set1_epi32((127 - 14) << 23), AbsI);
+            
+            // NOTE: Adding the magic number lets the float adder round the subnormal mantissa
+            __m128i SubnormalMagic = _mm_set1_epi32(((127 - 15) + (23 - 10) + 1) << 23);
+            __m128i Subnormal = _mm_sub_epi32(_mm_castps_si128(_mm_add_ps(AbsF, _mm_castsi128_ps(SubnormalMagic))), SubnormalMagic);
+            
+            __m128i MantissaOdd = _mm_srai_epi32(_mm_slli_epi32(AbsI, 31 - 13), 31);
+            __m128i Normal = _mm_add_epi32(AbsI, _mm_set1_epi32(0xFFF - ((127 - 15) << 23)));
+            Normal = _mm_srli_epi32(_mm_sub_epi32(Normal, MantissaOdd), 13);
+            
+            __m128i Finite = _mm_or_si128(_mm_and_si128(IsSubnormal, Subnormal), _mm_andnot_si128(IsSubnormal, Normal));
+            __m128i R = _mm_or_si128(_mm_and_si128(IsRegular, Finite), _mm_andnot_si128(IsRegular, InfOrNaN));
+            return _mm_or_si128(R, _mm_srai_epi32(_mm_castps_si128(Sign), 16));
+        }
+        // NOTE: H holds one half per 32 bit lane, only the low 16 bits are read. Half subnormals become normal
+        //       floats through a subtraction of normal floats, so the result doesn't depend on DAZ or FTZ.
+        FM_SINL __m128 FM_CALL FloatFromHalf4(__m128i H) {
+            __m128i ExpMantissa = _mm_slli_epi32(_mm_and_si128(H, _mm_set1_epi32(0x7FFF)), 13);
+            __m128i Exp = _mm_and_si128(ExpMantissa, _mm_set1_epi32(0x7C00 << 13));
+            __m128i R = _mm_add_epi32(ExpMantissa, _mm_set1_epi32((127 - 15) << 23));
+            __m128i IsInfOrNaN = _mm_cmpeq_epi32(Exp, _mm_set1_epi32(0x7C00 << 13));
+            __m128i IsSubnormal = _mm_cmpeq_epi32(Exp, _mm_setzero_si128());
+            R = _mm_add_epi32(R, _mm_and_si128(IsInfOrNaN, _mm_set1_epi32((128 - 16) << 23)));
+            __m128 Subnormal = _mm_sub_ps(_mm_castsi128_ps(_mm_add_epi32(R, _mm_set1_epi32(1 << 23))),
+                                          _mm_castsi128_ps(_mm_set1_epi32((127 - 14) << 23)));
+            R = _mm_or_si128(_mm_and_si128(IsSubnormal, _mm_castps_si128(Subnormal)), _mm_andnot_si128(IsSubnormal, R));
+            R = _mm_or_si128(R, _mm_slli_epi32(_mm_and_si128(H, _mm_set1_epi32(0x8000)), 16));
+            return _mm_castsi128_ps(R);
+        }
+        FM_SINL __m128i FM_CALL LoadHalfs4(const uint16_t* Mem) {
+            return _mm_unpacklo_epi16(_mm_loadl_epi64((const __m128i*)Mem), _mm_setzero_si128());
+        }
+        FM_SINL void FM_CALL StoreHalfs4(uint16_t* Mem, __m128i H) {
+            _mm_storel_epi64((__m128i*)Mem, _mm_packs_epi32(H, H));
+        }
     }
-    FM_FUN_TSI GetWidth(rect2_base<t> A) -> t {
-        return A.Max.X - A.Min.X;
+    FM_SINL uint16_t FM_CALL HalfFromFloat(float F) {
+        return (uint16_t)_mm_cvtsi128_si32(priv::HalfFromFloat4(_mm_set_ss(F)));
     }
-    FM_FUN_TSI GetHeight(rect2_base<t> A) -> t {
-        return A.Max.Y - A.Min.Y;
+    FM_SINL float FM_CALL FloatFromHalf(uint16_t H) {
+        return _mm_cvtss_f32(priv::FloatFromHalf4(_mm_cvtsi32_si128(H)));
     }
-    FM_FUN_TSI GetW(rect2_base<t> A) -> t {
-        return GetWidth(A);
+    FM_SINL v4h FM_CALL CastToV4h(vec4 V) {
+        v4h R;
+        priv::StoreHalfs4(&R.X, priv::HalfFromFloat4(V.M));
+        return R;
     }
-    FM_FUN_TSI GetH(rect2_base<t> A) -> t {
-        return GetHeight(A);
+    FM_SINL v4h FM_CALL CastToV4h(v4 V) {
+        return CastToV4h(Vec4(V.X, V.Y, V.Z, V.W));
     }
-    FM_FUN_TSI GetDim(rect2_base<t> A) -> v2_base<t> {
-        return A.Max - A.Min;
+    FM_SINL v3h FM_CALL CastToV3h(v3 V) {
+        v4h R = CastToV4h(Vec4(V.X, V.Y, V.Z, 0.f));
+        return {R.X, R.Y, R.Z};
     }
-    FM_FUN_TSI GetSize(rect2_base<t> A) -> v2_base<t> {
-        return GetDim(A);
+    FM_SINL v2h FM_CALL CastToV2h(v2 V) {
+        v4h R = CastToV4h(Vec4(V.X, V.Y, 0.f, 0.f));
+        return {R.X, R.Y};
     }
-    FM_FUN_TSI GetRadius(rect2_base<t> A) -> v2_base<t> {
-        return GetDim(A) / (t)2;
+    FM_SINL vec4 FM_CALL CastToVec4(v4h V) {
+        vec4 R;
+        R.M = priv::FloatFromHalf4(priv::LoadHalfs4(&V.X));
+        return R;
     }
-    FM_FUN_TSI GetRadiusX(rect2_base<t> A) -> t {
-        return GetWidth(A) / (t)2;
+    FM_SINL v4 FM_CALL CastToV4(v4h V) {
+        return CastToV4(CastToVec4(V));
     }
-    FM_FUN_TSI GetRadiusY(rect2_base<t> A) -> t {
-        return GetHeight(A) / (t)2;
+    FM_SINL v3 FM_CALL CastToV3(v3h V) {
+        v4 R = CastToV4(v4h{V.X, V.Y, V.Z, 0});
+        return R.XYZ;
     }
-    FM_FUN_TSI GetArea(rect2_base<t> A) -> t {
-        auto Dim = GetDim(A);
-        return Dim.W * Dim.H;
+    FM_SINL v2 FM_CALL CastToV2(v2h V) {
+        v4 R = CastToV4(v4h{V.X, V.Y, 0, 0});
+        return R.XY;
     }
-    FM_FUN_TSI GetCenter(rect2_base<t> A) -> v2_base<t> {
-        return v2_base<t>((A.Min + A.Max) / (t)2);
+    
+    //////////////////////////////////
+    // octahedral normals functions //
+    //////////////////////////////////
+    namespace priv {
+        // NOTE: The unit vector is projected on the octahedron |X| + |Y| + |Z| = 1 and the lower half is folded over
+        //       the diagonals, so X and Y in [-1, 1] cover the whole sphere. Zero vectors encode as (0, 0, 1).
+        FM_SINL void FM_CALL OctahedralProject4(__m128 X, __m128 Y, __m128 Z, __m128* U, __m128* V) {
+            __m128 SignMask = _mm_castsi128_ps(_mm_set1_epi32((int32_t)0x80000000));
+            __m128 One = _mm_set1_ps(1.f);
+            __m128 Length = _mm_add_ps(_mm_add_ps(_mm_andnot_ps(SignMask, X), _mm_andnot_ps(SignMask, Y)), _mm_andnot_ps(SignMask, Z));
+            __m128 InvLength = _mm_and_ps(_mm_cmpgt_ps(Length, _mm_setzero_ps()), _mm_div_ps(One, Length));
+            X = _mm_mul_ps(X, InvLength);
+            Y = _mm_mul_ps(Y, InvLength);
+            __m128 FoldedX = _mm_or_ps(_mm_sub_ps(One, _mm_andnot_ps(SignMask, Y)), _mm_and_ps(X, SignMask));
+            __m128 FoldedY = _mm_or_ps(_mm_sub_ps(One, _mm_andnot_ps(SignMask, X)), _mm_and_ps(Y, SignMask));
+            __m128 Lower = _mm_cmplt_ps(Z, _mm_setzero_ps());
+            *U = _mm_or_ps(_mm_and_ps(Lower, FoldedX), _mm_andnot_ps(Lower, X));
+            *V = _mm_or_ps(_mm_and_ps(Lower, FoldedY), _mm_andnot_ps(Lower, Y));
+        }
+        FM_SINL void FM_CALL OctahedralUnproject4(__m128 U, __m128 V, __m128* X, __m128* Y, __m128* Z) {
+            __m128 SignMask = _mm_castsi128_ps(_mm_set1_epi32((int32_t)0x80000000));
+            __m128 Height = _mm_sub_ps(_mm_sub_ps(_mm_set1_ps(1.f), _mm_andnot_ps(SignMask, U)), _mm_andnot_ps(SignMask, V));
+            __m128 Fold = _mm_max_ps(_mm_sub_ps(_mm_setzero_ps(), Height), _mm_setzero_ps());
+            U = _mm_sub_ps(U, _mm_or_ps(Fold, _mm_and_ps(U, SignMask)));
+            V = _mm_sub_ps(V, _mm_or_ps(Fold, _mm_and_ps(V, SignMask)));
+            __m128 InvLength = ReciprocalSqrt(_mm_add_ps(_mm_add_ps(_mm_mul_ps(U, U), _mm_mul_ps(V, V)), _mm_mul_ps(Height, Height)));
+            *X = _mm_mul_ps(U, InvLength);
+            *Y = _mm_mul_ps(V, InvLength);
+            *Z = _mm_mul_ps(Height, InvLength);
+        }
+        // NOTE: 16 bit codes hold U and V as 8 bit snorms, 32 bit codes as 16 bit snorms, U in the low half.
+        //       Both codes are returned and taken in 32 bit lanes. The worst angle error is below 0.017 radians
+        //       for 16 bit codes and below 0.00007 radians for 32 bit codes, decoded vectors are NormalizeFast precise.
+        FM_SINL __m128i FM_CALL Octahedral16FromV3x4(__m128 X, __m128 Y, __m128 Z) {
+            __m128 U, V;
+            OctahedralProject4(X, Y, Z, &U, &V);
+            __m128i QU = _mm_cvtps_epi32(_mm_mul_ps(U, _mm_set1_ps(127.f)));
+            __m128i QV = _mm_cvtps_epi32(_mm_mul_ps(V, _mm_set1_ps(127.f)));
+            return _mm_or_si128(_mm_and_si128(QU, _mm_set1_epi32(0xFF)), _mm_slli_epi32(_mm_and_si128(QV, _mm_set1_epi32(0xFF)), 8));
+        }
+        FM_SINL __m128i FM_CALL Octahedral32FromV3x4(__m128 X, __m128 Y, __m128 Z) {
+            __m128 U, V;
+            OctahedralProject4(X, Y, Z, &U, &V);
+            __m128i QU = _mm_cvtps_epi32(_mm_mul_ps(U, _mm_set1_ps(32767.f)));
+            __m128i QV = _mm_cvtps_epi32(_mm_mul_ps(V, _mm_set1_ps(32767.f)));
+            return _mm_or_si128(_mm_and_si128(QU, _mm_set1_epi32(0xFFFF)), _mm_slli_epi32(QV, 16));
+        }
+        FM_SINL void FM_CALL V3x4FromOctahedral16(__m128i Code, __m128* X, __m128* Y, __m128* Z) {
+            __m128 MinusOne = _mm_set1_ps(-1.f);
+            __m128 U = _mm_cvtepi32_ps(_mm_srai_epi32(_mm_slli_epi32(Code, 24), 24));
+            __m128 V = _mm_cvtepi32_ps(_mm_srai_epi32(_mm_slli_epi32(Code, 16), 24));
+            U = _mm_max_ps(_mm_mul_ps(U, _mm_set1_ps(1.f / 127.f)), MinusOne);
+            V = _mm_max_ps(_mm_mul_ps(V, _mm_set1_ps(1.f / 127.f)), MinusOne);
+            OctahedralUnproject4(U, V, X, Y, Z);
+        }
+        FM_SINL void FM_CALL V3x4FromOctahedral32(__m128i Code, __m128* X, __m128* Y, __m128* Z) {
+            __m128 MinusOne = _mm_set1_ps(-1.f);
+            __m128 U = _mm_cvtepi32_ps(_mm_srai_epi32(_mm_slli_epi32(Code, 16), 16));
+            __m128 V = _mm_cvtepi32_ps(_mm_srai_epi32(Code, 16));
+            U = _mm_max_ps(_mm_mul_ps(U, _mm_set1_ps(1.f / 32767.f)), MinusOne);
+            V = _mm_max_ps(_mm_mul_ps(V, _mm_set1_ps(1.f / 32767.f)), MinusOne);
+            OctahedralUnproject4(U, V, X, Y, Z);
+        }
     }
-    FM_FUN_TSI GetMaxXMinY(rect2_base<t> A) -> v2_base<t> {
-        return v2_base<t>(A.Max.X, A.Min.Y);
+    FM_SINL uint16_t FM_CALL Octahedral16(v3 N) {
+        return (uint16_t)_mm_cvtsi128_si32(priv::Octahedral16FromV3x4(_mm_set_ss(N.X), _mm_set_ss(N.Y), _mm_set_ss(N.Z)));
     }
-    FM_FUN_TSI GetMinXMaxY(rect2_base<t> A) -> v2_base<t> {
-        return v2_base<t>(A.Min.X, A.Max.Y);
+    FM_SINL uint16_t FM_CALL Octahedral16(vec3 N) {
+        return Octahedral16(v3(N.X(), N.Y(), N.Z()));
     }
-    FM_FUN_TSI GetMinYCenter(rect2_base<t> A) -> v2_base<t> {
-        return v2_base<t>(A.Min.X + GetWidth(A)/(t)2, A.Min.Y);
+    FM_SINL uint32_t FM_CALL Octahedral32(v3 N) {
+        return (uint32_t)_mm_cvtsi128_si32(priv::Octahedral32FromV3x4(_mm_set_ss(N.X), _mm_set_ss(N.Y), _mm_set_ss(N.Z)));
     }
-    FM_FUN_TSI GetMaxYCenter(rect2_base<t> A) -> v2_base<t> {
-        return v2_base<t>(A.Min.X + GetWidth(A)/(t)2, A.Max.Y);
+    FM_SINL uint32_t FM_CALL Octahedral32(vec3 N) {
+        return Octahedral32(v3(N.X(), N.Y(), N.Z()));
     }
-    FM_FUN_TSI GetMinXCenter(rect2_base<t> A) -> v2_base<t> {
-        return v2_base<t>(A.Min.X, A.Min.Y + GetHeight(A)/(t)2);
+    FM_SINL v3 FM_CALL V3FromOctahedral16(uint16_t Code) {
+        __m128 X, Y, Z;
+        priv::V3x4FromOctahedral16(_mm_cvtsi32_si128(Code), &X, &Y, &Z);
+        return v3(_mm_cvtss_f32(X), _mm_cvtss_f32(Y), _mm_cvtss_f32(Z));
     }
-    FM_FUN_TSI GetMaxXCenter(rect2_base<t> A) -> v2_base<t> {
-        return v2_base<t>(A.Max.X, A.Min.Y + GetHeight(A)/(t)2);
+    FM_SINL v3 FM_CALL V3FromOctahedral32(uint32_t Code) {
+        __m128 X, Y, Z;
+        priv::V3x4FromOctahedral32(_mm_cvtsi32_si128((int32_t)Code), &X, &Y, &Z);
+        return v3(_mm_cvtss_f32(X), _mm_cvtss_f32(Y), _mm_cvtss_f32(Z));
     }
-    FM_FUN_TSI SetCenter(rect2_base<t> A, v2_base<t> Center) -> rect2_base<t> {
-        auto Radius = GetRadius(A);
-        A.Min = Center - Radius;
-        A.Max = Center + Radius;
-        return A;
+    FM_SINL vec3 FM_CALL Vec3FromOctahedral16(uint16_t Code) {
+        return CastToVec3(V3FromOctahedral16(Code));
     }
-    FM_FUN_TSI SetCenter(rect2_base<t> A, t X, t Y) -> rect2_base<t> {
-        return SetCenter(A, v2_base<t>(X, Y));
+    FM_SINL vec3 FM_CALL Vec3FromOctahedral32(uint32_t Code) {
+        return CastToVec3(V3FromOctahedral32(Code));
     }
-    FM_FUN_TSI SetCenter(rect2_base<t>* A, v2_base<t> Center) -> void {
-        *A = SetCenter(*A, Center);
+    
+    //////////////////////////////////
+    // normalized integer functions //
+    //////////////////////////////////
+    namespace priv {
+        // NOTE: Saturating conversions like the D3D and Vulkan unorm/snorm formats, the float is clamped, scaled and
+        //       rounded to nearest even, NaN becomes 0. Decoding of snorm clamps the most negative integer to -1.
+        FM_SINL __m128i FM_CALL QuantizeUnorm(__m128 V, float Max) {
+            return _mm_cvtps_epi32(_mm_mul_ps(_mm_min_ps(_mm_max_ps(V, _mm_setzero_ps()), _mm_set1_ps(1.f)), _mm_set1_ps(Max)));
+        }
+        FM_SINL __m128i FM_CALL QuantizeSnorm(__m128 V, float Max) {
+            __m128 NotNaN = _mm_cmpord_ps(V, V);
+            V = _mm_and_ps(NotNaN, _mm_min_ps(_mm_max_ps(V, _mm_set1_ps(-1.f)), _mm_set1_ps(1.f)));
+            return _mm_cvtps_epi32(_mm_mul_ps(V, _mm_set1_ps(Max)));
+        }
+        FM_SINL __m128 FM_CALL FloatFromUnorm(__m128i Q, float Max) {
+            return _mm_div_ps(_mm_cvtepi32_ps(Q), _mm_set1_ps(Max));
+        }
+        FM_SINL __m128 FM_CALL FloatFromSnorm(__m128i Q, float Max) {
+            return _mm_max_ps(_mm_div_ps(_mm_cvtepi32_ps(Q), _mm_set1_ps(Max)), _mm_set1_ps(-1.f));
+        }
+        // NOTE: A, B, C and D are 4 pixels, results keep their order
+        FM_SINL __m128i FM_CALL Unorm8FromFloat16(__m128 A, __m128 B, __m128 C, __m128 D) {
+            __m128i AB = _mm_packs_epi32(QuantizeUnorm(A, 255.f), QuantizeUnorm(B, 255.f));
+            __m128i CD = _mm_packs_epi32(QuantizeUnorm(C, 255.f), QuantizeUnorm(D, 255.f));
+            return _mm_packus_epi16(AB, CD);
+        }
+        FM_SINL __m128i FM_CALL Snorm8FromFloat16(__m128 A, __m128 B, __m128 C, __m128 D) {
+            __m128i AB = _mm_packs_epi32(QuantizeSnorm(A, 127.f), QuantizeSnorm(B, 127.f));
+            __m128i CD = _mm_packs_epi32(QuantizeSnorm(C, 127.f), QuantizeSnorm(D, 127.f));
+            return _mm_packs_epi16(AB, CD);
+        }
+        // NOTE: SSE2 has no unsigned 32 to 16 bit pack, so the values are biased into the signed range and back
+        FM_SINL __m128i FM_CALL Unorm16FromFloat8(__m128 A, __m128 B) {
+            __m128i Bias = _mm_set1_epi32(32768);
+            __m128i AB = _mm_packs_epi32(_mm_sub_epi32(QuantizeUnorm(A, 65535.f), Bias), _mm_sub_epi32(QuantizeUnorm(B, 65535.f), Bias));
+            return _mm_xor_si128(AB, _mm_set1_epi16((int16_t)0x8000));
+        }
+        FM_SINL __m128i FM_CALL Snorm16FromFloat8(__m128 A, __m128 B) {
+            return _mm_packs_epi32(QuantizeSnorm(A, 32767.f), QuantizeSnorm(B, 32767.f));
+        }
+        FM_SINL void FM_CALL Float16FromUnorm8(__m128i Q, __m128* A, __m128* B, __m128* C, __m128* D) {
+            __m128i Zero = _mm_setzero_si128();
+            __m128i Lo = _mm_unpacklo_epi8(Q, Zero);
+            __m128i Hi = _mm_unpackhi_epi8(Q, Zero);
+            *A = FloatFromUnorm(_mm_unpacklo_epi16(Lo, Zero), 255.f);
+            *B = FloatFromUnorm(_mm_unpackhi_epi16(Lo, Zero), 255.f);
+            *C = FloatFromUnorm(_mm_unpacklo_epi16(Hi, Zero), 255.f);
+            *D = FloatFromUnorm(_mm_unpackhi_epi16(Hi, Zero), 255.f);
+        }
+        FM_SINL void FM_CALL Float16FromSnorm8(__m128i Q, __m128* A, __m128* B, __m128* C, __m128* D) {
+            __m128i Lo = _mm_srai_epi16(_mm_unpacklo_epi8(Q, Q), 8);
+            __m128i Hi = _mm_srai_epi16(_mm_unpackhi_epi8(Q, Q), 8);
+            *A = FloatFromSnorm(_mm_srai_epi32(_mm_unpacklo_epi16(Lo, Lo), 16), 127.f);
+            *B = FloatFromSnorm(_mm_srai_epi32(_mm_unpackhi_epi16(Lo, Lo), 16), 127.f);
+            *C = FloatFromSnorm(_mm_srai_epi32(_mm_unpacklo_epi16(Hi, Hi), 16), 127.f);
+            *D = FloatFromSnorm(_mm_srai_epi32(_mm_unpackhi_epi16(Hi, Hi), 16), 127.f);
+        }
+        FM_SINL void FM_CALL Float8FromUnorm16(__m128i Q, __m128* A, __m128* B) {
+            *A = FloatFromUnorm(_mm_unpacklo_epi16(Q, _mm_setzero_si128()), 65535.f);
+            *B = FloatFromUnorm(_mm_unpackhi_epi16(Q, _mm_setzero_si128()), 65535.f);
+        }
+        FM_SINL void FM_CALL Float8FromSnorm16(__m128i Q, __m128* A, __m128* B) {
+            *A = FloatFromSnorm(_mm_srai_epi32(_mm_unpacklo_epi16(Q, Q), 16), 32767.f);
+            *B = FloatFromSnorm(_mm_srai_epi32(_mm_unpackhi_epi16(Q, Q), 16), 32767.f);
+        }
     }
-    FM_FUN_TSI SetCenter(rect2_base<t>* A, t X, t Y) -> void {
-        *A = SetCenter(*A, X, Y);
+    FM_SINL v4u8 FM_CALL PackUnorm8(vec4 V) {
+        v4u8 R;
+        int32_t Bits = _mm_cvtsi128_si32(priv::Unorm8FromFloat16(V.M, V.M, V.M, V.M));
+        memcpy(&R, &Bits, sizeof(R));
+        return R;
     }
-    FM_FUN_TSI SetDimWithFixedCenter(rect2_base<t> A, v2_base<t> Dim) -> rect2_base<t> {
-        auto NewRadius = Dim / (t)2;
-        auto Center = GetCenter(A);
-        A.Min = Center - NewRadius;
-        A.Max = Center + NewRadius;
-        return A;
+    FM_SINL v4i8 FM_CALL PackSnorm8(vec4 V) {
+        v4i8 R;
+        int32_t Bits = _mm_cvtsi128_si32(priv::Snorm8FromFloat16(V.M, V.M, V.M, V.M));
+        memcpy(&R, &Bits, sizeof(R));
+        return R;
     }
-    FM_FUN_TSI SetDimWithFixedCenter(rect2_base<t> A, t Width, t Height) -> rect2_base<t> {
-        return SetDimWithFixedCenter(A, v2_base<t>(Width, Height));
+    FM_SINL v4u16 FM_CALL PackUnorm16(vec4 V) {
+        v4u16 R;
+        _mm_storel_epi64((__m128i*)&R, priv::Unorm16FromFloat8(V.M, V.M));
+        return R;
     }
-    FM_FUN_TSI SetDimWithFixedCenter(rect2_base<t>* A, t Width, t Height) -> void {
-        *A = SetDimWithFixedCenter(*A, Width, Height);
+    FM_SINL v4i16 FM_CALL PackSnorm16(vec4 V) {
+        v4i16 R;
+        _mm_storel_epi64((__m128i*)&R, priv::Snorm16FromFloat8(V.M, V.M));
+        return R;
     }
-    FM_FUN_TSI SetDimWithFixedCenter(rect2_base<t>* A, v2_base<t> Dim) -> void {
-        *A = SetDimWithFixedCenter(*A, Dim);
+    FM_SINL v4u8 FM_CALL PackUnorm8(v4 V) { return PackUnorm8(CastToVec4(V)); }
+    FM_SINL v4i8 FM_CALL PackSnorm8(v4 V) { return PackSnorm8(CastToVec4(V)); }
+    FM_SINL v4u16 FM_CALL PackUnorm16(v4 V) { return PackUnorm16(CastToVec4(V)); }
+    FM_SINL v4i16 FM_CALL PackSnorm16(v4 V) { return PackSnorm16(CastToVec4(V)); }
+    FM_SINL vec4 FM_CALL Vec4FromUnorm8(v4u8 V) {
+        int32_t Bits;
+        memcpy(&Bits, &V, sizeof(Bits));
+        vec4 R, Unused;
+        priv::Float16FromUnorm8(_mm_cvtsi32_si128(Bits), &R.M, &Unused.M, &Unused.M, &Unused.M);
+        return R;
     }
-    FM_FUN_TSI SetDimWithFixedMin(rect2_base<t> A, v2_base<t> Dim) -> rect2_base<t> {
-        A.Max = A.Min + Dim;
-        return A;
+    FM_SINL vec4 FM_CALL Vec4FromSnorm8(v4i8 V) {
+        int32_t Bits;
+        memcpy(&Bits, &V, sizeof(Bits));
+        vec4 R, Unused;
+        priv::Float16FromSnorm8(_mm_cvtsi32_si128(Bits), &R.M, &Unused.M, &Unused.M, &Unused.M);
+        return R;
     }
-    FM_FUN_TSI SetDimWithFixedMin(rect2_base<t> A, t Width, t Height) -> rect2_base<t> {
-        return SetDimWithFixedMin(A, v2_base<t>(Width, Height));
+    FM_SINL vec4 FM_CALL Vec4FromUnorm16(v4u16 V) {
+        vec4 R, Unused;
+        priv::Float8FromUnorm16(_mm_loadl_epi64((const __m128i*)&V), &R.M, &Unused.M);
+        return R;
     }
-    FM_FUN_TSI SetDimWithFixedMin(rect2_base<t>* A, v2_base<t> Dim) -> void {
-        *A = SetDimWithFixedMin(*A, Dim);
+    FM_SINL vec4 FM_CALL Vec4FromSnorm16(v4i16 V) {
+        vec4 R, Unused;
+        priv::Float8FromSnorm16(_mm_loadl_epi64((const __m128i*)&V), &R.M, &Unused.M);
+        return R;
     }
-    FM_FUN_TSI SetDimWithFixedMin(rect2_base<t>* A, t Width, t Height) -> void {
-        *A = SetDimWithFixedMin(*A, v2_base<t>(Width, Height));
+    FM_SINL v4 FM_CALL V4FromUnorm8(v4u8 V) { return CastToV4(Vec4FromUnorm8(V)); }
+    FM_SINL v4 FM_CALL V4FromSnorm8(v4i8 V) { return CastToV4(Vec4FromSnorm8(V)); }
+    FM_SINL v4 FM_CALL V4FromUnorm16(v4u16 V) { return CastToV4(Vec4FromUnorm16(V)); }
+    FM_SINL v4 FM_CALL V4FromSnorm16(v4i16 V) { return CastToV4(Vec4FromSnorm16(V)); }
+    
+    //////////////////////////////
+    // vector packets functions //
+    //////////////////////////////
+    namespace priv {
+        FM_SINL __m128 FM_CALL PacketAdd(__m128 A, __m128 B) { return _mm_add_ps(A, B); }
+        FM_SINL __m128 FM_CALL PacketSub(__m128 A, __m128 B) { return _mm_sub_ps(A, B); }
+        FM_SINL __m128 FM_CALL PacketMul(__m128 A, __m128 B) { return _mm_mul_ps(A, B); }
+        FM_SINL __m128 FM_CALL PacketDiv(__m128 A, __m128 B) { return _mm_div_ps(A, B); }
+        FM_SINL __m128 FM_CALL PacketMin(__m128 A, __m128 B) { return _mm_min_ps(A, B); }
+        FM_SINL __m128 FM_CALL PacketMax(__m128 A, __m128 B) { return _mm_max_ps(A, B); }
+        FM_SINL __m128 FM_CALL PacketSqrt(__m128 A) { return _mm_sqrt_ps(A); }
+        FM_SINL __m128 FM_CALL PacketReciprocalSqrt(__m128 A) { return ReciprocalSqrt(A); }
+        FM_SINL __m128 FM_CALL PacketAnd(__m128 A, __m128 B) { return _mm_and_ps(A, B); }
+        FM_SINL __m128 FM_CALL PacketAndNot(__m128 A, __m128 B) { return _mm_andnot_ps(A, B); }
+        FM_SINL __m128 FM_CALL PacketOr(__m128 A, __m128 B) { return _mm_or_ps(A, B); }
+        FM_SINL __m128 FM_CALL PacketXor(__m128 A, __m128 B) { return _mm_xor_ps(A, B); }
+        FM_SINL __m128 FM_CALL PacketEquals(__m128 A, __m128 B) { return _mm_cmpeq_ps(A, B); }
+        FM_SINL __m128 FM_CALL PacketGreater(__m128 A, __m128 B) { return _mm_cmpgt_ps(A, B); }
+        FM_SINL __m128 FM_CALL PacketGreaterOrEqual(__m128 A, __m128 B) { return _mm_cmpge_ps(A, B); }
+        FM_SINL __m128 FM_CALL PacketLesser(__m128 A, __m128 B) { return _mm_cmplt_ps(A, B); }
+        FM_SINL __m128 FM_CALL PacketLesserOrEqual(__m128 A, __m128 B) { return _mm_cmple_ps(A, B); }
+        // NOTE: Rounds to nearest even, floats of magnitude 2^23 and above are already integers
+        FM_SINL __m128 FM_CALL PacketRound(__m128 A) {
+#ifndef FM_USE_SSE2_INSTEAD_OF_SSE4
+            return _mm_round_ps(A, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC);
+#else
+            __m128 Big = _mm_cmpge_ps(_mm_andnot_ps(_mm_set1_ps(-0.f), A), _mm_set1_ps(8388608.f));
+            __m128 Rounded = _mm_cvtepi32_ps(_mm_cvtps_epi32(A));
+            return _mm_or_ps(_mm_and_ps(Big, A), _mm_andnot_ps(Big, Rounded));
+#endif
+        }
+        FM_SINL bool FM_CALL PacketAllSet(__m128 Mask) { return _mm_movemask_ps(Mask) == 0xF; }
+        FM_SINL bool FM_CALL PacketAnySet(__m128 Mask) { return _mm_movemask_ps(Mask) != 0; }
+        FM_SINL void FM_CALL PacketStore(float* Mem, __m128 A) { _mm_storeu_ps(Mem, A); }
+        FM_SINL void FM_CALL PacketLoad(__m128* A, const float* Mem) { *A = _mm_loadu_ps(Mem); }
+        FM_SINL void FM_CALL PacketSplat(__m128* A, float Scalar) { *A = _mm_set1_ps(Scalar); }
+        
+        // NOTE: 4 v3 are 12 floats, X = {0, 3, 6, 9}, Y = {1, 4, 7, 10}, Z = {2, 5, 8, 11}
+        FM_SINL void FM_CALL TransposeLoadV3x4(const float* Mem, __m128* X, __m128* Y, __m128* Z) {
+            __m128 A = _mm_loadu_ps(Mem);
+            __m128 B = _mm_loadu_ps(Mem + 4);
+            __m128 C = _mm_loadu_ps(Mem + 8);
+            __m128 B2C1 = _mm_shuffle_ps(B, C, _MM_SHUFFLE(1, 1, 2, 2));
+            __m128 A1B0 = _mm_shuffle_ps(A, B, _MM_SHUFFLE(0, 0, 1, 1));
+            __m128 B3C2 = _mm_shuffle_ps(B, C, _MM_SHUFFLE(2, 2, 3, 3));
+            __m128 A2B1 = _mm_shuffle_ps(A, B, _MM_SHUFFLE(1, 1, 2, 2));
+            *X = _mm_shuffle_ps(A, B2C1, _MM_SHUFFLE(2, 0, 3, 0));
+            *Y = _mm_shuffle_ps(A1B0, B3C2, _MM_SHUFFLE(2, 0, 2, 0));
+            *Z = _mm_shuffle_ps(A2B1, C, _MM_SHUFFLE(3, 0, 2, 0));
+        }
+        FM_SINL void FM_CALL TransposeStoreV3x4(float* Mem, __m128 X, __m128 Y, __m128 Z) {
+            __m128 X0Y0 = _mm_shuffle_ps(X, Y, _MM_SHUFFLE(0, 0, 0, 0));
+            __m128 Z0X1 = _mm_shuffle_ps(Z, X, _MM_SHUFFLE(1, 1, 0, 0));
+            __m128 Y1Z1 = _mm_shuffle_ps(Y, Z, _MM_SHUFFLE(1, 1, 1, 1));
+            __m128 X2Y2 = _mm_shuffle_ps(X, Y, _MM_SHUFFLE(2, 2, 2, 2));
+            __m128 Z2X3 = _mm_shuffle_ps(Z, X, _MM_SHUFFLE(3, 3, 2, 2));
+            __m128 Y3Z3 = _mm_shuffle_ps(Y, Z, _MM_SHUFFLE(3, 3, 3, 3));
+            _mm_storeu_ps(Mem, _mm_shuffle_ps(X0Y0, Z0X1, _MM_SHUFFLE(2, 0, 2, 0)));
+            _mm_storeu_ps(Mem + 4, _mm_shuffle_ps(Y1Z1, X2Y2, _MM_SHUFFLE(2, 0, 2, 0)));
+            _mm_storeu_ps(Mem + 8, _mm_shuffle_ps(Z2X3, Y3Z3, _MM_SHUFFLE(2, 0, 2, 0)));
+        }
+        // NOTE: Rows are 4 consecutive 16 byte vectors, Stride is in floats
+        FM_SINL void FM_CALL TransposeLoad4x4(const float* Mem, uint32_t Stride, __m128* X, __m128* Y, __m128* Z, __m128* W) {
+            __m128 R0 = _mm_loadu_ps(Mem);
+            __m128 R1 = _mm_loadu_ps(Mem + Stride);
+            __m128 R2 = _mm_loadu_ps(Mem + 2*Stride);
+            __m128 R3 = _mm_loadu_ps(Mem + 3*Stride);
+            _MM_TRANSPOSE4_PS(R0, R1, R2, R3);
+            *X = R0; *Y = R1; *Z = R2; *W = R3;
+        }
+        FM_SINL void FM_CALL TransposeStore4x4(float* Mem, uint32_t Stride, __m128 X, __m128 Y, __m128 Z, __m128 W) {
+            _MM_TRANSPOSE4_PS(X, Y, Z, W);
+            _mm_storeu_ps(Mem, X);
+            _mm_storeu_ps(Mem + Stride, Y);
+            _mm_storeu_ps(Mem + 2*Stride, Z);
+            _mm_storeu_ps(Mem + 3*Stride, W);
+        }
+        
+#ifdef __AVX__
+        FM_SINL __m256 FM_CALL PacketAdd(__m256 A, __m256 B) { return _mm256_add_ps(A, B); }
+        FM_SINL __m256 FM_CALL PacketSub(__m256 A, __m256 B) { return _mm256_sub_ps(A, B); }
+        FM_SINL __m256 FM_CALL PacketMul(__m256 A, __m256 B) { return _mm256_mul_ps(A, B); }
+        FM_SINL __m256 FM_CALL PacketDiv(__m256 A, __m256 B) { return _mm256_div_ps(A, B); }
+        FM_SINL __m256 FM_CALL PacketMin(__m256 A, __m256 B) { return _mm256_min_ps(A, B); }
+        FM_SINL __m256 FM_CALL PacketMax(__m256 A, __m256 B) { return _mm256_max_ps(A, B); }
+        FM_SINL __m256 FM_CALL PacketSqrt(__m256 A) { return _mm256_sqrt_ps(A); }
+        FM_SINL __m256 FM_CALL PacketReciprocalSqrt(__m256 A) {
+            __m256 R = _mm256_rsqrt_ps(A);
+            return _mm256_mul_ps(_mm256_mul_ps(_mm256_set1_ps(0.5f), R), _mm256_sub_ps(_mm256_set1_ps(3.f), _mm256_mul_ps(_mm256_mul_ps(A, R), R)));
+        }
+        FM_SINL __m256 FM_CALL PacketAnd(__m256 A, __m256 B) { return _mm256_and_ps(A, B); }
+        FM_SINL __m256 FM_CALL PacketAndNot(__m256 A, __m256 B) { return _mm256_andnot_ps(A, B); }
+        FM_SINL __m256 FM_CALL PacketOr(__m256 A, __m256 B) { return _mm256_or_ps(A, B); }
+        FM_SINL __m256 FM_CALL PacketXor(__m256 A, __m256 B) { return _mm256_xor_ps(A, B); }
+        FM_SINL __m256 FM_CALL PacketEquals(__m256 A, __m256 B) { return _mm256_cmp_ps(A, B, _CMP_EQ_OQ); }
+        FM_SINL __m256 FM_CALL PacketGreater(__m256 A, __m256 B) { return _mm256_cmp_ps(A, B, _CMP_GT_OQ); }
+        FM_SINL __m256 FM_CALL PacketGreaterOrEqual(__m256 A, __m256 B) { return _mm256_cmp_ps(A, B, _CMP_GE_OQ); }
+        FM_SINL __m256 FM_CALL PacketLesser(__m256 A, __m256 B) { return _mm256_cmp_ps(A, B, _CMP_LT_OQ); }
+        FM_SINL __m256 FM_CALL PacketLesserOrEqual(__m256 A, __m256 B) { return _mm256_cmp_ps(A, B, _CMP_LE_OQ); }
+        FM_SINL __m256 FM_CALL PacketRound(__m256 A) { return _mm256_round_ps(A, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC); }
+        FM_SINL bool FM_CALL PacketAllSet(__m256 Mask) { return _mm256_movemask_ps(Mask) == 0xFF; }
+        FM_SINL bool FM_CALL PacketAnySet(__m256 Mask) { return _mm256_movemask_ps(Mask) != 0; }
+        FM_SINL void FM_CALL PacketStore(float* Mem, __m256 A) { _mm256_storeu_ps(Mem, A); }
+        FM_SINL void FM_CALL PacketLoad(__m256* A, const float* Mem) { *A = _mm256_loadu_ps(Mem); }
+        FM_SINL void FM_CALL PacketSplat(__m256* A, float Scalar) { *A = _mm256_set1_ps(Scalar); }
+        FM_SINL __m256 FM_CALL Combine(__m128 Lo, __m128 Hi) {
+            return _mm256_insertf128_ps(_mm256_castps128_ps256(Lo), Hi, 1);
+        }
+        FM_SINL __m128 FM_CALL LowerHalf(__m256 A) { return _mm256_castps256_ps128(A); }
+        FM_SINL __m128 FM_CALL UpperHalf(__m256 A) { return _mm256_extractf128_ps(A, 1); }
+#endif
     }
-    FM_FUN_TSI SetDimWithFixedMax(rect2_base<t> A, v2_base<t> Dim) -> rect2_base<t> {
-        A.Min = A.Max - Dim;
-        return A;
+    
+    template<uint32_t n> FM_INL auto FM_CALL v3x_base<n>::GetV3(uint32_t Index) -> v3 {
+        FM_ASSERT(Index < n);
+        float Xs[n], Ys[n], Zs[n];
+        priv::PacketStore(Xs, X);
+        priv::PacketStore(Ys, Y);
+        priv::PacketStore(Zs, Z);
+        return v3(Xs[Index], Ys[Index], Zs[Index]);
+    }
+    template<uint32_t n> FM_INL auto FM_CALL v3x_base<n>::GetVec3(uint32_t Index) -> vec3 {
+        v3 V = GetV3(Index);
+        return Vec3(V.X, V.Y, V.Z);
+    }
+    template<uint32_t n> FM_INL auto FM_CALL v3x_base<n>::Set(uint32_t Index, v3 V) -> void {
+        FM_ASSERT(Index < n);
+        float Xs[n], Ys[n], Zs[n];
+        priv::PacketStore(Xs, X);
+        priv::PacketStore(Ys, Y);
+        priv::PacketStore(Zs, Z);
+        Xs[Index] = V.X;
+        Ys[Index] = V.Y;
+        Zs[Index] = V.Z;
+        priv::PacketLoad(&X, Xs);
+        priv::PacketLoad(&Y, Ys);
+        priv::PacketLoad(&Z, Zs);
+    }
+    template<uint32_t n> FM_INL auto FM_CALL v3x_base<n>::Set(uint32_t Index, vec3 V) -> void {
+        Set(Index, v3(V.X(), V.Y(), V.Z()));
+    }
+    template<uint32_t n> FM_INL auto FM_CALL v4x_base<n>::GetV4(uint32_t Index) -> v4 {
+        FM_ASSERT(Index < n);
+        float Xs[n], Ys[n], Zs[n], Ws[n];
+        priv::PacketStore(Xs, X);
+        priv::PacketStore(Ys, Y);
+        priv::PacketStore(Zs, Z);
+        priv::PacketStore(Ws, W);
+        return v4(Xs[Index], Ys[Index], Zs[Index], Ws[Index]);
+    }
+    template<uint32_t n> FM_INL auto FM_CALL v4x_base<n>::GetVec4(uint32_t Index) -> vec4 {
+        v4 V = GetV4(Index);
+        return Vec4(V.X, V.Y, V.Z, V.W);
+    }
+    template<uint32_t n> FM_INL auto FM_CALL v4x_base<n>::Set(uint32_t Index, v4 V) -> void {
+        FM_ASSERT(Index < n);
+        float Xs[n], Ys[n], Zs[n], Ws[n];
+        priv::PacketStore(Xs, X);
+        priv::PacketStore(Ys, Y);
+        priv::PacketStore(Zs, Z);
+        priv::PacketStore(Ws, W);
+        Xs[Index] = V.X;
+        Ys[Index] = V.Y;
+        Zs[Index] = V.Z;
+        Ws[Index] = V.W;
+        priv::PacketLoad(&X, Xs);
+        priv::PacketLoad(&Y, Ys);
+        priv::PacketLoad(&Z, Zs);
+        priv::PacketLoad(&W, Ws);
+    }
+    template<uint32_t n> FM_INL auto FM_CALL v4x_base<n>::Set(uint32_t Index, vec4 V) -> void {
+        Set(Index, v4(V.X(), V.Y(), V.Z(), V.W()));
     }
-    FM_FUN_TSI SetDimWithFixedMax(rect2_base<t> A, t Width, t Height) -> rect2_base<t> {
-        return SetDimWithFixedMax(A, v2_base<t>(Width, Height));
+    
+    // v3x4 construction, loads and stores
+    FM_FUN_SIC V3x4(__m128 X, __m128 Y, __m128 Z) -> v3x4 {
+        v3x4 R;
+        R.X = X; R.Y = Y; R.Z = Z;
+        return R;
     }
-    FM_FUN_TSI SetDimWithFixedMax(rect2_base<t>* A, v2_base<t> Dim) -> void {
-        *A = SetDimWithFixedMax(*A, Dim);
+    FM_FUN_SIC V3x4(float X, float Y, float Z) -> v3x4 {
+        return V3x4(_mm_set1_ps(X), _mm_set1_ps(Y), _mm_set1_ps(Z));
     }
-    FM_FUN_TSI SetDimWithFixedMax(rect2_base<t>* A, t Width, t Height) -> void {
-        *A = SetDimWithFixedMax(*A, v2_base<t>(Width, Height));
+    FM_FUN_SIC V3x4(v3 V) -> v3x4 {
+        return V3x4(V.X, V.Y, V.Z);
     }
-    FM_FUN_TSI SetMin(rect2_base<t> A, v2_base<t> Min) -> rect2_base<t> {
-        auto Dim = GetDim(A);
-        A.Min = Min;
-        A.Max = Min + Dim;
-        return A;
+    FM_FUN_SIC V3x4(vec3 V) -> v3x4 {
+        v3x4 R;
+        R.X = _mm_shuffle_ps(V.M, V.M, _MM_SHUFFLE(0, 0, 0, 0));
+        R.Y = _mm_shuffle_ps(V.M, V.M, _MM_SHUFFLE(1, 1, 1, 1));
+        R.Z = _mm_shuffle_ps(V.M, V.M, _MM_SHUFFLE(2, 2, 2, 2));
+        return R;
     }
-    FM_FUN_TSI SetMin(rect2_base<t>* A, v2_base<t> Min) -> void {
-        *A = SetMin(*A, Min);
+    FM_FUN_SIC V3x4() -> v3x4 {
+        __m128 Zero = _mm_setzero_ps();
+        return V3x4(Zero, Zero, Zero);
     }
-    FM_FUN_TSI SetMax(rect2_base<t> A, v2_base<t> Max) -> rect2_base<t> {
-        auto Dim = GetDim(A);
-        A.Min = Max - Dim;
-        A.Max = Max;
-        return A;
+    FM_FUN_SIC V3x4FromMemory(const v3* Arr) -> v3x4 {
+        v3x4 R;
+        priv::TransposeLoadV3x4(Arr->Elements, &R.X, &R.Y, &R.Z);
+        return R;
     }
-    FM_FUN_TSI SetMax(rect2_base<t>* A, v2_base<t> Max) -> void {
-        *A = SetMax(*A, Max);
+    FM_FUN_SIC V3x4FromMemory(const vec3* Arr) -> v3x4 {
+        v3x4 R;
+        __m128 W;
+        priv::TransposeLoad4x4((const float*)Arr, 4, &R.X, &R.Y, &R.Z, &W);
+        return R;
     }
-    FM_FUN_TSI SetMaxXMinY(rect2_base<t> A, v2_base<t> P) -> rect2_base<t> {
-        auto Dim = GetDim(A);
-        A.Min = {P.X - Dim.W, P.Y};
-        A.Max = {P.X, P.Y + Dim.H};
-        return A;
+    FM_FUN_SIC V3x4FromSoA(const float* X, const float* Y, const float* Z) -> v3x4 {
+        return V3x4(_mm_loadu_ps(X), _mm_loadu_ps(Y), _mm_loadu_ps(Z));
     }
-    FM_FUN_TSI SetMaxXMinY(rect2_base<t>* A, v2_base<t> P) -> void {
-        *A = SetMaxXMinY(*A, P);
+    FM_FUN_SIC Store(v3* Arr, v3x4 P) -> void {
+        priv::TransposeStoreV3x4(Arr->Elements, P.X, P.Y, P.Z);
     }
-    FM_FUN_TSI SetMinXMaxY(rect2_base<t> A, v2_base<t> P) -> rect2_base<t> {
-        auto Dim = GetDim(A);
-        A.Min = {P.X, P.Y - Dim.H};
-        A.Max = {P.X + Dim.W, P.Y};
-        return A;
+    FM_FUN_SIC Store(vec3* Arr, v3x4 P) -> void {
+        priv::TransposeStore4x4((float*)Arr, 4, P.X, P.Y, P.Z, _mm_setzero_ps());
     }
-    FM_FUN_TSI SetMinXMaxY(rect2_base<t>* A, v2_base<t> P) -> void {
-        *A = SetMinXMaxY(*A, P);
+    FM_FUN_SIC StoreSoA(float* X, float* Y, float* Z, v3x4 P) -> void {
+        _mm_storeu_ps(X, P.X);
+        _mm_storeu_ps(Y, P.Y);
+        _mm_storeu_ps(Z, P.Z);
     }
-    FM_FUN_TSI SetCenterXMinY(rect2_base<t> A, v2_base<t> P) -> rect2_base<t> {
-        t Rx = GetRadiusX(A);
-        t H = GetHeight(A);
-        A.Min = {P.X - Rx, P.Y};
-        A.Max = {P.X + Rx, P.Y + H};
-        return A;
+    
+    // v4x4 construction, loads and stores
+    FM_FUN_SIC V4x4(__m128 X, __m128 Y, __m128 Z, __m128 W) -> v4x4 {
+        v4x4 R;
+        R.X = X; R.Y = Y; R.Z = Z; R.W = W;
+        return R;
     }
-    FM_FUN_TSI SetCenterXMinY(rect2_base<t>* A, v2_base<t> P) -> void {
-        *A = SetCenterXMinY(*A, P);
+    FM_FUN_SIC V4x4(float X, float Y, float Z, float W) -> v4x4 {
+        return V4x4(_mm_set1_ps(X), _mm_set1_ps(Y), _mm_set1_ps(Z), _mm_set1_ps(W));
     }
-    FM_FUN_TSI SetCenterXMaxY(rect2_base<t> A, v2_base<t> P) -> rect2_base<t> {
-        t Rx = GetRadiusX(A);
-        t H = GetHeight(A);
-        A.Min = {P.X - Rx, P.Y - H};
-        A.Max = {P.X + Rx, P.Y};
-        return A;
+    FM_FUN_SIC V4x4(v4 V) -> v4x4 {
+        return V4x4(V.X, V.Y, V.Z, V.W);
     }
-    FM_FUN_TSI SetCenterXMaxY(rect2_base<t>* A, v2_base<t> P) -> void {
-        *A = SetCenterXMaxY(*A, P);
+    FM_FUN_SIC V4x4(vec4 V) -> v4x4 {
+        v4x4 R;
+        R.X = _mm_shuffle_ps(V.M, V.M, _MM_SHUFFLE(0, 0, 0, 0));
+        R.Y = _mm_shuffle_ps(V.M, V.M, _MM_SHUFFLE(1, 1, 1, 1));
+        R.Z = _mm_shuffle_ps(V.M, V.M, _MM_SHUFFLE(2, 2, 2, 2));
+        R.W = _mm_shuffle_ps(V.M, V.M, _MM_SHUFFLE(3, 3, 3, 3));
+        return R;
     }
-    FM_FUN_TSI SetMinXCenterY(rect2_base<t> A, v2_base<t> P) -> rect2_base<t> {
-        t Ry = GetRadiusY(A);
-        t W = GetWidth(A);
-        A.Min = {P.X, P.Y - Ry};
-        A.Max = {P.X + W, P.Y + Ry};
-        return A;
+    FM_FUN_SIC V4x4() -> v4x4 {
+        __m128 Zero = _mm_setzero_ps();
+        return V4x4(Zero, Zero, Zero, Zero);
     }
-    FM_FUN_TSI SetMinXCenterY(rect2_base<t>* A, v2_base<t> P) -> void {
-        *A = SetMinXCenterY(*A, P);
+    FM_FUN_SIC V4x4FromMemory(const v4* Arr) -> v4x4 {
+        v4x4 R;
+        priv::TransposeLoad4x4(Arr->Elements, 4, &R.X, &R.Y, &R.Z, &R.W);
+        return R;
     }
-    FM_FUN_TSI SetMaxXCenterY(rect2_base<t> A, v2_base<t> P) -> rect2_base<t> {
-        t Ry = GetRadiusY(A);
-        t W = GetWidth(A);
-        A.Min = {P.X - W, P.Y - Ry};
-        A.Max = {P.X, P.Y + Ry};
-        return A;
+    FM_FUN_SIC V4x4FromMemory(const vec4* Arr) -> v4x4 {
+        v4x4 R;
+        priv::TransposeLoad4x4((const float*)Arr, 4, &R.X, &R.Y, &R.Z, &R.W);
+        return R;
     }
-    FM_FUN_TSI SetMaxXCenterY(rect2_base<t>* A, v2_base<t> P) -> void {
-        *A = SetMaxXCenterY(*A, P);
+    FM_FUN_SIC V4x4FromSoA(const float* X, const float* Y, const float* Z, const float* W) -> v4x4 {
+        return V4x4(_mm_loadu_ps(X), _mm_loadu_ps(Y), _mm_loadu_ps(Z), _mm_loadu_ps(W));
     }
-    FM_FUN_TSI HasArea(rect2_base<t> A) -> bool {
-        return A.Min.X < A.Max.X && A.Min.Y < A.Max.Y;
+    FM_FUN_SIC Store(v4* Arr, v4x4 P) -> void {
+        priv::TransposeStore4x4(Arr->Elements, 4, P.X, P.Y, P.Z, P.W);
     }
-    FM_FUN_TSI HasAreaFlipAllowed(rect2_base<t> A) -> bool {
-        return A.Min.X != A.Max.X && A.Min.Y != A.Max.Y;
+    FM_FUN_SIC Store(vec4* Arr, v4x4 P) -> void {
+        priv::TransposeStore4x4((float*)Arr, 4, P.X, P.Y, P.Z, P.W);
     }
-    FM_FUN_TSI Rect2BaseMinMax(t MinX, t MinY, t MaxX, t MaxY) -> rect2_base<t> {
-        rect2_base<t> R;
-        R.Min.X = MinX;
-        R.Min.Y = MinY;
-        R.Max.X = MaxX;
-        R.Max.Y = MaxY;
-        return R;
+    FM_FUN_SIC StoreSoA(float* X, float* Y, float* Z, float* W, v4x4 P) -> void {
+        _mm_storeu_ps(X, P.X);
+        _mm_storeu_ps(Y, P.Y);
+        _mm_storeu_ps(Z, P.Z);
+        _mm_storeu_ps(W, P.W);
     }
-    FM_FUN_TSI Rect2BaseMinMax(v2_base<t> Min, v2_base<t> Max) -> rect2_base<t> {
-        rect2_base<t> R;
-        R.Min = Min;
-        R.Max = Max;
+    
+#ifdef __AVX__
+    // v3x8 construction, loads and stores
+    FM_FUN_SIC V3x8(__m256 X, __m256 Y, __m256 Z) -> v3x8 {
+        v3x8 R;
+        R.X = X; R.Y = Y; R.Z = Z;
         return R;
     }
-    FM_FUN_TSI Rect2BaseMinDim(t MinX, t MinY, t Width, t Height) -> rect2_base<t> {
-        rect2_base<t> R;
-        R.Min.X = MinX;
-        R.Min.Y = MinY;
-        R.Max.X = MinX + Width;
-        R.Max.Y = MinY + Height;
-        return R;
+    FM_FUN_SIC V3x8(float X, float Y, float Z) -> v3x8 {
+        return V3x8(_mm256_set1_ps(X), _mm256_set1_ps(Y), _mm256_set1_ps(Z));
     }
-    FM_FUN_TSI Rect2BaseMinDim(v2_base<t> Min, v2_base<t> Dim) -> rect2_base<t> {
-        rect2_base<t> R;
-        R.Min = Min;
-        R.Max = Min + Dim;
-        return R;
+    FM_FUN_SIC V3x8(v3 V) -> v3x8 {
+        return V3x8(V.X, V.Y, V.Z);
     }
-    FM_FUN_TSI Rect2BaseDimMax(t Width, t Height, t MaxX, t MaxY) -> rect2_base<t> {
-        rect2_base<t> R;
-        R.Min.X = MaxX - Width;
-        R.Min.Y = MaxY - Height;
-        R.Max.X = MaxX;
-        R.Max.Y = MaxY;
-        return R;
+    FM_FUN_SIC V3x8(vec3 V) -> v3x8 {
+        return V3x8(V.X(), V.Y(), V.Z());
     }
-    FM_FUN_TSI Rect2BaseDimMax(v2_base<t> Dim, v2_base<t> Max) -> rect2_base<t> {
-        rect2_base<t> R;
-        R.Min = Max - Dim;
-        R.Max = Max;
-        return R;
+    FM_FUN_SIC V3x8(v3x4 Lo, v3x4 Hi) -> v3x8 {
+        return V3x8(priv::Combine(Lo.X, Hi.X), priv::Combine(Lo.Y, Hi.Y), priv::Combine(Lo.Z, Hi.Z));
     }
-    FM_FUN_TSI Rect2BaseCenterRadius(v2_base<t> Center, t Radius) -> rect2_base<t> {
-        rect2_base<t> R;
-        R.Min.X = Center.X - Radius;
-        R.Min.Y = Center.Y - Radius;
-        R.Max.X = Center.X + Radius;
-        R.Max.Y = Center.Y + Radius;
-        return R;
+    FM_FUN_SIC V3x8() -> v3x8 {
+        __m256 Zero = _mm256_setzero_ps();
+        return V3x8(Zero, Zero, Zero);
     }
-    FM_FUN_TSI Rect2BaseCenterRadius(v2_base<t> Center, v2_base<t> Radius) -> rect2_base<t> {
-        rect2_base<t> R;
-        R.Min = Center - Radius;
-        R.Max = Center + Radius;
-        return R;
+    FM_FUN_SIC V3x8FromMemory(const v3* Arr) -> v3x8 {
+        return V3x8(V3x4FromMemory(Arr), V3x4FromMemory(Arr + 4));
     }
-    FM_FUN_TSI Rect2BaseCenterDim(v2_base<t> Center, t Dim) -> rect2_base<t> {
-        return Rect2BaseCenterRadius<t>(Center, Dim / (t)2);
+    FM_FUN_SIC V3x8FromMemory(const vec3* Arr) -> v3x8 {
+        return V3x8(V3x4FromMemory(Arr), V3x4FromMemory(Arr + 4));
     }
-    FM_FUN_TSI Rect2BaseCenterDim(v2_base<t> Center, v2_base<t> Dim) -> rect2_base<t> {
-        return Rect2BaseCenterRadius<t>(Center, Dim / (t)2);
+    FM_FUN_SIC V3x8FromSoA(const float* X, const float* Y, const float* Z) -> v3x8 {
+        return V3x8(_mm256_loadu_ps(X), _mm256_loadu_ps(Y), _mm256_loadu_ps(Z));
     }
-    FM_FUN_TSI Rect2BaseDim(v2_base<t> Dim) -> rect2_base<t> {
-        rect2_base<t> R;
-        R.Min = {};
-        R.Max = Dim;
-        return R;
+    FM_FUN_SIC LowerHalf(v3x8 P) -> v3x4 {
+        return V3x4(priv::LowerHalf(P.X), priv::LowerHalf(P.Y), priv::LowerHalf(P.Z));
     }
-    FM_FUN_TSI Rect2BaseDim(t Width, t Height) -> rect2_base<t> {
-        return Rect2BaseDim<t>({Width, Height});
+    FM_FUN_SIC UpperHalf(v3x8 P) -> v3x4 {
+        return V3x4(priv::UpperHalf(P.X), priv::UpperHalf(P.Y), priv::UpperHalf(P.Z));
     }
-    FM_FUN_TSI Ptr(rect2_base<t>& A) -> t* {
-        return &A.Min.X;
+    FM_FUN_SIC Store(v3* Arr, v3x8 P) -> void {
+        Store(Arr, LowerHalf(P));
+        Store(Arr + 4, UpperHalf(P));
     }
-    FM_FUN_TSI PtrMax(rect2_base<t>& A) -> t* {
-        return &A.Max.X;
+    FM_FUN_SIC Store(vec3* Arr, v3x8 P) -> void {
+        Store(Arr, LowerHalf(P));
+        Store(Arr + 4, UpperHalf(P));
     }
-    FM_FUN_TSI operator*(rect2_base<t> A, t Scalar) -> rect2_base<t> {
-        A.Min *= Scalar;
-        A.Max *= Scalar;
-        return A;
+    FM_FUN_SIC StoreSoA(float* X, float* Y, float* Z, v3x8 P) -> void {
+        _mm256_storeu_ps(X, P.X);
+        _mm256_storeu_ps(Y, P.Y);
+        _mm256_storeu_ps(Z, P.Z);
     }
-    FM_FUN_TSI operator/(rect2_base<t> A, t Scalar) -> rect2_base<t> {
-        A.Min /= Scalar;
-        A.Max /= Scalar;
-        return A;
+    
+    // v4x8 construction, loads and stores
+    FM_FUN_SIC V4x8(__m256 X, __m256 Y, __m256 Z, __m256 W) -> v4x8 {
+        v4x8 R;
+        R.X = X; R.Y = Y; R.Z = Z; R.W = W;
+        return R;
     }
-    FM_FUN_TSI ScaleWithFixedMin(rect2_base<t> A, v2_base<t> ACurrentDim, v2_base<t> Scalar) -> rect2_base<t> {
-        auto NewDim = HadamardMul(ACurrentDim, Scalar);
-        return SetDimWithFixedMin(A, NewDim);
+    FM_FUN_SIC V4x8(float X, float Y, float Z, float W) -> v4x8 {
+        return V4x8(_mm256_set1_ps(X), _mm256_set1_ps(Y), _mm256_set1_ps(Z), _mm256_set1_ps(W));
     }
-    FM_FUN_TSI ScaleWithFixedMin(rect2_base<t> A, v2_base<t> Scalar) -> rect2_base<t> {
-        return ScaleWithFixedMin(A, GetDim(A), Scalar);
+    FM_FUN_SIC V4x8(v4 V) -> v4x8 {
+        return V4x8(V.X, V.Y, V.Z, V.W);
     }
-    FM_FUN_TSI ScaleWithFixedMin(rect2_base<t> A, v2_base<t> ACurrentDim, t Scalar) -> rect2_base<t> {
-        return ScaleWithFixedMin(A, ACurrentDim, v2_base<t>(Scalar));
+    FM_FUN_SIC V4x8(vec4 V) -> v4x8 {
+        return V4x8(V.X(), V.Y(), V.Z(), V.W());
     }
-    FM_FUN_TSI ScaleWithFixedMin(rect2_base<t> A, t Scalar) -> rect2_base<t> {
-        return ScaleWithFixedMin(A, v2_base<t>(Scalar));
+    FM_FUN_SIC V4x8(v4x4 Lo, v4x4 Hi) -> v4x8 {
+        return V4x8(priv::Combine(Lo.X, Hi.X), priv::Combine(Lo.Y, Hi.Y),
+                    priv::Combine(Lo.Z, Hi.Z), priv::Combine(Lo.W, Hi.W));
     }
-    FM_FUN_TSI ScaleWithFixedMin(rect2_base<t>* A, v2_base<t> ACurrentDim, v2_base<t> Scalar) -> void {
-        *A = ScaleWithFixedMin(*A, ACurrentDim, Scalar);	
+    FM_FUN_SIC V4x8() -> v4x8 {
+        __m256 Zero = _mm256_setzero_ps();
+        return V4x8(Zero, Zero, Zero, Zero);
     }
-    FM_FUN_TSI ScaleWithFixedMin(rect2_base<t>* A, v2_base<t> Scalar) -> void {
-        *A = ScaleWithFixedMin(*A, Scalar);	
+    FM_FUN_SIC V4x8FromMemory(const v4* Arr) -> v4x8 {
+        return V4x8(V4x4FromMemory(Arr), V4x4FromMemory(Arr + 4));
     }
-    FM_FUN_TSI ScaleWithFixedMin(rect2_base<t>* A, v2_base<t> ACurrentDim, t Scalar) -> void {
-        *A = ScaleWithFixedMin(*A, ACurrentDim, v2_base<t>(Scalar));
+    FM_FUN_SIC V4x8FromMemory(const vec4* Arr) -> v4x8 {
+        return V4x8(V4x4FromMemory(Arr), V4x4FromMemory(Arr + 4));
     }
-    FM_FUN_TSI ScaleWithFixedMin(rect2_base<t>* A, t Scalar) -> void {
-        *A = ScaleWithFixedMin(*A, v2_base<t>(Scalar));
+    FM_FUN_SIC V4x8FromSoA(const float* X, const float* Y, const float* Z, const float* W) -> v4x8 {
+        return V4x8(_mm256_loadu_ps(X), _mm256_loadu_ps(Y), _mm256_loadu_ps(Z), _mm256_loadu_ps(W));
     }
-    FM_FUN_TSI ScaleWithFixedMax(rect2_base<t> A, v2_base<t> ACurrentDim, v2_base<t> Scalar) -> rect2_base<t> {
-        auto NewDim = HadamardMul(ACurrentDim, Scalar);
-        return SetDimWithFixedMax(A, NewDim);
+    FM_FUN_SIC LowerHalf(v4x8 P) -> v4x4 {
+        return V4x4(priv::LowerHalf(P.X), priv::LowerHalf(P.Y), priv::LowerHalf(P.Z), priv::LowerHalf(P.W));
     }
-    FM_FUN_TSI ScaleWithFixedMax(rect2_base<t> A, v2_base<t> Scalar) -> rect2_base<t> {
-        return ScaleWithFixedMax(A, GetDim(A), Scalar);
+    FM_FUN_SIC UpperHalf(v4x8 P) -> v4x4 {
+        return V4x4(priv::UpperHalf(P.X), priv::UpperHalf(P.Y), priv::UpperHalf(P.Z), priv::UpperHalf(P.W));
     }
-    FM_FUN_TSI ScaleWithFixedMax(rect2_base<t> A, v2_base<t> ACurrentDim, t Scalar) -> rect2_base<t> {
-        return ScaleWithFixedMax(A, ACurrentDim, v2_base<t>(Scalar));
+    FM_FUN_SIC Store(v4* Arr, v4x8 P) -> void {
+        Store(Arr, LowerHalf(P));
+        Store(Arr + 4, UpperHalf(P));
     }
-    FM_FUN_TSI ScaleWithFixedMax(rect2_base<t> A, t Scalar) -> rect2_base<t> {
-        return ScaleWithFixedMax(A, v2_base<t>(Scalar));
+    FM_FUN_SIC Store(vec4* Arr, v4x8 P) -> void {
+        Store(Arr, LowerHalf(P));
+        Store(Arr + 4, UpperHalf(P));
     }
-    FM_FUN_TSI ScaleWithFixedMax(rect2_base<t>* A, v2_base<t> ACurrentDim, v2_base<t> Scalar) -> void {
-        *A = ScaleWithFixedMax(*A, ACurrentDim, Scalar);	
+    FM_FUN_SIC StoreSoA(float* X, float* Y, float* Z, float* W, v4x8 P) -> void {
+        _mm256_storeu_ps(X, P.X);
+        _mm256_storeu_ps(Y, P.Y);
+        _mm256_storeu_ps(Z, P.Z);
+        _mm256_storeu_ps(W, P.W);
     }
-    FM_FUN_TSI ScaleWithFixedMax(rect2_base<t>* A, v2_base<t> Scalar) -> void {
-        *A = ScaleWithFixedMax(*A, Scalar);	
+#endif
+    
+    // v3x_base functions, shared by v3x4 and v3x8
+    template<uint32_t n> FM_INL auto FM_CALL operator+(v3x_base<n> A, v3x_base<n> B) -> v3x_base<n> {
+        A.X = priv::PacketAdd(A.X, B.X);
+        A.Y = priv::PacketAdd(A.Y, B.Y);
+        A.Z = priv::PacketAdd(A.Z, B.Z);
+        return A;
     }
-    FM_FUN_TSI ScaleWithFixedMax(rect2_base<t>* A, v2_base<t> ACurrentDim, t Scalar) -> void {
-        *A = ScaleWithFixedMax(*A, ACurrentDim, Scalar);	
+    template<uint32_t n> FM_INL auto FM_CALL operator-(v3x_base<n> A, v3x_base<n> B) -> v3x_base<n> {
+        A.X = priv::PacketSub(A.X, B.X);
+        A.Y = priv::PacketSub(A.Y, B.Y);
+        A.Z = priv::PacketSub(A.Z, B.Z);
+        return A;
     }
-    FM_FUN_TSI ScaleWithFixedMax(rect2_base<t>* A, t Scalar) -> void {
-        *A = ScaleWithFixedMax(*A, Scalar);	
+    template<uint32_t n> FM_INL auto FM_CALL operator+=(v3x_base<n>& A, v3x_base<n> B) -> v3x_base<n>& {
+        A = A + B;
+        return A;
     }
-    FM_FUN_TSI ScaleWithFixedCenter(rect2_base<t> A, v2_base<t> ACurrentDim, v2_base<t> Scalar) -> rect2_base<t> {
-        auto NewDim = HadamardMul(ACurrentDim, Scalar);
-        return SetDimWithFixedCenter(A, NewDim);
+    template<uint32_t n> FM_INL auto FM_CALL operator-=(v3x_base<n>& A, v3x_base<n> B) -> v3x_base<n>& {
+        A = A - B;
+        return A;
     }
-    FM_FUN_TSI ScaleWithFixedCenter(rect2_base<t> A, v2_base<t> Scalar) -> rect2_base<t> {
-        return ScaleWithFixedCenter(A, GetDim(A), Scalar);
+    template<uint32_t n> FM_INL auto FM_CALL HadamardMul(v3x_base<n> A, v3x_base<n> B) -> v3x_base<n> {
+        A.X = priv::PacketMul(A.X, B.X);
+        A.Y = priv::PacketMul(A.Y, B.Y);
+        A.Z = priv::PacketMul(A.Z, B.Z);
+        return A;
     }
-    FM_FUN_TSI ScaleWithFixedCenter(rect2_base<t> A, v2_base<t> ACurrentDim, t Scalar) -> rect2_base<t> {
-        return ScaleWithFixedCenter(A, ACurrentDim, v2_base<t>(Scalar));
+    template<uint32_t n> FM_INL auto FM_CALL HadamardDiv(v3x_base<n> A, v3x_base<n> B) -> v3x_base<n> {
+        A.X = priv::PacketDiv(A.X, B.X);
+        A.Y = priv::PacketDiv(A.Y, B.Y);
+        A.Z = priv::PacketDiv(A.Z, B.Z);
+        return A;
     }
-    FM_FUN_TSI ScaleWithFixedCenter(rect2_base<t> A, t Scalar) -> rect2_base<t> {
-        return ScaleWithFixedCenter(A, v2_base<t>(Scalar));
+    // NOTE: Packet times packet_float scales every vector by its own scalar
+    template<uint32_t n> FM_INL auto FM_CALL operator*(v3x_base<n> V, packet_float<n> Scalars) -> v3x_base<n> {
+        V.X = priv::PacketMul(V.X, Scalars);
+        V.Y = priv::PacketMul(V.Y, Scalars);
+        V.Z = priv::PacketMul(V.Z, Scalars);
+        return V;
     }
-    FM_FUN_TSI ScaleWithFixedCenter(rect2_base<t>* A, v2_base<t> ACurrentDim, v2_base<t> Scalar) -> void {
-        *A = ScaleWithFixedCenter(*A, ACurrentDim, Scalar);	
+    template<uint32_t n> FM_INL auto FM_CALL operator*(v3x_base<n> V, float Scalar) -> v3x_base<n> {
+        packet_float<n> S;
+        priv::PacketSplat(&S, Scalar);
+        return V * S;
     }
-    FM_FUN_TSI ScaleWithFixedCenter(rect2_base<t>* A, v2_base<t> Scalar) -> void {
-        *A = ScaleWithFixedCenter(*A, Scalar);	
+    template<uint32_t n> FM_INL auto FM_CALL operator*(float Scalar, v3x_base<n> V) -> v3x_base<n> {
+        return V * Scalar;
     }
-    FM_FUN_TSI ScaleWithFixedCenter(rect2_base<t>* A, v2_base<t> ACurrentDim, t Scalar) -> void {
-        *A = ScaleWithFixedCenter(*A, ACurrentDim, Scalar);
+    template<uint32_t n> FM_INL auto FM_CALL operator*=(v3x_base<n>& V, float Scalar) -> v3x_base<n>& {
+        V = V * Scalar;
+        return V;
     }
-    FM_FUN_TSI ScaleWithFixedCenter(rect2_base<t>* A, t Scalar) -> void {
-        *A = ScaleWithFixedCenter(*A, Scalar);	
+    template<uint32_t n> FM_INL auto FM_CALL operator/(v3x_base<n> V, packet_float<n> Scalars) -> v3x_base<n> {
+        V.X = priv::PacketDiv(V.X, Scalars);
+        V.Y = priv::PacketDiv(V.Y, Scalars);
+        V.Z = priv::PacketDiv(V.Z, Scalars);
+        return V;
     }
-    FM_FUN_TSI AddRadius(rect2_base<t> A, v2_base<t> Radius) -> rect2_base<t> {
-        A.Min -= Radius;
-        A.Max += Radius;
-        return A;
+    template<uint32_t n> FM_INL auto FM_CALL operator/(v3x_base<n> V, float Scalar) -> v3x_base<n> {
+        packet_float<n> S;
+        priv::PacketSplat(&S, Scalar);
+        return V / S;
     }
-    FM_FUN_TSI AddRadius(rect2_base<t> A, t Radius) -> rect2_base<t> {
-        return AddRadius(A, v2_base<t>(Radius));
+    template<uint32_t n> FM_INL auto FM_CALL operator/=(v3x_base<n>& V, float Scalar) -> v3x_base<n>& {
+        V = V / Scalar;
+        return V;
     }
-    FM_FUN_TSI AddRadius(rect2_base<t>* A, v2_base<t> Radius) -> void {
-        *A = AddRadius(*A, Radius);
+    template<uint32_t n> FM_INL auto FM_CALL operator-(v3x_base<n> V) -> v3x_base<n> {
+        packet_float<n> Zero;
+        priv::PacketSplat(&Zero, 0.f);
+        V.X = priv::PacketSub(Zero, V.X);
+        V.Y = priv::PacketSub(Zero, V.Y);
+        V.Z = priv::PacketSub(Zero, V.Z);
+        return V;
     }
-    FM_FUN_TSI AddRadius(rect2_base<t>* A, t Radius) -> void {
-        *A = AddRadius(*A, Radius);
+    template<uint32_t n> FM_INL auto FM_CALL SumOfElements(v3x_base<n> V) -> packet_float<n> {
+        return priv::PacketAdd(priv::PacketAdd(V.X, V.Y), V.Z);
     }
-    FM_FUN_TSI MoveRect(rect2_base<t> A, v2_base<t> Offset) -> rect2_base<t> {
-        rect2_base<t> R;
-        R.Min = A.Min + Offset;
-        R.Max = A.Max + Offset;
+    template<uint32_t n> FM_INL auto FM_CALL Dot(v3x_base<n> A, v3x_base<n> B) -> packet_float<n> {
+        return SumOfElements(HadamardMul(A, B));
+    }
+    template<uint32_t n> FM_INL auto FM_CALL Cross(v3x_base<n> A, v3x_base<n> B) -> v3x_base<n> {
+        v3x_base<n> R;
+        R.X = priv::PacketSub(priv::PacketMul(A.Y, B.Z), priv::PacketMul(A.Z, B.Y));
+        R.Y = priv::PacketSub(priv::PacketMul(A.Z, B.X), priv::PacketMul(A.X, B.Z));
+        R.Z = priv::PacketSub(priv::PacketMul(A.X, B.Y), priv::PacketMul(A.Y, B.X));
         return R;
     }
-    FM_FUN_TSI MoveRect(rect2_base<t>* A, v2_base<t> Offset) -> void {
-        A->Min += Offset;
-        A->Max += Offset;
+    template<uint32_t n> FM_INL auto FM_CALL Min(v3x_base<n> A, v3x_base<n> B) -> v3x_base<n> {
+        A.X = priv::PacketMin(A.X, B.X);
+        A.Y = priv::PacketMin(A.Y, B.Y);
+        A.Z = priv::PacketMin(A.Z, B.Z);
+        return A;
     }
-    FM_FUN_TSI MakeRectNotHaveNegativeDim(rect2_base<t> A) -> rect2_base<t> {
-        rect2_base<t> R;
-        R.Min = Min(A.Min, A.Max);
-        R.Max = Max(A.Min, A.Max);
-        return R;
+    template<uint32_t n> FM_INL auto FM_CALL Max(v3x_base<n> A, v3x_base<n> B) -> v3x_base<n> {
+        A.X = priv::PacketMax(A.X, B.X);
+        A.Y = priv::PacketMax(A.Y, B.Y);
+        A.Z = priv::PacketMax(A.Z, B.Z);
+        return A;
     }
-    FM_FUN_TSI MakeRectNotHaveNegativeDim(rect2_base<t>* A) -> void {
-        *A = MakeRectNotHaveNegativeDim(*A);
+    template<uint32_t n> FM_INL auto FM_CALL Abs(v3x_base<n> V) -> v3x_base<n> {
+        packet_float<n> SignMask;
+        priv::PacketSplat(&SignMask, -0.f);
+        V.X = priv::PacketAndNot(SignMask, V.X);
+        V.Y = priv::PacketAndNot(SignMask, V.Y);
+        V.Z = priv::PacketAndNot(SignMask, V.Z);
+        return V;
     }
-    FM_FUN_TSI MakeRectsNotHaveNegativeDim(rect2_base<t>* A, rect2_base<t>* B) -> void {
-        MakeRectNotHaveNegativeDim(A);
-        MakeRectNotHaveNegativeDim(B);
+    template<uint32_t n> FM_INL auto FM_CALL LengthSquared(v3x_base<n> V) -> packet_float<n> {
+        return Dot(V, V);
     }
-    FM_FUN_TSI HasNegativeDim(rect2_base<t> A) -> bool {
-        return A.Min.X > A.Max.X || A.Min.Y > A.Max.Y;
+    template<uint32_t n> FM_INL auto FM_CALL Length(v3x_base<n> V) -> packet_float<n> {
+        return priv::PacketSqrt(Dot(V, V));
     }
-    FM_FUN_TSI HasNegativeWidth(rect2_base<t> A) -> bool {
-        return A.Min.X > A.Max.X;
+    template<uint32_t n> FM_INL auto FM_CALL Normalize(v3x_base<n> V) -> v3x_base<n> {
+        return V / Length(V);
     }
-    FM_FUN_TSI HasNegativeHeight(rect2_base<t> A) -> bool {
-        return A.Min.Y > A.Max.Y;
+    template<uint32_t n> FM_INL auto Normalize(v3x_base<n>* V) -> void {
+        *V = *V / Length(*V);
     }
-    FM_FUN_TSI HasNegativeW(rect2_base<t> A) -> bool {
-        return HasNegativeWidth(A);
+    template<uint32_t n> FM_INL auto FM_CALL NormalizeFast(v3x_base<n> V) -> v3x_base<n> {
+        return V * priv::PacketReciprocalSqrt(Dot(V, V));
     }
-    FM_FUN_TSI HasNegativeH(rect2_base<t> A) -> bool {
-        return HasNegativeHeight(A);
+    template<uint32_t n> FM_INL auto FM_CALL Clamp(v3x_base<n> V, v3x_base<n> MinV, v3x_base<n> MaxV) -> v3x_base<n> {
+        return Min(Max(V, MinV), MaxV);
     }
-    FM_FUN_TSI Intersect(rect2_base<t> Rect, v2_base<t> Point) -> bool {
-        return Point.X > Rect.Min.X && Point.X < Rect.Max.X &&
-            Point.Y > Rect.Min.Y && Point.Y < Rect.Max.Y;
+    template<uint32_t n> FM_INL auto FM_CALL Lerp(v3x_base<n> A, v3x_base<n> B, packet_float<n> T) -> v3x_base<n> {
+        return A + (B-A)*T;
     }
-    FM_FUN_TSI IntersectOrTouch(rect2_base<t> Rect, v2_base<t> Point) -> bool {
-        return Point.X >= Rect.Min.X && Point.X <= Rect.Max.X &&
-            Point.Y >= Rect.Min.Y && Point.Y <= Rect.Max.Y;
+    template<uint32_t n> FM_INL auto FM_CALL Lerp(v3x_base<n> A, v3x_base<n> B, float T) -> v3x_base<n> {
+        return A + (B-A)*T;
     }
-    FM_FUN_TSI IntersectFlipAllowed(rect2_base<t> Rect, v2_base<t> Point) -> bool {
-        MakeRectNotHaveNegativeDim(&Rect);
-        return Intersect(Rect, Point);
+    template<uint32_t n> FM_INL auto FM_CALL EqualsMask(v3x_base<n> A, v3x_base<n> B) -> v3x_base<n> {
+        A.X = priv::PacketEquals(A.X, B.X);
+        A.Y = priv::PacketEquals(A.Y, B.Y);
+        A.Z = priv::PacketEquals(A.Z, B.Z);
+        return A;
     }
-    FM_FUN_TSI IntersectOrTouchFlipAllowed(rect2_base<t> Rect, v2_base<t> Point) -> bool {
-        MakeRectNotHaveNegativeDim(&Rect);
-        return IntersectOrTouch(Rect, Point);
+    template<uint32_t n> FM_INL auto FM_CALL GreaterMask(v3x_base<n> A, v3x_base<n> B) -> v3x_base<n> {
+        A.X = priv::PacketGreater(A.X, B.X);
+        A.Y = priv::PacketGreater(A.Y, B.Y);
+        A.Z = priv::PacketGreater(A.Z, B.Z);
+        return A;
     }
-    FM_FUN_TSI Intersect(rect2_base<t> A, rect2_base<t> B) -> bool {
-        return A.Max.X > B.Min.X && A.Min.X < B.Max.X &&
-            A.Max.Y > B.Min.Y && A.Min.Y < B.Max.Y;
+    template<uint32_t n> FM_INL auto FM_CALL GreaterOrEqualMask(v3x_base<n> A, v3x_base<n> B) -> v3x_base<n> {
+        A.X = priv::PacketGreaterOrEqual(A.X, B.X);
+        A.Y = priv::PacketGreaterOrEqual(A.Y, B.Y);
+        A.Z = priv::PacketGreaterOrEqual(A.Z, B.Z);
+        return A;
     }
-    FM_FUN_TSI IntersectOrTouch(rect2_base<t> A, rect2_base<t> B) -> bool {
-        return A.Max.X >= B.Min.X && A.Min.X <= B.Max.X &&
-            A.Max.Y >= B.Min.Y && A.Min.Y <= B.Max.Y;
+    template<uint32_t n> FM_INL auto FM_CALL LesserMask(v3x_base<n> A, v3x_base<n> B) -> v3x_base<n> {
+        A.X = priv::PacketLesser(A.X, B.X);
+        A.Y = priv::PacketLesser(A.Y, B.Y);
+        A.Z = priv::PacketLesser(A.Z, B.Z);
+        return A;
     }
-    FM_FUN_TSI FullyIntersect(rect2_base<t> A, rect2_base<t> B) -> bool {
-        return Intersect(A, B.Min) && Intersect(A, B.Max) &&
-            Intersect(A, GetMaxXMinY(B)) && Intersect(A, GetMinXMaxY(B));
+    template<uint32_t n> FM_INL auto FM_CALL LesserOrEqualMask(v3x_base<n> A, v3x_base<n> B) -> v3x_base<n> {
+        A.X = priv::PacketLesserOrEqual(A.X, B.X);
+        A.Y = priv::PacketLesserOrEqual(A.Y, B.Y);
+        A.Z = priv::PacketLesserOrEqual(A.Z, B.Z);
+        return A;
     }
-    FM_FUN_TSI FullyIntersectOrTouch(rect2_base<t> A, rect2_base<t> B) -> bool {
-        return IntersectOrTouch(A, B.Min) && IntersectOrTouch(A, B.Max) &&
-            IntersectOrTouch(A, GetMaxXMinY(B)) && IntersectOrTouch(A, GetMinXMaxY(B));
+    // NOTE: One lane mask per vector, set where all components of the vector mask are set
+    template<uint32_t n> FM_INL auto FM_CALL AllComponentsMask(v3x_base<n> Mask) -> packet_float<n> {
+        return priv::PacketAnd(priv::PacketAnd(Mask.X, Mask.Y), Mask.Z);
     }
-    FM_FUN_TSI IntersectFlipAllowed(rect2_base<t> A, rect2_base<t> B) -> bool {
-        MakeRectsNotHaveNegativeDim(&A, &B);
-        return Intersect(A, B);
+    // NOTE: Picks A where the lane mask is set and B elsewhere
+    template<uint32_t n> FM_INL auto FM_CALL Select(packet_float<n> Mask, v3x_base<n> A, v3x_base<n> B) -> v3x_base<n> {
+        A.X = priv::PacketOr(priv::PacketAnd(Mask, A.X), priv::PacketAndNot(Mask, B.X));
+        A.Y = priv::PacketOr(priv::PacketAnd(Mask, A.Y), priv::PacketAndNot(Mask, B.Y));
+        A.Z = priv::PacketOr(priv::PacketAnd(Mask, A.Z), priv::PacketAndNot(Mask, B.Z));
+        return A;
     }
-    FM_FUN_TSI IntersectOrTouchFlipAllowed(rect2_base<t> A, rect2_base<t> B) -> bool {
-        MakeRectsNotHaveNegativeDim(&A, &B);
-        return IntersectOrTouch(A, B);
+    template<uint32_t n> FM_INL auto FM_CALL operator==(v3x_base<n> A, v3x_base<n> B) -> bool {
+        return priv::PacketAllSet(AllComponentsMask(EqualsMask(A, B)));
     }
-    FM_FUN_TSI FullyIntersectFlipAllowed(rect2_base<t> A, rect2_base<t> B) -> bool {
-        MakeRectsNotHaveNegativeDim(&A, &B);
-        return FullyIntersect(A, B);
+    template<uint32_t n> FM_INL auto FM_CALL operator!=(v3x_base<n> A, v3x_base<n> B) -> bool {
+        return !(A == B);
     }
-    FM_FUN_TSI FullyIntersectOrTouchFlipAllowed(rect2_base<t> A, rect2_base<t> B) -> bool {
-        MakeRectsNotHaveNegativeDim(&A, &B);
-        return FullyIntersect(A, B);
+    
+    // v4x_base functions, shared by v4x4 and v4x8
+    template<uint32_t n> FM_INL auto FM_CALL operator+(v4x_base<n> A, v4x_base<n> B) -> v4x_base<n> {
+        A.X = priv::PacketAdd(A.X, B.X);
+        A.Y = priv::PacketAdd(A.Y, B.Y);
+        A.Z = priv::PacketAdd(A.Z, B.Z);
+        A.W = priv::PacketAdd(A.W, B.W);
+        return A;
     }
-    FM_FUN_TSI IntersectionRect(rect2_base<t> A, rect2_base<t> B, rect2_base<t>* Intersection) -> bool {
-        auto RMin = Max(A.Min, B.Min);
-        auto RMax = Min(A.Max, B.Max);
-        if(RMin.X < RMax.X && RMin.Y < RMax.Y)
-        {
-            *Intersection = Rect2BaseMinMax<t>(RMin, RMax);
-            return true;
-        }
-        else
-        {
-            return false;
-        }
+    template<uint32_t n> FM_INL auto FM_CALL operator-(v4x_base<n> A, v4x_base<n> B) -> v4x_base<n> {
+        A.X = priv::PacketSub(A.X, B.X);
+        A.Y = priv::PacketSub(A.Y, B.Y);
+        A.Z = priv::PacketSub(A.Z, B.Z);
+        A.W = priv::PacketSub(A.W, B.W);
+        return A;
     }
-    FM_FUN_TSI IntersectionRectFlipAllowed(rect2_base<t> A, rect2_base<t> B, rect2_base<t>* Intersection) -> bool {
-        MakeRectNotHaveNegativeDim(&A, &B);
-        return IntersectionRect(A, B, Intersection);
+    template<uint32_t n> FM_INL auto FM_CALL operator+=(v4x_base<n>& A, v4x_base<n> B) -> v4x_base<n>& {
+        A = A + B;
+        return A;
     }
-    FM_FUN_TSI Union(rect2_base<t> A, rect2_base<t> B) -> rect2_base<t> {
-        rect2_base<t> R;
-        R.Min = Min(A.Min, B.Min);
-        R.Max = Max(A.Max, B.Max);
-        return R;
+    template<uint32_t n> FM_INL auto FM_CALL operator-=(v4x_base<n>& A, v4x_base<n> B) -> v4x_base<n>& {
+        A = A - B;
+        return A;
     }
-    FM_FUN_TSI Union(rect2_base<t>* A, rect2_base<t> B) -> void {
-        *A = Union(*A, B);
+    template<uint32_t n> FM_INL auto FM_CALL HadamardMul(v4x_base<n> A, v4x_base<n> B) -> v4x_base<n> {
+        A.X = priv::PacketMul(A.X, B.X);
+        A.Y = priv::PacketMul(A.Y, B.Y);
+        A.Z = priv::PacketMul(A.Z, B.Z);
+        A.W = priv::PacketMul(A.W, B.W);
+        return A;
     }
-    FM_FUN_TSI Union(rect2_base<t> A, v2_base<t> P) -> rect2_base<t> {
-        rect2_base<t> R;
-        R.Min = Min(A.Min, P);
-        R.Max = Max(A.Max, P);
-        return R;
+    template<uint32_t n> FM_INL auto FM_CALL HadamardDiv(v4x_base<n> A, v4x_base<n> B) -> v4x_base<n> {
+        A.X = priv::PacketDiv(A.X, B.X);
+        A.Y = priv::PacketDiv(A.Y, B.Y);
+        A.Z = priv::PacketDiv(A.Z, B.Z);
+        A.W = priv::PacketDiv(A.W, B.W);
+        return A;
     }
-    FM_FUN_TSI Union(rect2_base<t>* A, v2_base<t> B) -> void {
-        *A = Union(*A, B);
+    template<uint32_t n> FM_INL auto FM_CALL operator*(v4x_base<n> V, packet_float<n> Scalars) -> v4x_base<n> {
+        V.X = priv::PacketMul(V.X, Scalars);
+        V.Y = priv::PacketMul(V.Y, Scalars);
+        V.Z = priv::PacketMul(V.Z, Scalars);
+        V.W = priv::PacketMul(V.W, Scalars);
+        return V;
     }
-    FM_FUN_TSI ClampToRect(v2_base<t> V, rect2_base<t> Rect) -> v2_base<t> {
-        FM_ASSERT(!HasNegativeDim(Rect));
-        if(V.X < Rect.Min.X)	
-            V.X = Rect.Min.X;
-        else if(V.X > Rect.Max.X)
-            V.X = Rect.Max.X;
-        if(V.Y < Rect.Min.Y)
-            V.Y = Rect.Min.Y;
-        else if(V.Y > Rect.Max.Y)
-            V.Y = Rect.Max.Y;
+    template<uint32_t n> FM_INL auto FM_CALL operator*(v4x_base<n> V, float Scalar) -> v4x_base<n> {
+        packet_float<n> S;
+        priv::PacketSplat(&S, Scalar);
+        return V * S;
+    }
+    template<uint32_t n> FM_INL auto FM_CALL operator*(float Scalar, v4x_base<n> V) -> v4x_base<n> {
+        return V * Scalar;
+    }
+    template<uint32_t n> FM_INL auto FM_CALL operator*=(v4x_base<n>& V, float Scalar) -> v4x_base<n>& {
+        V = V * Scalar;
         return V;
     }
-    FM_FUN_TSI ClampToRectFlipAllowed(v2_base<t> V, rect2_base<t> Rect) {
-        Rect = MakeRectNotHaveNegativeDim(Rect);
-        ClampToRect(V, Rect);
+    template<uint32_t n> FM_INL auto FM_CALL operator/(v4x_base<n> V, packet_float<n> Scalars) -> v4x_base<n> {
+        V.X = priv::PacketDiv(V.X, Scalars);
+        V.Y = priv::PacketDiv(V.Y, Scalars);
+        V.Z = priv::PacketDiv(V.Z, Scalars);
+        V.W = priv::PacketDiv(V.W, Scalars);
+        return V;
     }
-    FM_FUN_TSI ClampToRect(v2_base<t>* V, rect2_base<t> Rect) {
-        *V = ClampToRect(*V, Rect);
+    template<uint32_t n> FM_INL auto FM_CALL operator/(v4x_base<n> V, float Scalar) -> v4x_base<n> {
+        packet_float<n> S;
+        priv::PacketSplat(&S, Scalar);
+        return V / S;
     }
-    FM_FUN_TSI ClampToRectFlipAllowed(v2_base<t>* V, rect2_base<t> Rect) {
-        *V = ClampToRectFlipAllowed(*V, Rect);
+    template<uint32_t n> FM_INL auto FM_CALL operator/=(v4x_base<n>& V, float Scalar) -> v4x_base<n>& {
+        V = V / Scalar;
+        return V;
     }
-    FM_FUN_TSI FitRectInsideBounds(rect2_base<t> Rect, rect2_base<t> Bounds) -> rect2 {
-        auto RectDim = GetDim(Rect);
-        if(Rect.Min.X < Bounds.Min.X)
-        {
-            Rect.Min.X = Bounds.Min.X;
-            Rect.Max.X = Bounds.Min.X + RectDim.W;
-        }
-        if(Rect.Min.Y < Bounds.Min.Y)
-        {
-            Rect.Min.Y = Bounds.Min.Y;
-            Rect.Max.Y = Bounds.Min.Y + RectDim.H;
-        }
-        if(Rect.Max.X > Bounds.Max.X)
-        {
-            Rect.Min.X = Bounds.Max.X - RectDim.W;
-            Rect.Max.X = Bounds.Max.X;
-        }
-        if(Rect.Max.Y > Bounds.Max.Y)
-        {
-            Rect.Min.Y = Bounds.Max.Y - RectDim.H;
-            Rect.Max.Y = Bounds.Max.Y;
-        }
-        return Rect;
+    template<uint32_t n> FM_INL auto FM_CALL operator-(v4x_base<n> V) -> v4x_base<n> {
+        packet_float<n> Zero;
+        priv::PacketSplat(&Zero, 0.f);
+        V.X = priv::PacketSub(Zero, V.X);
+        V.Y = priv::PacketSub(Zero, V.Y);
+        V.Z = priv::PacketSub(Zero, V.Z);
+        V.W = priv::PacketSub(Zero, V.W);
+        return V;
     }
-    FM_FUN_TSI FitRectInsideBounds(rect2_base<t>* Rect, rect2_base<t> Bounds) -> void {
-        *Rect = FitRectInsideBounds(*Rect, Bounds);
+    template<uint32_t n> FM_INL auto FM_CALL SumOfElements(v4x_base<n> V) -> packet_float<n> {
+        return priv::PacketAdd(priv::PacketAdd(V.X, V.Y), priv::PacketAdd(V.Z, V.W));
     }
-    FM_FUN_TSI GetWidthHeightRatio(rect2_base<t> Rect) -> t {
-        auto RectDim = GetDim(Rect);
-        return SafeDivN(RectDim.W, RectDim.H, InvalidF32);
+    template<uint32_t n> FM_INL auto FM_CALL Dot(v4x_base<n> A, v4x_base<n> B) -> packet_float<n> {
+        return SumOfElements(HadamardMul(A, B));
     }
-    FM_FUN_TSI GetHeightWidthRatio(rect2_base<t> Rect) -> t {
-        auto RectDim = GetDim(Rect);
-        return SafeDivN(RectDim.H, RectDim.W, InvalidF32);
+    template<uint32_t n> FM_INL auto FM_CALL Min(v4x_base<n> A, v4x_base<n> B) -> v4x_base<n> {
+        A.X = priv::PacketMin(A.X, B.X);
+        A.Y = priv::PacketMin(A.Y, B.Y);
+        A.Z = priv::PacketMin(A.Z, B.Z);
+        A.W = priv::PacketMin(A.W, B.W);
+        return A;
     }
-    FM_FUN_TSI ExpandToDesiredWidthHeightRatioWithFixedCenter(rect2_base<t> A, t DesiredWidthHeightRatio) -> rect2_base<t> {
-        t WidthHeightRatio = GetWidthHeightRatio(A);
-        FM_ASSERT(IsValid(WidthHeightRatio));
-        t Factor = DesiredWidthHeightRatio / WidthHeightRatio;
-        if(Factor > 1)
-            ScaleWithFixedCenter(&A, v2_base<t>(Factor, 1));
-        else
-            ScaleWithFixedCenter(&A, v2_base<t>(1, 1 / Factor));
+    template<uint32_t n> FM_INL auto FM_CALL Max(v4x_base<n> A, v4x_base<n> B) -> v4x_base<n> {
+        A.X = priv::PacketMax(A.X, B.X);
+        A.Y = priv::PacketMax(A.Y, B.Y);
+        A.Z = priv::PacketMax(A.Z, B.Z);
+        A.W = priv::PacketMax(A.W, B.W);
         return A;
     }
-    FM_FUN_TSI ExpandToDesiredWidthHeightRatioWithFixedCenter(rect2_base<t>* A, t DesiredWidthHeightRatio) -> void {
-        *A = ExpandToDesiredWidthHeightRatioWithFixedCenter(*A, DesiredWidthHeightRatio);
+    template<uint32_t n> FM_INL auto FM_CALL Abs(v4x_base<n> V) -> v4x_base<n> {
+        packet_float<n> SignMask;
+        priv::PacketSplat(&SignMask, -0.f);
+        V.X = priv::PacketAndNot(SignMask, V.X);
+        V.Y = priv::PacketAndNot(SignMask, V.Y);
+        V.Z = priv::PacketAndNot(SignMask, V.Z);
+        V.W = priv::PacketAndNot(SignMask, V.W);
+        return V;
     }
-    FM_FUN_TSI operator==(rect2_base<t> A, rect2_base<t> B) -> bool {
-        return A.Min == B.Min && A.Max == B.Max;
+    template<uint32_t n> FM_INL auto FM_CALL LengthSquared(v4x_base<n> V) -> packet_float<n> {
+        return Dot(V, V);
     }
-    FM_FUN_TSI operator!=(rect2_base<t> A, rect2_base<t> B) -> bool {
-        return !(A == B);
+    template<uint32_t n> FM_INL auto FM_CALL Length(v4x_base<n> V) -> packet_float<n> {
+        return priv::PacketSqrt(Dot(V, V));
     }
-    FM_FUN_TSI Equal(rect2_base<t> A, rect2_base<t> B, t Epsilon = constants<t>::Epsilon()) -> bool {
-        return Equal(A.Min, B.Min) && Equal(A.Max, B.Max);
+    template<uint32_t n> FM_INL auto FM_CALL Normalize(v4x_base<n> V) -> v4x_base<n> {
+        return V / Length(V);
     }
-    FM_FUN_TSI Lerp(rect2_base<t> Source, rect2_base<t> Dest, float T) -> rect2_base<t> {
-        rect2_base<t> R;
-        R.Min = Lerp((v2)Source.Min, (v2)Dest.Min, T);
-        R.Max = Lerp((v2)Source.Max, (v2)Dest.Max, T);
-        return (rect2_base<t>)(R);
+    template<uint32_t n> FM_INL auto Normalize(v4x_base<n>* V) -> void {
+        *V = *V / Length(*V);
     }
-    FM_FUN_TSI FastLerp(rect2_base<t> Source, rect2_base<t> Dest, float T) -> rect2_base<t> {
-        rect2_base<t> R;
-        R.Min = (v2_base<t>)FastLerp((v2)Source.Min, (v2)Dest.Min, T);
-        R.Max = (v2_base<t>)FastLerp((v2)Source.Max, (v2)Dest.Max, T);
-        return R;
+    template<uint32_t n> FM_INL auto FM_CALL NormalizeFast(v4x_base<n> V) -> v4x_base<n> {
+        return V * priv::PacketReciprocalSqrt(Dot(V, V));
     }
-	
-#define FM_RECT2_MIN_MAX(InsideName, T) \
-FM_FUN_SI Rect2##InsideName##MinMax(T Left, T Top, T Right, T Bottom) -> rect2_base<T>\
-{ return Rect2BaseMinMax<T>(Left, Top, Right, Bottom); }
-    FM_GENERIC_FUNCTION(FM_RECT2_MIN_MAX);
-	
-#define FM_RECT2_MIN_MAX_2(InsideName, T) \
-FM_FUN_SI Rect2##InsideName##MinMax(v2_base<T> Min, v2_base<T> Max) -> rect2_base<T>\
-{ return Rect2BaseMinMax<T>(Min, Max); }
-    FM_GENERIC_FUNCTION(FM_RECT2_MIN_MAX_2);
-	
-#define FM_RECT2_MIN_DIM(InsideName, T) \
-FM_FUN_SI Rect2##InsideName##MinDim(T Left, T Top, T Width, T Height) -> rect2_base<T>\
-{ return Rect2BaseMinDim<T>(Left, Top, Width, Height); }
-    FM_GENERIC_FUNCTION(FM_RECT2_MIN_DIM);
-	
-#define FM_RECT2_MIN_DIM_2(InsideName, T) \
-FM_FUN_SI Rect2##InsideName##MinDim(v2_base<T> Min, v2_base<T> Dim) -> rect2_base<T>\
-{ return Rect2BaseMinDim<T>(Min, Dim); }
-    FM_GENERIC_FUNCTION(FM_RECT2_MIN_DIM_2);
-	
-#define FM_RECT2_DIM_MAX(InsideName, T) \
-FM_FUN_SI Rect2##InsideName##DimMax(T Width, T Height, T MaxX, T MaxY) -> rect2_base<T>\
-{ return Rect2BaseDimMax<T>(Width, Height, MaxX, MaxY); }
-    FM_GENERIC_FUNCTION(FM_RECT2_DIM_MAX);
-	
-#define FM_RECT2_DIM_MAX_2(InsideName, T) \
-FM_FUN_SI Rect2##InsideName##DimMax(v2_base<T> Dim, v2_base<T> Max) -> rect2_base<T>\
-{ return Rect2BaseDimMax<T>(Dim, Max); }
-    FM_GENERIC_FUNCTION(FM_RECT2_DIM_MAX_2);
-	
-#define FM_RECT2_CENTER_RADIUS(InsideName, T) \
-FM_FUN_SI Rect2##InsideName##CenterRadius(v2_base<T> Center, T Radius) -> rect2_base<T>\
-{ return Rect2BaseCenterRadius<T>(Center, Radius); }
-    FM_GENERIC_FUNCTION(FM_RECT2_CENTER_RADIUS);
-	
-#define FM_RECT2_CENTER_RADIUS_2(InsideName, T) \
-FM_FUN_SI Rect2##InsideName##CenterRadius(v2_base<T> Center, v2_base<T> Radius) -> rect2_base<T>\
-{ return Rect2BaseCenterRadius<T>(Center, Radius); }
-    FM_GENERIC_FUNCTION(FM_RECT2_CENTER_RADIUS_2);
-	
-#define FM_RECT2_CENTER_DIM(InsideName, T) \
-FM_FUN_SI Rect2##InsideName##CenterDim(v2_base<T> Center, T Dim) -> rect2_base<T>\
-{ return Rect2BaseCenterDim<T>(Center, Dim); }
-    FM_GENERIC_FUNCTION(FM_RECT2_CENTER_DIM);
-	
-#define FM_RECT2_CENTER_DIM_2(InsideName, T) \
-FM_FUN_SI Rect2##InsideName##CenterDim(v2_base<T> Center, v2_base<T> Dim) -> rect2_base<T>\
-{ return Rect2BaseCenterDim<T>(Center, Dim); }
-    FM_GENERIC_FUNCTION(FM_RECT2_CENTER_DIM_2);
-	
-#define FM_RECT2_DIM(InsideName, T) \
-FM_FUN_SI Rect2##InsideName##Dim(v2_base<T> Dim) -> rect2_base<T>\
-{ return Rect2BaseDim<T>(Dim); }
-    FM_GENERIC_FUNCTION(FM_RECT2_DIM);
-	
-#define FM_RECT2_DIM_2(InsideName, T) \
-FM_FUN_SI Rect2##InsideName##Dim(T Width, T Height) -> rect2_base<T>\
-{ return Rect2BaseDim<T>(Width, Height); }
-    FM_GENERIC_FUNCTION(FM_RECT2_DIM_2);
-	
-#define FM_Rect2ToMinMax(_Rect, _Min, _Max) \
-auto _Min = (_Rect).Min; \
-auto _Max = (_Rect).Max
-	
-#define FM_Rect2ToMinDim(_Rect, _Min, _Dim) \
-auto _Min = (_Rect).Min; \
-auto _Dim = GetDim(_Rect);
-    
-    //////////////////////////////////
-    // pointer versions of funcions // 
-    //////////////////////////////////
-    FM_FUN_TSI HadamardMul(t* A, t B) -> void {
-        *A = HadamardMul(*A, B);
+    template<uint32_t n> FM_INL auto FM_CALL Clamp(v4x_base<n> V, v4x_base<n> MinV, v4x_base<n> MaxV) -> v4x_base<n> {
+        return Min(Max(V, MinV), MaxV);
     }
-    FM_FUN_TSI SafeHadamardDivN(t* A, t B, t N) -> void {
-        *A = SafeHadamardDivN(*A, B, N);
+    template<uint32_t n> FM_INL auto FM_CALL Lerp(v4x_base<n> A, v4x_base<n> B, packet_float<n> T) -> v4x_base<n> {
+        return A + (B-A)*T;
     }
-    FM_FUN_TSI SafeHadamardDiv1(t* A, t B) -> void {
-        return SafeHadamardDivN<t>(*A, B, t((t)1));
+    template<uint32_t n> FM_INL auto FM_CALL Lerp(v4x_base<n> A, v4x_base<n> B, float T) -> v4x_base<n> {
+        return A + (B-A)*T;
     }
-    FM_FUN_TSI SafeHadamardDiv0(t* A, t B) -> void {
-        return SafeHadamardDivN<t>(*A, B, t((t)0));
+    template<uint32_t n> FM_INL auto FM_CALL EqualsMask(v4x_base<n> A, v4x_base<n> B) -> v4x_base<n> {
+        A.X = priv::PacketEquals(A.X, B.X);
+        A.Y = priv::PacketEquals(A.Y, B.Y);
+        A.Z = priv::PacketEquals(A.Z, B.Z);
+        A.W = priv::PacketEquals(A.W, B.W);
+        return A;
     }
-    
-    ////////////////////////
-    // geometric funcions // 
-    ////////////////////////
-    FM_FUN_SI RayIntersectsCircle(v2 RayPos, v2 RayDir, v2 CircleCenter, float CircleRadius) -> bool {
-        v2 RayToCircleCenterDirection = Normalize(CircleCenter - RayPos);
-        float RayStepsToGetToClosestPointFromCircleCenterOnRayLine = Dot(CircleCenter - RayPos, RayToCircleCenterDirection);
-        v2 ClosestPointFromCircleCenterOnRayLine = RayPos + RayDir * RayStepsToGetToClosestPointFromCircleCenterOnRayLine;
-        return GetDistanceBetween(CircleCenter, ClosestPointFromCircleCenterOnRayLine) <= CircleRadius;
+    template<uint32_t n> FM_INL auto FM_CALL GreaterMask(v4x_base<n> A, v4x_base<n> B) -> v4x_base<n> {
+        A.X = priv::PacketGreater(A.X, B.X);
+        A.Y = priv::PacketGreater(A.Y, B.Y);
+        A.Z = priv::PacketGreater(A.Z, B.Z);
+        A.W = priv::PacketGreater(A.W, B.W);
+        return A;
     }
-    
-    ///////////////////////////////////////////
-    // headers of not inlined mat4 functions //
-    ///////////////////////////////////////////
-    FM_FUN_C operator*(mat4 A, mat4 B) -> mat4; 
-    FM_FUN Mat4Orthographic(float Left, float Right, float Bottom, float Top, float Near = 0, float Far = 1) -> mat4;
-    FM_FUN Mat4Perspective(float FOV, float AspectRatio, float near, float Far) -> mat4;
-    FM_FUN Mat4LookAt(vec3 Eye, vec3 At, vec3 Up = Vec3(0.f, 1.f, 0.f)) -> mat4;
-    FM_FUN Mat4LookAt(v3 Eye, v3 At, v3 Up = {0.f, 1.f, 0.f}) -> mat4;
-    
-    ////////////////////
-    // mat4 functions //
-    ////////////////////
-    FM_FUN_I mat4::operator[](uint32_t Index) -> float& {
-        FM_ASSERT(Index >= 0 && Index <= 15);
-        return *((float*)(Columns) + Index);
+    template<uint32_t n> FM_INL auto FM_CALL GreaterOrEqualMask(v4x_base<n> A, v4x_base<n> B) -> v4x_base<n> {
+        A.X = priv::PacketGreaterOrEqual(A.X, B.X);
+        A.Y = priv::PacketGreaterOrEqual(A.Y, B.Y);
+        A.Z = priv::PacketGreaterOrEqual(A.Z, B.Z);
+        A.W = priv::PacketGreaterOrEqual(A.W, B.W);
+        return A;
     }
-    FM_FUN_IC mat4::GetColumnVec4(uint32_t Index) -> vec4 {
-        FM_ASSERT(Index >= 0 && Index <= 3);
-        return Vec4(Columns[Index]);
+    template<uint32_t n> FM_INL auto FM_CALL LesserMask(v4x_base<n> A, v4x_base<n> B) -> v4x_base<n> {
+        A.X = priv::PacketLesser(A.X, B.X);
+        A.Y = priv::PacketLesser(A.Y, B.Y);
+        A.Z = priv::PacketLesser(A.Z, B.Z);
+        A.W = priv::PacketLesser(A.W, B.W);
+        return A;
     }
-    FM_FUN_IC mat4::GetColumnV4(uint32_t Index) -> v4 {
-        return CastToV4(GetColumnVec4(Index));
+    template<uint32_t n> FM_INL auto FM_CALL LesserOrEqualMask(v4x_base<n> A, v4x_base<n> B) -> v4x_base<n> {
+        A.X = priv::PacketLesserOrEqual(A.X, B.X);
+        A.Y = priv::PacketLesserOrEqual(A.Y, B.Y);
+        A.Z = priv::PacketLesserOrEqual(A.Z, B.Z);
+        A.W = priv::PacketLesserOrEqual(A.W, B.W);
+        return A;
     }
-    FM_FUN_IC mat4::SetColumn(uint32_t Index, vec4 Col) -> void {
-        FM_ASSERT(Index >= 0 && Index <= 3);
-        Columns[Index] = Col.M;
+    template<uint32_t n> FM_INL auto FM_CALL AllComponentsMask(v4x_base<n> Mask) -> packet_float<n> {
+        return priv::PacketAnd(priv::PacketAnd(Mask.X, Mask.Y), priv::PacketAnd(Mask.Z, Mask.W));
     }
-    FM_FUN_IC mat4::SetColumn(uint32_t Index, v4 Col) -> void {
-        SetColumn(Index, CastToVec4(Col));
+    template<uint32_t n> FM_INL auto FM_CALL Select(packet_float<n> Mask, v4x_base<n> A, v4x_base<n> B) -> v4x_base<n> {
+        A.X = priv::PacketOr(priv::PacketAnd(Mask, A.X), priv::PacketAndNot(Mask, B.X));
+        A.Y = priv::PacketOr(priv::PacketAnd(Mask, A.Y), priv::PacketAndNot(Mask, B.Y));
+        A.Z = priv::PacketOr(priv::PacketAnd(Mask, A.Z), priv::PacketAndNot(Mask, B.Z));
+        A.W = priv::PacketOr(priv::PacketAnd(Mask, A.W), priv::PacketAndNot(Mask, B.W));
+        return A;
     }
-    FM_FUN_IC mat4::SetColumn(uint32_t Index, float X, float Y, float Z, float W) -> void {
-        FM_ASSERT(Index >= 0 && Index <= 3);
-        Columns[Index] = _mm_set_ps(W, Z, Y, X);
+    template<uint32_t n> FM_INL auto FM_CALL operator==(v4x_base<n> A, v4x_base<n> B) -> bool {
+        return priv::PacketAllSet(AllComponentsMask(EqualsMask(A, B)));
     }
-    FM_FUN_IC mat4::SwapColumns(uint32_t Col1Index, uint32_t Col2Index) -> void {
-        FM_ASSERT(Col1Index >= 0 && Col1Index <= 3 && Col1Index >= 0 && Col1Index <= 3);
-        __m128 Temp = Columns[Col1Index];
-        Columns[Col1Index] = Columns[Col2Index];
-        Columns[Col2Index] = Temp;
+    template<uint32_t n> FM_INL auto FM_CALL operator!=(v4x_base<n> A, v4x_base<n> B) -> bool {
+        return !(A == B);
     }
-    FM_FUN_IC mat4::GetRowVec4(uint32_t Index) -> vec4 {
-        return CastToVec4(GetRowV4(Index));
+
+    //////////////////////////////////
+    // aligned containers functions //
+    //////////////////////////////////
+    // NOTE: A failed allocation leaves the array empty
+    namespace priv {
+        FM_SINL auto AlignedAllocZeroed(size_t Bytes) -> void* {
+            if(Bytes == 0)
+                return nullptr;
+            void* Mem = FM_ALIGNED_ALLOC(Bytes, 64);
+            if(Mem)
+                memset(Mem, 0, Bytes);
+            return Mem;
+        }
+        FM_SINL auto RoundUpToCacheLine(size_t Bytes) -> size_t {
+            return (Bytes + 63) & ~(size_t)63;
+        }
+        // NOTE: Returns 0 when the rounded size does not fit in size_t
+        FM_SINL auto CacheLineArrayBytes(size_t Count, size_t ElementSize) -> size_t {
+            if(Count > ((size_t)-1 - 63) / ElementSize)
+                return 0;
+            return RoundUpToCacheLine(Count * ElementSize);
+        }
     }
-    FM_FUN_IC mat4::SetRow(uint32_t Index, float X, float Y, float Z, float W) -> void {
-        SetRow(Index, v4(X, Y, Z, W));
+    
+    template<class t> aligned_array<t>::aligned_array(size_t Count)
+        :Count(Count), Capacity(priv::CacheLineArrayBytes(Count, sizeof(t)) / sizeof(t)) {
+        static_assert(std::is_trivially_copyable_v<t>);
+        Data = (t*)priv::AlignedAllocZeroed(priv::CacheLineArrayBytes(Count, sizeof(t)));
+        if(!Data)
+            this->Count = Capacity = 0;
+    }
+    template<class t> aligned_array<t>::aligned_array(aligned_array&& Other) noexcept
+        :Data(Other.Data), Count(Other.Count), Capacity(Other.Capacity) {
+        Other.Data = nullptr;
+        Other.Count = Other.Capacity = 0;
+    }
+    template<class t> aligned_array<t>::~aligned_array() {
+        if(Data)
+            FM_ALIGNED_FREE(Data);
+    }
+    FM_FUN_TI aligned_array<t>::operator=(aligned_array&& Other) noexcept -> aligned_array& {
+        if(this != &Other)
+        {
+            if(Data)
+                FM_ALIGNED_FREE(Data);
+            Data = Other.Data;
+            Count = Other.Count;
+            Capacity = Other.Capacity;
+            Other.Data = nullptr;
+            Other.Count = Other.Capacity = 0;
+        }
+        return *this;
     }
-    FM_FUN_IC mat4::SetRow(uint32_t Index, vec4 V) -> void {
-        SetRow(Index, CastToV4(V));
+    FM_FUN_TI aligned_array<t>::operator[](size_t Index) -> t& {
+        FM_ASSERT(Index < Count);
+        return Data[Index];
     }
-    FM_FUN_IC mat4::SwapRows(uint32_t Row1Index, uint32_t Row2Index) -> void {
-        FM_ASSERT(Row1Index >= 0 && Row2Index <= 3 && Row1Index >= 0 && Row2Index <= 3);
-        v4 Row1 = GetRowV4(Row1Index);
-        v4 Row2 = GetRowV4(Row2Index);
-        SetRow(Row2Index, Row1);
-        SetRow(Row1Index, Row2);
+    template<class t> template<uint32_t n> FM_INL auto aligned_array<t>::PacketCount() const -> size_t {
+        return (Count + n - 1) / n;
     }
-    FM_FUN_IC mat4::GetMainDiagonalV4() -> v4 {
-        v4 R;
-        R.X = priv::GetX(Columns[0]);
-        R.Y = priv::GetY(Columns[1]);
-        R.Z = priv::GetZ(Columns[2]);
-        R.W = priv::GetW(Columns[3]);
-        return R;
+    template<class t> template<uint32_t n> FM_INL auto aligned_array<t>::Packet(size_t Index) -> packet_float<n>& {
+        static_assert(std::is_same_v<t, float>);
+        return ((packet_float<n>*)Data)[Index];
     }
-    FM_FUN_IC mat4::GetMainDiagonalVec4() -> vec4 {
-        return CastToVec4(GetMainDiagonalV4());
+    template<class t> template<uint32_t n, class f> FM_INL auto aligned_array<t>::ForEachPacket(f Function) -> void {
+        size_t Packets = PacketCount<n>();
+        for(size_t i = 0; i < Packets; ++i)
+            Function(Packet<n>(i));
     }
-    FM_FUN_IC mat4::SetMainDiagonal(float X, float Y, float Z, float W) -> void {
-        Columns[0] = priv::SetX(Columns[0], X);
-        Columns[1] = priv::SetY(Columns[1], Y);
-        Columns[2] = priv::SetZ(Columns[2], Z);
-        Columns[3] = priv::SetW(Columns[3], W);
+    
+    template<class t> soa_array<t>::soa_array(size_t Count)
+        :Count(Count), Capacity(priv::CacheLineArrayBytes(Count, sizeof(float)) / sizeof(float)) {
+        static_assert(std::is_same_v<t, v2> || std::is_same_v<t, v3> || std::is_same_v<t, v4>);
+        if(Capacity > (size_t)-1 / (Components * sizeof(float)))
+            Capacity = 0;
+        Data = (float*)priv::AlignedAllocZeroed(Components * Capacity * sizeof(float));
+        if(!Data)
+            this->Count = Capacity = 0;
+    }
+    template<class t> soa_array<t>::soa_array(soa_array&& Other) noexcept
+        :Data(Other.Data), Count(Other.Count), Capacity(Other.Capacity) {
+        Other.Data = nullptr;
+        Other.Count = Other.Capacity = 0;
+    }
+    template<class t> soa_array<t>::~soa_array() {
+        if(Data)
+            FM_ALIGNED_FREE(Data);
+    }
+    FM_FUN_TI soa_array<t>::operator=(soa_array&& Other) noexcept -> soa_array& {
+        if(this != &Other)
+        {
+            if(Data)
+                FM_ALIGNED_FREE(Data);
+            Data = Other.Data;
+            Count = Other.Count;
+            Capacity = Other.Capacity;
+            Other.Data = nullptr;
+            Other.Count = Other.Capacity = 0;
+        }
+        return *this;
     }
-    FM_FUN_IC mat4::SetMainDiagonal(v4 V) -> void {
-        SetMainDiagonal(V.X, V.Y, V.Z, V.W);
+    FM_FUN_TI soa_array<t>::Get(size_t Index) const -> t {
+        FM_ASSERT(Index < Count);
+        t R;
+        for(uint32_t c = 0; c < Components; ++c)
+            R.Elements[c] = Data[c * Capacity + Index];
+        return R;
     }
-    FM_FUN_IC mat4::SetMainDiagonal(vec4 V) -> void {
-        SetMainDiagonal(CastToV4(V));
+    FM_FUN_TI soa_array<t>::Set(size_t Index, t V) -> void {
+        FM_ASSERT(Index < Count);
+        for(uint32_t c = 0; c < Components; ++c)
+            Data[c * Capacity + Index] = V.Elements[c];
+    }
+    FM_FUN_TI soa_array<t>::Component(uint32_t Index) -> std::span<float> {
+        FM_ASSERT(Index < Components);
+        return std::span<float>(Data + Index * Capacity, Count);
+    }
+    template<class t> template<uint32_t n> FM_INL auto soa_array<t>::PacketCount() const -> size_t {
+        return (Count + n - 1) / n;
+    }
+    template<class t> template<uint32_t n> FM_INL auto soa_array<t>::GetPacket(size_t Index) const -> typename priv::soa_packet<t, n>::type {
+        typename priv::soa_packet<t, n>::type P;
+        const packet_float<n>* Lanes = (const packet_float<n>*)Data + Index;
+        size_t Stride = Capacity / n;
+        P.X = Lanes[0];
+        P.Y = Lanes[Stride];
+        P.Z = Lanes[2 * Stride];
+        if constexpr(Components == 4)
+            P.W = Lanes[3 * Stride];
+        return P;
+    }
+    template<class t> template<uint32_t n> FM_INL auto soa_array<t>::SetPacket(size_t Index, typename priv::soa_packet<t, n>::type P) -> void {
+        packet_float<n>* Lanes = (packet_float<n>*)Data + Index;
+        size_t Stride = Capacity / n;
+        Lanes[0] = P.X;
+        Lanes[Stride] = P.Y;
+        Lanes[2 * Stride] = P.Z;
+        if constexpr(Components == 4)
+            Lanes[3 * Stride] = P.W;
+    }
+    template<class t> template<uint32_t n, class f> FM_INL auto soa_array<t>::ForEachPacket(f Function) -> void {
+        packet_float<n>* Lanes = (packet_float<n>*)Data;
+        size_t Stride = Capacity / n;
+        size_t Packets = PacketCount<n>();
+        for(size_t i = 0; i < Packets; ++i)
+        {
+            if constexpr(Components == 2)
+                Function(Lanes[i], Lanes[Stride + i]);
+            else if constexpr(Components == 3)
+                Function(Lanes[i], Lanes[Stride + i], Lanes[2 * Stride + i]);
+            else
+                Function(Lanes[i], Lanes[Stride + i], Lanes[2 * Stride + i], Lanes[3 * Stride + i]);
+        }
     }
-    FM_FUN_SIC Mat4FromColumnMajorMemory(float* Mem) -> mat4 {
-        mat4 R;
-        for(int32_t i = 0; i < 4; ++i)
-            R.Columns[i] = _mm_load_ps(Mem + i*4);
-        return R;
+    
+    ////////////////////////////////////
+    // frame_arena and pool functions //
+    ////////////////////////////////////
+    // NOTE: A failed allocation gives an empty arena, every Push on it returns nullptr
+    FM_FUN_SI FrameArena(size_t Size) -> frame_arena {
+        frame_arena A;
+        A.Size = Size > (size_t)-1 - 63 ? 0 : priv::RoundUpToCacheLine(Size);
+        A.Base = A.Size ? (uint8_t*)FM_ALIGNED_ALLOC(A.Size, 64) : nullptr;
+        if(!A.Base)
+            A.Size = 0;
+        A.Used = 0;
+        A.OwnsMemory = true;
+        return A;
     }
-    FM_FUN_SIC Mat4FromRowMajorMemory(float* Mem) -> mat4 {
-        mat4 R;
-        R.Columns[0] = _mm_setr_ps(Mem[0], Mem[4], Mem[8], Mem[12]);
-        R.Columns[1] = _mm_setr_ps(Mem[1], Mem[5], Mem[9], Mem[13]);
-        R.Columns[2] = _mm_setr_ps(Mem[2], Mem[6], Mem[10], Mem[14]);
-        R.Columns[3] = _mm_setr_ps(Mem[3], Mem[7], Mem[11], Mem[15]);
-        return R;
+    // NOTE: Memory is not freed by the arena and has to be 64 byte aligned
+    FM_FUN_SI FrameArena(void* Memory, size_t Size) -> frame_arena {
+        FM_ASSERT((uintptr_t)Memory % 64 == 0);
+        frame_arena A;
+        A.Base = (uint8_t*)Memory;
+        A.Size = Size;
+        A.Used = 0;
+        A.OwnsMemory = false;
+        return A;
     }
-    FM_FUN_SIC Mat4() -> mat4 {
-        mat4 R;
-        R.Columns[0] = _mm_setzero_ps();
-        R.Columns[1] = _mm_setzero_ps();
-        R.Columns[2] = _mm_setzero_ps();
-        R.Columns[3] = _mm_setzero_ps();
-        return R;
+    FM_FUN_SI Free(frame_arena* A) -> void {
+        if(A->OwnsMemory && A->Base)
+            FM_ALIGNED_FREE(A->Base);
+        A->Base = nullptr;
+        A->Size = A->Used = 0;
     }
-    FM_FUN_SIC Mat4Diagonal(float Diag) -> mat4 {
-        mat4 R;
-        R.Columns[0] = _mm_setr_ps(Diag, 0.f, 0.f, 0.f);
-        R.Columns[1] = _mm_setr_ps(0.f, Diag, 0.f, 0.f);
-        R.Columns[2] = _mm_setr_ps(0.f, 0.f, Diag, 0.f);
-        R.Columns[3] = _mm_setr_ps(0.f, 0.f, 0.f, Diag);
-        return R;
+    FM_FUN_SI Reset(frame_arena* A) -> void {
+        A->Used = 0;
     }
-    FM_FUN_SIC Mat4Diagonal(float DiagX, float DiagY, float DiagZ, float DiagW) -> mat4 {
-        mat4 R;
-        R.Columns[0] = _mm_setr_ps(DiagX, 0.f, 0.f, 0.f);
-        R.Columns[1] = _mm_setr_ps(0.f, DiagY, 0.f, 0.f);
-        R.Columns[2] = _mm_setr_ps(0.f, 0.f, DiagZ, 0.f);
-        R.Columns[3] = _mm_setr_ps(0.f, 0.f, 0.f, DiagW);
-        return R;
+    // NOTE: Alignment has to be a power of two, returns nullptr when the arena is full.
+    //       Sizes that would overflow size_t are reported as full, so they never wrap around to a small block.
+    FM_FUN_SI Push(frame_arena* A, size_t Bytes, size_t Alignment = 64) -> void* {
+        FM_ASSERT((Alignment & (Alignment - 1)) == 0);
+        size_t Start = (A->Used + Alignment - 1) & ~(Alignment - 1);
+        if(Start > A->Size || Bytes > A->Size - Start)
+            return nullptr;
+        A->Used = Start + Bytes;
+        return A->Base + Start;
     }
-    FM_FUN_SIC Mat4Diagonal(v4 Diag) -> mat4 {
-        mat4 R;
-        R.Columns[0] = _mm_setr_ps(Diag.X, 0.f, 0.f, 0.f);
-        R.Columns[1] = _mm_setr_ps(0.f, Diag.Y, 0.f, 0.f);
-        R.Columns[2] = _mm_setr_ps(0.f, 0.f, Diag.Z, 0.f);
-        R.Columns[3] = _mm_setr_ps(0.f, 0.f, 0.f, Diag.W);
-        return R;
+    FM_FUN_TSI PushArray(frame_arena* A, size_t Count) -> t* {
+        static_assert(std::is_trivially_copyable_v<t>);
+        if(Count > (size_t)-1 / sizeof(t))
+            return nullptr;
+        return (t*)Push(A, Count * sizeof(t), alignof(t) > 64 ? alignof(t) : 64);
     }
-    FM_FUN_SIC Mat4Diagonal(vec4 Diag) -> mat4 {
-        return Mat4Diagonal(CastToV4(Diag));
+    FM_FUN_SI AllocMat4Array(frame_arena* A, size_t Count) -> mat4* {
+        return PushArray<mat4>(A, Count);
     }
-    FM_FUN_SIC Mat4Identity() -> mat4 {
-        return Mat4Diagonal(1.f);
+    FM_FUN_SI AllocMat3x4Array(frame_arena* A, size_t Count) -> mat3x4* {
+        return PushArray<mat3x4>(A, Count);
     }
-    FM_FUN_SIC Mat4FromColumns(vec4 Col1, vec4 Col2, vec4 Col3, vec4 Col4) -> mat4 {
-        mat4 R;
-        R.Columns[0] = Col1.M;
-        R.Columns[1] = Col2.M;
-        R.Columns[2] = Col3.M;
-        R.Columns[3] = Col4.M;
-        return R;
+    FM_FUN_SI AllocQuatArray(frame_arena* A, size_t Count) -> quat* {
+        return PushArray<quat>(A, Count);
     }
-    FM_FUN_SIC Mat4FromColumns(v4 Col1, v4 Col2, v4 Col3, v4 Col4) -> mat4 {
-        return Mat4FromColumns(CastToVec4(Col1), CastToVec4(Col2), CastToVec4(Col3), CastToVec4(Col4));
+    FM_FUN_SI AllocVec4Array(frame_arena* A, size_t Count) -> vec4* {
+        return PushArray<vec4>(A, Count);
     }
-    FM_FUN_SIC Mat4FromColumns(vec3 Col1, vec3 Col2, vec3 Col3, vec3 Col4) -> mat4 {
-        mat4 R;
-        R.Columns[0] = Col1.M;
-        R.Columns[1] = Col2.M;
-        R.Columns[2] = Col3.M;
-        R.Columns[3] = Col4.M;
-        R.SetRow(3, 0.f, 0.f, 0.f, 1.f);
-        return R;
+    FM_FUN_SI AllocVec3Array(frame_arena* A, size_t Count) -> vec3* {
+        return PushArray<vec3>(A, Count);
     }
-    FM_FUN_SIC Mat4FromColumns(v3 Col1, v3 Col2, v3 Col3, v3 Col4) -> mat4 {
-        return Mat4FromColumns(CastToVec3(Col1), CastToVec3(Col2), CastToVec3(Col3), CastToVec3(Col4));
+    FM_FUN_SI AllocV4Array(frame_arena* A, size_t Count) -> v4* {
+        return PushArray<v4>(A, Count);
     }
-    FM_FUN_SIC Mat4FromColumns(
-                               float E11, float E21, float E31, float E41,
-                               float E12, float E22, float E32, float E42,
-                               float E13, float E23, float E33, float E43,
-                               float E14, float E24, float E34, float E44) -> mat4
-    {
-        mat4 R;
-        R.Columns[0] = _mm_setr_ps(E11, E21, E31, E41);
-        R.Columns[1] = _mm_setr_ps(E12, E22, E32, E42);
-        R.Columns[2] = _mm_setr_ps(E13, E23, E33, E43);
-        R.Columns[3] = _mm_setr_ps(E14, E24, E34, E44);
-        return R;
+    FM_FUN_SI AllocV3Array(frame_arena* A, size_t Count) -> v3* {
+        return PushArray<v3>(A, Count);
     }
-    FM_FUN_SIC Mat4FromRows(vec4 Row1, vec4 Row2, vec4 Row3, vec4 Row4) -> mat4 {
-        mat4 R;
-        R.Columns[0] = _mm_setr_ps(Row1.X(), Row2.X(), Row3.X(), Row4.X());
-        R.Columns[1] = _mm_setr_ps(Row1.Y(), Row2.Y(), Row3.Y(), Row4.Y());
-        R.Columns[2] = _mm_setr_ps(Row1.Z(), Row2.Z(), Row3.Z(), Row4.Z());
-        R.Columns[3] = _mm_setr_ps(Row1.W(), Row2.W(), Row3.W(), Row4.W());
-        return R;
+    FM_FUN_SI AllocFloatArray(frame_arena* A, size_t Count) -> float* {
+        return PushArray<float>(A, Count);
     }
-    FM_FUN_SIC Mat4FromRows(v4 Row1, v4 Row2, v4 Row3, v4 Row4) -> mat4 {
-        return Mat4FromRows(CastToVec4(Row1), CastToVec4(Row2), CastToVec4(Row3), CastToVec4(Row4));
+    namespace priv {
+        struct thread_frame_arena
+        {
+            frame_arena Arena = FrameArena(FM_THREAD_FRAME_ARENA_SIZE);
+            ~thread_frame_arena() { Free(&Arena); }
+        };
     }
-    FM_FUN_SIC Mat4FromRows(
-                            float E11, float E12, float E13, float E14,
-                            float E21, float E22, float E23, float E24,
-                            float E31, float E32, float E33, float E34,
-                            float E41, float E42, float E43, float E44) -> mat4
-    {
-        mat4 R;
-        R.Columns[0] = _mm_setr_ps(E11, E21, E31, E41);
-        R.Columns[1] = _mm_setr_ps(E12, E22, E32, E42);
-        R.Columns[2] = _mm_setr_ps(E13, E23, E33, E43);
-        R.Columns[3] = _mm_setr_ps(E14, E24, E34, E44);
-        return R;
+    // NOTE: One arena per thread, created on the first call and freed when the thread exits
+    FM_FUN_I ThreadFrameArena() -> frame_arena* {
+        static thread_local priv::thread_frame_arena ThreadArena;
+        return &ThreadArena.Arena;
     }
-    FM_FUN_SIC Mat4FromRows(vec3 Row1, vec3 Row2, vec3 Row3, vec3 Row4) -> mat4 {
-        mat4 R;
-        R.Columns[0] = _mm_setr_ps(Row1.X(), Row2.X(), Row3.X(), Row4.X());
-        R.Columns[1] = _mm_setr_ps(Row1.Y(), Row2.Y(), Row3.Y(), Row4.Y());
-        R.Columns[2] = _mm_setr_ps(Row1.Z(), Row2.Z(), Row3.Z(), Row4.Z());
-        R.Columns[3] = _mm_setr_ps(0.f, 0.f, 0.f, 1.f);
-        return R;
+    
+    // NOTE: A failed allocation gives a pool without slots, every Alloc on it returns nullptr
+    FM_FUN_TSI Pool(uint32_t Capacity) -> pool<t> {
+        static_assert(std::is_trivially_copyable_v<t> && sizeof(t) >= sizeof(uint32_t));
+        pool<t> P;
+        if(Capacity > ((size_t)-1 - 63) / sizeof(t))
+            Capacity = 0;
+        P.Slots = Capacity ? (t*)FM_ALIGNED_ALLOC(priv::RoundUpToCacheLine(Capacity * sizeof(t)), 64) : nullptr;
+        if(!P.Slots)
+            Capacity = 0;
+        P.Capacity = Capacity;
+        P.Used = 0;
+        P.FirstFree = Capacity;
+        return P;
+    }
+    FM_FUN_TSI Free(pool<t>* P) -> void {
+        if(P->Slots)
+            FM_ALIGNED_FREE(P->Slots);
+        P->Slots = nullptr;
+        P->Capacity = P->Used = 0;
+        P->FirstFree = 0;
+    }
+    // NOTE: Slots are handed out in order first, released ones are reused last in first out.
+    //       Returns nullptr when every slot is taken.
+    FM_FUN_TSI Alloc(pool<t>* P) -> t* {
+        if(P->FirstFree != P->Capacity)
+        {
+            t* Slot = P->Slots + P->FirstFree;
+            memcpy(&P->FirstFree, Slot, sizeof(uint32_t));
+            return Slot;
+        }
+        if(P->Used == P->Capacity)
+            return nullptr;
+        return P->Slots + P->Used++;
     }
-    FM_FUN_SIC Mat4FromRows(v3 Row1, v3 Row2, v3 Row3, v3 Row4) -> mat4 {
-        return Mat4FromRows(CastToVec3(Row1), CastToVec3(Row2), CastToVec3(Row3), CastToVec3(Row4));
+    FM_FUN_TSI Release(pool<t>* P, t* Slot) -> void {
+        FM_ASSERT(Slot >= P->Slots && Slot < P->Slots + P->Used);
+        memcpy(Slot, &P->FirstFree, sizeof(uint32_t));
+        P->FirstFree = (uint32_t)(Slot - P->Slots);
     }
-    FM_FUN_SI Ptr(const mat4& V) -> float* {
-        return (float*)(&V);
+    FM_FUN_TSI Reset(pool<t>* P) -> void {
+        P->Used = 0;
+        P->FirstFree = P->Capacity;
     }
-    FM_FUN_SIC Store(float* Mem, mat4 Mat) -> void {
-        for(int32_t Col = 0; Col < 4; ++Col)
-            _mm_storeu_ps(Mem + Col*4, Mat.Columns[Col]);
+    
+    /////////////////////////
+    // vector trigonometry //
+    /////////////////////////
+    // NOTE: Every lane is computed on its own, max errors are measured against the exact result.
+    //       Full precision: Sin, Cos and SinCos 3 ulp, Tan 5 ulp, Atan2 4 ulp, Asin 3 ulp and Acos 2 ulp.
+    //       Fast versions use shorter polynomials: FastSin, FastCos and FastSinCos 28 ulp, FastTan 40 ulp,
+    //       FastAtan2 80 ulp, FastAsin and FastAcos 33 ulp. Atan2 handles signed zeros like libm, Atan2(+-0, -0) is +-Pi.
+    //       Sin, Cos and Tan hold these bounds for |X| <= 50000, lanes above that and infinities go through libm.
+    //       -ffast-math lets the compiler merge the range reduction steps, then results close to 0 lose their ulp bounds.
+    namespace priv {
+        template<uint32_t n> FM_INL auto FM_CALL PacketConstant(float Scalar) -> packet_float<n> {
+            packet_float<n> R;
+            PacketSplat(&R, Scalar);
+            return R;
+        }
+        template<class t> FM_INL auto FM_CALL PacketSelect(t Mask, t A, t B) -> t {
+            return PacketOr(PacketAnd(Mask, A), PacketAndNot(Mask, B));
+        }
+        FM_SINL __m128 FM_CALL PacketMulAdd(__m128 A, __m128 B, __m128 C) {
+            return MulAdd(A, B, C);
+        }
+#ifdef __AVX__
+        FM_SINL __m256 FM_CALL PacketMulAdd(__m256 A, __m256 B, __m256 C) {
+#ifdef FM_USE_FMA
+            return _mm256_fmadd_ps(A, B, C);
+#else
+            return _mm256_add_ps(_mm256_mul_ps(A, B), C);
+#endif
+        }
+#endif
+        
+        // NOTE: Rounds Scaled to the nearest quadrant J. Sin and Cos swap when J is odd,
+        //       Sin flips its sign when J & 2 and Cos when (J + 1) & 2. Sign masks have only the sign bit set.
+        FM_SINL __m128 FM_CALL SinCosQuadrant(__m128 Scaled, __m128* Swap, __m128* SinSign, __m128* CosSign) {
+            __m128i J = _mm_cvtps_epi32(Scaled);
+            __m128i One = _mm_set1_epi32(1);
+            __m128i SignBit = _mm_set1_epi32((int)0x80000000);
+            *Swap = _mm_castsi128_ps(_mm_cmpeq_epi32(_mm_and_si128(J, One), One));
+            *SinSign = _mm_castsi128_ps(_mm_and_si128(_mm_slli_epi32(J, 30), SignBit));
+            *CosSign = _mm_castsi128_ps(_mm_and_si128(_mm_slli_epi32(_mm_add_epi32(J, One), 30), SignBit));
+            return _mm_cvtepi32_ps(J);
+        }
+#ifdef __AVX__
+        FM_SINL __m256 FM_CALL SinCosQuadrant(__m256 Scaled, __m256* Swap, __m256* SinSign, __m256* CosSign) {
+#ifdef __AVX2__
+            __m256i J = _mm256_cvtps_epi32(Scaled);
+            __m256i One = _mm256_set1_epi32(1);
+            __m256i SignBit = _mm256_set1_epi32((int)0x80000000);
+            *Swap = _mm256_castsi256_ps(_mm256_cmpeq_epi32(_mm256_and_si256(J, One), One));
+            *SinSign = _mm256_castsi256_ps(_mm256_and_si256(_mm256_slli_epi32(J, 30), SignBit));
+            *CosSign = _mm256_castsi256_ps(_mm256_and_si256(_mm256_slli_epi32(_mm256_add_epi32(J, One), 30), SignBit));
+            return _mm256_cvtepi32_ps(J);
+#else
+            // NOTE: AVX1 has no 256 bit integer instructions
+            __m128 SwapLo, SwapHi, SinSignLo, SinSignHi, CosSignLo, CosSignHi;
+            __m128 Lo = SinCosQuadrant(LowerHalf(Scaled), &SwapLo, &SinSignLo, &CosSignLo);
+            __m128 Hi = SinCosQuadrant(UpperHalf(Scaled), &SwapHi, &SinSignHi, &CosSignHi);
+            *Swap = Combine(SwapLo, SwapHi);
+            *SinSign = Combine(SinSignLo, SinSignHi);
+            *CosSign = Combine(CosSignLo, CosSignHi);
+            return Combine(Lo, Hi);
+#endif
+        }
+#endif
+        
+        // NOTE: Above this the range reduction loses its ulp bounds, and above 2^31 * Pi/2 the quadrant overflows an int32
+        constexpr float SinCosReductionLimit = 50000.f;
+        // NOTE: Kept out of line, it only runs when a lane is past SinCosReductionLimit
+        template<uint32_t n> static auto SinCosLargeLanes(packet_float<n> X, packet_float<n>* Sin, packet_float<n>* Cos) -> void {
+            float Xs[n], Sins[n], Coss[n];
+            PacketStore(Xs, X);
+            PacketStore(Sins, *Sin);
+            PacketStore(Coss, *Cos);
+            for(uint32_t i = 0; i < n; ++i)
+            {
+                if(!(Abs(Xs[i]) <= SinCosReductionLimit))
+                {
+                    Sins[i] = sinf(Xs[i]);
+                    Coss[i] = cosf(Xs[i]);
+                }
+            }
+            PacketLoad(Sin, Sins);
+            PacketLoad(Cos, Coss);
+        }
+        // NOTE: X - J * Pi/2 with Pi/2 split in parts whose products with J stay exact (Cody-Waite),
+        //       the polynomials cover [-Pi/4, Pi/4]. Lanes past SinCosReductionLimit go through libm.
+        template<uint32_t n, bool Fast> FM_INL auto FM_CALL SinCosLanes(packet_float<n> X, packet_float<n>* Sin, packet_float<n>* Cos) -> void {
+            using t = packet_float<n>;
+            t Swap, SinSign, CosSign;
+            t J = SinCosQuadrant(PacketMul(X, PacketConstant<n>(0.636619772f)), &Swap, &SinSign, &CosSign);
+            t R = PacketSub(X, PacketMul(J, PacketConstant<n>(1.5703125f)));
+            R = PacketSub(R, PacketMul(J, PacketConstant<n>(4.8351287841796875e-4f)));
+            R = PacketSub(R, PacketMul(J, PacketConstant<n>(3.1385570764541626e-7f)));
+            R = PacketSub(R, PacketMul(J, PacketConstant<n>(6.0771006282767105e-11f)));
+            t Z = PacketMul(R, R);
+            t SinR, CosR;
+            if constexpr(Fast)
+            {
+                t SinP = PacketMulAdd(Z, PacketConstant<n>(8.16328192e-3f), PacketConstant<n>(-1.66633904e-1f));
+                t CosP = PacketMulAdd(Z, PacketConstant<n>(-1.36487143e-3f), PacketConstant<n>(4.16610713e-2f));
+                SinR = PacketMulAdd(PacketMul(R, Z), SinP, R);
+                CosR = PacketMulAdd(PacketMul(Z, Z), CosP, PacketMulAdd(Z, PacketConstant<n>(-0.5f), PacketConstant<n>(1.f)));
+            }
+            else
+            {
+                t SinP = PacketMulAdd(Z, PacketConstant<n>(-1.9515295891e-4f), PacketConstant<n>(8.3321608736e-3f));
+                SinP = PacketMulAdd(Z, SinP, PacketConstant<n>(-1.6666654611e-1f));
+                t CosP = PacketMulAdd(Z, PacketConstant<n>(2.443315711809948e-5f), PacketConstant<n>(-1.388731625493765e-3f));
+                CosP = PacketMulAdd(Z, CosP, PacketConstant<n>(4.166664568298827e-2f));
+                SinR = PacketMulAdd(PacketMul(R, Z), SinP, R);
+                CosR = PacketMulAdd(PacketMul(Z, Z), CosP, PacketMulAdd(Z, PacketConstant<n>(-0.5f), PacketConstant<n>(1.f)));
+            }
+            *Sin = PacketXor(PacketSelect(Swap, CosR, SinR), SinSign);
+            *Cos = PacketXor(PacketSelect(Swap, SinR, CosR), CosSign);
+            t AbsX = PacketAndNot(PacketConstant<n>(-0.f), X);
+            if(PacketAnySet(PacketGreater(AbsX, PacketConstant<n>(SinCosReductionLimit))))
+                SinCosLargeLanes<n>(X, Sin, Cos);
+        }
+        template<uint32_t n, bool Fast> FM_INL auto FM_CALL TanLanes(packet_float<n> X) -> packet_float<n> {
+            packet_float<n> Sin, Cos;
+            SinCosLanes<n, Fast>(X, &Sin, &Cos);
+            return PacketDiv(Sin, Cos);
+        }
+        // NOTE: Atan of A in [0, 1], the full version moves A above Tan(Pi/8) to (A - 1) / (A + 1) and adds Pi/4
+        template<uint32_t n, bool Fast> FM_INL auto FM_CALL AtanUnitLanes(packet_float<n> A) -> packet_float<n> {
+            using t = packet_float<n>;
+            if constexpr(Fast)
+            {
+                t Z = PacketMul(A, A);
+                t P = PacketMulAdd(Z, PacketConstant<n>(-1.39550957e-2f), PacketConstant<n>(5.87702425e-2f));
+                P = PacketMulAdd(Z, P, PacketConstant<n>(-1.22515003e-1f));
+                P = PacketMulAdd(Z, P, PacketConstant<n>(1.96183091e-1f));
+                P = PacketMulAdd(Z, P, PacketConstant<n>(-3.33089000e-1f));
+                return PacketMulAdd(PacketMul(A, Z), P, A);
+            }
+            else
+            {
+                t One = PacketConstant<n>(1.f);
+                t Big = PacketGreater(A, PacketConstant<n>(0.414213562f));
+                A = PacketSelect(Big, PacketDiv(PacketSub(A, One), PacketAdd(A, One)), A);
+                t Offset = PacketAnd(Big, PacketConstant<n>(Pi32 / 4.f));
+                t Z = PacketMul(A, A);
+                t P = PacketMulAdd(Z, PacketConstant<n>(8.05374449538e-2f), PacketConstant<n>(-1.38776856032e-1f));
+                P = PacketMulAdd(Z, P, PacketConstant<n>(1.99777106478e-1f));
+                P = PacketMulAdd(Z, P, PacketConstant<n>(-3.33329491539e-1f));
+                return PacketAdd(Offset, PacketMulAdd(PacketMul(A, Z), P, A));
+            }
+        }
+        template<uint32_t n, bool Fast> FM_INL auto FM_CALL Atan2Lanes(packet_float<n> Y, packet_float<n> X) -> packet_float<n> {
+            using t = packet_float<n>;
+            t SignMask = PacketConstant<n>(-0.f);
+            t Zero = PacketConstant<n>(0.f);
+            t AbsX = PacketAndNot(SignMask, X);
+            t AbsY = PacketAndNot(SignMask, Y);
+            t Num = PacketMin(AbsX, AbsY);
+            t Den = PacketMax(AbsX, AbsY);
+            t A = PacketAnd(PacketGreater(Den, Zero), PacketDiv(Num, Den));
+            t R = AtanUnitLanes<n, Fast>(A);
+            R = PacketSelect(PacketGreater(AbsY, AbsX), PacketSub(PacketConstant<n>(Pi32 / 2.f), R), R);
+            // NOTE: Sign bit of X instead of X < 0, so -0 picks the left half plane like libm does
+            t NegativeX = PacketLesser(PacketOr(PacketAnd(SignMask, X), PacketConstant<n>(1.f)), Zero);
+            R = PacketSelect(NegativeX, PacketSub(PacketConstant<n>(Pi32), R), R);
+            return PacketXor(R, PacketAnd(SignMask, Y));
+        }
+        // NOTE: Asin of |X|, above 0.5 it uses Asin(A) = Pi/2 - 2 * Asin(Sqrt((1 - A) / 2)), Big marks those lanes
+        template<uint32_t n, bool Fast> FM_INL auto FM_CALL AsinAbsLanes(packet_float<n> X, packet_float<n>* Big) -> packet_float<n> {
+            using t = packet_float<n>;
+            t Half = PacketConstant<n>(0.5f);
+            t A = PacketAndNot(PacketConstant<n>(-0.f), X);
+            *Big = PacketGreater(A, Half);
+            t Z = PacketSelect(*Big, PacketMul(Half, PacketSub(PacketConstant<n>(1.f), A)), PacketMul(A, A));
+            t S = PacketSelect(*Big, PacketSqrt(Z), A);
+            t P;
+            if constexpr(Fast)
+            {
+                P = PacketMulAdd(Z, PacketConstant<n>(6.41073040e-2f), PacketConstant<n>(7.18997987e-2f));
+                P = PacketMulAdd(Z, P, PacketConstant<n>(1.66801259e-1f));
+            }
+            else
+            {
+                P = PacketMulAdd(Z, PacketConstant<n>(4.2163199048e-2f), PacketConstant<n>(2.4181311049e-2f));
+                P = PacketMulAdd(Z, P, PacketConstant<n>(4.5470025998e-2f));
+                P = PacketMulAdd(Z, P, PacketConstant<n>(7.4953002686e-2f));
+                P = PacketMulAdd(Z, P, PacketConstant<n>(1.6666752422e-1f));
+            }
+            return PacketMulAdd(PacketMul(S, Z), P, S);
+        }
+        template<uint32_t n, bool Fast> FM_INL auto FM_CALL AsinLanes(packet_float<n> X) -> packet_float<n> {
+            packet_float<n> Big;
+            packet_float<n> P = AsinAbsLanes<n, Fast>(X, &Big);
+            packet_float<n> FromHalf = PacketSub(PacketConstant<n>(Pi32 / 2.f), PacketAdd(P, P));
+            return PacketXor(PacketSelect(Big, FromHalf, P), PacketAnd(PacketConstant<n>(-0.f), X));
+        }
+        template<uint32_t n, bool Fast> FM_INL auto FM_CALL AcosLanes(packet_float<n> X) -> packet_float<n> {
+            using t = packet_float<n>;
+            t Big;
+            t P = AsinAbsLanes<n, Fast>(X, &Big);
+            t Negative = PacketLesser(X, PacketConstant<n>(0.f));
+            t TwoP = PacketAdd(P, P);
+            t FromOne = PacketSelect(Negative, PacketSub(PacketConstant<n>(Pi32), TwoP), TwoP);
+            t Small = PacketSub(PacketConstant<n>(Pi32 / 2.f), PacketXor(P, PacketAnd(PacketConstant<n>(-0.f), X)));
+            return PacketSelect(Big, FromOne, Small);
+        }
     }
-    FM_FUN_SIC Store16ByteAligned(float* Mem, mat4 Mat) -> void {
-        FM_ASSERT(Mem % 16 == 0);
-        for(int32_t Col = 0; Col < 4; ++Col)
-            _mm_store_ps(Mem + Col*4, Mat.Columns[Col]);
+    
+#define FM_LANES_TRIGONOMETRY(Type, Lanes) \
+FM_FUN_SIC SinCos(Type X, Type* Sin, Type* Cos) -> void { priv::SinCosLanes<Lanes, false>(X, Sin, Cos); } \
+FM_FUN_SIC FastSinCos(Type X, Type* Sin, Type* Cos) -> void { priv::SinCosLanes<Lanes, true>(X, Sin, Cos); } \
+FM_FUN_SIC Sin(Type X) -> Type { Type S, C; priv::SinCosLanes<Lanes, false>(X, &S, &C); return S; } \
+FM_FUN_SIC FastSin(Type X) -> Type { Type S, C; priv::SinCosLanes<Lanes, true>(X, &S, &C); return S; } \
+FM_FUN_SIC Cos(Type X) -> Type { Type S, C; priv::SinCosLanes<Lanes, false>(X, &S, &C); return C; } \
+FM_FUN_SIC FastCos(Type X) -> Type { Type S, C; priv::SinCosLanes<Lanes, true>(X, &S, &C); return C; } \
+FM_FUN_SIC Tan(Type X) -> Type { return priv::TanLanes<Lanes, false>(X); } \
+FM_FUN_SIC FastTan(Type X) -> Type { return priv::TanLanes<Lanes, true>(X); } \
+FM_FUN_SIC Atan2(Type Y, Type X) -> Type { return priv::Atan2Lanes<Lanes, false>(Y, X); } \
+FM_FUN_SIC FastAtan2(Type Y, Type X) -> Type { return priv::Atan2Lanes<Lanes, true>(Y, X); } \
+FM_FUN_SIC Asin(Type X) -> Type { return priv::AsinLanes<Lanes, false>(X); } \
+FM_FUN_SIC FastAsin(Type X) -> Type { return priv::AsinLanes<Lanes, true>(X); } \
+FM_FUN_SIC Acos(Type X) -> Type { return priv::AcosLanes<Lanes, false>(X); } \
+FM_FUN_SIC FastAcos(Type X) -> Type { return priv::AcosLanes<Lanes, true>(X); }
+    FM_LANES_TRIGONOMETRY(__m128, 4)
+#ifdef __AVX__
+    FM_LANES_TRIGONOMETRY(__m256, 8)
+#endif
+    
+#define FM_VECTOR_TRIGONOMETRY(Type) \
+FM_FUN_SIC SinCos(Type V, Type* Sin, Type* Cos) -> void { SinCos(V.M, &Sin->M, &Cos->M); } \
+FM_FUN_SIC FastSinCos(Type V, Type* Sin, Type* Cos) -> void { FastSinCos(V.M, &Sin->M, &Cos->M); } \
+FM_FUN_SIC Sin(Type V) -> Type { V.M = Sin(V.M); return V; } \
+FM_FUN_SIC FastSin(Type V) -> Type { V.M = FastSin(V.M); return V; } \
+FM_FUN_SIC Cos(Type V) -> Type { V.M = Cos(V.M); return V; } \
+FM_FUN_SIC FastCos(Type V) -> Type { V.M = FastCos(V.M); return V; } \
+FM_FUN_SIC Tan(Type V) -> Type { V.M = Tan(V.M); return V; } \
+FM_FUN_SIC FastTan(Type V) -> Type { V.M = FastTan(V.M); return V; } \
+FM_FUN_SIC Atan2(Type Y, Type X) -> Type { Y.M = Atan2(Y.M, X.M); return Y; } \
+FM_FUN_SIC FastAtan2(Type Y, Type X) -> Type { Y.M = FastAtan2(Y.M, X.M); return Y; } \
+FM_FUN_SIC Asin(Type V) -> Type { V.M = Asin(V.M); return V; } \
+FM_FUN_SIC FastAsin(Type V) -> Type { V.M = FastAsin(V.M); return V; } \
+FM_FUN_SIC Acos(Type V) -> Type { V.M = Acos(V.M); return V; } \
+FM_FUN_SIC FastAcos(Type V) -> Type { V.M = FastAcos(V.M); return V; }
+    FM_VECTOR_TRIGONOMETRY(vec2)
+    FM_VECTOR_TRIGONOMETRY(vec3)
+    FM_VECTOR_TRIGONOMETRY(vec4)
+    
+    namespace priv {
+        // NOTE: Full precision Sin of X in lane 0 and Cos of X in lane 1, both come from one polynomial
+        //       evaluation because they differ only in their coefficients
+        FM_SINL __m128 FM_CALL SinCosPair(float X) {
+            __m128 V = _mm_set1_ps(X);
+            __m128i J = _mm_cvtps_epi32(_mm_mul_ps(V, _mm_set1_ps(0.636619772f)));
+            __m128 JF = _mm_cvtepi32_ps(J);
+            __m128 R = _mm_sub_ps(V, _mm_mul_ps(JF, _mm_set1_ps(1.5703125f)));
+            R = _mm_sub_ps(R, _mm_mul_ps(JF, _mm_set1_ps(4.8351287841796875e-4f)));
+            R = _mm_sub_ps(R, _mm_mul_ps(JF, _mm_set1_ps(3.1385570764541626e-7f)));
+            R = _mm_sub_ps(R, _mm_mul_ps(JF, _mm_set1_ps(6.0771006282767105e-11f)));
+            __m128 Z = _mm_mul_ps(R, R);
+            __m128 P = _mm_setr_ps(0.f, 2.443315711809948e-5f, 0.f, 2.443315711809948e-5f);
+            P = _mm_add_ps(_mm_mul_ps(P, Z), _mm_setr_ps(-1.9515295891e-4f, -1.388731625493765e-3f, -1.9515295891e-4f, -1.388731625493765e-3f));
+            P = _mm_add_ps(_mm_mul_ps(P, Z), _mm_setr_ps(8.3321608736e-3f, 4.166664568298827e-2f, 8.3321608736e-3f, 4.166664568298827e-2f));
+            P = _mm_add_ps(_mm_mul_ps(P, Z), _mm_setr_ps(-1.6666654611e-1f, -0.5f, -1.6666654611e-1f, -0.5f));
+            __m128 Base = _mm_unpacklo_ps(R, _mm_set1_ps(1.f));
+            __m128 SinCos = _mm_add_ps(Base, _mm_mul_ps(_mm_mul_ps(Base, Z), P));
+            __m128i One = _mm_set1_epi32(1);
+            __m128 Swap = _mm_castsi128_ps(_mm_cmpeq_epi32(_mm_and_si128(J, One), One));
+            __m128 Swapped = _mm_shuffle_ps(SinCos, SinCos, _MM_SHUFFLE(2, 3, 0, 1));
+            SinCos = _mm_or_ps(_mm_and_ps(Swap, Swapped), _mm_andnot_ps(Swap, SinCos));
+            __m128i Quadrants = _mm_add_epi32(J, _mm_setr_epi32(0, 1, 0, 1));
+            __m128i Signs = _mm_and_si128(_mm_slli_epi32(Quadrants, 30), _mm_set1_epi32((int)0x80000000));
+            return _mm_xor_ps(SinCos, _mm_castsi128_ps(Signs));
+        }
     }
-    FM_FUN_SIC operator+(mat4 A, mat4 B) -> mat4 {
-        for(int32_t Col = 0; Col < 4; ++Col)
-            A.Columns[Col] = _mm_add_ps(A.Columns[Col], B.Columns[Col]);
-        return A;
+    FM_FUN_SI SinCos(float Radians, float* Sin, float* Cos) -> void {
+        if(Abs(Radians) > priv::SinCosReductionLimit)
+        {
+            *Sin = sinf(Radians);
+            *Cos = cosf(Radians);
+            return;
+        }
+        __m128 SinCos = priv::SinCosPair(Radians);
+        *Sin = priv::GetX(SinCos);
+        *Cos = priv::GetY(SinCos);
     }
-    FM_FUN_SIC operator-(mat4 A, mat4 B) -> mat4 {
-        for(int32_t Col = 0; Col < 4; ++Col)
-            A.Columns[Col] = _mm_sub_ps(A.Columns[Col], B.Columns[Col]);
+    
+    ////////////////////////////////////////
+    // vector exponentials and logarithms //
+    ////////////////////////////////////////
+    // NOTE: Max errors are measured against the exact result: Exp, Exp2, Log and Log2 1.5 ulp.
+    //       Pow is Exp2(Y * Log2(X)) and Exp2 scales up the rounding error of Y * Log2(X), so it's 4 + 1.5 * |Y * Log2(X)| ulp.
+    //       Exp and Exp2 overflow to infinity above 88.72 and 128, results below the smallest normal float are denormals.
+    //       Log of 0 is -infinity, of a negative number NaN. Pow(X, 0), Pow(1, Y) and Pow(-1, +-infinity) are 1. For negative X,
+    //       including -0, Pow is Pow(-X, Y) negated when Y is an odd integer, Pow(-X, Y) for other integers and NaN when Y isn't an integer.
+    namespace priv {
+        // NOTE: Coefficients from the highest power down, the batch kernels use them too
+        constexpr float ExpPolynomial[] = {1.9875691500e-4f, 1.3981999507e-3f, 8.3334519073e-3f,
+                                           4.1665795894e-2f, 1.6666665459e-1f, 5.0000001201e-1f};
+        constexpr float Exp2Polynomial[] = {1.535336188319500e-4f, 1.339887440266574e-3f, 9.618437357674640e-3f,
+                                            5.550332471162809e-2f, 2.402264791363012e-1f, 6.931472028550421e-1f};
+        constexpr float LogPolynomial[] = {7.0376836292e-2f, -1.1514610310e-1f, 1.1676998740e-1f,
+                                           -1.2420140846e-1f, 1.4249322787e-1f, -1.6668057665e-1f,
+                                           2.0000714765e-1f, -2.4999993993e-1f, 3.3333331174e-1f};
+        constexpr float Ln2Hi = 0.693359375f;
+        constexpr float Ln2Lo = -2.12194440e-4f;
+        constexpr float Log2EMinusOne = 0.44269504088896340736f;
+        constexpr float MinNormalF32 = 1.17549435e-38f;
+        
+        template<uint32_t n, uint32_t c> FM_INL auto FM_CALL PacketPolynomial(packet_float<n> X, const float (&Coefficients)[c]) -> packet_float<n> {
+            packet_float<n> R = PacketConstant<n>(Coefficients[0]);
+            for(uint32_t i = 1; i < c; ++i)
+                R = PacketMulAdd(R, X, PacketConstant<n>(Coefficients[i]));
+            return R;
+        }
+        
+        // NOTE: Rounds X to the nearest integer N and builds 2^N from two halves, so both stay normal for N in [-252, 254]
+        FM_SINL __m128 FM_CALL RoundAndPowerOfTwo(__m128 X, __m128* ScaleLo, __m128* ScaleHi) {
+            __m128i N = _mm_cvtps_epi32(X);
+            __m128i NLo = _mm_srai_epi32(N, 1);
+            __m128i Bias = _mm_set1_epi32(127);
+            *ScaleLo = _mm_castsi128_ps(_mm_slli_epi32(_mm_add_epi32(NLo, Bias), 23));
+            *ScaleHi = _mm_castsi128_ps(_mm_slli_epi32(_mm_add_epi32(_mm_sub_epi32(N, NLo), Bias), 23));
+            return _mm_cvtepi32_ps(N);
+        }
+        // NOTE: Splits a normal X into M * 2^E with M in [Sqrt(0.5), Sqrt(2)) and returns M - 1
+        FM_SINL __m128 FM_CALL SplitMantissa(__m128 X, __m128* E) {
+            __m128i Bits = _mm_castps_si128(X);
+            __m128 M = _mm_castsi128_ps(_mm_or_si128(_mm_and_si128(Bits, _mm_set1_epi32(0x007FFFFF)), _mm_set1_epi32(0x3F000000)));
+            __m128 Exponent = _mm_cvtepi32_ps(_mm_sub_epi32(_mm_srli_epi32(Bits, 23), _mm_set1_epi32(126)));
+            __m128 Below = _mm_cmplt_ps(M, _mm_set1_ps(0.707106781f));
+            *E = _mm_sub_ps(Exponent, _mm_and_ps(Below, _mm_set1_ps(1.f)));
+            return _mm_sub_ps(_mm_add_ps(M, _mm_and_ps(Below, M)), _mm_set1_ps(1.f));
+        }
+#ifdef __AVX__
+        FM_SINL __m256 FM_CALL RoundAndPowerOfTwo(__m256 X, __m256* ScaleLo, __m256* ScaleHi) {
+#ifdef __AVX2__
+            __m256i N = _mm256_cvtps_epi32(X);
+            __m256i NLo = _mm256_srai_epi32(N, 1);
+            __m256i Bias = _mm256_set1_epi32(127);
+            *ScaleLo = _mm256_castsi256_ps(_mm256_slli_epi32(_mm256_add_epi32(NLo, Bias), 23));
+            *ScaleHi = _mm256_castsi256_ps(_mm256_slli_epi32(_mm256_add_epi32(_mm256_sub_epi32(N, NLo), Bias), 23));
+            return _mm256_cvtepi32_ps(N);
+#else
+            __m128 ScaleLoLo, ScaleLoHi, ScaleHiLo, ScaleHiHi;
+            __m128 Lo = RoundAndPowerOfTwo(LowerHalf(X), &ScaleLoLo, &ScaleHiLo);
+            __m128 Hi = RoundAndPowerOfTwo(UpperHalf(X), &ScaleLoHi, &ScaleHiHi);
+            *ScaleLo = Combine(ScaleLoLo, ScaleLoHi);
+            *ScaleHi = Combine(ScaleHiLo, ScaleHiHi);
+            return Combine(Lo, Hi);
+#endif
+        }
+        FM_SINL __m256 FM_CALL SplitMantissa(__m256 X, __m256* E) {
+#ifdef __AVX2__
+            __m256i Bits = _mm256_castps_si256(X);
+            __m256 M = _mm256_castsi256_ps(_mm256_or_si256(_mm256_and_si256(Bits, _mm256_set1_epi32(0x007FFFFF)), _mm256_set1_epi32(0x3F000000)));
+            __m256 Exponent = _mm256_cvtepi32_ps(_mm256_sub_epi32(_mm256_srli_epi32(Bits, 23), _mm256_set1_epi32(126)));
+            __m256 Below = _mm256_cmp_ps(M, _mm256_set1_ps(0.707106781f), _CMP_LT_OQ);
+            *E = _mm256_sub_ps(Exponent, _mm256_and_ps(Below, _mm256_set1_ps(1.f)));
+            return _mm256_sub_ps(_mm256_add_ps(M, _mm256_and_ps(Below, M)), _mm256_set1_ps(1.f));
+#else
+            __m128 ELo, EHi;
+            __m128 Lo = SplitMantissa(LowerHalf(X), &ELo);
+            __m128 Hi = SplitMantissa(UpperHalf(X), &EHi);
+            *E = Combine(ELo, EHi);
+            return Combine(Lo, Hi);
+#endif
+        }
+#endif
+        
+        // NOTE: The clamps keep NaN, _mm_min_ps and _mm_max_ps return the second operand when one of them is NaN
+        template<uint32_t n> FM_INL auto FM_CALL ExpLanes(packet_float<n> X) -> packet_float<n> {
+            using t = packet_float<n>;
+            X = PacketMax(PacketConstant<n>(-104.f), PacketMin(PacketConstant<n>(89.f), X));
+            t ScaleLo, ScaleHi;
+            t N = RoundAndPowerOfTwo(PacketMul(X, PacketConstant<n>(1.44269504f)), &ScaleLo, &ScaleHi);
+            t R = PacketSub(X, PacketMul(N, PacketConstant<n>(Ln2Hi)));
+            R = PacketSub(R, PacketMul(N, PacketConstant<n>(Ln2Lo)));
+            t P = PacketMulAdd(PacketMul(R, R), PacketPolynomial<n>(R, ExpPolynomial), R);
+            P = PacketAdd(P, PacketConstant<n>(1.f));
+            return PacketMul(PacketMul(P, ScaleLo), ScaleHi);
+        }
+        template<uint32_t n> FM_INL auto FM_CALL Exp2Lanes(packet_float<n> X) -> packet_float<n> {
+            using t = packet_float<n>;
+            X = PacketMax(PacketConstant<n>(-151.f), PacketMin(PacketConstant<n>(129.f), X));
+            t ScaleLo, ScaleHi;
+            t F = PacketSub(X, RoundAndPowerOfTwo(X, &ScaleLo, &ScaleHi));
+            t P = PacketMulAdd(F, PacketPolynomial<n>(F, Exp2Polynomial), PacketConstant<n>(1.f));
+            return PacketMul(PacketMul(P, ScaleLo), ScaleHi);
+        }
+        // NOTE: Denormals are scaled by 2^23 to become normal, returns M - 1 and E
+        template<uint32_t n> FM_INL auto FM_CALL LogReduce(packet_float<n> X, packet_float<n>* E) -> packet_float<n> {
+            using t = packet_float<n>;
+            t Denormal = PacketLesser(X, PacketConstant<n>(MinNormalF32));
+            X = PacketSelect(Denormal, PacketMul(X, PacketConstant<n>(8388608.f)), X);
+            t M = SplitMantissa(X, E);
+            *E = PacketSub(*E, PacketAnd(Denormal, PacketConstant<n>(23.f)));
+            return M;
+        }
+        template<uint32_t n> FM_INL auto FM_CALL LogSpecialCases(packet_float<n> X, packet_float<n> R) -> packet_float<n> {
+            using t = packet_float<n>;
+            t Zero = PacketConstant<n>(0.f);
+            t Infinity = PacketConstant<n>(INFINITY);
+            R = PacketSelect(PacketEquals(X, Infinity), Infinity, R);
+            R = PacketSelect(PacketEquals(X, Zero), PacketConstant<n>(-INFINITY), R);
+            return PacketOr(R, PacketAndNot(PacketGreaterOrEqual(X, Zero), PacketConstant<n>(NAN)));
+        }
+        template<uint32_t n> FM_INL auto FM_CALL LogLanes(packet_float<n> X) -> packet_float<n> {
+            using t = packet_float<n>;
+            t E;
+            t M = LogReduce<n>(X, &E);
+            t Z = PacketMul(M, M);
+            t Y = PacketMul(PacketMul(M, Z), PacketPolynomial<n>(M, LogPolynomial));
+            Y = PacketMulAdd(E, PacketConstant<n>(Ln2Lo), Y);
+            Y = PacketMulAdd(Z, PacketConstant<n>(-0.5f), Y);
+            t R = PacketMulAdd(E, PacketConstant<n>(Ln2Hi), PacketAdd(M, Y));
+            return LogSpecialCases<n>(X, R);
+        }
+        // NOTE: Log2(X) = E + (M + Y) * Log2(e), with Log2(e) - 1 multiplied separately to keep the low bits
+        template<uint32_t n> FM_INL auto FM_CALL Log2Lanes(packet_float<n> X) -> packet_float<n> {
+            using t = packet_float<n>;
+            t E;
+            t M = LogReduce<n>(X, &E);
+            t Z = PacketMul(M, M);
+            t Y = PacketMul(PacketMul(M, Z), PacketPolynomial<n>(M, LogPolynomial));
+            Y = PacketMulAdd(Z, PacketConstant<n>(-0.5f), Y);
+            t L = PacketConstant<n>(Log2EMinusOne);
+            t R = PacketMulAdd(M, L, PacketMul(Y, L));
+            R = PacketAdd(PacketAdd(PacketAdd(R, Y), M), E);
+            return LogSpecialCases<n>(X, R);
+        }
+        template<uint32_t n> FM_INL auto FM_CALL PowLanes(packet_float<n> X, packet_float<n> Y) -> packet_float<n> {
+            using t = packet_float<n>;
+            t SignMask = PacketConstant<n>(-0.f);
+            t One = PacketConstant<n>(1.f);
+            t Sign = PacketAnd(X, SignMask);
+            t AbsX = PacketXor(X, Sign);
+            t R = Exp2Lanes<n>(PacketMul(Y, Log2Lanes<n>(AbsX)));
+            t HalfY = PacketMul(Y, PacketConstant<n>(0.5f));
+            t IntegerY = PacketEquals(PacketRound(Y), Y);
+            t OddY = PacketAndNot(PacketEquals(PacketRound(HalfY), HalfY), IntegerY);
+            R = PacketXor(R, PacketAnd(OddY, Sign));
+            R = PacketOr(R, PacketAndNot(IntegerY, PacketAnd(PacketLesser(X, PacketConstant<n>(0.f)), PacketConstant<n>(NAN))));
+            // NOTE: Y * Log2(X) is NaN for Pow(1, NaN), Pow(1, +-infinity) and Pow(-1, +-infinity), libm gives 1
+            t InfiniteY = PacketEquals(PacketAndNot(SignMask, Y), PacketConstant<n>(INFINITY));
+            t UnitX = PacketAnd(PacketEquals(AbsX, One), PacketOr(PacketEquals(X, One), InfiniteY));
+            return PacketSelect(PacketOr(PacketEquals(Y, PacketConstant<n>(0.f)), UnitX), One, R);
+        }
+    }
+    
+#define FM_LANES_EXPONENTIALS(Type, Lanes) \
+FM_FUN_SIC Exp(Type X) -> Type { return priv::ExpLanes<Lanes>(X); } \
+FM_FUN_SIC Exp2(Type X) -> Type { return priv::Exp2Lanes<Lanes>(X); } \
+FM_FUN_SIC Log(Type X) -> Type { return priv::LogLanes<Lanes>(X); } \
+FM_FUN_SIC Log2(Type X) -> Type { return priv::Log2Lanes<Lanes>(X); } \
+FM_FUN_SIC Pow(Type X, Type Y) -> Type { return priv::PowLanes<Lanes>(X, Y); }
+    FM_LANES_EXPONENTIALS(__m128, 4)
+#ifdef __AVX__
+    FM_LANES_EXPONENTIALS(__m256, 8)
+#endif
+    
+#define FM_VECTOR_EXPONENTIALS(Type) \
+FM_FUN_SIC Exp(Type V) -> Type { V.M = Exp(V.M); return V; } \
+FM_FUN_SIC Exp2(Type V) -> Type { V.M = Exp2(V.M); return V; } \
+FM_FUN_SIC Log(Type V) -> Type { V.M = Log(V.M); return V; } \
+FM_FUN_SIC Log2(Type V) -> Type { V.M = Log2(V.M); return V; } \
+FM_FUN_SIC Pow(Type V, Type Exponent) -> Type { V.M = Pow(V.M, Exponent.M); return V; } \
+FM_FUN_SIC Pow(Type V, float Exponent) -> Type { V.M = Pow(V.M, _mm_set1_ps(Exponent)); return V; }
+    FM_VECTOR_EXPONENTIALS(vec2)
+    FM_VECTOR_EXPONENTIALS(vec3)
+    FM_VECTOR_EXPONENTIALS(vec4)
+    
+    ////////////////////
+    // srgb functions //
+    ////////////////////
+    // NOTE: Float conversions clamp to [0, 1] and replace the powers of the sRGB curve with rational fits in
+    //       Sqrt((X + 0.055) / 1.055) and X^(1 / 4), the relative error is below 3e-6. Srgb8 values are decoded through
+    //       a table of correctly rounded floats and encoded with the float curve and PackUnorm8, so every one of them
+    //       round trips. Alpha is never touched, for v4u8 it's a plain unorm.
+    namespace priv {
+        // NOTE: Coefficients from the highest power down, the fits are in U = T * Scale + Offset
+        constexpr float SrgbToLinearScale = 2.86036629f;
+        constexpr float SrgbToLinearOffset = -1.86036629f;
+        constexpr float SrgbToLinearNumerator[] = {2.036642551e-02f, 2.304089203e-01f, 7.216811123e-01f, 6.782447632e-01f};
+        constexpr float SrgbToLinearDenominator[] = {8.905170991e-04f, 8.629503394e-02f, 6.066632681e-01f, 9.568524830e-01f};
+        constexpr float LinearToSrgbScale = 2.6196699f;
+        constexpr float LinearToSrgbOffset = -1.6196699f;
+        constexpr float LinearToSrgbNumerator[] = {4.608764512e-02f, 3.125980399e-01f, 6.598013501e-01f, 4.438805078e-01f};
+        constexpr float LinearToSrgbDenominator[] = {-8.949592840e-04f, 2.152941326e-02f, 4.524973103e-01f, 9.892352934e-01f};
+        
+        // NOTE: ((X + 0.055) / 1.055)^2.4 = T^4 * T^0.8 with T = Sqrt((X + 0.055) / 1.055), the fit is T^0.8
+        template<uint32_t n> FM_INL auto FM_CALL SrgbToLinearLanes(packet_float<n> X) -> packet_float<n> {
+            using t = packet_float<n>;
+            X = PacketMax(PacketConstant<n>(0.f), PacketMin(PacketConstant<n>(1.f), X));
+            t T = PacketSqrt(PacketMul(PacketAdd(X, PacketConstant<n>(0.055f)), PacketConstant<n>(1.f / 1.055f)));
+            t U = PacketMulAdd(T, PacketConstant<n>(SrgbToLinearScale), PacketConstant<n>(SrgbToLinearOffset));
+            t Curve = PacketDiv(PacketPolynomial<n>(U, SrgbToLinearNumerator), PacketPolynomial<n>(U, SrgbToLinearDenominator));
+            t T2 = PacketMul(T, T);
+            Curve = PacketMul(PacketMul(T2, T2), Curve);
+            t Linear = PacketDiv(X, PacketConstant<n>(12.92f));
+            return PacketSelect(PacketLesserOrEqual(X, PacketConstant<n>(0.04045f)), Linear, Curve);
+        }
+        // NOTE: X^(1 / 2.4) = T^(5 / 3) with T = X^(1 / 4), the fit is T^(5 / 3)
+        template<uint32_t n> FM_INL auto FM_CALL LinearToSrgbLanes(packet_float<n> X) -> packet_float<n> {
+            using t = packet_float<n>;
+            X = PacketMax(PacketConstant<n>(0.f), PacketMin(PacketConstant<n>(1.f), X));
+            t T = PacketSqrt(PacketSqrt(X));
+            t U = PacketMulAdd(T, PacketConstant<n>(LinearToSrgbScale), PacketConstant<n>(LinearToSrgbOffset));
+            t Curve = PacketDiv(PacketPolynomial<n>(U, LinearToSrgbNumerator), PacketPolynomial<n>(U, LinearToSrgbDenominator));
+            Curve = PacketMulAdd(Curve, PacketConstant<n>(1.055f), PacketConstant<n>(-0.055f));
+            t Linear = PacketMul(X, PacketConstant<n>(12.92f));
+            return PacketSelect(PacketLesserOrEqual(X, PacketConstant<n>(0.0031308f)), Linear, Curve);
+        }
+        FM_SINL __m128 FM_CALL KeepAlpha(__m128 Color, __m128 Alpha) {
+            __m128 AlphaMask = _mm_castsi128_ps(_mm_setr_epi32(0, 0, 0, -1));
+            return _mm_or_ps(_mm_andnot_ps(AlphaMask, Color), _mm_and_ps(AlphaMask, Alpha));
+        }
+        
+        // NOTE: Linear value of every 8 bit sRGB channel, built at compile time in the FM_IMPLEMENTATION file
+        struct srgb8_table { float Values[256]; };
+        extern const srgb8_table Srgb8ToLinearTable;
+    }
+    FM_SINL float FM_CALL SrgbToLinear(float X) {
+        return _mm_cvtss_f32(priv::SrgbToLinearLanes<4>(_mm_set_ss(X)));
+    }
+    FM_SINL float FM_CALL LinearToSrgb(float X) {
+        return _mm_cvtss_f32(priv::LinearToSrgbLanes<4>(_mm_set_ss(X)));
+    }
+    FM_SINL vec4 FM_CALL SrgbToLinear(vec4 V) {
+        V.M = priv::KeepAlpha(priv::SrgbToLinearLanes<4>(V.M), V.M);
+        return V;
+    }
+    FM_SINL vec4 FM_CALL LinearToSrgb(vec4 V) {
+        V.M = priv::KeepAlpha(priv::LinearToSrgbLanes<4>(V.M), V.M);
+        return V;
+    }
+    FM_SINL v4 FM_CALL SrgbToLinear(v4 V) {
+        return CastToV4(SrgbToLinear(CastToVec4(V)));
+    }
+    FM_SINL v4 FM_CALL LinearToSrgb(v4 V) {
+        return CastToV4(LinearToSrgb(CastToVec4(V)));
+    }
+    FM_SINL vec4 FM_CALL Vec4FromSrgb8(v4u8 V) {
+        const float* Table = priv::Srgb8ToLinearTable.Values;
+        return Vec4(Table[V.X], Table[V.Y], Table[V.Z], (float)V.W / 255.f);
+    }
+    FM_SINL v4 FM_CALL V4FromSrgb8(v4u8 V) {
+        const float* Table = priv::Srgb8ToLinearTable.Values;
+        return v4(Table[V.X], Table[V.Y], Table[V.Z], (float)V.W / 255.f);
+    }
+    FM_SINL v4u8 FM_CALL PackSrgb8(vec4 V) {
+        return PackUnorm8(LinearToSrgb(V));
+    }
+    FM_SINL v4u8 FM_CALL PackSrgb8(v4 V) {
+        return PackSrgb8(CastToVec4(V));
+    }
+    
+    /////////////////////
+    // rect2 functions //
+    /////////////////////
+    template<class t> template<class u> constexpr rect2_base<t>::rect2_base(rect2_base<u> A)
+        :Min((v2_base<t>)A.Min), Max((v2_base<t>)A.Max) {}
+    FM_FUN_TSI GetWidth(rect2_base<t> A) -> t {
+        return A.Max.X - A.Min.X;
+    }
+    FM_FUN_TSI GetHeight(rect2_base<t> A) -> t {
+        return A.Max.Y - A.Min.Y;
+    }
+    FM_FUN_TSI GetW(rect2_base<t> A) -> t {
+        return GetWidth(A);
+    }
+    FM_FUN_TSI GetH(rect2_base<t> A) -> t {
+        return GetHeight(A);
+    }
+    FM_FUN_TSI GetDim(rect2_base<t> A) -> v2_base<t> {
+        return A.Max - A.Min;
+    }
+    FM_FUN_TSI GetSize(rect2_base<t> A) -> v2_base<t> {
+        return GetDim(A);
+    }
+    FM_FUN_TSI GetRadius(rect2_base<t> A) -> v2_base<t> {
+        return GetDim(A) / (t)2;
+    }
+    FM_FUN_TSI GetRadiusX(rect2_base<t> A) -> t {
+        return GetWidth(A) / (t)2;
+    }
+    FM_FUN_TSI GetRadiusY(rect2_base<t> A) -> t {
+        return GetHeight(A) / (t)2;
+    }
+    FM_FUN_TSI GetArea(rect2_base<t> A) -> t {
+        auto Dim = GetDim(A);
+        return Dim.W * Dim.H;
+    }
+    FM_FUN_TSI GetCenter(rect2_base<t> A) -> v2_base<t> {
+        return v2_base<t>((A.Min + A.Max) / (t)2);
+    }
+    FM_FUN_TSI GetMaxXMinY(rect2_base<t> A) -> v2_base<t> {
+        return v2_base<t>(A.Max.X, A.Min.Y);
+    }
+    FM_FUN_TSI GetMinXMaxY(rect2_base<t> A) -> v2_base<t> {
+        return v2_base<t>(A.Min.X, A.Max.Y);
+    }
+    FM_FUN_TSI GetMinYCenter(rect2_base<t> A) -> v2_base<t> {
+        return v2_base<t>(A.Min.X + GetWidth(A)/(t)2, A.Min.Y);
+    }
+    FM_FUN_TSI GetMaxYCenter(rect2_base<t> A) -> v2_base<t> {
+        return v2_base<t>(A.Min.X + GetWidth(A)/(t)2, A.Max.Y);
+    }
+    FM_FUN_TSI GetMinXCenter(rect2_base<t> A) -> v2_base<t> {
+        return v2_base<t>(A.Min.X, A.Min.Y + GetHeight(A)/(t)2);
+    }
+    FM_FUN_TSI GetMaxXCenter(rect2_base<t> A) -> v2_base<t> {
+        return v2_base<t>(A.Max.X, A.Min.Y + GetHeight(A)/(t)2);
+    }
+    FM_FUN_TSI SetCenter(rect2_base<t> A, v2_base<t> Center) -> rect2_base<t> {
+        auto Radius = GetRadius(A);
+        A.Min = Center - Radius;
+        A.Max = Center + Radius;
         return A;
     }
-    FM_FUN_SIC operator*(mat4 M, vec4 V) -> vec4 {
-        __m128 Row1 = _mm_setr_ps(priv::GetX(M.Columns[0]), priv::GetX(M.Columns[1]),
-                                  priv::GetX(M.Columns[2]), priv::GetX(M.Columns[3]));
-        __m128 Row2 = _mm_setr_ps(priv::GetY(M.Columns[0]), priv::GetY(M.Columns[1]),
-                                  priv::GetY(M.Columns[2]), priv::GetY(M.Columns[3]));
-        __m128 Row3 = _mm_setr_ps(priv::GetZ(M.Columns[0]), priv::GetZ(M.Columns[1]),
-                                  priv::GetZ(M.Columns[2]), priv::GetZ(M.Columns[3]));
-        __m128 Row4 = _mm_setr_ps(priv::GetW(M.Columns[0]), priv::GetW(M.Columns[1]),
-                                  priv::GetW(M.Columns[2]), priv::GetW(M.Columns[3]));
-        float X = priv::SumOfElements(_mm_mul_ps(Row1, V.M)); 
-        float Y = priv::SumOfElements(_mm_mul_ps(Row2, V.M)); 
-        float Z = priv::SumOfElements(_mm_mul_ps(Row3, V.M)); 
-        float W = priv::SumOfElements(_mm_mul_ps(Row4, V.M));
-        return Vec4(X, Y, Z, W);
+    FM_FUN_TSI SetCenter(rect2_base<t> A, t X, t Y) -> rect2_base<t> {
+        return SetCenter(A, v2_base<t>(X, Y));
     }
-    FM_FUN_SIC operator*(mat4 M, v4 V) -> v4 {
-        // TODO: Try to implement the logic in v4 function and make vec4 version call it. 
-        //       Maybe just make separate implementations. Profile it!
-        return CastToV4(M * CastToVec4(V));
+    FM_FUN_TSI SetCenter(rect2_base<t>* A, v2_base<t> Center) -> void {
+        *A = SetCenter(*A, Center);
     }
-    FM_FUN_SIC operator*(mat4 M, float Scalar) -> mat4 {
-        __m128 ScalarM = _mm_set1_ps(Scalar);
-        for(uint32_t Col = 0; Col < 4; ++Col)
-            M.Columns[Col] = _mm_mul_ps(M.Columns[Col], ScalarM);
-        return M;
+    FM_FUN_TSI SetCenter(rect2_base<t>* A, t X, t Y) -> void {
+        *A = SetCenter(*A, X, Y);
     }
-    FM_FUN_SIC HadamardMul(mat4 A, mat4 B) -> mat4 {
-        for(uint32_t Col = 0; Col < 4; ++Col)
-            A.Columns[Col] = _mm_mul_ps(A.Columns[Col], B.Columns[Col]);
+    FM_FUN_TSI SetDimWithFixedCenter(rect2_base<t> A, v2_base<t> Dim) -> rect2_base<t> {
+        auto NewRadius = Dim / (t)2;
+        auto Center = GetCenter(A);
+        A.Min = Center - NewRadius;
+        A.Max = Center + NewRadius;
         return A;
     }
-    FM_FUN_SIC HadamardDiv(mat4 A, mat4 B) -> mat4 {
-        for(uint32_t Col = 0; Col < 4; ++Col)
-            A.Columns[Col] = _mm_div_ps(A.Columns[Col], B.Columns[Col]);
+    FM_FUN_TSI SetDimWithFixedCenter(rect2_base<t> A, t Width, t Height) -> rect2_base<t> {
+        return SetDimWithFixedCenter(A, v2_base<t>(Width, Height));
+    }
+    FM_FUN_TSI SetDimWithFixedCenter(rect2_base<t>* A, t Width, t Height) -> void {
+        *A = SetDimWithFixedCenter(*A, Width, Height);
+    }
+    FM_FUN_TSI SetDimWithFixedCenter(rect2_base<t>* A, v2_base<t> Dim) -> void {
+        *A = SetDimWithFixedCenter(*A, Dim);
+    }
+    FM_FUN_TSI SetDimWithFixedMin(rect2_base<t> A, v2_base<t> Dim) -> rect2_base<t> {
+        A.Max = A.Min + Dim;
         return A;
     }
-    FM_FUN_SIC operator*(float Scalar, mat4 M) -> mat4 {
-        return M * Scalar;
+    FM_FUN_TSI SetDimWithFixedMin(rect2_base<t> A, t Width, t Height) -> rect2_base<t> {
+        return SetDimWithFixedMin(A, v2_base<t>(Width, Height));
     }
-    FM_FUN_SIC operator*=(mat4& M, float Scalar) -> mat4& {
-        M = M * Scalar;	
-        return M;
+    FM_FUN_TSI SetDimWithFixedMin(rect2_base<t>* A, v2_base<t> Dim) -> void {
+        *A = SetDimWithFixedMin(*A, Dim);
     }
-    FM_FUN_SIC operator/(mat4 M, float Scalar) -> mat4 {
-        __m128 ScalarM = _mm_set1_ps(Scalar);
-        for(uint32_t Col = 0; Col < 4; ++Col)
-            M.Columns[Col] = _mm_div_ps(M.Columns[Col], ScalarM);
-        return M;
+    FM_FUN_TSI SetDimWithFixedMin(rect2_base<t>* A, t Width, t Height) -> void {
+        *A = SetDimWithFixedMin(*A, v2_base<t>(Width, Height));
     }
-    FM_FUN_SIC operator/=(mat4& M, float Scalar) -> mat4& {
-        M = M / Scalar;
-        return M;
+    FM_FUN_TSI SetDimWithFixedMax(rect2_base<t> A, v2_base<t> Dim) -> rect2_base<t> {
+        A.Min = A.Max - Dim;
+        return A;
     }
-    FM_FUN_SIC operator==(mat4 A, mat4 B) -> bool {
-        bool R = true;
-        for(uint32_t Col = 0; Col < 4; ++Col)
+    FM_FUN_TSI SetDimWithFixedMax(rect2_base<t> A, t Width, t Height) -> rect2_base<t> {
+        return SetDimWithFixedMax(A, v2_base<t>(Width, Height));
+    }
+    FM_FUN_TSI SetDimWithFixedMax(rect2_base<t>* A, v2_base<t> Dim) -> void {
+        *A = SetDimWithFixedMax(*A, Dim);
+    }
+    FM_FUN_TSI SetDimWithFixedMax(rect2_base<t>* A, t Width, t Height) -> void {
+        *A = SetDimWithFixedMax(*A, v2_base<t>(Width, Height));
+    }
+    FM_FUN_TSI SetMin(rect2_base<t> A, v2_base<t> Min) -> rect2_base<t> {
+        auto Dim = GetDim(A);
+        A.Min = Min;
+        A.Max = Min + Dim;
+        return A;
+    }
+    FM_FUN_TSI SetMin(rect2_base<t>* A, v2_base<t> Min) -> void {
+        *A = SetMin(*A, Min);
+    }
+    FM_FUN_TSI SetMax(rect2_base<t> A, v2_base<t> Max) -> rect2_base<t> {
+        auto Dim = GetDim(A);
+        A.Min = Max - Dim;
+        A.Max = Max;
+        return A;
+    }
+    FM_FUN_TSI SetMax(rect2_base<t>* A, v2_base<t> Max) -> void {
+        *A = SetMax(*A, Max);
+    }
+    FM_FUN_TSI SetMaxXMinY(rect2_base<t> A, v2_base<t> P) -> rect2_base<t> {
+        auto Dim = GetDim(A);
+        A.Min = {P.X - Dim.W, P.Y};
+        A.Max = {P.X, P.Y + Dim.H};
+        return A;
+    }
+    FM_FUN_TSI SetMaxXMinY(rect2_base<t>* A, v2_base<t> P) -> void {
+        *A = SetMaxXMinY(*A, P);
+    }
+    FM_FUN_TSI SetMinXMaxY(rect2_base<t> A, v2_base<t> P) -> rect2_base<t> {
+        auto Dim = GetDim(A);
+        A.Min = {P.X, P.Y - Dim.H};
+        A.Max = {P.X + Dim.W, P.Y};
+        return A;
+    }
+    FM_FUN_TSI SetMinXMaxY(rect2_base<t>* A, v2_base<t> P) -> void {
+        *A = SetMinXMaxY(*A, P);
+    }
+    FM_FUN_TSI SetCenterXMinY(rect2_base<t> A, v2_base<t> P) -> rect2_base<t> {
+        t Rx = GetRadiusX(A);
+        t H = GetHeight(A);
+        A.Min = {P.X - Rx, P.Y};
+        A.Max = {P.X + Rx, P.Y + H};
+        return A;
+    }
+    FM_FUN_TSI SetCenterXMinY(rect2_base<t>* A, v2_base<t> P) -> void {
+        *A = SetCenterXMinY(*A, P);
+    }
+    FM_FUN_TSI SetCenterXMaxY(rect2_base<t> A, v2_base<t> P) -> rect2_base<t> {
+        t Rx = GetRadiusX(A);
+        t H = GetHeight(A);
+        A.Min = {P.X - Rx, P.Y - H};
+        A.Max = {P.X + Rx, P.Y};
+        return A;
+    }
+    FM_FUN_TSI SetCenterXMaxY(rect2_base<t>* A, v2_base<t> P) -> void {
+        *A = SetCenterXMaxY(*A, P);
+    }
+    FM_FUN_TSI SetMinXCenterY(rect2_base<t> A, v2_base<t> P) -> rect2_base<t> {
+        t Ry = GetRadiusY(A);
+        t W = GetWidth(A);
+        A.Min = {P.X, P.Y - Ry};
+        A.Max = {P.X + W, P.Y + Ry};
+        return A;
+    }
+    FM_FUN_TSI SetMinXCenterY(rect2_base<t>* A, v2_base<t> P) -> void {
+        *A = SetMinXCenterY(*A, P);
+    }
+    FM_FUN_TSI SetMaxXCenterY(rect2_base<t> A, v2_base<t> P) -> rect2_base<t> {
+        t Ry = GetRadiusY(A);
+        t W = GetWidth(A);
+        A.Min = {P.X - W, P.Y - Ry};
+        A.Max = {P.X, P.Y + Ry};
+        return A;
+    }
+    FM_FUN_TSI SetMaxXCenterY(rect2_base<t>* A, v2_base<t> P) -> void {
+        *A = SetMaxXCenterY(*A, P);
+    }
+    FM_FUN_TSI HasArea(rect2_base<t> A) -> bool {
+        return A.Min.X < A.Max.X && A.Min.Y < A.Max.Y;
+    }
+    FM_FUN_TSI HasAreaFlipAllowed(rect2_base<t> A) -> bool {
+        return A.Min.X != A.Max.X && A.Min.Y != A.Max.Y;
+    }
+    FM_FUN_TSI Rect2BaseMinMax(t MinX, t MinY, t MaxX, t MaxY) -> rect2_base<t> {
+        rect2_base<t> R;
+        R.Min.X = MinX;
+        R.Min.Y = MinY;
+        R.Max.X = MaxX;
+        R.Max.Y = MaxY;
+        return R;
+    }
+    FM_FUN_TSI Rect2BaseMinMax(v2_base<t> Min, v2_base<t> Max) -> rect2_base<t> {
+        rect2_base<t> R;
+        R.Min = Min;
+        R.Max = Max;
+        return R;
+    }
+    FM_FUN_TSI Rect2BaseMinDim(t MinX, t MinY, t Width, t Height) -> rect2_base<t> {
+        rect2_base<t> R;
+        R.Min.X = MinX;
+        R.Min.Y = MinY;
+        R.Max.X = MinX + Width;
+        R.Max.Y = MinY + Height;
+        return R;
+    }
+    FM_FUN_TSI Rect2BaseMinDim(v2_base<t> Min, v2_base<t> Dim) -> rect2_base<t> {
+        rect2_base<t> R;
+        R.Min = Min;
+        R.Max = Min + Dim;
+        return R;
+    }
+    FM_FUN_TSI Rect2BaseDimMax(t Width, t Height, t MaxX, t MaxY) -> rect2_base<t> {
+        rect2_base<t> R;
+        R.Min.X = MaxX - Width;
+        R.Min.Y = MaxY - Height;
+        R.Max.X = MaxX;
+        R.Max.Y = MaxY;
+        return R;
+    }
+    FM_FUN_TSI Rect2BaseDimMax(v2_base<t> Dim, v2_base<t> Max) -> rect2_base<t> {
+        rect2_base<t> R;
+        R.Min = Max - Dim;
+        R.Max = Max;
+        return R;
+    }
+    FM_FUN_TSI Rect2BaseCenterRadius(v2_base<t> Center, t Radius) -> rect2_base<t> {
+        rect2_base<t> R;
+        R.Min.X = Center.X - Radius;
+        R.Min.Y = Center.Y - Radius;
+        R.Max.X = Center.X + Radius;
+        R.Max.Y = Center.Y + Radius;
+        return R;
+    }
+    FM_FUN_TSI Rect2BaseCenterRadius(v2_base<t> Center, v2_base<t> Radius) -> rect2_base<t> {
+        rect2_base<t> R;
+        R.Min = Center - Radius;
+        R.Max = Center + Radius;
+        return R;
+    }
+    FM_FUN_TSI Rect2BaseCenterDim(v2_base<t> Center, t Dim) -> rect2_base<t> {
+        return Rect2BaseCenterRadius<t>(Center, Dim / (t)2);
+    }
+    FM_FUN_TSI Rect2BaseCenterDim(v2_base<t> Center, v2_base<t> Dim) -> rect2_base<t> {
+        return Rect2BaseCenterRadius<t>(Center, Dim / (t)2);
+    }
+    FM_FUN_TSI Rect2BaseDim(v2_base<t> Dim) -> rect2_base<t> {
+        rect2_base<t> R;
+        R.Min = {};
+        R.Max = Dim;
+        return R;
+    }
+    FM_FUN_TSI Rect2BaseDim(t Width, t Height) -> rect2_base<t> {
+        return Rect2BaseDim<t>({Width, Height});
+    }
+    FM_FUN_TSI Ptr(rect2_base<t>& A) -> t* {
+        return &A.Min.X;
+    }
+    FM_FUN_TSI PtrMax(rect2_base<t>& A) -> t* {
+        return &A.Max.X;
+    }
+    FM_FUN_TSI operator*(rect2_base<t> A, t Scalar) -> rect2_base<t> {
+        A.Min *= Scalar;
+        A.Max *= Scalar;
+        return A;
+    }
+    FM_FUN_TSI operator/(rect2_base<t> A, t Scalar) -> rect2_base<t> {
+        A.Min /= Scalar;
+        A.Max /= Scalar;
+        return A;
+    }
+    FM_FUN_TSI ScaleWithFixedMin(rect2_base<t> A, v2_base<t> ACurrentDim, v2_base<t> Scalar) -> rect2_base<t> {
+        auto NewDim = HadamardMul(ACurrentDim, Scalar);
+        return SetDimWithFixedMin(A, NewDim);
+    }
+    FM_FUN_TSI ScaleWithFixedMin(rect2_base<t> A, v2_base<t> Scalar) -> rect2_base<t> {
+        return ScaleWithFixedMin(A, GetDim(A), Scalar);
+    }
+    FM_FUN_TSI ScaleWithFixedMin(rect2_base<t> A, v2_base<t> ACurrentDim, t Scalar) -> rect2_base<t> {
+        return ScaleWithFixedMin(A, ACurrentDim, v2_base<t>(Scalar));
+    }
+    FM_FUN_TSI ScaleWithFixedMin(rect2_base<t> A, t Scalar) -> rect2_base<t> {
+        return ScaleWithFixedMin(A, v2_base<t>(Scalar));
+    }
+    FM_FUN_TSI ScaleWithFixedMin(rect2_base<t>* A, v2_base<t> ACurrentDim, v2_base<t> Scalar) -> void {
+        *A = ScaleWithFixedMin(*A, ACurrentDim, Scalar);	
+    }
+    FM_FUN_TSI ScaleWithFixedMin(rect2_base<t>* A, v2_base<t> Scalar) -> void {
+        *A = ScaleWithFixedMin(*A, Scalar);	
+    }
+    FM_FUN_TSI ScaleWithFixedMin(rect2_base<t>* A, v2_base<t> ACurrentDim, t Scalar) -> void {
+        *A = ScaleWithFixedMin(*A, ACurrentDim, v2_base<t>(Scalar));
+    }
+    FM_FUN_TSI ScaleWithFixedMin(rect2_base<t>* A, t Scalar) -> void {
+        *A = ScaleWithFixedMin(*A, v2_base<t>(Scalar));
+    }
+    FM_FUN_TSI ScaleWithFixedMax(rect2_base<t> A, v2_base<t> ACurrentDim, v2_base<t> Scalar) -> rect2_base<t> {
+        auto NewDim = HadamardMul(ACurrentDim, Scalar);
+        return SetDimWithFixedMax(A, NewDim);
+    }
+    FM_FUN_TSI ScaleWithFixedMax(rect2_base<t> A, v2_base<t> Scalar) -> rect2_base<t> {
+        return ScaleWithFixedMax(A, GetDim(A), Scalar);
+    }
+    FM_FUN_TSI ScaleWithFixedMax(rect2_base<t> A, v2_base<t> ACurrentDim, t Scalar) -> rect2_base<t> {
+        return ScaleWithFixedMax(A, ACurrentDim, v2_base<t>(Scalar));
+    }
+    FM_FUN_TSI ScaleWithFixedMax(rect2_base<t> A, t Scalar) -> rect2_base<t> {
+        return ScaleWithFixedMax(A, v2_base<t>(Scalar));
+    }
+    FM_FUN_TSI ScaleWithFixedMax(rect2_base<t>* A, v2_base<t> ACurrentDim, v2_base<t> Scalar) -> void {
+        *A = ScaleWithFixedMax(*A, ACurrentDim, Scalar);	
+    }
+    FM_FUN_TSI ScaleWithFixedMax(rect2_base<t>* A, v2_base<t> Scalar) -> void {
+        *A = ScaleWithFixedMax(*A, Scalar);	
+    }
+    FM_FUN_TSI ScaleWithFixedMax(rect2_base<t>* A, v2_base<t> ACurrentDim, t Scalar) -> void {
+        *A = ScaleWithFixedMax(*A, ACurrentDim, Scalar);	
+    }
+    FM_FUN_TSI ScaleWithFixedMax(rect2_base<t>* A, t Scalar) -> void {
+        *A = ScaleWithFixedMax(*A, Scalar);	
+    }
+    FM_FUN_TSI ScaleWithFixedCenter(rect2_base<t> A, v2_base<t> ACurrentDim, v2_base<t> Scalar) -> rect2_base<t> {
+        auto NewDim = HadamardMul(ACurrentDim, Scalar);
+        return SetDimWithFixedCenter(A, NewDim);
+    }
+    FM_FUN_TSI ScaleWithFixedCenter(rect2_base<t> A, v2_base<t> Scalar) -> rect2_base<t> {
+        return ScaleWithFixedCenter(A, GetDim(A), Scalar);
+    }
+    FM_FUN_TSI ScaleWithFixedCenter(rect2_base<t> A, v2_base<t> ACurrentDim, t Scalar) -> rect2_base<t> {
+        return ScaleWithFixedCenter(A, ACurrentDim, v2_base<t>(Scalar));
+    }
+    FM_FUN_TSI ScaleWithFixedCenter(rect2_base<t> A, t Scalar) -> rect2_base<t> {
+        return ScaleWithFixedCenter(A, v2_base<t>(Scalar));
+    }
+    FM_FUN_TSI ScaleWithFixedCenter(rect2_base<t>* A, v2_base<t> ACurrentDim, v2_base<t> Scalar) -> void {
+        *A = ScaleWithFixedCenter(*A, ACurrentDim, Scalar);	
+    }
+    FM_FUN_TSI ScaleWithFixedCenter(rect2_base<t>* A, v2_base<t> Scalar) -> void {
+        *A = ScaleWithFixedCenter(*A, Scalar);	
+    }
+    FM_FUN_TSI ScaleWithFixedCenter(rect2_base<t>* A, v2_base<t> ACurrentDim, t Scalar) -> void {
+        *A = ScaleWithFixedCenter(*A, ACurrentDim, Scalar);
+    }
+    FM_FUN_TSI ScaleWithFixedCenter(rect2_base<t>* A, t Scalar) -> void {
+        *A = ScaleWithFixedCenter(*A, Scalar);	
+    }
+    FM_FUN_TSI AddRadius(rect2_base<t> A, v2_base<t> Radius) -> rect2_base<t> {
+        A.Min -= Radius;
+        A.Max += Radius;
+        return A;
+    }
+    FM_FUN_TSI AddRadius(rect2_base<t> A, t Radius) -> rect2_base<t> {
+        return AddRadius(A, v2_base<t>(Radius));
+    }
+    FM_FUN_TSI AddRadius(rect2_base<t>* A, v2_base<t> Radius) -> void {
+        *A = AddRadius(*A, Radius);
+    }
+    FM_FUN_TSI AddRadius(rect2_base<t>* A, t Radius) -> void {
+        *A = AddRadius(*A, Radius);
+    }
+    FM_FUN_TSI MoveRect(rect2_base<t> A, v2_base<t> Offset) -> rect2_base<t> {
+        rect2_base<t> R;
+        R.Min = A.Min + Offset;
+        R.Max = A.Max + Offset;
+        return R;
+    }
+    FM_FUN_TSI MoveRect(rect2_base<t>* A, v2_base<t> Offset) -> void {
+        A->Min += Offset;
+        A->Max += Offset;
+    }
+    FM_FUN_TSI MakeRectNotHaveNegativeDim(rect2_base<t> A) -> rect2_base<t> {
+        rect2_base<t> R;
+        R.Min = Min(A.Min, A.Max);
+        R.Max = Max(A.Min, A.Max);
+        return R;
+    }
+    FM_FUN_TSI MakeRectNotHaveNegativeDim(rect2_base<t>* A) -> void {
+        *A = MakeRectNotHaveNegativeDim(*A);
+    }
+    FM_FUN_TSI MakeRectsNotHaveNegativeDim(rect2_base<t>* A, rect2_base<t>* B) -> void {
+        MakeRectNotHaveNegativeDim(A);
+        MakeRectNotHaveNegativeDim(B);
+    }
+    FM_FUN_TSI HasNegativeDim(rect2_base<t> A) -> bool {
+        return A.Min.X > A.Max.X || A.Min.Y > A.Max.Y;
+    }
+    FM_FUN_TSI HasNegativeWidth(rect2_base<t> A) -> bool {
+        return A.Min.X > A.Max.X;
+    }
+    FM_FUN_TSI HasNegativeHeight(rect2_base<t> A) -> bool {
+        return A.Min.Y > A.Max.Y;
+    }
+    FM_FUN_TSI HasNegativeW(rect2_base<t> A) -> bool {
+        return HasNegativeWidth(A);
+    }
+    FM_FUN_TSI HasNegativeH(rect2_base<t> A) -> bool {
+        return HasNegativeHeight(A);
+    }
+    FM_FUN_TSI Intersect(rect2_base<t> Rect, v2_base<t> Point) -> bool {
+        return Point.X > Rect.Min.X && Point.X < Rect.Max.X &&
+            Point.Y > Rect.Min.Y && Point.Y < Rect.Max.Y;
+    }
+    FM_FUN_TSI IntersectOrTouch(rect2_base<t> Rect, v2_base<t> Point) -> bool {
+        return Point.X >= Rect.Min.X && Point.X <= Rect.Max.X &&
+            Point.Y >= Rect.Min.Y && Point.Y <= Rect.Max.Y;
+    }
+    FM_FUN_TSI IntersectFlipAllowed(rect2_base<t> Rect, v2_base<t> Point) -> bool {
+        MakeRectNotHaveNegativeDim(&Rect);
+        return Intersect(Rect, Point);
+    }
+    FM_FUN_TSI IntersectOrTouchFlipAllowed(rect2_base<t> Rect, v2_base<t> Point) -> bool {
+        MakeRectNotHaveNegativeDim(&Rect);
+        return IntersectOrTouch(Rect, Point);
+    }
+    FM_FUN_TSI Intersect(rect2_base<t> A, rect2_base<t> B) -> bool {
+        return A.Max.X > B.Min.X && A.Min.X < B.Max.X &&
+            A.Max.Y > B.Min.Y && A.Min.Y < B.Max.Y;
+    }
+    FM_FUN_TSI IntersectOrTouch(rect2_base<t> A, rect2_base<t> B) -> bool {
+        return A.Max.X >= B.Min.X && A.Min.X <= B.Max.X &&
+            A.Max.Y >= B.Min.Y && A.Min.Y <= B.Max.Y;
+    }
+    FM_FUN_TSI FullyIntersect(rect2_base<t> A, rect2_base<t> B) -> bool {
+        return Intersect(A, B.Min) && Intersect(A, B.Max) &&
+            Intersect(A, GetMaxXMinY(B)) && Intersect(A, GetMinXMaxY(B));
+    }
+    FM_FUN_TSI FullyIntersectOrTouch(rect2_base<t> A, rect2_base<t> B) -> bool {
+        return IntersectOrTouch(A, B.Min) && IntersectOrTouch(A, B.Max) &&
+            IntersectOrTouch(A, GetMaxXMinY(B)) && IntersectOrTouch(A, GetMinXMaxY(B));
+    }
+    FM_FUN_TSI IntersectFlipAllowed(rect2_base<t> A, rect2_base<t> B) -> bool {
+        MakeRectsNotHaveNegativeDim(&A, &B);
+        return Intersect(A, B);
+    }
+    FM_FUN_TSI IntersectOrTouchFlipAllowed(rect2_base<t> A, rect2_base<t> B) -> bool {
+        MakeRectsNotHaveNegativeDim(&A, &B);
+        return IntersectOrTouch(A, B);
+    }
+    FM_FUN_TSI FullyIntersectFlipAllowed(rect2_base<t> A, rect2_base<t> B) -> bool {
+        MakeRectsNotHaveNegativeDim(&A, &B);
+        return FullyIntersect(A, B);
+    }
+    FM_FUN_TSI FullyIntersectOrTouchFlipAllowed(rect2_base<t> A, rect2_base<t> B) -> bool {
+        MakeRectsNotHaveNegativeDim(&A, &B);
+        return FullyIntersect(A, B);
+    }
+    FM_FUN_TSI IntersectionRect(rect2_base<t> A, rect2_base<t> B, rect2_base<t>* Intersection) -> bool {
+        auto RMin = Max(A.Min, B.Min);
+        auto RMax = Min(A.Max, B.Max);
+        if(RMin.X < RMax.X && RMin.Y < RMax.Y)
+        {
+            *Intersection = Rect2BaseMinMax<t>(RMin, RMax);
+            return true;
+        }
+        else
+        {
+            return false;
+        }
+    }
+    FM_FUN_TSI IntersectionRectFlipAllowed(rect2_base<t> A, rect2_base<t> B, rect2_base<t>* Intersection) -> bool {
+        MakeRectNotHaveNegativeDim(&A, &B);
+        return IntersectionRect(A, B, Intersection);
+    }
+    FM_FUN_TSI Union(rect2_base<t> A, rect2_base<t> B) -> rect2_base<t> {
+        rect2_base<t> R;
+        R.Min = Min(A.Min, B.Min);
+        R.Max = Max(A.Max, B.Max);
+        return R;
+    }
+    FM_FUN_TSI Union(rect2_base<t>* A, rect2_base<t> B) -> void {
+        *A = Union(*A, B);
+    }
+    FM_FUN_TSI Union(rect2_base<t> A, v2_base<t> P) -> rect2_base<t> {
+        rect2_base<t> R;
+        R.Min = Min(A.Min, P);
+        R.Max = Max(A.Max, P);
+        return R;
+    }
+    FM_FUN_TSI Union(rect2_base<t>* A, v2_base<t> B) -> void {
+        *A = Union(*A, B);
+    }
+    FM_FUN_TSI ClampToRect(v2_base<t> V, rect2_base<t> Rect) -> v2_base<t> {
+        FM_ASSERT(!HasNegativeDim(Rect));
+        if(V.X < Rect.Min.X)	
+            V.X = Rect.Min.X;
+        else if(V.X > Rect.Max.X)
+            V.X = Rect.Max.X;
+        if(V.Y < Rect.Min.Y)
+            V.Y = Rect.Min.Y;
+        else if(V.Y > Rect.Max.Y)
+            V.Y = Rect.Max.Y;
+        return V;
+    }
+    FM_FUN_TSI ClampToRectFlipAllowed(v2_base<t> V, rect2_base<t> Rect) {
+        Rect = MakeRectNotHaveNegativeDim(Rect);
+        ClampToRect(V, Rect);
+    }
+    FM_FUN_TSI ClampToRect(v2_base<t>* V, rect2_base<t> Rect) {
+        *V = ClampToRect(*V, Rect);
+    }
+    FM_FUN_TSI ClampToRectFlipAllowed(v2_base<t>* V, rect2_base<t> Rect) {
+        *V = ClampToRectFlipAllowed(*V, Rect);
+    }
+    FM_FUN_TSI FitRectInsideBounds(rect2_base<t> Rect, rect2_base<t> Bounds) -> rect2 {
+        auto RectDim = GetDim(Rect);
+        if(Rect.Min.X < Bounds.Min.X)
+        {
+            Rect.Min.X = Bounds.Min.X;
+            Rect.Max.X = Bounds.Min.X + RectDim.W;
+        }
+        if(Rect.Min.Y < Bounds.Min.Y)
+        {
+            Rect.Min.Y = Bounds.Min.Y;
+            Rect.Max.Y = Bounds.Min.Y + RectDim.H;
+        }
+        if(Rect.Max.X > Bounds.Max.X)
+        {
+            Rect.Min.X = Bounds.Max.X - RectDim.W;
+            Rect.Max.X = Bounds.Max.X;
+        }
+        if(Rect.Max.Y > Bounds.Max.Y)
+        {
+            Rect.Min.Y = Bounds.Max.Y - RectDim.H;
+            Rect.Max.Y = Bounds.Max.Y;
+        }
+        return Rect;
+    }
+    FM_FUN_TSI FitRectInsideBounds(rect2_base<t>* Rect, rect2_base<t> Bounds) -> void {
+        *Rect = FitRectInsideBounds(*Rect, Bounds);
+    }
+    FM_FUN_TSI GetWidthHeightRatio(rect2_base<t> Rect) -> t {
+        auto RectDim = GetDim(Rect);
+        return SafeDivN(RectDim.W, RectDim.H, InvalidF32);
+    }
+    FM_FUN_TSI GetHeightWidthRatio(rect2_base<t> Rect) -> t {
+        auto RectDim = GetDim(Rect);
+        return SafeDivN(RectDim.H, RectDim.W, InvalidF32);
+    }
+    FM_FUN_TSI ExpandToDesiredWidthHeightRatioWithFixedCenter(rect2_base<t> A, t DesiredWidthHeightRatio) -> rect2_base<t> {
+        t WidthHeightRatio = GetWidthHeightRatio(A);
+        FM_ASSERT(IsValid(WidthHeightRatio));
+        t Factor = DesiredWidthHeightRatio / WidthHeightRatio;
+        if(Factor > 1)
+            ScaleWithFixedCenter(&A, v2_base<t>(Factor, 1));
+        else
+            ScaleWithFixedCenter(&A, v2_base<t>(1, 1 / Factor));
+        return A;
+    }
+    FM_FUN_TSI ExpandToDesiredWidthHeightRatioWithFixedCenter(rect2_base<t>* A, t DesiredWidthHeightRatio) -> void {
+        *A = ExpandToDesiredWidthHeightRatioWithFixedCenter(*A, DesiredWidthHeightRatio);
+    }
+    FM_FUN_TSI operator==(rect2_base<t> A, rect2_base<t> B) -> bool {
+        return A.Min == B.Min && A.Max == B.Max;
+    }
+    FM_FUN_TSI operator!=(rect2_base<t> A, rect2_base<t> B) -> bool {
+        return !(A == B);
+    }
+    FM_FUN_TSI Equal(rect2_base<t> A, rect2_base<t> B, t Epsilon = constants<t>::Epsilon()) -> bool {
+        return Equal(A.Min, B.Min) && Equal(A.Max, B.Max);
+    }
+    FM_FUN_TSI Lerp(rect2_base<t> Source, rect2_base<t> Dest, float T) -> rect2_base<t> {
+        rect2_base<t> R;
+        R.Min = Lerp((v2)Source.Min, (v2)Dest.Min, T);
+        R.Max = Lerp((v2)Source.Max, (v2)Dest.Max, T);
+        return (rect2_base<t>)(R);
+    }
+    FM_FUN_TSI FastLerp(rect2_base<t> Source, rect2_base<t> Dest, float T) -> rect2_base<t> {
+        rect2_base<t> R;
+        R.Min = (v2_base<t>)FastLerp((v2)Source.Min, (v2)Dest.Min, T);
+        R.Max = (v2_base<t>)FastLerp((v2)Source.Max, (v2)Dest.Max, T);
+        return R;
+    }
+	
+#define FM_RECT2_MIN_MAX(InsideName, T) \
+FM_FUN_SIE Rect2##InsideName##MinMax(T Left, T Top, T Right, T Bottom) -> rect2_base<T>\
+{ return Rect2BaseMinMax<T>(Left, Top, Right, Bottom); }
+    FM_GENERIC_FUNCTION(FM_RECT2_MIN_MAX);
+	
+#define FM_RECT2_MIN_MAX_2(InsideName, T) \
+FM_FUN_SIE Rect2##InsideName##MinMax(v2_base<T> Min, v2_base<T> Max) -> rect2_base<T>\
+{ return Rect2BaseMinMax<T>(Min, Max); }
+    FM_GENERIC_FUNCTION(FM_RECT2_MIN_MAX_2);
+	
+#define FM_RECT2_MIN_DIM(InsideName, T) \
+FM_FUN_SIE Rect2##InsideName##MinDim(T Left, T Top, T Width, T Height) -> rect2_base<T>\
+{ return Rect2BaseMinDim<T>(Left, Top, Width, Height); }
+    FM_GENERIC_FUNCTION(FM_RECT2_MIN_DIM);
+	
+#define FM_RECT2_MIN_DIM_2(InsideName, T) \
+FM_FUN_SIE Rect2##InsideName##MinDim(v2_base<T> Min, v2_base<T> Dim) -> rect2_base<T>\
+{ return Rect2BaseMinDim<T>(Min, Dim); }
+    FM_GENERIC_FUNCTION(FM_RECT2_MIN_DIM_2);
+	
+#define FM_RECT2_DIM_MAX(InsideName, T) \
+FM_FUN_SIE Rect2##InsideName##DimMax(T Width, T Height, T MaxX, T MaxY) -> rect2_base<T>\
+{ return Rect2BaseDimMax<T>(Width, Height, MaxX, MaxY); }
+    FM_GENERIC_FUNCTION(FM_RECT2_DIM_MAX);
+	
+#define FM_RECT2_DIM_MAX_2(InsideName, T) \
+FM_FUN_SIE Rect2##InsideName##DimMax(v2_base<T> Dim, v2_base<T> Max) -> rect2_base<T>\
+{ return Rect2BaseDimMax<T>(Dim, Max); }
+    FM_GENERIC_FUNCTION(FM_RECT2_DIM_MAX_2);
+	
+#define FM_RECT2_CENTER_RADIUS(InsideName, T) \
+FM_FUN_SIE Rect2##InsideName##CenterRadius(v2_base<T> Center, T Radius) -> rect2_base<T>\
+{ return Rect2BaseCenterRadius<T>(Center, Radius); }
+    FM_GENERIC_FUNCTION(FM_RECT2_CENTER_RADIUS);
+	
+#define FM_RECT2_CENTER_RADIUS_2(InsideName, T) \
+FM_FUN_SIE Rect2##InsideName##CenterRadius(v2_base<T> Center, v2_base<T> Radius) -> rect2_base<T>\
+{ return Rect2BaseCenterRadius<T>(Center, Radius); }
+    FM_GENERIC_FUNCTION(FM_RECT2_CENTER_RADIUS_2);
+	
+#define FM_RECT2_CENTER_DIM(InsideName, T) \
+FM_FUN_SIE Rect2##InsideName##CenterDim(v2_base<T> Center, T Dim) -> rect2_base<T>\
+{ return Rect2BaseCenterDim<T>(Center, Dim); }
+    FM_GENERIC_FUNCTION(FM_RECT2_CENTER_DIM);
+	
+#define FM_RECT2_CENTER_DIM_2(InsideName, T) \
+FM_FUN_SIE Rect2##InsideName##CenterDim(v2_base<T> Center, v2_base<T> Dim) -> rect2_base<T>\
+{ return Rect2BaseCenterDim<T>(Center, Dim); }
+    FM_GENERIC_FUNCTION(FM_RECT2_CENTER_DIM_2);
+	
+#define FM_RECT2_DIM(InsideName, T) \
+FM_FUN_SIE Rect2##InsideName##Dim(v2_base<T> Dim) -> rect2_base<T>\
+{ return Rect2BaseDim<T>(Dim); }
+    FM_GENERIC_FUNCTION(FM_RECT2_DIM);
+	
+#define FM_RECT2_DIM_2(InsideName, T) \
+FM_FUN_SIE Rect2##InsideName##Dim(T Width, T Height) -> rect2_base<T>\
+{ return Rect2BaseDim<T>(Width, Height); }
+    FM_GENERIC_FUNCTION(FM_RECT2_DIM_2);
+	
+#define FM_Rect2ToMinMax(_Rect, _Min, _Max) \
+auto _Min = (_Rect).Min; \
+auto _Max = (_Rect).Max
+	
+#define FM_Rect2ToMinDim(_Rect, _Min, _Dim) \
+auto _Min = (_Rect).Min; \
+auto _Dim = GetDim(_Rect);
+    
+    //////////////////////
+    // rect2s functions //
+    //////////////////////
+    namespace priv {
+        // NOTE: Flipping the sign of the max lanes turns every Min < X < Max test into one compare
+        FM_SINL __m128 FM_CALL NegateMaxLanes(__m128 A) {
+            return _mm_xor_ps(A, _mm_castsi128_ps(_mm_setr_epi32(0, 0, (int32_t)0x80000000, (int32_t)0x80000000)));
+        }
+        FM_SINL __m128 FM_CALL MinLanes(__m128 A) { return _mm_shuffle_ps(A, A, _MM_SHUFFLE(1, 0, 1, 0)); }
+        FM_SINL __m128 FM_CALL MaxLanes(__m128 A) { return _mm_shuffle_ps(A, A, _MM_SHUFFLE(3, 2, 3, 2)); }
+        FM_SINL __m128 FM_CALL SwapMinMax(__m128 A) { return _mm_shuffle_ps(A, A, _MM_SHUFFLE(1, 0, 3, 2)); }
+        FM_SINL __m128 FM_CALL PointLanes(v2 P) { return _mm_setr_ps(P.X, P.Y, P.X, P.Y); }
+        FM_SINL __m128 FM_CALL DimLanes(__m128 A) { return _mm_sub_ps(MaxLanes(A), MinLanes(A)); }
+        FM_SINL bool FM_CALL PointInside(__m128 Rect, __m128 Point) {
+            return _mm_movemask_ps(_mm_cmplt_ps(NegateMaxLanes(Rect), NegateMaxLanes(Point))) == 0xF;
+        }
+        FM_SINL bool FM_CALL PointInsideOrTouch(__m128 Rect, __m128 Point) {
+            return _mm_movemask_ps(_mm_cmple_ps(NegateMaxLanes(Rect), NegateMaxLanes(Point))) == 0xF;
+        }
+        // NOTE: Lanes in SubMask become Point - Offset, lanes in AddMask become Point + Offset, the rest stay Point
+        template<int SubMask, int AddMask> FM_INL __m128 FM_CALL AnchorLanes(v2 Point, __m128 Offset) {
+            __m128 P = PointLanes(Point);
+            return Blend<AddMask>(Blend<SubMask>(P, _mm_sub_ps(P, Offset)), _mm_add_ps(P, Offset));
+        }
+    }
+    FM_INL float FM_CALL rect2s::MinX() const { return priv::GetX(M); }
+    FM_INL float FM_CALL rect2s::MinY() const { return priv::GetY(M); }
+    FM_INL float FM_CALL rect2s::MaxX() const { return priv::GetZ(M); }
+    FM_INL float FM_CALL rect2s::MaxY() const { return priv::GetW(M); }
+    FM_INL v2 FM_CALL rect2s::Min() const { return v2(MinX(), MinY()); }
+    FM_INL v2 FM_CALL rect2s::Max() const { return v2(MaxX(), MaxY()); }
+    
+    FM_FUN_SIC Rect2s(__m128 M) -> rect2s {
+        rect2s R;
+        R.M = M;
+        return R;
+    }
+    FM_FUN_SIC Rect2sMinMax(float MinX, float MinY, float MaxX, float MaxY) -> rect2s {
+        return Rect2s(_mm_setr_ps(MinX, MinY, MaxX, MaxY));
+    }
+    FM_FUN_SIC Rect2sMinMax(v2 Min, v2 Max) -> rect2s {
+        return Rect2sMinMax(Min.X, Min.Y, Max.X, Max.Y);
+    }
+    FM_FUN_SIC Rect2sMinDim(float MinX, float MinY, float Width, float Height) -> rect2s {
+        __m128 Min = _mm_setr_ps(MinX, MinY, MinX, MinY);
+        return Rect2s(_mm_add_ps(Min, _mm_setr_ps(0.f, 0.f, Width, Height)));
+    }
+    FM_FUN_SIC Rect2sMinDim(v2 Min, v2 Dim) -> rect2s {
+        return Rect2sMinDim(Min.X, Min.Y, Dim.X, Dim.Y);
+    }
+    FM_FUN_SIC Rect2sDimMax(float Width, float Height, float MaxX, float MaxY) -> rect2s {
+        __m128 Max = _mm_setr_ps(MaxX, MaxY, MaxX, MaxY);
+        return Rect2s(_mm_sub_ps(Max, _mm_setr_ps(Width, Height, 0.f, 0.f)));
+    }
+    FM_FUN_SIC Rect2sDimMax(v2 Dim, v2 Max) -> rect2s {
+        return Rect2sDimMax(Dim.X, Dim.Y, Max.X, Max.Y);
+    }
+    FM_FUN_SIC Rect2sCenterRadius(v2 Center, v2 Radius) -> rect2s {
+        return Rect2s(_mm_add_ps(priv::PointLanes(Center), _mm_setr_ps(-Radius.X, -Radius.Y, Radius.X, Radius.Y)));
+    }
+    FM_FUN_SIC Rect2sCenterRadius(v2 Center, float Radius) -> rect2s {
+        return Rect2sCenterRadius(Center, v2(Radius));
+    }
+    FM_FUN_SIC Rect2sCenterDim(v2 Center, v2 Dim) -> rect2s {
+        return Rect2sCenterRadius(Center, Dim / 2.f);
+    }
+    FM_FUN_SIC Rect2sCenterDim(v2 Center, float Dim) -> rect2s {
+        return Rect2sCenterRadius(Center, Dim / 2.f);
+    }
+    FM_FUN_SIC Rect2sDim(float Width, float Height) -> rect2s {
+        return Rect2sMinMax(0.f, 0.f, Width, Height);
+    }
+    FM_FUN_SIC Rect2sDim(v2 Dim) -> rect2s {
+        return Rect2sDim(Dim.X, Dim.Y);
+    }
+    FM_FUN_SIC CastToRect2s(rect2 A) -> rect2s {
+        return Rect2s(_mm_loadu_ps(&A.Min.X));
+    }
+    FM_FUN_SIC CastToRect2(rect2s A) -> rect2 {
+        rect2 R;
+        _mm_storeu_ps(&R.Min.X, A.M);
+        return R;
+    }
+    
+    FM_FUN_SIC GetDim(rect2s A) -> v2 {
+        __m128 Dim = priv::DimLanes(A.M);
+        return v2(priv::GetX(Dim), priv::GetY(Dim));
+    }
+    FM_FUN_SIC GetSize(rect2s A) -> v2 {
+        return GetDim(A);
+    }
+    FM_FUN_SIC GetWidth(rect2s A) -> float {
+        return A.MaxX() - A.MinX();
+    }
+    FM_FUN_SIC GetHeight(rect2s A) -> float {
+        return A.MaxY() - A.MinY();
+    }
+    FM_FUN_SIC GetW(rect2s A) -> float {
+        return GetWidth(A);
+    }
+    FM_FUN_SIC GetH(rect2s A) -> float {
+        return GetHeight(A);
+    }
+    FM_FUN_SIC GetRadius(rect2s A) -> v2 {
+        return GetDim(A) / 2.f;
+    }
+    FM_FUN_SIC GetRadiusX(rect2s A) -> float {
+        return GetWidth(A) / 2.f;
+    }
+    FM_FUN_SIC GetRadiusY(rect2s A) -> float {
+        return GetHeight(A) / 2.f;
+    }
+    FM_FUN_SIC GetArea(rect2s A) -> float {
+        v2 Dim = GetDim(A);
+        return Dim.W * Dim.H;
+    }
+    FM_FUN_SIC GetCenter(rect2s A) -> v2 {
+        __m128 Center = _mm_div_ps(_mm_add_ps(A.M, priv::SwapMinMax(A.M)), _mm_set1_ps(2.f));
+        return v2(priv::GetX(Center), priv::GetY(Center));
+    }
+    FM_FUN_SIC GetMaxXMinY(rect2s A) -> v2 {
+        return v2(A.MaxX(), A.MinY());
+    }
+    FM_FUN_SIC GetMinXMaxY(rect2s A) -> v2 {
+        return v2(A.MinX(), A.MaxY());
+    }
+    FM_FUN_SIC GetMinYCenter(rect2s A) -> v2 {
+        return v2(A.MinX() + GetWidth(A) / 2.f, A.MinY());
+    }
+    FM_FUN_SIC GetMaxYCenter(rect2s A) -> v2 {
+        return v2(A.MinX() + GetWidth(A) / 2.f, A.MaxY());
+    }
+    FM_FUN_SIC GetMinXCenter(rect2s A) -> v2 {
+        return v2(A.MinX(), A.MinY() + GetHeight(A) / 2.f);
+    }
+    FM_FUN_SIC GetMaxXCenter(rect2s A) -> v2 {
+        return v2(A.MaxX(), A.MinY() + GetHeight(A) / 2.f);
+    }
+    FM_FUN_SIC SetCenter(rect2s A, v2 Center) -> rect2s {
+        return Rect2sCenterRadius(Center, GetRadius(A));
+    }
+    FM_FUN_SIC SetCenter(rect2s A, float X, float Y) -> rect2s {
+        return SetCenter(A, v2(X, Y));
+    }
+    FM_FUN_SIC SetCenter(rect2s* A, v2 Center) -> void {
+        *A = SetCenter(*A, Center);
+    }
+    FM_FUN_SIC SetCenter(rect2s* A, float X, float Y) -> void {
+        *A = SetCenter(*A, X, Y);
+    }
+    FM_FUN_SIC SetDimWithFixedCenter(rect2s A, v2 Dim) -> rect2s {
+        return Rect2sCenterRadius(GetCenter(A), Dim / 2.f);
+    }
+    FM_FUN_SIC SetDimWithFixedCenter(rect2s A, float Width, float Height) -> rect2s {
+        return SetDimWithFixedCenter(A, v2(Width, Height));
+    }
+    FM_FUN_SIC SetDimWithFixedCenter(rect2s* A, v2 Dim) -> void {
+        *A = SetDimWithFixedCenter(*A, Dim);
+    }
+    FM_FUN_SIC SetDimWithFixedCenter(rect2s* A, float Width, float Height) -> void {
+        *A = SetDimWithFixedCenter(*A, Width, Height);
+    }
+    FM_FUN_SIC SetDimWithFixedMin(rect2s A, v2 Dim) -> rect2s {
+        return Rect2s(_mm_add_ps(priv::MinLanes(A.M), _mm_setr_ps(0.f, 0.f, Dim.X, Dim.Y)));
+    }
+    FM_FUN_SIC SetDimWithFixedMin(rect2s A, float Width, float Height) -> rect2s {
+        return SetDimWithFixedMin(A, v2(Width, Height));
+    }
+    FM_FUN_SIC SetDimWithFixedMin(rect2s* A, v2 Dim) -> void {
+        *A = SetDimWithFixedMin(*A, Dim);
+    }
+    FM_FUN_SIC SetDimWithFixedMin(rect2s* A, float Width, float Height) -> void {
+        *A = SetDimWithFixedMin(*A, Width, Height);
+    }
+    FM_FUN_SIC SetDimWithFixedMax(rect2s A, v2 Dim) -> rect2s {
+        return Rect2s(_mm_sub_ps(priv::MaxLanes(A.M), _mm_setr_ps(Dim.X, Dim.Y, 0.f, 0.f)));
+    }
+    FM_FUN_SIC SetDimWithFixedMax(rect2s A, float Width, float Height) -> rect2s {
+        return SetDimWithFixedMax(A, v2(Width, Height));
+    }
+    FM_FUN_SIC SetDimWithFixedMax(rect2s* A, v2 Dim) -> void {
+        *A = SetDimWithFixedMax(*A, Dim);
+    }
+    FM_FUN_SIC SetDimWithFixedMax(rect2s* A, float Width, float Height) -> void {
+        *A = SetDimWithFixedMax(*A, Width, Height);
+    }
+    FM_FUN_SIC SetMin(rect2s A, v2 Min) -> rect2s {
+        return Rect2s(priv::AnchorLanes<0b0000, 0b1100>(Min, priv::DimLanes(A.M)));
+    }
+    FM_FUN_SIC SetMin(rect2s* A, v2 Min) -> void {
+        *A = SetMin(*A, Min);
+    }
+    FM_FUN_SIC SetMax(rect2s A, v2 Max) -> rect2s {
+        return Rect2s(priv::AnchorLanes<0b0011, 0b0000>(Max, priv::DimLanes(A.M)));
+    }
+    FM_FUN_SIC SetMax(rect2s* A, v2 Max) -> void {
+        *A = SetMax(*A, Max);
+    }
+    FM_FUN_SIC SetMaxXMinY(rect2s A, v2 P) -> rect2s {
+        return Rect2s(priv::AnchorLanes<0b0001, 0b1000>(P, priv::DimLanes(A.M)));
+    }
+    FM_FUN_SIC SetMaxXMinY(rect2s* A, v2 P) -> void {
+        *A = SetMaxXMinY(*A, P);
+    }
+    FM_FUN_SIC SetMinXMaxY(rect2s A, v2 P) -> rect2s {
+        return Rect2s(priv::AnchorLanes<0b0010, 0b0100>(P, priv::DimLanes(A.M)));
+    }
+    FM_FUN_SIC SetMinXMaxY(rect2s* A, v2 P) -> void {
+        *A = SetMinXMaxY(*A, P);
+    }
+    FM_FUN_SIC SetCenterXMinY(rect2s A, v2 P) -> rect2s {
+        __m128 Offset = _mm_mul_ps(priv::DimLanes(A.M), _mm_setr_ps(0.5f, 1.f, 0.5f, 1.f));
+        return Rect2s(priv::AnchorLanes<0b0001, 0b1100>(P, Offset));
+    }
+    FM_FUN_SIC SetCenterXMinY(rect2s* A, v2 P) -> void {
+        *A = SetCenterXMinY(*A, P);
+    }
+    FM_FUN_SIC SetCenterXMaxY(rect2s A, v2 P) -> rect2s {
+        __m128 Offset = _mm_mul_ps(priv::DimLanes(A.M), _mm_setr_ps(0.5f, 1.f, 0.5f, 1.f));
+        return Rect2s(priv::AnchorLanes<0b0011, 0b0100>(P, Offset));
+    }
+    FM_FUN_SIC SetCenterXMaxY(rect2s* A, v2 P) -> void {
+        *A = SetCenterXMaxY(*A, P);
+    }
+    FM_FUN_SIC SetMinXCenterY(rect2s A, v2 P) -> rect2s {
+        __m128 Offset = _mm_mul_ps(priv::DimLanes(A.M), _mm_setr_ps(1.f, 0.5f, 1.f, 0.5f));
+        return Rect2s(priv::AnchorLanes<0b0010, 0b1100>(P, Offset));
+    }
+    FM_FUN_SIC SetMinXCenterY(rect2s* A, v2 P) -> void {
+        *A = SetMinXCenterY(*A, P);
+    }
+    FM_FUN_SIC SetMaxXCenterY(rect2s A, v2 P) -> rect2s {
+        __m128 Offset = _mm_mul_ps(priv::DimLanes(A.M), _mm_setr_ps(1.f, 0.5f, 1.f, 0.5f));
+        return Rect2s(priv::AnchorLanes<0b0011, 0b1000>(P, Offset));
+    }
+    FM_FUN_SIC SetMaxXCenterY(rect2s* A, v2 P) -> void {
+        *A = SetMaxXCenterY(*A, P);
+    }
+    FM_FUN_SIC HasArea(rect2s A) -> bool {
+        return (_mm_movemask_ps(_mm_cmplt_ps(A.M, priv::SwapMinMax(A.M))) & 0x3) == 0x3;
+    }
+    FM_FUN_SIC HasAreaFlipAllowed(rect2s A) -> bool {
+        return (_mm_movemask_ps(_mm_cmpneq_ps(A.M, priv::SwapMinMax(A.M))) & 0x3) == 0x3;
+    }
+    FM_FUN_SIC HasNegativeDim(rect2s A) -> bool {
+        return _mm_movemask_ps(_mm_cmpgt_ps(A.M, priv::SwapMinMax(A.M))) & 0x3;
+    }
+    FM_FUN_SIC HasNegativeWidth(rect2s A) -> bool {
+        return _mm_movemask_ps(_mm_cmpgt_ps(A.M, priv::SwapMinMax(A.M))) & 0x1;
+    }
+    FM_FUN_SIC HasNegativeHeight(rect2s A) -> bool {
+        return _mm_movemask_ps(_mm_cmpgt_ps(A.M, priv::SwapMinMax(A.M))) & 0x2;
+    }
+    FM_FUN_SIC HasNegativeW(rect2s A) -> bool {
+        return HasNegativeWidth(A);
+    }
+    FM_FUN_SIC HasNegativeH(rect2s A) -> bool {
+        return HasNegativeHeight(A);
+    }
+    FM_FUN_SIC operator*(rect2s A, float Scalar) -> rect2s {
+        return Rect2s(_mm_mul_ps(A.M, _mm_set1_ps(Scalar)));
+    }
+    FM_FUN_SIC operator/(rect2s A, float Scalar) -> rect2s {
+        return Rect2s(_mm_div_ps(A.M, _mm_set1_ps(Scalar)));
+    }
+    FM_FUN_SIC ScaleWithFixedMin(rect2s A, v2 ACurrentDim, v2 Scalar) -> rect2s {
+        return SetDimWithFixedMin(A, HadamardMul(ACurrentDim, Scalar));
+    }
+    FM_FUN_SIC ScaleWithFixedMin(rect2s A, v2 Scalar) -> rect2s {
+        return ScaleWithFixedMin(A, GetDim(A), Scalar);
+    }
+    FM_FUN_SIC ScaleWithFixedMin(rect2s A, v2 ACurrentDim, float Scalar) -> rect2s {
+        return ScaleWithFixedMin(A, ACurrentDim, v2(Scalar));
+    }
+    FM_FUN_SIC ScaleWithFixedMin(rect2s A, float Scalar) -> rect2s {
+        return ScaleWithFixedMin(A, v2(Scalar));
+    }
+    FM_FUN_SIC ScaleWithFixedMin(rect2s* A, v2 ACurrentDim, v2 Scalar) -> void {
+        *A = ScaleWithFixedMin(*A, ACurrentDim, Scalar);
+    }
+    FM_FUN_SIC ScaleWithFixedMin(rect2s* A, v2 Scalar) -> void {
+        *A = ScaleWithFixedMin(*A, Scalar);
+    }
+    FM_FUN_SIC ScaleWithFixedMin(rect2s* A, v2 ACurrentDim, float Scalar) -> void {
+        *A = ScaleWithFixedMin(*A, ACurrentDim, Scalar);
+    }
+    FM_FUN_SIC ScaleWithFixedMin(rect2s* A, float Scalar) -> void {
+        *A = ScaleWithFixedMin(*A, Scalar);
+    }
+    FM_FUN_SIC ScaleWithFixedMax(rect2s A, v2 ACurrentDim, v2 Scalar) -> rect2s {
+        return SetDimWithFixedMax(A, HadamardMul(ACurrentDim, Scalar));
+    }
+    FM_FUN_SIC ScaleWithFixedMax(rect2s A, v2 Scalar) -> rect2s {
+        return ScaleWithFixedMax(A, GetDim(A), Scalar);
+    }
+    FM_FUN_SIC ScaleWithFixedMax(rect2s A, v2 ACurrentDim, float Scalar) -> rect2s {
+        return ScaleWithFixedMax(A, ACurrentDim, v2(Scalar));
+    }
+    FM_FUN_SIC ScaleWithFixedMax(rect2s A, float Scalar) -> rect2s {
+        return ScaleWithFixedMax(A, v2(Scalar));
+    }
+    FM_FUN_SIC ScaleWithFixedMax(rect2s* A, v2 ACurrentDim, v2 Scalar) -> void {
+        *A = ScaleWithFixedMax(*A, ACurrentDim, Scalar);
+    }
+    FM_FUN_SIC ScaleWithFixedMax(rect2s* A, v2 Scalar) -> void {
+        *A = ScaleWithFixedMax(*A, Scalar);
+    }
+    FM_FUN_SIC ScaleWithFixedMax(rect2s* A, v2 ACurrentDim, float Scalar) -> void {
+        *A = ScaleWithFixedMax(*A, ACurrentDim, Scalar);
+    }
+    FM_FUN_SIC ScaleWithFixedMax(rect2s* A, float Scalar) -> void {
+        *A = ScaleWithFixedMax(*A, Scalar);
+    }
+    FM_FUN_SIC ScaleWithFixedCenter(rect2s A, v2 ACurrentDim, v2 Scalar) -> rect2s {
+        return SetDimWithFixedCenter(A, HadamardMul(ACurrentDim, Scalar));
+    }
+    FM_FUN_SIC ScaleWithFixedCenter(rect2s A, v2 Scalar) -> rect2s {
+        return ScaleWithFixedCenter(A, GetDim(A), Scalar);
+    }
+    FM_FUN_SIC ScaleWithFixedCenter(rect2s A, v2 ACurrentDim, float Scalar) -> rect2s {
+        return ScaleWithFixedCenter(A, ACurrentDim, v2(Scalar));
+    }
+    FM_FUN_SIC ScaleWithFixedCenter(rect2s A, float Scalar) -> rect2s {
+        return ScaleWithFixedCenter(A, v2(Scalar));
+    }
+    FM_FUN_SIC ScaleWithFixedCenter(rect2s* A, v2 ACurrentDim, v2 Scalar) -> void {
+        *A = ScaleWithFixedCenter(*A, ACurrentDim, Scalar);
+    }
+    FM_FUN_SIC ScaleWithFixedCenter(rect2s* A, v2 Scalar) -> void {
+        *A = ScaleWithFixedCenter(*A, Scalar);
+    }
+    FM_FUN_SIC ScaleWithFixedCenter(rect2s* A, v2 ACurrentDim, float Scalar) -> void {
+        *A = ScaleWithFixedCenter(*A, ACurrentDim, Scalar);
+    }
+    FM_FUN_SIC ScaleWithFixedCenter(rect2s* A, float Scalar) -> void {
+        *A = ScaleWithFixedCenter(*A, Scalar);
+    }
+    FM_FUN_SIC AddRadius(rect2s A, v2 Radius) -> rect2s {
+        return Rect2s(_mm_add_ps(A.M, _mm_setr_ps(-Radius.X, -Radius.Y, Radius.X, Radius.Y)));
+    }
+    FM_FUN_SIC AddRadius(rect2s A, float Radius) -> rect2s {
+        return AddRadius(A, v2(Radius));
+    }
+    FM_FUN_SIC AddRadius(rect2s* A, v2 Radius) -> void {
+        *A = AddRadius(*A, Radius);
+    }
+    FM_FUN_SIC AddRadius(rect2s* A, float Radius) -> void {
+        *A = AddRadius(*A, Radius);
+    }
+    FM_FUN_SIC MoveRect(rect2s A, v2 Offset) -> rect2s {
+        return Rect2s(_mm_add_ps(A.M, priv::PointLanes(Offset)));
+    }
+    FM_FUN_SIC MoveRect(rect2s* A, v2 Offset) -> void {
+        *A = MoveRect(*A, Offset);
+    }
+    FM_FUN_SIC MakeRectNotHaveNegativeDim(rect2s A) -> rect2s {
+        __m128 Swapped = priv::SwapMinMax(A.M);
+        return Rect2s(_mm_shuffle_ps(_mm_min_ps(A.M, Swapped), _mm_max_ps(A.M, Swapped), _MM_SHUFFLE(3, 2, 1, 0)));
+    }
+    FM_FUN_SIC MakeRectNotHaveNegativeDim(rect2s* A) -> void {
+        *A = MakeRectNotHaveNegativeDim(*A);
+    }
+    FM_FUN_SIC MakeRectsNotHaveNegativeDim(rect2s* A, rect2s* B) -> void {
+        MakeRectNotHaveNegativeDim(A);
+        MakeRectNotHaveNegativeDim(B);
+    }
+    FM_FUN_SIC Intersect(rect2s Rect, v2 Point) -> bool {
+        return priv::PointInside(Rect.M, priv::PointLanes(Point));
+    }
+    FM_FUN_SIC IntersectOrTouch(rect2s Rect, v2 Point) -> bool {
+        return priv::PointInsideOrTouch(Rect.M, priv::PointLanes(Point));
+    }
+    FM_FUN_SIC IntersectFlipAllowed(rect2s Rect, v2 Point) -> bool {
+        return Intersect(MakeRectNotHaveNegativeDim(Rect), Point);
+    }
+    FM_FUN_SIC IntersectOrTouchFlipAllowed(rect2s Rect, v2 Point) -> bool {
+        return IntersectOrTouch(MakeRectNotHaveNegativeDim(Rect), Point);
+    }
+    // NOTE: A.Min < B.Max and B.Min < A.Max, with B's halves swapped it's the same test as for a point
+    FM_FUN_SIC Intersect(rect2s A, rect2s B) -> bool {
+        return priv::PointInside(A.M, priv::SwapMinMax(B.M));
+    }
+    FM_FUN_SIC IntersectOrTouch(rect2s A, rect2s B) -> bool {
+        return priv::PointInsideOrTouch(A.M, priv::SwapMinMax(B.M));
+    }
+    // NOTE: The 4 corners of B only use 2 distinct X and 2 distinct Y values, so testing B.Min and B.Max is enough
+    FM_FUN_SIC FullyIntersect(rect2s A, rect2s B) -> bool {
+        return priv::PointInside(A.M, priv::MinLanes(B.M)) && priv::PointInside(A.M, priv::MaxLanes(B.M));
+    }
+    FM_FUN_SIC FullyIntersectOrTouch(rect2s A, rect2s B) -> bool {
+        return priv::PointInsideOrTouch(A.M, priv::MinLanes(B.M)) && priv::PointInsideOrTouch(A.M, priv::MaxLanes(B.M));
+    }
+    FM_FUN_SIC IntersectFlipAllowed(rect2s A, rect2s B) -> bool {
+        MakeRectsNotHaveNegativeDim(&A, &B);
+        return Intersect(A, B);
+    }
+    FM_FUN_SIC IntersectOrTouchFlipAllowed(rect2s A, rect2s B) -> bool {
+        MakeRectsNotHaveNegativeDim(&A, &B);
+        return IntersectOrTouch(A, B);
+    }
+    FM_FUN_SIC FullyIntersectFlipAllowed(rect2s A, rect2s B) -> bool {
+        MakeRectsNotHaveNegativeDim(&A, &B);
+        return FullyIntersect(A, B);
+    }
+    FM_FUN_SIC FullyIntersectOrTouchFlipAllowed(rect2s A, rect2s B) -> bool {
+        MakeRectsNotHaveNegativeDim(&A, &B);
+        return FullyIntersectOrTouch(A, B);
+    }
+    FM_FUN_SIC IntersectionRect(rect2s A, rect2s B, rect2s* Intersection) -> bool {
+        __m128 R = _mm_shuffle_ps(_mm_max_ps(A.M, B.M), _mm_min_ps(A.M, B.M), _MM_SHUFFLE(3, 2, 1, 0));
+        if((_mm_movemask_ps(_mm_cmplt_ps(R, priv::SwapMinMax(R))) & 0x3) != 0x3)
+            return false;
+        Intersection->M = R;
+        return true;
+    }
+    FM_FUN_SIC IntersectionRectFlipAllowed(rect2s A, rect2s B, rect2s* Intersection) -> bool {
+        MakeRectsNotHaveNegativeDim(&A, &B);
+        return IntersectionRect(A, B, Intersection);
+    }
+    FM_FUN_SIC Union(rect2s A, rect2s B) -> rect2s {
+        return Rect2s(_mm_shuffle_ps(_mm_min_ps(A.M, B.M), _mm_max_ps(A.M, B.M), _MM_SHUFFLE(3, 2, 1, 0)));
+    }
+    FM_FUN_SIC Union(rect2s* A, rect2s B) -> void {
+        *A = Union(*A, B);
+    }
+    FM_FUN_SIC Union(rect2s A, v2 P) -> rect2s {
+        return Union(A, Rect2s(priv::PointLanes(P)));
+    }
+    FM_FUN_SIC Union(rect2s* A, v2 P) -> void {
+        *A = Union(*A, P);
+    }
+    FM_FUN_SIC ClampToRect(v2 V, rect2s Rect) -> v2 {
+        FM_ASSERT(!HasNegativeDim(Rect));
+        __m128 R = _mm_min_ps(priv::MaxLanes(Rect.M), _mm_max_ps(Rect.M, priv::PointLanes(V)));
+        return v2(priv::GetX(R), priv::GetY(R));
+    }
+    FM_FUN_SIC ClampToRect(v2* V, rect2s Rect) -> void {
+        *V = ClampToRect(*V, Rect);
+    }
+    FM_FUN_SIC ClampToRectFlipAllowed(v2 V, rect2s Rect) -> v2 {
+        return ClampToRect(V, MakeRectNotHaveNegativeDim(Rect));
+    }
+    FM_FUN_SIC ClampToRectFlipAllowed(v2* V, rect2s Rect) -> void {
+        *V = ClampToRectFlipAllowed(*V, Rect);
+    }
+    // NOTE: Same steps as the rect2 version, the max side wins when Rect is bigger than Bounds
+    FM_FUN_SIC FitRectInsideBounds(rect2s Rect, rect2s Bounds) -> rect2s {
+        __m128 Dim = priv::DimLanes(Rect.M);
+        __m128 BoundsMin = priv::MinLanes(Bounds.M);
+        __m128 BoundsMax = priv::MaxLanes(Bounds.M);
+        __m128 MaxLanesOnly = _mm_castsi128_ps(_mm_setr_epi32(0, 0, -1, -1));
+        __m128 BelowMin = _mm_cmplt_ps(priv::MinLanes(Rect.M), BoundsMin);
+        __m128 AtMin = _mm_add_ps(BoundsMin, _mm_and_ps(MaxLanesOnly, Dim));
+        __m128 R = _mm_or_ps(_mm_and_ps(BelowMin, AtMin), _mm_andnot_ps(BelowMin, Rect.M));
+        __m128 AboveMax = _mm_cmpgt_ps(priv::MaxLanes(R), BoundsMax);
+        __m128 AtMax = _mm_sub_ps(BoundsMax, _mm_andnot_ps(MaxLanesOnly, Dim));
+        return Rect2s(_mm_or_ps(_mm_and_ps(AboveMax, AtMax), _mm_andnot_ps(AboveMax, R)));
+    }
+    FM_FUN_SIC FitRectInsideBounds(rect2s* Rect, rect2s Bounds) -> void {
+        *Rect = FitRectInsideBounds(*Rect, Bounds);
+    }
+    FM_FUN_SIC GetWidthHeightRatio(rect2s Rect) -> float {
+        v2 RectDim = GetDim(Rect);
+        return SafeDivN(RectDim.W, RectDim.H, InvalidF32);
+    }
+    FM_FUN_SIC GetHeightWidthRatio(rect2s Rect) -> float {
+        v2 RectDim = GetDim(Rect);
+        return SafeDivN(RectDim.H, RectDim.W, InvalidF32);
+    }
+    FM_FUN_SIC ExpandToDesiredWidthHeightRatioWithFixedCenter(rect2s A, float DesiredWidthHeightRatio) -> rect2s {
+        float WidthHeightRatio = GetWidthHeightRatio(A);
+        FM_ASSERT(WidthHeightRatio != InvalidF32);
+        float Factor = DesiredWidthHeightRatio / WidthHeightRatio;
+        if(Factor > 1)
+            ScaleWithFixedCenter(&A, v2(Factor, 1.f));
+        else
+            ScaleWithFixedCenter(&A, v2(1.f, 1.f / Factor));
+        return A;
+    }
+    FM_FUN_SIC ExpandToDesiredWidthHeightRatioWithFixedCenter(rect2s* A, float DesiredWidthHeightRatio) -> void {
+        *A = ExpandToDesiredWidthHeightRatioWithFixedCenter(*A, DesiredWidthHeightRatio);
+    }
+    FM_FUN_SIC operator==(rect2s A, rect2s B) -> bool {
+        return _mm_movemask_ps(_mm_cmpeq_ps(A.M, B.M)) == 0xF;
+    }
+    FM_FUN_SIC operator!=(rect2s A, rect2s B) -> bool {
+        return !(A == B);
+    }
+    FM_FUN_SIC Equal(rect2s A, rect2s B, float Epsilon = 0.0001f) -> bool {
+        __m128 AbsDiff = _mm_andnot_ps(_mm_set1_ps(-0.f), _mm_sub_ps(A.M, B.M));
+        return _mm_movemask_ps(_mm_cmplt_ps(AbsDiff, _mm_set1_ps(Epsilon))) == 0xF;
+    }
+    FM_FUN_SIC Lerp(rect2s Source, rect2s Dest, float T) -> rect2s {
+        return Rect2s(priv::MulAdd(_mm_set1_ps(1.f - T), Source.M, _mm_mul_ps(_mm_set1_ps(T), Dest.M)));
+    }
+    FM_FUN_SIC FastLerp(rect2s Source, rect2s Dest, float T) -> rect2s {
+        return Rect2s(priv::MulAdd(_mm_sub_ps(Dest.M, Source.M), _mm_set1_ps(T), Source.M));
+    }
+    // NOTE: Lanes are MinX, MinY, MaxX, MaxY, same order as rect2
+    FM_FUN_SIC Ptr(rect2s& A) -> float* {
+        return (float*)&A.M;
+    }
+    FM_FUN_SIC PtrMax(rect2s& A) -> float* {
+        return (float*)&A.M + 2;
+    }
+    
+    //////////////////////////////////
+    // pointer versions of funcions // 
+    //////////////////////////////////
+    FM_FUN_TSI HadamardMul(t* A, t B) -> void {
+        *A = HadamardMul(*A, B);
+    }
+    FM_FUN_TSI SafeHadamardDivN(t* A, t B, t N) -> void {
+        *A = SafeHadamardDivN(*A, B, N);
+    }
+    FM_FUN_TSI SafeHadamardDiv1(t* A, t B) -> void {
+        return SafeHadamardDivN<t>(*A, B, t((t)1));
+    }
+    FM_FUN_TSI SafeHadamardDiv0(t* A, t B) -> void {
+        return SafeHadamardDivN<t>(*A, B, t((t)0));
+    }
+    
+    ////////////////////////
+    // geometric funcions // 
+    ////////////////////////
+    FM_FUN_SI RayIntersectsCircle(v2 RayPos, v2 RayDir, v2 CircleCenter, float CircleRadius) -> bool {
+        vec2 Center = Vec2(CircleCenter.X, CircleCenter.Y);
+        vec2 Pos = Vec2(RayPos.X, RayPos.Y);
+        vec2 RayToCircleCenter = Center - Pos;
+        vec2 RayStepsToGetToClosestPointFromCircleCenterOnRayLine = DotSplat(RayToCircleCenter, Normalize(RayToCircleCenter));
+        vec2 ClosestPointFromCircleCenterOnRayLine = Pos + HadamardMul(Vec2(RayDir.X, RayDir.Y), RayStepsToGetToClosestPointFromCircleCenterOnRayLine);
+        return Length(Center - ClosestPointFromCircleCenterOnRayLine) <= CircleRadius;
+    }
+    
+    //////////////////////////////////
+    // runtime simd tier selection  //
+    //////////////////////////////////
+    // NOTE: Not inlined and batch functions are compiled for every tier and picked at startup with cpuid.
+    //       Inlined functions still use the instruction set chosen with FM_USE_SSE2_INSTEAD_OF_SSE4.
+    enum simd_tier : uint32_t
+    {
+        SimdTier_SSE2,
+        SimdTier_AVX2_FMA,
+        SimdTier_Count
+    };
+    FM_FUN GetSimdTier() -> simd_tier;
+    FM_FUN GetMaxSupportedSimdTier() -> simd_tier;
+    // NOTE: Clamped to the max supported tier, returns the selected one. Safe to call from any thread, but calls
+    //       already running on other threads finish with the tier they started with.
+    FM_FUN SetSimdTier(simd_tier Tier) -> simd_tier;
+    FM_FUN GetSimdTierName(simd_tier Tier) -> const char*;
+    
+    ///////////////////////////////////////////
+    // headers of not inlined mat4 functions //
+    ///////////////////////////////////////////
+    FM_FUN_C operator*(mat4 A, mat4 B) -> mat4; 
+    FM_FUN Mat4Orthographic(float Left, float Right, float Bottom, float Top, float Near = 0, float Far = 1) -> mat4;
+    FM_FUN Mat4Perspective(float FOV, float AspectRatio, float near, float Far) -> mat4;
+    FM_FUN Mat4LookAt(vec3 Eye, vec3 At, vec3 Up = Vec3(0.f, 1.f, 0.f)) -> mat4;
+    FM_FUN Mat4LookAt(v3 Eye, v3 At, v3 Up = {0.f, 1.f, 0.f}) -> mat4;
+    FM_FUN_C Determinant(mat4 M) -> float;
+    FM_FUN_C Inverse(mat4 M) -> mat4; // NOTE: M has to be invertible
+    FM_FUN_C InverseAffine(mat4 M) -> mat4; // NOTE: Last row of M has to be (0, 0, 0, 1)
+    FM_FUN_C InverseRigid(mat4 M) -> mat4; // NOTE: M has to be a rotation followed by a translation, without scale or shear
+    
+    /////////////////////////////////////////////
+    // headers of not inlined mat3x4 functions //
+    /////////////////////////////////////////////
+    FM_FUN_C Determinant(mat3x4 M) -> float;
+    FM_FUN_C Inverse(mat3x4 M) -> mat3x4; // NOTE: M has to be invertible
+    FM_FUN_C InverseRigid(mat3x4 M) -> mat3x4; // NOTE: M has to be a rotation followed by a translation, without scale or shear
+    
+    ////////////////////////////////////////////
+    // headers of not inlined batch functions //
+    ////////////////////////////////////////////
+    // NOTE: Output arrays can be the same as input arrays, but must not partially overlap them.
+    FM_FUN MultiplyMat4Arrays(const mat4* A, const mat4* B, mat4* Out, size_t Count) -> void; // NOTE: Out[i] = A[i] * B[i]
+    FM_FUN InverseMat4Array(const mat4* In, mat4* Out, size_t Count) -> void;
+    FM_FUN InverseAffineMat4Array(const mat4* In, mat4* Out, size_t Count) -> void;
+    FM_FUN InverseRigidMat4Array(const mat4* In, mat4* Out, size_t Count) -> void;
+    // NOTE: Out[i] is A[i] blended towards B[i] by T along the shorter path, the inputs have to be unit quaternions.
+    //       SlerpQuatArray approximates sin with a polynomial and stays within 2e-6 of an exact slerp.
+    FM_FUN NlerpQuatArray(const quat* A, const quat* B, float T, quat* Out, size_t Count) -> void;
+    FM_FUN SlerpQuatArray(const quat* A, const quat* B, float T, quat* Out, size_t Count) -> void;
+    // NOTE: Every vertex is skinned by up to 4 bones, unused influences need a weight of 0 but still a valid index.
+    //       Normals can be null, otherwise they are renormalized after the linear blend.
+    FM_FUN SkinVerticesLinear(const mat4* Palette, const v4u16* BoneIndices, const v4* BoneWeights,
+                              const v3* Positions, const v3* Normals, v3* OutPositions, v3* OutNormals, size_t Count) -> void;
+    FM_FUN SkinVerticesDualQuat(const dual_quat* Palette, const v4u16* BoneIndices, const v4* BoneWeights,
+                                const v3* Positions, const v3* Normals, v3* OutPositions, v3* OutNormals, size_t Count) -> void;
+    // NOTE: Same precision as NormalizeFast, vectors shorter than 1e-19 become zero vectors.
+    FM_FUN NormalizeArray(const v3* In, v3* Out, size_t Count) -> void;
+    FM_FUN NormalizeArray(const vec3* In, vec3* Out, size_t Count) -> void;
+    // NOTE: Every float is mapped on its own with the functions of the vector exponentials and logarithms section,
+    //       so the same ulp bounds apply. The v4 versions map all 4 components.
+    FM_FUN ExpArray(const float* In, float* Out, size_t Count) -> void;
+    FM_FUN Exp2Array(const float* In, float* Out, size_t Count) -> void;
+    FM_FUN LogArray(const float* In, float* Out, size_t Count) -> void;
+    FM_FUN Log2Array(const float* In, float* Out, size_t Count) -> void;
+    FM_FUN PowArray(const float* In, float Exponent, float* Out, size_t Count) -> void;
+    FM_FUN ExpArray(const v4* In, v4* Out, size_t Count) -> void;
+    FM_FUN Exp2Array(const v4* In, v4* Out, size_t Count) -> void;
+    FM_FUN LogArray(const v4* In, v4* Out, size_t Count) -> void;
+    FM_FUN Log2Array(const v4* In, v4* Out, size_t Count) -> void;
+    FM_FUN PowArray(const v4* In, float Exponent, v4* Out, size_t Count) -> void;
+    // NOTE: Same rounding as HalfFromFloat and FloatFromHalf, F16C is used when the cpu has it
+    FM_FUN PackHalfArray(const float* In, uint16_t* Out, size_t Count) -> void;
+    FM_FUN PackHalfArray(const v2* In, v2h* Out, size_t Count) -> void;
+    FM_FUN PackHalfArray(const v3* In, v3h* Out, size_t Count) -> void;
+    FM_FUN PackHalfArray(const v4* In, v4h* Out, size_t Count) -> void;
+    FM_FUN PackHalfArray(const vec4* In, v4h* Out, size_t Count) -> void;
+    FM_FUN UnpackHalfArray(const uint16_t* In, float* Out, size_t Count) -> void;
+    FM_FUN UnpackHalfArray(const v2h* In, v2* Out, size_t Count) -> void;
+    FM_FUN UnpackHalfArray(const v3h* In, v3* Out, size_t Count) -> void;
+    FM_FUN UnpackHalfArray(const v4h* In, v4* Out, size_t Count) -> void;
+    FM_FUN UnpackHalfArray(const v4h* In, vec4* Out, size_t Count) -> void;
+    // NOTE: Same codes as Octahedral16/Octahedral32 and V3FromOctahedral16/V3FromOctahedral32, 4 normals per iteration
+    FM_FUN PackOctahedralArray(const v3* In, uint16_t* Out, size_t Count) -> void;
+    FM_FUN PackOctahedralArray(const v3* In, uint32_t* Out, size_t Count) -> void;
+    FM_FUN PackOctahedralArray(const vec3* In, uint16_t* Out, size_t Count) -> void;
+    FM_FUN PackOctahedralArray(const vec3* In, uint32_t* Out, size_t Count) -> void;
+    FM_FUN UnpackOctahedralArray(const uint16_t* In, v3* Out, size_t Count) -> void;
+    FM_FUN UnpackOctahedralArray(const uint32_t* In, v3* Out, size_t Count) -> void;
+    FM_FUN UnpackOctahedralArray(const uint16_t* In, vec3* Out, size_t Count) -> void;
+    FM_FUN UnpackOctahedralArray(const uint32_t* In, vec3* Out, size_t Count) -> void;
+    // NOTE: Same results as PackUnorm8, PackSnorm8, PackUnorm16, PackSnorm16 and the matching Vec4From functions
+    FM_FUN PackUnorm8Array(const v4* In, v4u8* Out, size_t Count) -> void;
+    FM_FUN PackUnorm8Array(const vec4* In, v4u8* Out, size_t Count) -> void;
+    FM_FUN PackSnorm8Array(const v4* In, v4i8* Out, size_t Count) -> void;
+    FM_FUN PackSnorm8Array(const vec4* In, v4i8* Out, size_t Count) -> void;
+    FM_FUN PackUnorm16Array(const v4* In, v4u16* Out, size_t Count) -> void;
+    FM_FUN PackUnorm16Array(const vec4* In, v4u16* Out, size_t Count) -> void;
+    FM_FUN PackSnorm16Array(const v4* In, v4i16* Out, size_t Count) -> void;
+    FM_FUN PackSnorm16Array(const vec4* In, v4i16* Out, size_t Count) -> void;
+    FM_FUN UnpackUnorm8Array(const v4u8* In, v4* Out, size_t Count) -> void;
+    FM_FUN UnpackUnorm8Array(const v4u8* In, vec4* Out, size_t Count) -> void;
+    FM_FUN UnpackSnorm8Array(const v4i8* In, v4* Out, size_t Count) -> void;
+    FM_FUN UnpackSnorm8Array(const v4i8* In, vec4* Out, size_t Count) -> void;
+    FM_FUN UnpackUnorm16Array(const v4u16* In, v4* Out, size_t Count) -> void;
+    FM_FUN UnpackUnorm16Array(const v4u16* In, vec4* Out, size_t Count) -> void;
+    FM_FUN UnpackSnorm16Array(const v4i16* In, v4* Out, size_t Count) -> void;
+    FM_FUN UnpackSnorm16Array(const v4i16* In, vec4* Out, size_t Count) -> void;
+    // NOTE: Same results as SrgbToLinear, LinearToSrgb, PackSrgb8 and Vec4FromSrgb8, alpha is left as it is
+    FM_FUN SrgbToLinearArray(const v4* In, v4* Out, size_t Count) -> void;
+    FM_FUN SrgbToLinearArray(const vec4* In, vec4* Out, size_t Count) -> void;
+    FM_FUN LinearToSrgbArray(const v4* In, v4* Out, size_t Count) -> void;
+    FM_FUN LinearToSrgbArray(const vec4* In, vec4* Out, size_t Count) -> void;
+    FM_FUN PackSrgb8Array(const v4* In, v4u8* Out, size_t Count) -> void;
+    FM_FUN PackSrgb8Array(const vec4* In, v4u8* Out, size_t Count) -> void;
+    FM_FUN UnpackSrgb8Array(const v4u8* In, v4* Out, size_t Count) -> void;
+    FM_FUN UnpackSrgb8Array(const v4u8* In, vec4* Out, size_t Count) -> void;
+    // NOTE: Points are transformed with W = 1 and directions with W = 0, the W of v4 and vec4 inputs is ignored.
+    //       TransformAndProjectPoints divides by the resulting W, so v4 and vec4 outputs end up with W = 1.
+    FM_FUN_C TransformPoints(mat4 M, const v3* In, v3* Out, size_t Count) -> void;
+    FM_FUN_C TransformPoints(mat4 M, const vec3* In, vec3* Out, size_t Count) -> void;
+    FM_FUN_C TransformPoints(mat4 M, const v4* In, v4* Out, size_t Count) -> void;
+    FM_FUN_C TransformPoints(mat4 M, const vec4* In, vec4* Out, size_t Count) -> void;
+    FM_FUN_C TransformDirections(mat4 M, const v3* In, v3* Out, size_t Count) -> void;
+    FM_FUN_C TransformDirections(mat4 M, const vec3* In, vec3* Out, size_t Count) -> void;
+    FM_FUN_C TransformDirections(mat4 M, const v4* In, v4* Out, size_t Count) -> void;
+    FM_FUN_C TransformDirections(mat4 M, const vec4* In, vec4* Out, size_t Count) -> void;
+    FM_FUN_C TransformAndProjectPoints(mat4 M, const v3* In, v3* Out, size_t Count) -> void;
+    FM_FUN_C TransformAndProjectPoints(mat4 M, const vec3* In, vec3* Out, size_t Count) -> void;
+    FM_FUN_C TransformAndProjectPoints(mat4 M, const v4* In, v4* Out, size_t Count) -> void;
+    FM_FUN_C TransformAndProjectPoints(mat4 M, const vec4* In, vec4* Out, size_t Count) -> void;
+    
+    ////////////////////
+    // mat4 functions //
+    ////////////////////
+    FM_FUN_I mat4::operator[](uint32_t Index) -> float& {
+        FM_ASSERT(Index >= 0 && Index <= 15);
+        return *((float*)(Columns) + Index);
+    }
+    FM_FUN_IC mat4::GetColumnVec4(uint32_t Index) -> vec4 {
+        FM_ASSERT(Index >= 0 && Index <= 3);
+        return Vec4(Columns[Index]);
+    }
+    FM_FUN_IC mat4::GetColumnV4(uint32_t Index) -> v4 {
+        return CastToV4(GetColumnVec4(Index));
+    }
+    FM_FUN_IC mat4::SetColumn(uint32_t Index, vec4 Col) -> void {
+        FM_ASSERT(Index >= 0 && Index <= 3);
+        Columns[Index] = Col.M;
+    }
+    FM_FUN_IC mat4::SetColumn(uint32_t Index, v4 Col) -> void {
+        SetColumn(Index, CastToVec4(Col));
+    }
+    FM_FUN_IC mat4::SetColumn(uint32_t Index, float X, float Y, float Z, float W) -> void {
+        FM_ASSERT(Index >= 0 && Index <= 3);
+        Columns[Index] = _mm_set_ps(W, Z, Y, X);
+    }
+    FM_FUN_IC mat4::SwapColumns(uint32_t Col1Index, uint32_t Col2Index) -> void {
+        FM_ASSERT(Col1Index >= 0 && Col1Index <= 3 && Col1Index >= 0 && Col1Index <= 3);
+        __m128 Temp = Columns[Col1Index];
+        Columns[Col1Index] = Columns[Col2Index];
+        Columns[Col2Index] = Temp;
+    }
+    FM_FUN_IC mat4::GetRowVec4(uint32_t Index) -> vec4 {
+        return CastToVec4(GetRowV4(Index));
+    }
+    FM_FUN_IC mat4::SetRow(uint32_t Index, float X, float Y, float Z, float W) -> void {
+        SetRow(Index, v4(X, Y, Z, W));
+    }
+    FM_FUN_IC mat4::SetRow(uint32_t Index, vec4 V) -> void {
+        SetRow(Index, CastToV4(V));
+    }
+    FM_FUN_IC mat4::SwapRows(uint32_t Row1Index, uint32_t Row2Index) -> void {
+        FM_ASSERT(Row1Index >= 0 && Row2Index <= 3 && Row1Index >= 0 && Row2Index <= 3);
+        v4 Row1 = GetRowV4(Row1Index);
+        v4 Row2 = GetRowV4(Row2Index);
+        SetRow(Row2Index, Row1);
+        SetRow(Row1Index, Row2);
+    }
+    FM_FUN_IC mat4::GetMainDiagonalV4() -> v4 {
+        v4 R;
+        R.X = priv::GetX(Columns[0]);
+        R.Y = priv::GetY(Columns[1]);
+        R.Z = priv::GetZ(Columns[2]);
+        R.W = priv::GetW(Columns[3]);
+        return R;
+    }
+    FM_FUN_IC mat4::GetMainDiagonalVec4() -> vec4 {
+        return CastToVec4(GetMainDiagonalV4());
+    }
+    FM_FUN_IC mat4::SetMainDiagonal(float X, float Y, float Z, float W) -> void {
+        Columns[0] = priv::SetX(Columns[0], X);
+        Columns[1] = priv::SetY(Columns[1], Y);
+        Columns[2] = priv::SetZ(Columns[2], Z);
+        Columns[3] = priv::SetW(Columns[3], W);
+    }
+    FM_FUN_IC mat4::SetMainDiagonal(v4 V) -> void {
+        SetMainDiagonal(V.X, V.Y, V.Z, V.W);
+    }
+    FM_FUN_IC mat4::SetMainDiagonal(vec4 V) -> void {
+        SetMainDiagonal(CastToV4(V));
+    }
+    FM_FUN_SIC Mat4FromColumnMajorMemory(float* Mem) -> mat4 {
+        mat4 R;
+        for(int32_t i = 0; i < 4; ++i)
+            R.Columns[i] = _mm_load_ps(Mem + i*4);
+        return R;
+    }
+    FM_FUN_SIC Mat4FromRowMajorMemory(float* Mem) -> mat4 {
+        mat4 R;
+        R.Columns[0] = _mm_setr_ps(Mem[0], Mem[4], Mem[8], Mem[12]);
+        R.Columns[1] = _mm_setr_ps(Mem[1], Mem[5], Mem[9], Mem[13]);
+        R.Columns[2] = _mm_setr_ps(Mem[2], Mem[6], Mem[10], Mem[14]);
+        R.Columns[3] = _mm_setr_ps(Mem[3], Mem[7], Mem[11], Mem[15]);
+        return R;
+    }
+    FM_FUN_SIC Mat4() -> mat4 {
+        mat4 R;
+        R.Columns[0] = _mm_setzero_ps();
+        R.Columns[1] = _mm_setzero_ps();
+        R.Columns[2] = _mm_setzero_ps();
+        R.Columns[3] = _mm_setzero_ps();
+        return R;
+    }
+    FM_FUN_SIC Mat4Diagonal(float Diag) -> mat4 {
+        mat4 R;
+        R.Columns[0] = _mm_setr_ps(Diag, 0.f, 0.f, 0.f);
+        R.Columns[1] = _mm_setr_ps(0.f, Diag, 0.f, 0.f);
+        R.Columns[2] = _mm_setr_ps(0.f, 0.f, Diag, 0.f);
+        R.Columns[3] = _mm_setr_ps(0.f, 0.f, 0.f, Diag);
+        return R;
+    }
+    FM_FUN_SIC Mat4Diagonal(float DiagX, float DiagY, float DiagZ, float DiagW) -> mat4 {
+        mat4 R;
+        R.Columns[0] = _mm_setr_ps(DiagX, 0.f, 0.f, 0.f);
+        R.Columns[1] = _mm_setr_ps(0.f, DiagY, 0.f, 0.f);
+        R.Columns[2] = _mm_setr_ps(0.f, 0.f, DiagZ, 0.f);
+        R.Columns[3] = _mm_setr_ps(0.f, 0.f, 0.f, DiagW);
+        return R;
+    }
+    FM_FUN_SIC Mat4Diagonal(v4 Diag) -> mat4 {
+        mat4 R;
+        R.Columns[0] = _mm_setr_ps(Diag.X, 0.f, 0.f, 0.f);
+        R.Columns[1] = _mm_setr_ps(0.f, Diag.Y, 0.f, 0.f);
+        R.Columns[2] = _mm_setr_ps(0.f, 0.f, Diag.Z, 0.f);
+        R.Columns[3] = _mm_setr_ps(0.f, 0.f, 0.f, Diag.W);
+        return R;
+    }
+    FM_FUN_SIC Mat4Diagonal(vec4 Diag) -> mat4 {
+        return Mat4Diagonal(CastToV4(Diag));
+    }
+    FM_FUN_SIC Mat4Identity() -> mat4 {
+        return Mat4Diagonal(1.f);
+    }
+    FM_FUN_SIC Mat4FromColumns(vec4 Col1, vec4 Col2, vec4 Col3, vec4 Col4) -> mat4 {
+        mat4 R;
+        R.Columns[0] = Col1.M;
+        R.Columns[1] = Col2.M;
+        R.Columns[2] = Col3.M;
+        R.Columns[3] = Col4.M;
+        return R;
+    }
+    FM_FUN_SIC Mat4FromColumns(v4 Col1, v4 Col2, v4 Col3, v4 Col4) -> mat4 {
+        return Mat4FromColumns(CastToVec4(Col1), CastToVec4(Col2), CastToVec4(Col3), CastToVec4(Col4));
+    }
+    FM_FUN_SIC Mat4FromColumns(vec3 Col1, vec3 Col2, vec3 Col3, vec3 Col4) -> mat4 {
+        mat4 R;
+        R.Columns[0] = Col1.M;
+        R.Columns[1] = Col2.M;
+        R.Columns[2] = Col3.M;
+        R.Columns[3] = Col4.M;
+        R.SetRow(3, 0.f, 0.f, 0.f, 1.f);
+        return R;
+    }
+    FM_FUN_SIC Mat4FromColumns(v3 Col1, v3 Col2, v3 Col3, v3 Col4) -> mat4 {
+        return Mat4FromColumns(CastToVec3(Col1), CastToVec3(Col2), CastToVec3(Col3), CastToVec3(Col4));
+    }
+    FM_FUN_SIC Mat4FromColumns(
+                               float E11, float E21, float E31, float E41,
+                               float E12, float E22, float E32, float E42,
+                               float E13, float E23, float E33, float E43,
+                               float E14, float E24, float E34, float E44) -> mat4
+    {
+        mat4 R;
+        R.Columns[0] = _mm_setr_ps(E11, E21, E31, E41);
+        R.Columns[1] = _mm_setr_ps(E12, E22, E32, E42);
+        R.Columns[2] = _mm_setr_ps(E13, E23, E33, E43);
+        R.Columns[3] = _mm_setr_ps(E14, E24, E34, E44);
+        return R;
+    }
+    FM_FUN_SIC Mat4FromRows(vec4 Row1, vec4 Row2, vec4 Row3, vec4 Row4) -> mat4 {
+        mat4 R;
+        R.Columns[0] = _mm_setr_ps(Row1.X(), Row2.X(), Row3.X(), Row4.X());
+        R.Columns[1] = _mm_setr_ps(Row1.Y(), Row2.Y(), Row3.Y(), Row4.Y());
+        R.Columns[2] = _mm_setr_ps(Row1.Z(), Row2.Z(), Row3.Z(), Row4.Z());
+        R.Columns[3] = _mm_setr_ps(Row1.W(), Row2.W(), Row3.W(), Row4.W());
+        return R;
+    }
+    FM_FUN_SIC Mat4FromRows(v4 Row1, v4 Row2, v4 Row3, v4 Row4) -> mat4 {
+        return Mat4FromRows(CastToVec4(Row1), CastToVec4(Row2), CastToVec4(Row3), CastToVec4(Row4));
+    }
+    FM_FUN_SIC Mat4FromRows(
+                            float E11, float E12, float E13, float E14,
+                            float E21, float E22, float E23, float E24,
+                            float E31, float E32, float E33, float E34,
+                            float E41, float E42, float E43, float E44) -> mat4
+    {
+        mat4 R;
+        R.Columns[0] = _mm_setr_ps(E11, E21, E31, E41);
+        R.Columns[1] = _mm_setr_ps(E12, E22, E32, E42);
+        R.Columns[2] = _mm_setr_ps(E13, E23, E33, E43);
+        R.Columns[3] = _mm_setr_ps(E14, E24, E34, E44);
+        return R;
+    }
+    FM_FUN_SIC Mat4FromRows(vec3 Row1, vec3 Row2, vec3 Row3, vec3 Row4) -> mat4 {
+        mat4 R;
+        R.Columns[0] = _mm_setr_ps(Row1.X(), Row2.X(), Row3.X(), Row4.X());
+        R.Columns[1] = _mm_setr_ps(Row1.Y(), Row2.Y(), Row3.Y(), Row4.Y());
+        R.Columns[2] = _mm_setr_ps(Row1.Z(), Row2.Z(), Row3.Z(), Row4.Z());
+        R.Columns[3] = _mm_setr_ps(0.f, 0.f, 0.f, 1.f);
+        return R;
+    }
+    FM_FUN_SIC Mat4FromRows(v3 Row1, v3 Row2, v3 Row3, v3 Row4) -> mat4 {
+        return Mat4FromRows(CastToVec3(Row1), CastToVec3(Row2), CastToVec3(Row3), CastToVec3(Row4));
+    }
+    FM_FUN_SI Ptr(const mat4& V) -> float* {
+        return (float*)(&V);
+    }
+    FM_FUN_SIC Store(float* Mem, mat4 Mat) -> void {
+        for(int32_t Col = 0; Col < 4; ++Col)
+            _mm_storeu_ps(Mem + Col*4, Mat.Columns[Col]);
+    }
+    FM_FUN_SIC Store16ByteAligned(float* Mem, mat4 Mat) -> void {
+        FM_ASSERT((uintptr_t)Mem % 16 == 0);
+        for(int32_t Col = 0; Col < 4; ++Col)
+            _mm_store_ps(Mem + Col*4, Mat.Columns[Col]);
+    }
+    FM_FUN_SIC operator+(mat4 A, mat4 B) -> mat4 {
+        for(int32_t Col = 0; Col < 4; ++Col)
+            A.Columns[Col] = _mm_add_ps(A.Columns[Col], B.Columns[Col]);
+        return A;
+    }
+    FM_FUN_SIC operator-(mat4 A, mat4 B) -> mat4 {
+        for(int32_t Col = 0; Col < 4; ++Col)
+            A.Columns[Col] = _mm_sub_ps(A.Columns[Col], B.Columns[Col]);
+        return A;
+    }
+    FM_FUN_SIC operator*(mat4 M, vec4 V) -> vec4 {
+        // NOTE: Linear combination of the columns summed as two independent chains to keep the latency down
+        __m128 R01 = _mm_mul_ps(M.Columns[0], _mm_shuffle_ps(V.M, V.M, _MM_SHUFFLE(0, 0, 0, 0)));
+        __m128 R23 = _mm_mul_ps(M.Columns[2], _mm_shuffle_ps(V.M, V.M, _MM_SHUFFLE(2, 2, 2, 2)));
+        R01 = priv::MulAdd(M.Columns[1], _mm_shuffle_ps(V.M, V.M, _MM_SHUFFLE(1, 1, 1, 1)), R01);
+        R23 = priv::MulAdd(M.Columns[3], _mm_shuffle_ps(V.M, V.M, _MM_SHUFFLE(3, 3, 3, 3)), R23);
+        V.M = _mm_add_ps(R01, R23);
+        return V;
+    }
+    FM_FUN_SIC operator*(mat4 M, v4 V) -> v4 {
+        // TODO: Try to implement the logic in v4 function and make vec4 version call it. 
+        //       Maybe just make separate implementations. Profile it!
+        return CastToV4(M * CastToVec4(V));
+    }
+    FM_FUN_SIC operator*(mat4 M, float Scalar) -> mat4 {
+        __m128 ScalarM = _mm_set1_ps(Scalar);
+        for(uint32_t Col = 0; Col < 4; ++Col)
+            M.Columns[Col] = _mm_mul_ps(M.Columns[Col], ScalarM);
+        return M;
+    }
+    FM_FUN_SIC HadamardMul(mat4 A, mat4 B) -> mat4 {
+        for(uint32_t Col = 0; Col < 4; ++Col)
+            A.Columns[Col] = _mm_mul_ps(A.Columns[Col], B.Columns[Col]);
+        return A;
+    }
+    FM_FUN_SIC HadamardDiv(mat4 A, mat4 B) -> mat4 {
+        for(uint32_t Col = 0; Col < 4; ++Col)
+            A.Columns[Col] = _mm_div_ps(A.Columns[Col], B.Columns[Col]);
+        return A;
+    }
+    FM_FUN_SIC operator*(float Scalar, mat4 M) -> mat4 {
+        return M * Scalar;
+    }
+    FM_FUN_SIC operator*=(mat4& M, float Scalar) -> mat4& {
+        M = M * Scalar;	
+        return M;
+    }
+    FM_FUN_SIC operator/(mat4 M, float Scalar) -> mat4 {
+        __m128 ScalarM = _mm_set1_ps(Scalar);
+        for(uint32_t Col = 0; Col < 4; ++Col)
+            M.Columns[Col] = _mm_div_ps(M.Columns[Col], ScalarM);
+        return M;
+    }
+    FM_FUN_SIC operator/=(mat4& M, float Scalar) -> mat4& {
+        M = M / Scalar;
+        return M;
+    }
+    FM_FUN_SIC operator==(mat4 A, mat4 B) -> bool {
+        bool R = true;
+        for(uint32_t Col = 0; Col < 4; ++Col)
+        {
+            if(Vec4(A.Columns[Col]) != Vec4(B.Columns[Col]))
+            {
+                R = false;
+                break;
+            }
+        }
+        return R;
+    }
+    FM_FUN_SIC operator!=(mat4 A, mat4 B) -> bool {
+        return !(A == B);
+    }
+    FM_FUN_SIC Transpose(mat4* M) -> void {
+        _MM_TRANSPOSE4_PS(M->Columns[0], M->Columns[1], M->Columns[2], M->Columns[3]);
+    }
+    FM_FUN_SIC Transpose(mat4 M) -> mat4 {
+        _MM_TRANSPOSE4_PS(M.Columns[0], M.Columns[1], M.Columns[2], M.Columns[3]);
+        return M;
+    }
+    FM_FUN_SIC Mat4Translation(float X, float Y, float Z) -> mat4 {
+        return Mat4FromRows(
+                            1.f, 0.f, 0.f, X,
+                            0.f, 1.f, 0.f, Y,
+                            0.f, 0.f, 1.f, Z,
+                            0.f, 0.f, 0.f, 1.f);
+    }
+    FM_FUN_SIC Mat4Translation(v3 Translation) -> mat4 {
+        return Mat4FromRows(
+                            1.f, 0.f, 0.f, Translation.X,
+                            0.f, 1.f, 0.f, Translation.Y,
+                            0.f, 0.f, 1.f, Translation.Z,
+                            0.f, 0.f, 0.f, 1.f);
+    }
+    FM_FUN_SIC Mat4Translation(vec3 Translation) -> mat4 {
+        return Mat4Translation(CastToV3(Translation));
+    }
+    FM_FUN_SIC Mat4Translation(float Translation) -> mat4 {
+        return Mat4FromRows(
+                            1.f, 0.f, 0.f, Translation,
+                            0.f, 1.f, 0.f, Translation,
+                            0.f, 0.f, 1.f, Translation,
+                            0.f, 0.f, 0.f, 1.f);
+    }
+    FM_FUN_SIC Translate(mat4* M, float X, float Y, float Z) -> void {
+        M->Columns[3] = _mm_add_ps(M->Columns[3], _mm_set_ps(0.f, Z, Y, X));
+    }
+    FM_FUN_SIC Translate(mat4* M, vec3 Trans) -> void {
+        M->Columns[3] = _mm_add_ps(M->Columns[3], Trans.M);
+    }
+    FM_FUN_SIC Translate(mat4* M, v3 Trans) -> void {
+        Translate(M, CastToVec3(Trans));
+    }
+    FM_FUN_SIC Translate(mat4* M, float Trans) -> void {
+        M->Columns[3] = _mm_add_ps(M->Columns[3], _mm_set_ps(0.f, Trans, Trans, Trans));
+    }
+    FM_FUN_SIC Mat4Scale(float Scalar) -> mat4 {
+        return Mat4Diagonal(Scalar, Scalar, Scalar, 1.f);
+    } 
+    FM_FUN_SIC Mat4Scale(float ScalarX, float ScalarY, float ScalarZ) -> mat4 {
+        return Mat4Diagonal(ScalarX, ScalarY, ScalarZ, 1.f);
+    } 
+    FM_FUN_SIC Mat4Scale(v3 Scalar) -> mat4 {
+        return Mat4Diagonal(Scalar.X, Scalar.Y, Scalar.Z, 1.f); 
+    }
+    FM_FUN_SIC Mat4Scale(vec3 Scalar) -> mat4 {
+        return Mat4Diagonal(Scalar.X(), Scalar.Y(), Scalar.Z(), 1.f); 
+    }
+    FM_FUN_SIC Scale(mat4* M, float X, float Y, float Z) -> void {
+        // NOTE: Only the main diagonal is scaled, the other elements of a column are multiplied by 1
+        __m128 Ones = _mm_set1_ps(1.f);
+        __m128 S = _mm_setr_ps(X, Y, Z, 1.f);
+        M->Columns[0] = _mm_mul_ps(M->Columns[0], priv::Blend<1>(Ones, S));
+        M->Columns[1] = _mm_mul_ps(M->Columns[1], priv::Blend<2>(Ones, S));
+        M->Columns[2] = _mm_mul_ps(M->Columns[2], priv::Blend<4>(Ones, S));
+    }
+    FM_FUN_SIC Scale(mat4* M, float Scalar) -> void {
+        Scale(M, Scalar, Scalar, Scalar);
+    }
+    FM_FUN_SIC Scale(mat4* M, vec3 Scalar) -> void {
+        __m128 Ones = _mm_set1_ps(1.f);
+        M->Columns[0] = _mm_mul_ps(M->Columns[0], priv::Blend<1>(Ones, Scalar.M));
+        M->Columns[1] = _mm_mul_ps(M->Columns[1], priv::Blend<2>(Ones, Scalar.M));
+        M->Columns[2] = _mm_mul_ps(M->Columns[2], priv::Blend<4>(Ones, Scalar.M));
+        M->Columns[3] = priv::Blend<8>(M->Columns[3], Ones);
+    }
+    FM_FUN_SIC Scale(mat4* M, v3 Scalar) -> void {
+        return Scale(M, CastToVec3(Scalar));
+    }
+    FM_FUN_SIC Mat4RotationRadians(float Radians, float AxisX, float AxisY, float AxisZ) -> mat4 {
+        __m128 N = Normalize(Vec3(AxisX, AxisY, AxisZ)).M;
+        float SinTheta, CosTheta;
+        SinCos(Radians, &SinTheta, &CosTheta);
+        // NOTE: Column i is N * (N[i] * (1 - Cos)) plus column i of the cross product matrix of N * Sin plus Cos on the diagonal
+        __m128 SN = _mm_mul_ps(N, _mm_set1_ps(SinTheta));
+        __m128 CN = _mm_mul_ps(N, _mm_set1_ps(1.f - CosTheta));
+        mat4 R;
+        R.Columns[0] = priv::MulAdd(_mm_shuffle_ps(SN, SN, _MM_SHUFFLE(3, 1, 2, 0)), _mm_setr_ps(0.f, 1.f, -1.f, 0.f),
+                                    _mm_setr_ps(CosTheta, 0.f, 0.f, 0.f));
+        R.Columns[1] = priv::MulAdd(_mm_shuffle_ps(SN, SN, _MM_SHUFFLE(3, 0, 1, 2)), _mm_setr_ps(-1.f, 0.f, 1.f, 0.f),
+                                    _mm_setr_ps(0.f, CosTheta, 0.f, 0.f));
+        R.Columns[2] = priv::MulAdd(_mm_shuffle_ps(SN, SN, _MM_SHUFFLE(3, 2, 0, 1)), _mm_setr_ps(1.f, -1.f, 0.f, 0.f),
+                                    _mm_setr_ps(0.f, 0.f, CosTheta, 0.f));
+        R.Columns[0] = priv::MulAdd(N, _mm_shuffle_ps(CN, CN, _MM_SHUFFLE(0, 0, 0, 0)), R.Columns[0]);
+        R.Columns[1] = priv::MulAdd(N, _mm_shuffle_ps(CN, CN, _MM_SHUFFLE(1, 1, 1, 1)), R.Columns[1]);
+        R.Columns[2] = priv::MulAdd(N, _mm_shuffle_ps(CN, CN, _MM_SHUFFLE(2, 2, 2, 2)), R.Columns[2]);
+        R.Columns[3] = _mm_setr_ps(0.f, 0.f, 0.f, 1.f);
+        return R;
+    }
+    FM_FUN_SIC Mat4RotationRadians(float Radians, v3 Axis) -> mat4 {
+        return Mat4RotationRadians(Radians, Axis.X, Axis.Y, Axis.Z);
+    }
+    FM_FUN_SIC Mat4RotationRadians(float Radians, vec3 Axis) -> mat4 {
+        return Mat4RotationRadians(Radians, Axis.X(), Axis.Y(), Axis.Z());
+    }
+    FM_FUN_SIC Mat4RotationAroundXAxisRadians(float R) -> mat4 {
+        float S, C;
+        SinCos(R, &S, &C);
+        return Mat4FromRows(
+                            1.f, 0.f, 0.f, 0.f,
+                            0.f, C, -S, 0.f,
+                            0.f, S, C, 0.f,
+                            0.f, 0.f, 0.f, 1.f);
+    }
+    FM_FUN_SIC Mat4RotationAroundYAxisRadians(float R) -> mat4 {
+        float S, C;
+        SinCos(R, &S, &C);
+        return Mat4FromRows(
+                            C, 0.f, S, 0.f,
+                            0.f, 1.f, 0.f, 0.f,
+                            -S, 0.f, C, 0.f,
+                            0.f, 0.f, 0.f, 1.f);
+    }
+    FM_FUN_SIC Mat4RotationAroundZAxisRadians(float R) -> mat4 {
+        float S, C;
+        SinCos(R, &S, &C);
+        return Mat4FromRows(
+                            C, -S, 0.f, 0.f,
+                            S, C, 0.f, 0.f,
+                            0.f, 0.f, 1.f, 0.f,
+                            0.f, 0.f, 0.f, 1.f);
+    }
+    FM_FUN_SIC Mat4RotationAroundAllAxesRadians(float R) -> mat4 {
+        return Mat4RotationRadians(R, 1.f, 1.f, 1.f);
+    }
+    FM_FUN_SIC RotateRadians(mat4* M, float Radians, float AxisX, float AxisY, float AxisZ) -> void {
+        *M = *M * Mat4RotationRadians(Radians, AxisX, AxisY, AxisZ);
+    }
+    FM_FUN_SIC RotateRadians(mat4* M, float Radians, vec3 Axes) -> void {
+        *M = *M * Mat4RotationRadians(Radians, Axes);
+    }
+    FM_FUN_SIC RotateRadians(mat4* M, float Radians, v3 Axes) -> void {
+        *M = *M * Mat4RotationRadians(Radians, Axes);
+    }
+    // NOTE: The in place rotations and shears only compute the columns the product changes, with the same mat4 kernel
+    //       column code as operator*. So they are bit identical to *M = *M * Mat4...(...) on every tier and build.
+    FM_FUN_C RotateAroundXAxisRadians(mat4* M, float Radians) -> void;
+    FM_FUN_C RotateAroundYAxisRadians(mat4* M, float Radians) -> void;
+    FM_FUN_C RotateAroundZAxisRadians(mat4* M, float Radians) -> void;
+    FM_FUN_SIC RotateAroundAllAxesRadians(mat4* M, float Radians) -> void {
+        *M = *M * Mat4RotationAroundAllAxesRadians(Radians);
+    }
+    FM_FUN_SIC Mat4RotationDegrees(float Degrees, float AxisX, float AxisY, float AxisZ) -> mat4 {
+        return Mat4RotationRadians(DegreesToRadians(Degrees), AxisX, AxisY, AxisZ);
+    } 
+    FM_FUN_SIC Mat4RotationDegrees(float Degrees, v3 Axis) -> mat4 {
+        return Mat4RotationRadians(DegreesToRadians(Degrees), Axis);
+    }
+    FM_FUN_SIC Mat4RotationDegrees(float Degrees, vec3 Axis) -> mat4 {
+        return Mat4RotationRadians(DegreesToRadians(Degrees), Axis);
+    }
+    FM_FUN_SIC Mat4RotationAroundXAxisDegrees(float Degrees) -> mat4 {
+        return Mat4RotationAroundXAxisRadians(DegreesToRadians(Degrees));
+    }
+    FM_FUN_SIC Mat4RotationAroundYAxisDegrees(float Degrees) -> mat4 {
+        return Mat4RotationAroundYAxisRadians(DegreesToRadians(Degrees));
+    }
+    FM_FUN_SIC Mat4RotationAroundZAxisDegrees(float Degrees) -> mat4 {
+        return Mat4RotationAroundZAxisRadians(DegreesToRadians(Degrees));
+    }
+    FM_FUN_SIC Mat4RotationAroundAllAxesDegrees(float Degrees) -> mat4 {
+        return Mat4RotationAroundAllAxesRadians(DegreesToRadians(Degrees));
+    }
+    FM_FUN_SIC RotateDegrees(mat4* M, float Degrees, float AxisX, float AxisY, float AxisZ) -> void {
+        RotateRadians(M, DegreesToRadians(Degrees), AxisX, AxisY, AxisZ);
+    } 
+    FM_FUN_SIC RotateDegrees(mat4* M, float Degrees, v3 Axis) -> void {
+        RotateRadians(M, DegreesToRadians(Degrees), Axis);
+    }
+    FM_FUN_SIC RotateDegrees(mat4* M, float Degrees, vec3 Axis) -> void {
+        RotateRadians(M, DegreesToRadians(Degrees), Axis);
+    }
+    FM_FUN_SIC RotateAroundXAxisDegrees(mat4* M, float Degrees) -> void {
+        RotateAroundXAxisRadians(M, DegreesToRadians(Degrees));
+    }
+    FM_FUN_SIC RotateAroundYAxisDegrees(mat4* M, float Degrees) -> void {
+        RotateAroundYAxisRadians(M, DegreesToRadians(Degrees));
+    }
+    FM_FUN_SIC RotateAroundZAxisDegrees(mat4* M, float Degrees) -> void {
+        RotateAroundZAxisRadians(M, DegreesToRadians(Degrees));
+    }
+    FM_FUN_SIC RotateAroundAllAxesDegrees(mat4* M, float Degrees) -> void {
+        RotateAroundAllAxesRadians(M, DegreesToRadians(Degrees));
+    }
+    FM_FUN_SIC Mat4ShearXAxis(float Y, float Z) -> mat4 {
+        return Mat4FromRows(
+                            1.f, 0.f, 0.f, 0.f,
+                            Y,   1.f, 0.f, 0.f,
+                            Z,   0.f, 1.f, 0.f,
+                            0.f, 0.f, 0.f, 1.f);
+    }
+    FM_FUN_SIC Mat4ShearYAxis(float X, float Z) -> mat4 {
+        return Mat4FromRows(
+                            1.f, X,   0.f, 0.f,
+                            0.f, 1.f, 0.f, 0.f,
+                            0.f, Z,   1.f, 0.f,
+                            0.f, 0.f, 0.f, 1.f);
+    }
+    FM_FUN_SIC Mat4ShearZAxis(float X, float Y) -> mat4 {
+        return Mat4FromRows(
+                            1.f, 0.f, X,   0.f,
+                            0.f, 1.f, Y,   0.f,
+                            0.f, 0.f, 1.f, 0.f,
+                            0.f, 0.f, 0.f, 1.f);
+    }
+    FM_FUN_SIC Mat4Shear(float XY, float XZ, float YX, float YZ, float ZX, float ZY) -> mat4 {
+        return Mat4FromRows(
+                            1.f, YX, ZX, 0.f,
+                            XY, 1.f, ZY, 0.f,
+                            XZ, YZ, 1.f, 0.f,
+                            0.f, 0.f, 0.f, 1.f);
+    }
+    FM_FUN_C ShearXAxis(mat4* M, float Y, float Z) -> void;
+    FM_FUN_C ShearYAxis(mat4* M, float X, float Z) -> void;
+    FM_FUN_C ShearZAxis(mat4* M, float X, float Y) -> void;
+    FM_FUN_C Shear(mat4* M, float XY, float XZ, float YX, float YZ, float ZX, float ZY) -> void;
+    FM_FUN_SIC Mat4TranslationScaleRotationRadians(v3 Translation, v3 Scale, float Rotation, v3 RotationAxes) -> mat4 {
+        mat4 R = Mat4Scale(Scale);
+        RotateRadians(&R, Rotation, RotationAxes);
+        Translate(&R, Translation);
+        return R;
+    }
+    FM_FUN_SIC Mat4TranslationScaleRotationRadians(vec3 Translation, vec3 Scale, float Rotation, vec3 RotationAxes) -> mat4 {
+        mat4 R = Mat4Scale(Scale);
+        RotateRadians(&R, Rotation, RotationAxes);
+        Translate(&R, Translation);
+        return R;
+    }
+    FM_FUN_SIC Mat4TranslationScaleRotationDegrees(v3 Translation, v3 Scale, float Rotation, v3 RotationAxes) -> mat4 {
+        return Mat4TranslationScaleRotationRadians(Translation, Scale, DegreesToRadians(Rotation), RotationAxes);
+    }
+    FM_FUN_SIC Mat4TranslationScaleRotationDegrees(vec3 Translation, vec3 Scale, float Rotation, vec3 RotationAxes) -> mat4 {
+        return Mat4TranslationScaleRotationRadians(Translation, Scale, DegreesToRadians(Rotation), RotationAxes);
+    }
+    FM_FUN_SIC Mat4TranslationScale(v3 Translation, v3 Scale) -> mat4 {
+        mat4 R = Mat4Scale(Scale);
+        Translate(&R, Translation);
+        return R;
+    }
+    FM_FUN_SIC Mat4TranslationScale(vec3 Translation, vec3 Scale) -> mat4 {
+        mat4 R = Mat4Scale(Scale);
+        Translate(&R, Translation);
+        return R;
+    }
+    FM_FUN_SIC Mat4TranslationRotationRadians(v3 Translation, float Rotation, v3 RotationAxes) -> mat4 {
+        mat4 R = Mat4RotationRadians(Rotation, RotationAxes);
+        Translate(&R, Translation);
+        return R;
+    }
+    FM_FUN_SIC Mat4TranslationRotationRadians(vec3 Translation, float Rotation, vec3 RotationAxes) -> mat4 {
+        mat4 R = Mat4RotationRadians(Rotation, RotationAxes);
+        Translate(&R, Translation);
+        return R;
+    }
+    FM_FUN_SIC Mat4TranslationRotationDegrees(v3 Translation, float Rotation, v3 RotationAxes) -> mat4 {
+        return Mat4TranslationRotationRadians(Translation, DegreesToRadians(Rotation), RotationAxes);
+    }
+    FM_FUN_SIC Mat4TranslationRotationDegrees(vec3 Translation, float Rotation, vec3 RotationAxes) -> mat4 {
+        return Mat4TranslationRotationRadians(Translation, DegreesToRadians(Rotation), RotationAxes);
+    }
+    FM_FUN_SIC Mat4ScaleRotationRadians(v3 Scale, float Rotation, v3 RotationAxes) -> mat4 {
+        mat4 R = Mat4Scale(Scale);
+        RotateRadians(&R, Rotation, RotationAxes);
+        return R;
+    }
+    FM_FUN_SIC Mat4ScaleRotationRadians(vec3 Scale, float Rotation, vec3 RotationAxes) -> mat4 {
+        mat4 R = Mat4Scale(Scale);
+        RotateRadians(&R, Rotation, RotationAxes);
+        return R;
+    }
+    FM_FUN_SIC Mat4ScaleRotationDegrees(v3 Scale, float Rotation, v3 RotationAxes) -> mat4 {
+        return Mat4ScaleRotationRadians(Scale, DegreesToRadians(Rotation), RotationAxes);
+    }
+    FM_FUN_SIC Mat4ScaleRotationDegrees(vec3 Scale, float Rotation, vec3 RotationAxes) -> mat4 {
+        return Mat4ScaleRotationRadians(Scale, DegreesToRadians(Rotation), RotationAxes);
+    }
+    FM_FUN_SIC Mat4OrthographicTopDown(rect2 A) -> mat4 {
+        FM_Rect2ToMinMax(A, Min, Max);
+        return Mat4Orthographic(Min.X, Max.X, Max.Y, Min.Y);
+    }
+    FM_FUN_SIC Mat4OrthographicBottomUp(rect2 A) -> mat4 {
+        FM_Rect2ToMinMax(A, Min, Max);
+        return Mat4Orthographic(Min.X, Max.X, Min.Y, Max.Y);
+    }
+    namespace priv {
+        // NOTE: Taylor series evaluated in double, accurate for |X| <= Pi / 2 which covers every field of view below 180 degrees
+        FM_FUN_SIE ConstexprCotangent(double X) -> double {
+            double Sin = 0.0, Cos = 0.0;
+            double Term = 1.0;
+            for(int32_t i = 0; i < 26; ++i)
+            {
+                double SignedTerm = (i / 2) % 2 ? -Term : Term;
+                if(i % 2)
+                    Sin += SignedTerm;
+                else
+                    Cos += SignedTerm;
+                Term *= X / (i + 1);
+            }
+            return Cos / Sin;
+        }
+    }
+    FM_FUN_SIC Mat4FromConstant(const mat4_constant& C) -> mat4 {
+        mat4 R;
+        for(int32_t i = 0; i < 4; ++i)
+            R.Columns[i] = _mm_load_ps(&C.Columns[i].X);
+        return R;
+    }
+    FM_FUN_SIE Mat4TranslationConstant(float X, float Y, float Z) -> mat4_constant {
+        return {{
+                {1.f, 0.f, 0.f, 0.f},
+                {0.f, 1.f, 0.f, 0.f},
+                {0.f, 0.f, 1.f, 0.f},
+                {X, Y, Z, 1.f}}};
+    }
+    FM_FUN_SIE Mat4TranslationConstant(v3 Translation) -> mat4_constant {
+        return Mat4TranslationConstant(Translation.X, Translation.Y, Translation.Z);
+    }
+    FM_FUN_SIE Mat4OrthographicConstant(float Left, float Right, float Bottom, float Top, float Near = 0, float Far = 1) -> mat4_constant {
+        float RL = Right - Left;
+        float TB = Top - Bottom;
+        float FN = Far - Near;
+        
+        return {{
+                {2.f / RL, 0.f, 0.f, 0.f},
+                {0.f, 2.f / TB, 0.f, 0.f},
+                {0.f, 0.f, -2.f / FN, 0.f},
+                {-((Right + Left) / RL), -((Top + Bottom) / TB), -((Far + Near) / FN), 1.f}}};
+    }
+    FM_FUN_SIE Mat4PerspectiveConstant(float Fov, float AspectRatio, float Near, float Far) -> mat4_constant {
+        float Cotangent = (float)priv::ConstexprCotangent(Fov * Pi32 / 360.f);
+        float NF = Near - Far;
+        
+        return {{
+                {Cotangent / AspectRatio, 0.f, 0.f, 0.f},
+                {0.f, Cotangent, 0.f, 0.f},
+                {0.f, 0.f, (Near + Far) / NF, -1.f},
+                {0.f, 0.f, (2 * Near * Far) / NF, 0.f}}};
+    }
+    
+    //////////////////////
+    // mat3x4 functions //
+    //////////////////////
+    FM_FUN_IC mat3x4::GetRowV4(uint32_t Index) -> v4 {
+        FM_ASSERT(Index <= 2);
+        return CastToV4(Vec4(Rows[Index]));
+    }
+    FM_FUN_IC mat3x4::GetRowVec4(uint32_t Index) -> vec4 {
+        FM_ASSERT(Index <= 2);
+        return Vec4(Rows[Index]);
+    }
+    FM_FUN_IC mat3x4::GetTranslationVec3() -> vec3 {
+        __m128 T01 = _mm_unpackhi_ps(Rows[0], Rows[1]);
+        __m128 T = _mm_shuffle_ps(T01, Rows[2], _MM_SHUFFLE(2, 3, 3, 2));
+        return Vec3(_mm_and_ps(T, _mm_castsi128_ps(_mm_setr_epi32(-1, -1, -1, 0))));
+    }
+    FM_FUN_IC mat3x4::GetTranslationV3() -> v3 {
+        return CastToV3(GetTranslationVec3());
+    }
+    FM_FUN_I mat3x4::operator[](uint32_t Index) -> float& {
+        FM_ASSERT(Index <= 11);
+        return *((float*)(Rows) + Index);
+    }
+    FM_FUN_SIC Mat3x4FromRows(
+                              float XX, float XY, float XZ, float XW,
+                              float YX, float YY, float YZ, float YW,
+                              float ZX, float ZY, float ZZ, float ZW) -> mat3x4 {
+        mat3x4 R;
+        R.Rows[0] = _mm_setr_ps(XX, XY, XZ, XW);
+        R.Rows[1] = _mm_setr_ps(YX, YY, YZ, YW);
+        R.Rows[2] = _mm_setr_ps(ZX, ZY, ZZ, ZW);
+        return R;
+    }
+    FM_FUN_SIC Mat3x4FromRows(vec4 Row1, vec4 Row2, vec4 Row3) -> mat3x4 {
+        mat3x4 R;
+        R.Rows[0] = Row1.M;
+        R.Rows[1] = Row2.M;
+        R.Rows[2] = Row3.M;
+        return R;
+    }
+    FM_FUN_SIC Mat3x4FromRows(v4 Row1, v4 Row2, v4 Row3) -> mat3x4 {
+        return Mat3x4FromRows(CastToVec4(Row1), CastToVec4(Row2), CastToVec4(Row3));
+    }
+    FM_FUN_SIC Mat3x4FromRowMajorMemory(float* Mem) -> mat3x4 {
+        mat3x4 R;
+        for(int32_t i = 0; i < 3; ++i)
+            R.Rows[i] = _mm_loadu_ps(Mem + i*4);
+        return R;
+    }
+    FM_FUN_SIC Mat3x4Identity() -> mat3x4 {
+        return Mat3x4FromRows(
+                              1.f, 0.f, 0.f, 0.f,
+                              0.f, 1.f, 0.f, 0.f,
+                              0.f, 0.f, 1.f, 0.f);
+    }
+    // NOTE: The last row of M is dropped, it has to be (0, 0, 0, 1) for the conversion to be lossless
+    FM_FUN_SIC Mat3x4FromMat4(mat4 M) -> mat3x4 {
+        _MM_TRANSPOSE4_PS(M.Columns[0], M.Columns[1], M.Columns[2], M.Columns[3]);
+        mat3x4 R;
+        R.Rows[0] = M.Columns[0];
+        R.Rows[1] = M.Columns[1];
+        R.Rows[2] = M.Columns[2];
+        return R;
+    }
+    FM_FUN_SIC Mat4FromMat3x4(mat3x4 M) -> mat4 {
+        mat4 R;
+        R.Columns[0] = M.Rows[0];
+        R.Columns[1] = M.Rows[1];
+        R.Columns[2] = M.Rows[2];
+        R.Columns[3] = _mm_setr_ps(0.f, 0.f, 0.f, 1.f);
+        _MM_TRANSPOSE4_PS(R.Columns[0], R.Columns[1], R.Columns[2], R.Columns[3]);
+        return R;
+    }
+    FM_FUN_SIC Mat3x4Translation(float X, float Y, float Z) -> mat3x4 {
+        return Mat3x4FromRows(
+                              1.f, 0.f, 0.f, X,
+                              0.f, 1.f, 0.f, Y,
+                              0.f, 0.f, 1.f, Z);
+    }
+    FM_FUN_SIC Mat3x4Translation(v3 Translation) -> mat3x4 {
+        return Mat3x4Translation(Translation.X, Translation.Y, Translation.Z);
+    }
+    FM_FUN_SIC Mat3x4Translation(vec3 Translation) -> mat3x4 {
+        return Mat3x4Translation(CastToV3(Translation));
+    }
+    FM_FUN_SIC Mat3x4Scale(float ScalarX, float ScalarY, float ScalarZ) -> mat3x4 {
+        return Mat3x4FromRows(
+                              ScalarX, 0.f, 0.f, 0.f,
+                              0.f, ScalarY, 0.f, 0.f,
+                              0.f, 0.f, ScalarZ, 0.f);
+    }
+    FM_FUN_SIC Mat3x4Scale(float Scalar) -> mat3x4 {
+        return Mat3x4Scale(Scalar, Scalar, Scalar);
+    }
+    FM_FUN_SIC Mat3x4Scale(v3 Scalar) -> mat3x4 {
+        return Mat3x4Scale(Scalar.X, Scalar.Y, Scalar.Z);
+    }
+    FM_FUN_SIC Mat3x4Scale(vec3 Scalar) -> mat3x4 {
+        return Mat3x4Scale(CastToV3(Scalar));
+    }
+    FM_FUN_SIC Mat3x4RotationRadians(float Radians, float AxisX, float AxisY, float AxisZ) -> mat3x4 {
+        return Mat3x4FromMat4(Mat4RotationRadians(Radians, AxisX, AxisY, AxisZ));
+    }
+    FM_FUN_SIC Mat3x4RotationRadians(float Radians, v3 Axis) -> mat3x4 {
+        return Mat3x4RotationRadians(Radians, Axis.X, Axis.Y, Axis.Z);
+    }
+    FM_FUN_SIC Mat3x4RotationRadians(float Radians, vec3 Axis) -> mat3x4 {
+        return Mat3x4RotationRadians(Radians, Axis.X(), Axis.Y(), Axis.Z());
+    }
+    FM_FUN_SIC Mat3x4RotationDegrees(float Degrees, float AxisX, float AxisY, float AxisZ) -> mat3x4 {
+        return Mat3x4RotationRadians(DegreesToRadians(Degrees), AxisX, AxisY, AxisZ);
+    }
+    FM_FUN_SIC Mat3x4RotationDegrees(float Degrees, v3 Axis) -> mat3x4 {
+        return Mat3x4RotationRadians(DegreesToRadians(Degrees), Axis);
+    }
+    FM_FUN_SIC Mat3x4RotationDegrees(float Degrees, vec3 Axis) -> mat3x4 {
+        return Mat3x4RotationRadians(DegreesToRadians(Degrees), Axis);
+    }
+    // NOTE: Row i of A * B is A[i].X * B[0] + A[i].Y * B[1] + A[i].Z * B[2] + (0, 0, 0, A[i].W),
+    //       which is 9 multiplications instead of 16 for mat4
+    FM_FUN_SIC operator*(mat3x4 A, mat3x4 B) -> mat3x4 {
+        __m128 WMask = _mm_castsi128_ps(_mm_setr_epi32(0, 0, 0, -1));
+        mat3x4 R;
+        for(uint32_t Row = 0; Row < 3; ++Row)
+        {
+            __m128 ARow = A.Rows[Row];
+            __m128 X = _mm_mul_ps(_mm_shuffle_ps(ARow, ARow, _MM_SHUFFLE(0, 0, 0, 0)), B.Rows[0]);
+            __m128 Y = _mm_mul_ps(_mm_shuffle_ps(ARow, ARow, _MM_SHUFFLE(1, 1, 1, 1)), B.Rows[1]);
+            __m128 Z = _mm_mul_ps(_mm_shuffle_ps(ARow, ARow, _MM_SHUFFLE(2, 2, 2, 2)), B.Rows[2]);
+            R.Rows[Row] = _mm_add_ps(_mm_add_ps(X, Y), _mm_add_ps(Z, _mm_and_ps(ARow, WMask)));
+        }
+        return R;
+    }
+    FM_FUN_SIC operator*=(mat3x4& A, mat3x4 B) -> mat3x4& {
+        A = A * B;
+        return A;
+    }
+    FM_FUN_SIC operator==(mat3x4 A, mat3x4 B) -> bool {
+        bool R = true;
+        for(uint32_t Row = 0; Row < 3; ++Row)
+        {
+            if(Vec4(A.Rows[Row]) != Vec4(B.Rows[Row]))
+            {
+                R = false;
+                break;
+            }
+        }
+        return R;
+    }
+    FM_FUN_SIC operator!=(mat3x4 A, mat3x4 B) -> bool {
+        return !(A == B);
+    }
+    namespace priv {
+        // NOTE: V has to have the W it should be transformed with
+        FM_SINL __m128 FM_CALL Mat3x4Transform(const mat3x4& M, __m128 V) {
+            __m128 X = _mm_mul_ps(M.Rows[0], V);
+            __m128 Y = _mm_mul_ps(M.Rows[1], V);
+            __m128 Z = _mm_mul_ps(M.Rows[2], V);
+            __m128 W = _mm_setzero_ps();
+            _MM_TRANSPOSE4_PS(X, Y, Z, W);
+            return _mm_add_ps(_mm_add_ps(X, Y), _mm_add_ps(Z, W));
+        }
+    }
+    FM_FUN_SIC TransformPoint(mat3x4 M, vec3 P) -> vec3 {
+        __m128 XYZMask = _mm_castsi128_ps(_mm_setr_epi32(-1, -1, -1, 0));
+        __m128 P1 = _mm_or_ps(_mm_and_ps(P.M, XYZMask), _mm_setr_ps(0.f, 0.f, 0.f, 1.f));
+        return Vec3(priv::Mat3x4Transform(M, P1));
+    }
+    FM_FUN_SIC TransformPoint(mat3x4 M, v3 P) -> v3 {
+        return CastToV3(TransformPoint(M, CastToVec3(P)));
+    }
+    FM_FUN_SIC TransformDirection(mat3x4 M, vec3 D) -> vec3 {
+        __m128 XYZMask = _mm_castsi128_ps(_mm_setr_epi32(-1, -1, -1, 0));
+        return Vec3(priv::Mat3x4Transform(M, _mm_and_ps(D.M, XYZMask)));
+    }
+    FM_FUN_SIC TransformDirection(mat3x4 M, v3 D) -> v3 {
+        return CastToV3(TransformDirection(M, CastToVec3(D)));
+    }
+    
+    ////////////////////
+    // quat functions //
+    ////////////////////
+    FM_FUN_IC quat::X() const -> float {
+        return priv::GetX(M);
+    }
+    FM_FUN_IC quat::Y() const -> float {
+        return priv::GetY(M);
+    }
+    FM_FUN_IC quat::Z() const -> float {
+        return priv::GetZ(M);
+    }
+    FM_FUN_IC quat::W() const -> float {
+        return priv::GetW(M);
+    }
+    FM_FUN_I quat::operator[](uint32_t Index) -> float& {
+        FM_ASSERT(Index <= 3);
+        return *((float*)(&M) + Index);
+    }
+    FM_FUN_SIC Quat(float X, float Y, float Z, float W) -> quat {
+        quat R;
+        R.M = _mm_setr_ps(X, Y, Z, W);
+        return R;
+    }
+    FM_FUN_SIC Quat(__m128 M) -> quat {
+        quat R;
+        R.M = M;
+        return R;
+    }
+    FM_FUN_SIC QuatIdentity() -> quat {
+        return Quat(0.f, 0.f, 0.f, 1.f);
+    }
+    FM_FUN_SIC QuatRotationRadians(float Radians, float AxisX, float AxisY, float AxisZ) -> quat {
+        vec3 Axis = Normalize(Vec3(AxisX, AxisY, AxisZ));
+        float SinHalf, CosHalf;
+        SinCos(Radians * 0.5f, &SinHalf, &CosHalf);
+        return Quat(Axis.X() * SinHalf, Axis.Y() * SinHalf, Axis.Z() * SinHalf, CosHalf);
+    }
+    FM_FUN_SIC QuatRotationRadians(float Radians, v3 Axis) -> quat {
+        return QuatRotationRadians(Radians, Axis.X, Axis.Y, Axis.Z);
+    }
+    FM_FUN_SIC QuatRotationRadians(float Radians, vec3 Axis) -> quat {
+        return QuatRotationRadians(Radians, Axis.X(), Axis.Y(), Axis.Z());
+    }
+    FM_FUN_SIC QuatRotationDegrees(float Degrees, float AxisX, float AxisY, float AxisZ) -> quat {
+        return QuatRotationRadians(DegreesToRadians(Degrees), AxisX, AxisY, AxisZ);
+    }
+    FM_FUN_SIC QuatRotationDegrees(float Degrees, v3 Axis) -> quat {
+        return QuatRotationRadians(DegreesToRadians(Degrees), Axis);
+    }
+    FM_FUN_SIC QuatRotationDegrees(float Degrees, vec3 Axis) -> quat {
+        return QuatRotationRadians(DegreesToRadians(Degrees), Axis);
+    }
+    // NOTE: Rotates around X first, then around Y and then around Z
+    FM_FUN_SIC QuatEulerRadians(float X, float Y, float Z) -> quat {
+        vec4 Sin, Cos;
+        SinCos(Vec4(X, Y, Z, 0.f) * 0.5f, &Sin, &Cos);
+        float SX = Sin.X(), CX = Cos.X();
+        float SY = Sin.Y(), CY = Cos.Y();
+        float SZ = Sin.Z(), CZ = Cos.Z();
+        return Quat(
+                    SX * CY * CZ - CX * SY * SZ,
+                    CX * SY * CZ + SX * CY * SZ,
+                    CX * CY * SZ - SX * SY * CZ,
+                    CX * CY * CZ + SX * SY * SZ);
+    }
+    FM_FUN_SIC QuatEulerRadians(v3 Radians) -> quat {
+        return QuatEulerRadians(Radians.X, Radians.Y, Radians.Z);
+    }
+    FM_FUN_SIC QuatEulerDegrees(float X, float Y, float Z) -> quat {
+        return QuatEulerRadians(DegreesToRadians(X), DegreesToRadians(Y), DegreesToRadians(Z));
+    }
+    FM_FUN_SIC QuatEulerDegrees(v3 Degrees) -> quat {
+        return QuatEulerDegrees(Degrees.X, Degrees.Y, Degrees.Z);
+    }
+    FM_FUN_SIC operator*(quat A, quat B) -> quat {
+        __m128 AX = _mm_shuffle_ps(A.M, A.M, _MM_SHUFFLE(0, 0, 0, 0));
+        __m128 AY = _mm_shuffle_ps(A.M, A.M, _MM_SHUFFLE(1, 1, 1, 1));
+        __m128 AZ = _mm_shuffle_ps(A.M, A.M, _MM_SHUFFLE(2, 2, 2, 2));
+        __m128 AW = _mm_shuffle_ps(A.M, A.M, _MM_SHUFFLE(3, 3, 3, 3));
+        __m128 SignsX = _mm_castsi128_ps(_mm_setr_epi32(0, 0x80000000, 0, 0x80000000));
+        __m128 SignsY = _mm_castsi128_ps(_mm_setr_epi32(0, 0, 0x80000000, 0x80000000));
+        __m128 SignsZ = _mm_castsi128_ps(_mm_setr_epi32(0x80000000, 0, 0, 0x80000000));
+        __m128 X = _mm_mul_ps(AX, _mm_xor_ps(_mm_shuffle_ps(B.M, B.M, _MM_SHUFFLE(0, 1, 2, 3)), SignsX));
+        __m128 Y = _mm_mul_ps(AY, _mm_xor_ps(_mm_shuffle_ps(B.M, B.M, _MM_SHUFFLE(1, 0, 3, 2)), SignsY));
+        __m128 Z = _mm_mul_ps(AZ, _mm_xor_ps(_mm_shuffle_ps(B.M, B.M, _MM_SHUFFLE(2, 3, 0, 1)), SignsZ));
+        return Quat(_mm_add_ps(_mm_add_ps(_mm_mul_ps(AW, B.M), X), _mm_add_ps(Y, Z)));
+    }
+    FM_FUN_SIC operator*=(quat& A, quat B) -> quat& {
+        A = A * B;
+        return A;
+    }
+    FM_FUN_SIC operator-(quat Q) -> quat {
+        return Quat(_mm_sub_ps(_mm_setzero_ps(), Q.M));
+    }
+    FM_FUN_SIC operator==(quat A, quat B) -> bool {
+        return _mm_movemask_ps(_mm_cmpeq_ps(A.M, B.M)) == 0xF;
+    }
+    FM_FUN_SIC operator!=(quat A, quat B) -> bool {
+        return !(A == B);
+    }
+    FM_FUN_SIC Dot(quat A, quat B) -> float {
+        return Dot(Vec4(A.M), Vec4(B.M));
+    }
+    FM_FUN_SIC Length(quat Q) -> float {
+        return sqrtf(Dot(Q, Q));
+    }
+    FM_FUN_SIC Normalize(quat Q) -> quat {
+        return Quat(_mm_div_ps(Q.M, _mm_sqrt_ps(priv::SplatDot<4>(Q.M, Q.M))));
+    }
+    FM_FUN_SIC Conjugate(quat Q) -> quat {
+        return Quat(_mm_xor_ps(Q.M, _mm_castsi128_ps(_mm_setr_epi32(0x80000000, 0x80000000, 0x80000000, 0))));
+    }
+    FM_FUN_SIC Inverse(quat Q) -> quat {
+        return Quat(_mm_div_ps(Conjugate(Q).M, priv::SplatDot<4>(Q.M, Q.M)));
+    }
+    // NOTE: Both lerps take the shorter path, B is negated when it's on the other side of A
+    FM_FUN_SIC Nlerp(quat A, quat B, float T) -> quat {
+        if(Dot(A, B) < 0.f)
+            B = -B;
+        return Normalize(Quat(_mm_add_ps(_mm_mul_ps(A.M, _mm_set1_ps(1.f - T)), _mm_mul_ps(B.M, _mm_set1_ps(T)))));
+    }
+    FM_FUN_SIC Slerp(quat A, quat B, float T) -> quat {
+        float CosAngle = Dot(A, B);
+        if(CosAngle < 0.f)
+        {
+            B = -B;
+            CosAngle = -CosAngle;
+        }
+        if(CosAngle > 0.9995f)
+            return Nlerp(A, B, T);
+        float Angle = acosf(CosAngle);
+        vec4 Sines = Sin(Vec4(Angle, (1.f - T) * Angle, T * Angle, 0.f));
+        float InvSin = 1.f / Sines.X();
+        __m128 WA = _mm_set1_ps(Sines.Y() * InvSin);
+        __m128 WB = _mm_set1_ps(Sines.Z() * InvSin);
+        return Quat(_mm_add_ps(_mm_mul_ps(A.M, WA), _mm_mul_ps(B.M, WB)));
+    }
+    // NOTE: V + W * T + Cross(Q.XYZ, T) where T = 2 * Cross(Q.XYZ, V)
+    FM_FUN_SIC Rotate(quat Q, vec3 V) -> vec3 {
+        vec3 U = Vec3(Q.M);
+        vec3 T = Cross(U, V) * 2.f;
+        return V + T * Q.W() + Cross(U, T);
+    }
+    FM_FUN_SIC Rotate(quat Q, v3 V) -> v3 {
+        return CastToV3(Rotate(Q, CastToVec3(V)));
+    }
+    namespace priv {
+        // NOTE: Column j of the rotation is (W^2 - |U|^2) * E_j + 2 * U * U_j + 2 * W * Cross(U, E_j)
+        FM_SINL void FM_CALL QuatToColumns(__m128 Q, __m128* C0, __m128* C1, __m128* C2) {
+            __m128 XYZMask = _mm_castsi128_ps(_mm_setr_epi32(-1, -1, -1, 0));
+            __m128 U2 = _mm_and_ps(_mm_add_ps(Q, Q), XYZMask);
+            __m128 WU2 = _mm_mul_ps(_mm_shuffle_ps(Q, Q, _MM_SHUFFLE(3, 3, 3, 3)), U2);
+            __m128 S = _mm_mul_ps(Q, _mm_xor_ps(Q, _mm_castsi128_ps(_mm_setr_epi32(0x80000000, 0x80000000, 0x80000000, 0))));
+            S = _mm_add_ps(S, _mm_shuffle_ps(S, S, _MM_SHUFFLE(2, 3, 0, 1)));
+            S = _mm_add_ps(S, _mm_shuffle_ps(S, S, _MM_SHUFFLE(1, 0, 3, 2)));
+            
+            __m128 Cross0 = _mm_xor_ps(_mm_shuffle_ps(WU2, WU2, _MM_SHUFFLE(3, 1, 2, 3)), _mm_castsi128_ps(_mm_setr_epi32(0, 0, 0x80000000, 0)));
+            __m128 Cross1 = _mm_xor_ps(_mm_shuffle_ps(WU2, WU2, _MM_SHUFFLE(3, 0, 3, 2)), _mm_castsi128_ps(_mm_setr_epi32(0x80000000, 0, 0, 0)));
+            __m128 Cross2 = _mm_xor_ps(_mm_shuffle_ps(WU2, WU2, _MM_SHUFFLE(3, 3, 0, 1)), _mm_castsi128_ps(_mm_setr_epi32(0, 0x80000000, 0, 0)));
+            
+            *C0 = _mm_add_ps(_mm_and_ps(S, _mm_castsi128_ps(_mm_setr_epi32(-1, 0, 0, 0))),
+                             _mm_add_ps(_mm_mul_ps(U2, _mm_shuffle_ps(Q, Q, _MM_SHUFFLE(0, 0, 0, 0))), Cross0));
+            *C1 = _mm_add_ps(_mm_and_ps(S, _mm_castsi128_ps(_mm_setr_epi32(0, -1, 0, 0))),
+                             _mm_add_ps(_mm_mul_ps(U2, _mm_shuffle_ps(Q, Q, _MM_SHUFFLE(1, 1, 1, 1))), Cross1));
+            *C2 = _mm_add_ps(_mm_and_ps(S, _mm_castsi128_ps(_mm_setr_epi32(0, 0, -1, 0))),
+                             _mm_add_ps(_mm_mul_ps(U2, _mm_shuffle_ps(Q, Q, _MM_SHUFFLE(2, 2, 2, 2))), Cross2));
+        }
+    }
+    FM_FUN_SIC Mat4FromQuat(quat Q) -> mat4 {
+        mat4 R;
+        priv::QuatToColumns(Q.M, &R.Columns[0], &R.Columns[1], &R.Columns[2]);
+        R.Columns[3] = _mm_setr_ps(0.f, 0.f, 0.f, 1.f);
+        return R;
+    }
+    FM_FUN_SIC Mat3x4FromQuat(quat Q) -> mat3x4 {
+        // NOTE: Rows of a rotation are the columns of its inverse
+        mat3x4 R;
+        priv::QuatToColumns(Conjugate(Q).M, &R.Rows[0], &R.Rows[1], &R.Rows[2]);
+        return R;
+    }
+    // NOTE: Same order as Mat4TranslationScaleRotationRadians, Translation * Scale * Rotation
+    FM_FUN_SIC Mat4TranslationScaleRotation(vec3 Translation, vec3 Scale, quat Rotation) -> mat4 {
+        mat4 R;
+        priv::QuatToColumns(Rotation.M, &R.Columns[0], &R.Columns[1], &R.Columns[2]);
+        __m128 ScaleM = _mm_and_ps(Scale.M, _mm_castsi128_ps(_mm_setr_epi32(-1, -1, -1, 0)));
+        R.Columns[0] = _mm_mul_ps(R.Columns[0], ScaleM);
+        R.Columns[1] = _mm_mul_ps(R.Columns[1], ScaleM);
+        R.Columns[2] = _mm_mul_ps(R.Columns[2], ScaleM);
+        R.Columns[3] = Vec4(Translation, 1.f).M;
+        return R;
+    }
+    FM_FUN_SIC Mat4TranslationScaleRotation(v3 Translation, v3 Scale, quat Rotation) -> mat4 {
+        return Mat4TranslationScaleRotation(CastToVec3(Translation), CastToVec3(Scale), Rotation);
+    }
+    FM_FUN_SIC Mat3x4TranslationScaleRotation(vec3 Translation, vec3 Scale, quat Rotation) -> mat3x4 {
+        mat3x4 R = Mat3x4FromQuat(Rotation);
+        __m128 XYZMask = _mm_castsi128_ps(_mm_setr_epi32(-1, -1, -1, 0));
+        __m128 ScaleM = _mm_shuffle_ps(Scale.M, Scale.M, _MM_SHUFFLE(0, 0, 0, 0));
+        __m128 T = _mm_andnot_ps(XYZMask, _mm_shuffle_ps(Translation.M, Translation.M, _MM_SHUFFLE(0, 0, 0, 0)));
+        R.Rows[0] = _mm_or_ps(_mm_mul_ps(R.Rows[0], ScaleM), T);
+        ScaleM = _mm_shuffle_ps(Scale.M, Scale.M, _MM_SHUFFLE(1, 1, 1, 1));
+        T = _mm_andnot_ps(XYZMask, _mm_shuffle_ps(Translation.M, Translation.M, _MM_SHUFFLE(1, 1, 1, 1)));
+        R.Rows[1] = _mm_or_ps(_mm_mul_ps(R.Rows[1], ScaleM), T);
+        ScaleM = _mm_shuffle_ps(Scale.M, Scale.M, _MM_SHUFFLE(2, 2, 2, 2));
+        T = _mm_andnot_ps(XYZMask, _mm_shuffle_ps(Translation.M, Translation.M, _MM_SHUFFLE(2, 2, 2, 2)));
+        R.Rows[2] = _mm_or_ps(_mm_mul_ps(R.Rows[2], ScaleM), T);
+        return R;
+    }
+    FM_FUN_SIC Mat3x4TranslationScaleRotation(v3 Translation, v3 Scale, quat Rotation) -> mat3x4 {
+        return Mat3x4TranslationScaleRotation(CastToVec3(Translation), CastToVec3(Scale), Rotation);
+    }
+    
+    /////////////////////////////////
+    // transform_builder functions //
+    /////////////////////////////////
+    // NOTE: Translate adds to the translation like Translate(mat4*, ...), the other steps multiply on the right
+    //       like RotateRadians(mat4*, ...) and ShearXAxis(mat4*, ...). Scale(mat4*, ...) only matches for diagonal matrices.
+    FM_FUN_SIC TransformBuilder() -> transform_builder {
+        transform_builder R;
+        R.Translation = _mm_setzero_ps();
+        R.Scale = _mm_setr_ps(1.f, 1.f, 1.f, 0.f);
+        R.Rotation = QuatIdentity();
+        R.Linear[0] = R.Linear[1] = R.Linear[2] = _mm_setzero_ps();
+        R.HasRotation = false;
+        R.HasLinear = false;
+        return R;
+    }
+    namespace priv {
+        FM_SINL __m128 FM_CALL MulColumns3(const __m128* Columns, __m128 V) {
+            __m128 R = _mm_mul_ps(Columns[0], _mm_shuffle_ps(V, V, _MM_SHUFFLE(0, 0, 0, 0)));
+            R = MulAdd(Columns[1], _mm_shuffle_ps(V, V, _MM_SHUFFLE(1, 1, 1, 1)), R);
+            return MulAdd(Columns[2], _mm_shuffle_ps(V, V, _MM_SHUFFLE(2, 2, 2, 2)), R);
+        }
+        FM_SINL void FM_CALL ScaleRotationColumns(const transform_builder* B, __m128* Columns) {
+            if(B->HasRotation)
+            {
+                QuatToColumns(B->Rotation.M, &Columns[0], &Columns[1], &Columns[2]);
+                Columns[0] = _mm_mul_ps(Columns[0], B->Scale);
+                Columns[1] = _mm_mul_ps(Columns[1], B->Scale);
+                Columns[2] = _mm_mul_ps(Columns[2], B->Scale);
+            }
+            else
+            {
+                Columns[0] = _mm_and_ps(B->Scale, _mm_castsi128_ps(_mm_setr_epi32(-1, 0, 0, 0)));
+                Columns[1] = _mm_and_ps(B->Scale, _mm_castsi128_ps(_mm_setr_epi32(0, -1, 0, 0)));
+                Columns[2] = _mm_and_ps(B->Scale, _mm_castsi128_ps(_mm_setr_epi32(0, 0, -1, 0)));
+            }
+        }
+        FM_SINL void FM_CALL FoldIntoLinear(transform_builder* B) {
+            __m128 Columns[3];
+            ScaleRotationColumns(B, Columns);
+            for(uint32_t i = 0; B->HasLinear && i < 3; ++i)
+                Columns[i] = MulColumns3(B->Linear, Columns[i]);
+            B->Linear[0] = Columns[0];
+            B->Linear[1] = Columns[1];
+            B->Linear[2] = Columns[2];
+            B->Scale = _mm_setr_ps(1.f, 1.f, 1.f, 0.f);
+            B->Rotation = QuatIdentity();
+            B->HasRotation = false;
+            B->HasLinear = true;
+        }
+        FM_SINL void FM_CALL ShearBuilder(transform_builder* B, __m128 Col0, __m128 Col1, __m128 Col2) {
+            FoldIntoLinear(B);
+            __m128 L[3] = {B->Linear[0], B->Linear[1], B->Linear[2]};
+            B->Linear[0] = MulColumns3(L, Col0);
+            B->Linear[1] = MulColumns3(L, Col1);
+            B->Linear[2] = MulColumns3(L, Col2);
+        }
+    }
+    FM_FUN_SIC Translate(transform_builder* B, float X, float Y, float Z) -> void {
+        B->Translation = _mm_add_ps(B->Translation, _mm_set_ps(0.f, Z, Y, X));
+    }
+    FM_FUN_SIC Translate(transform_builder* B, vec3 Trans) -> void {
+        B->Translation = _mm_add_ps(B->Translation, _mm_and_ps(Trans.M, _mm_castsi128_ps(_mm_setr_epi32(-1, -1, -1, 0))));
+    }
+    FM_FUN_SIC Translate(transform_builder* B, v3 Trans) -> void {
+        Translate(B, Trans.X, Trans.Y, Trans.Z);
+    }
+    FM_FUN_SIC Rotate(transform_builder* B, quat Rotation) -> void {
+        B->Rotation = B->Rotation * Rotation;
+        B->HasRotation = true;
+    }
+    FM_FUN_SIC RotateRadians(transform_builder* B, float Radians, float AxisX, float AxisY, float AxisZ) -> void {
+        Rotate(B, QuatRotationRadians(Radians, AxisX, AxisY, AxisZ));
+    }
+    FM_FUN_SIC RotateRadians(transform_builder* B, float Radians, vec3 Axis) -> void {
+        Rotate(B, QuatRotationRadians(Radians, Axis));
+    }
+    FM_FUN_SIC RotateRadians(transform_builder* B, float Radians, v3 Axis) -> void {
+        Rotate(B, QuatRotationRadians(Radians, Axis));
+    }
+    FM_FUN_SIC RotateDegrees(transform_builder* B, float Degrees, float AxisX, float AxisY, float AxisZ) -> void {
+        Rotate(B, QuatRotationDegrees(Degrees, AxisX, AxisY, AxisZ));
+    }
+    FM_FUN_SIC RotateDegrees(transform_builder* B, float Degrees, vec3 Axis) -> void {
+        Rotate(B, QuatRotationDegrees(Degrees, Axis));
+    }
+    FM_FUN_SIC RotateDegrees(transform_builder* B, float Degrees, v3 Axis) -> void {
+        Rotate(B, QuatRotationDegrees(Degrees, Axis));
+    }
+    FM_FUN_SIC Scale(transform_builder* B, vec3 Scalar) -> void {
+        // NOTE: A uniform scale commutes with the rotation, a non uniform one only when there is no rotation yet
+        __m128 S = _mm_and_ps(Scalar.M, _mm_castsi128_ps(_mm_setr_epi32(-1, -1, -1, 0)));
+        bool Uniform = (_mm_movemask_ps(_mm_cmpeq_ps(S, _mm_shuffle_ps(S, S, _MM_SHUFFLE(0, 0, 0, 0)))) & 7) == 7;
+        if(!Uniform && B->HasRotation)
+            priv::FoldIntoLinear(B);
+        B->Scale = _mm_mul_ps(B->Scale, S);
+    }
+    FM_FUN_SIC Scale(transform_builder* B, float X, float Y, float Z) -> void {
+        Scale(B, Vec3(X, Y, Z));
+    }
+    FM_FUN_SIC Scale(transform_builder* B, v3 Scalar) -> void {
+        Scale(B, Vec3(Scalar.X, Scalar.Y, Scalar.Z));
+    }
+    FM_FUN_SIC Scale(transform_builder* B, float Scalar) -> void {
+        Scale(B, Vec3(Scalar));
+    }
+    FM_FUN_SIC ShearXAxis(transform_builder* B, float Y, float Z) -> void {
+        priv::ShearBuilder(B, _mm_setr_ps(1.f, Y, Z, 0.f), _mm_setr_ps(0.f, 1.f, 0.f, 0.f), _mm_setr_ps(0.f, 0.f, 1.f, 0.f));
+    }
+    FM_FUN_SIC ShearYAxis(transform_builder* B, float X, float Z) -> void {
+        priv::ShearBuilder(B, _mm_setr_ps(1.f, 0.f, 0.f, 0.f), _mm_setr_ps(X, 1.f, Z, 0.f), _mm_setr_ps(0.f, 0.f, 1.f, 0.f));
+    }
+    FM_FUN_SIC ShearZAxis(transform_builder* B, float X, float Y) -> void {
+        priv::ShearBuilder(B, _mm_setr_ps(1.f, 0.f, 0.f, 0.f), _mm_setr_ps(0.f, 1.f, 0.f, 0.f), _mm_setr_ps(X, Y, 1.f, 0.f));
+    }
+    FM_FUN_SIC Shear(transform_builder* B, float XY, float XZ, float YX, float YZ, float ZX, float ZY) -> void {
+        priv::ShearBuilder(B, _mm_setr_ps(1.f, XY, XZ, 0.f), _mm_setr_ps(YX, 1.f, YZ, 0.f), _mm_setr_ps(ZX, ZY, 1.f, 0.f));
+    }
+    FM_FUN_SIC Mat4FromTransformBuilder(transform_builder B) -> mat4 {
+        mat4 R;
+        priv::ScaleRotationColumns(&B, R.Columns);
+        if(B.HasLinear)
+        {
+            for(uint32_t i = 0; i < 3; ++i)
+                R.Columns[i] = priv::MulColumns3(B.Linear, R.Columns[i]);
+        }
+        R.Columns[3] = _mm_add_ps(B.Translation, _mm_setr_ps(0.f, 0.f, 0.f, 1.f));
+        return R;
+    }
+    
+    /////////////////////////
+    // dual_quat functions //
+    /////////////////////////
+    FM_FUN_SIC DualQuat(quat Rotation, vec3 Translation) -> dual_quat {
+        dual_quat R;
+        R.Real = Rotation;
+        __m128 T = _mm_and_ps(Translation.M, _mm_castsi128_ps(_mm_setr_epi32(-1, -1, -1, 0)));
+        R.Dual = Quat(_mm_mul_ps(_mm_set1_ps(0.5f), (Quat(T) * Rotation).M));
+        return R;
+    }
+    FM_FUN_SIC DualQuat(quat Rotation, v3 Translation) -> dual_quat {
+        return DualQuat(Rotation, CastToVec3(Translation));
+    }
+    FM_FUN_SIC DualQuatIdentity() -> dual_quat {
+        dual_quat R;
+        R.Real = QuatIdentity();
+        R.Dual = Quat(_mm_setzero_ps());
+        return R;
+    }
+    FM_FUN_SIC GetTranslationVec3(dual_quat Q) -> vec3 {
+        return Vec3(_mm_mul_ps(_mm_set1_ps(2.f), (Q.Dual * Conjugate(Q.Real)).M));
+    }
+    FM_FUN_SIC GetTranslationV3(dual_quat Q) -> v3 {
+        return CastToV3(GetTranslationVec3(Q));
+    }
+    FM_FUN_SIC Mat4FromDualQuat(dual_quat Q) -> mat4 {
+        mat4 R = Mat4FromQuat(Q.Real);
+        R.Columns[3] = Vec4(GetTranslationVec3(Q), 1.f).M;
+        return R;
+    }
+    FM_FUN_SIC TransformPoint(dual_quat Q, vec3 P) -> vec3 {
+        return Rotate(Q.Real, P) + GetTranslationVec3(Q);
+    }
+    FM_FUN_SIC TransformPoint(dual_quat Q, v3 P) -> v3 {
+        return CastToV3(TransformPoint(Q, CastToVec3(P)));
+    }
+    
+    //////////////////////////////////////
+    // invalid values - fast math types //
+    //////////////////////////////////////
+    static const v2 InvalidV2 = v2(InvalidF32, InvalidF32);
+    static const v3 InvalidV3 = v3(InvalidF32, InvalidF32, InvalidF32);
+    static const v4 InvalidV4 = v4(InvalidF32, InvalidF32, InvalidF32, InvalidF32);
+    static const v2d InvalidV2d = v2d(InvalidF64, InvalidF64);
+    static const v3d InvalidV3d = v3d(InvalidF64, InvalidF64, InvalidF64);
+    static const v4d InvalidV4d = v4d(InvalidF64, InvalidF64, InvalidF64, InvalidF64);
+    static const v2i InvalidV2i = v2i(InvalidI32, InvalidI32);
+    static const v3i InvalidV3i = v3i(InvalidI32, InvalidI32, InvalidI32);
+    static const v4i InvalidV4i = v4i(InvalidI32, InvalidI32, InvalidI32, InvalidI32);
+    static const v2u InvalidV2u = v2u(InvalidU32, InvalidU32);
+    static const v3u InvalidV3u = v3u(InvalidU32, InvalidU32, InvalidU32);
+    static const v4u InvalidV4u = v4u(InvalidU32, InvalidU32, InvalidU32, InvalidU32);
+    static const v2u16 InvalidV2u16 = v2u16(InvalidU16, InvalidU16);
+    static const v3u16 InvalidV3u16 = v3u16(InvalidU16, InvalidU16, InvalidU16);
+    static const v4u16 InvalidV4u16 = v4u16(InvalidU16, InvalidU16, InvalidU16, InvalidU16);
+    static const v2u8 InvalidV2u8 = v2u8(1, 111);
+    static const v3u8 InvalidV3u8 = v3u8(1, 111, 222);
+    static const v4u8 InvalidV4u8 = v4u8(1, 111, 222, 33);
+    static const rect2 InvalidRect2 = Rect2MinMax(InvalidF32, InvalidF32, InvalidF32, InvalidF32);
+    static const rect2s InvalidRect2s = Rect2sMinMax(InvalidF32, InvalidF32, InvalidF32, InvalidF32);
+    static const rect2d InvalidRect2d = Rect2dMinMax(InvalidF64, InvalidF64, InvalidF64, InvalidF64);
+    static const rect2i InvalidRect2i = Rect2iMinMax(InvalidI32, InvalidI32, InvalidI32, InvalidI32);
+    static const rect2u InvalidRect2u = Rect2uMinMax(InvalidU32, InvalidU32, InvalidU32, InvalidU32);
+    static const mat4 InvalidMat4 = Mat4Diagonal(InvalidF32, InvalidF32, InvalidF32, InvalidF32);
+    
+    FM_FUN_SI IsValid(uint16_t A) -> bool {
+        return A != InvalidU16;
+    }
+    FM_FUN_SI IsValid(uint32_t A) -> bool {
+        return A != InvalidU32;
+    }
+    FM_FUN_SI IsValid(uint64_t A) -> bool {
+        return A != InvalidU64;
+    }
+    FM_FUN_SI IsValid(int16_t A) -> bool {
+        return A != InvalidI16;
+    }
+    FM_FUN_SI IsValid(int32_t A) -> bool {
+        return A != InvalidI32;
+    }
+    FM_FUN_SI IsValid(int64_t A) -> bool {
+        return A != InvalidI64;
+    }
+    FM_FUN_SI IsValid(float A) -> bool {
+        return A != InvalidF32;
+    }
+    FM_FUN_SI IsValid(double A) -> bool {
+        return A != InvalidF64;
+    }
+    FM_FUN_SI IsValid(v2 A) -> bool {
+        return A.X != InvalidF32;
+    }
+    FM_FUN_SI IsValid(v2d A) -> bool {
+        return A.X != InvalidF64;
+    }
+    FM_FUN_SI IsValid(v2i A) -> bool {
+        return A.X != InvalidI32;
+    }
+    FM_FUN_SI IsValid(v2u A) -> bool {
+        return A.X != InvalidU32;
+    }
+    FM_FUN_SI IsValid(v2u16 A) -> bool {
+        return A.X != InvalidU16;
+    }
+    FM_FUN_SI IsValid(v2u8 A) -> bool {
+        return A != InvalidV2u8;
+    }
+    FM_FUN_SI IsValid(v3 A) -> bool {
+        return A.X != InvalidF32;
+    }
+    FM_FUN_SI IsValid(v3d A) -> bool {
+        return A.X != InvalidF64;
+    }
+    FM_FUN_SI IsValid(v3i A) -> bool {
+        return A.X != InvalidI32;
+    }
+    FM_FUN_SI IsValid(v3u A) -> bool {
+        return A.X != InvalidU32;
+    }
+    FM_FUN_SI IsValid(v3u16 A) -> bool {
+        return A.X != InvalidU16;
+    }
+    FM_FUN_SI IsValid(v3u8 A) -> bool {
+        return A != InvalidV3u8;
+    }
+    FM_FUN_SI IsValid(v4 A) -> bool {
+        return A.X != InvalidF32;
+    }
+    FM_FUN_SI IsValid(v4d A) -> bool {
+        return A.X != InvalidF64;
+    }
+    FM_FUN_SI IsValid(v4i A) -> bool {
+        return A.X != InvalidI32;
+    }
+    FM_FUN_SI IsValid(v4u A) -> bool {
+        return A.X != InvalidU32;
+    }
+    FM_FUN_SI IsValid(v4u16 A) -> bool {
+        return A.X != InvalidU16;
+    }
+    FM_FUN_SI IsValid(v4u8 A) -> bool {
+        return A != InvalidV4u8;
+    }
+    FM_FUN_SI IsValid(rect2 A) -> bool {
+        return A.Min.X != InvalidF32;
+    }
+    FM_FUN_SI IsValid(rect2s A) -> bool {
+        return A.MinX() != InvalidF32;
+    }
+    FM_FUN_SI IsValid(rect2d A) -> bool {
+        return A.Min.X != InvalidF64;
+    }
+    FM_FUN_SI IsValid(rect2i A) -> bool {
+        return A.Min.X != InvalidI32;
+    }
+    FM_FUN_SI IsValid(rect2u A) -> bool {
+        return A.Min.X != InvalidU32;
+    }
+    FM_FUN_SI IsValid(mat4 A) -> bool {
+        return A[0] != InvalidF32;
+    }
+    
+}
+
+#endif // FAST_MATH_H
+
+#ifndef FM_IMPLEMENTATION_ALREADY_DEFINED
+#ifdef FM_IMPLEMENTATION
+#define FM_IMPLEMENTATION_ALREADY_DEFINED
+
+#include <immintrin.h>
+#include <atomic>
+#if defined(_MSC_VER)
+#include <intrin.h>
+#else
+#include <cpuid.h>
+#endif
+
+// NOTE: Batch functions write outputs at least this big with non temporal stores, so they don't evict the cache
+#ifndef FM_STREAMING_STORES_MIN_BYTES
+#define FM_STREAMING_STORES_MIN_BYTES (4 * 1024 * 1024)
+#endif
+
+#if defined(_MSC_VER) && !defined(__clang__)
+#define FM_TARGET_AVX2_FMA
+#else
+#define FM_TARGET_AVX2_FMA __attribute__((target("avx2,fma,f16c")))
+#endif
+
+namespace fm {
+    
+    ///////////////////////////
+    // simd tier dispatching //
+    ///////////////////////////
+    namespace priv {
+        static auto Cpuid(uint32_t Leaf, uint32_t SubLeaf, uint32_t* Regs) -> bool {
+#if defined(_MSC_VER)
+            int32_t Info[4];
+            __cpuid(Info, 0);
+            if((uint32_t)Info[0] < Leaf)
+                return false;
+            __cpuidex(Info, (int32_t)Leaf, (int32_t)SubLeaf);
+            for(int32_t i = 0; i < 4; ++i)
+                Regs[i] = (uint32_t)Info[i];
+            return true;
+#else
+            return __get_cpuid_count(Leaf, SubLeaf, &Regs[0], &Regs[1], &Regs[2], &Regs[3]) != 0;
+#endif
+        }
+        static auto ReadXCR0() -> uint64_t {
+#if defined(_MSC_VER)
+            return _xgetbv(0);
+#else
+            uint32_t Lo, Hi;
+            __asm__ volatile("xgetbv" : "=a"(Lo), "=d"(Hi) : "c"(0));
+            return ((uint64_t)Hi << 32) | Lo;
+#endif
+        }
+        static auto DetectSimdTier() -> simd_tier {
+            uint32_t Leaf1[4], Leaf7[4] = {};
+            if(!Cpuid(1, 0, Leaf1))
+                return SimdTier_SSE2;
+            bool HasFMA = Leaf1[2] & (1u << 12);
+            bool HasOSXSAVE = Leaf1[2] & (1u << 27);
+            bool HasAVX = Leaf1[2] & (1u << 28);
+            bool HasF16C = Leaf1[2] & (1u << 29);
+            Cpuid(7, 0, Leaf7);
+            bool HasAVX2 = Leaf7[1] & (1u << 5);
+            
+            // NOTE: The OS has to save ymm state (XCR0 bits 1, 2) on context switches
+            uint64_t XCR0 = HasOSXSAVE ? ReadXCR0() : 0;
+            bool OSSavesYmm = (XCR0 & 0x6) == 0x6;
+            
+            if(HasAVX && HasAVX2 && HasFMA && HasF16C && OSSavesYmm)
+                return SimdTier_AVX2_FMA;
+            return SimdTier_SSE2;
+        }
+        
+        //////////////////
+        // mat4 kernels //
+        //////////////////
+        // NOTE: Column J of A * B is a linear combination of the columns of A weighted by the elements of column J of B.
+        //       Everything is loaded before the first store, so Out can be A or B.
+        //       operator* and the in place updates compute their columns with these two, so the compiler groups and
+        //       contracts the terms the same way for both. The ymm array kernel below repeats the FMA grouping.
+        FM_SINL __m128 FM_CALL Mat4MulColumnSSE2(__m128 A0, __m128 A1, __m128 A2, __m128 A3, __m128 BCol) {
+            __m128 R01 = _mm_mul_ps(A0, _mm_shuffle_ps(BCol, BCol, _MM_SHUFFLE(0, 0, 0, 0)));
+            __m128 R23 = _mm_mul_ps(A2, _mm_shuffle_ps(BCol, BCol, _MM_SHUFFLE(2, 2, 2, 2)));
+            R01 = _mm_add_ps(R01, _mm_mul_ps(A1, _mm_shuffle_ps(BCol, BCol, _MM_SHUFFLE(1, 1, 1, 1))));
+            R23 = _mm_add_ps(R23, _mm_mul_ps(A3, _mm_shuffle_ps(BCol, BCol, _MM_SHUFFLE(3, 3, 3, 3))));
+            return _mm_add_ps(R01, R23);
+        }
+        FM_TARGET_AVX2_FMA FM_SINL __m128 FM_CALL Mat4MulColumnFMA(__m128 A0, __m128 A1, __m128 A2, __m128 A3, __m128 BCol) {
+            // NOTE: Two independent fma chains to not serialize on the fma latency
+            __m128 R01 = _mm_mul_ps(A0, _mm_shuffle_ps(BCol, BCol, _MM_SHUFFLE(0, 0, 0, 0)));
+            __m128 R23 = _mm_mul_ps(A2, _mm_shuffle_ps(BCol, BCol, _MM_SHUFFLE(2, 2, 2, 2)));
+            R01 = _mm_fmadd_ps(A1, _mm_shuffle_ps(BCol, BCol, _MM_SHUFFLE(1, 1, 1, 1)), R01);
+            R23 = _mm_fmadd_ps(A3, _mm_shuffle_ps(BCol, BCol, _MM_SHUFFLE(3, 3, 3, 3)), R23);
+            return _mm_add_ps(R01, R23);
+        }
+        static auto Mat4MulSSE2(const mat4* A, const mat4* B, mat4* Out) -> void {
+            __m128 A0 = A->Columns[0], A1 = A->Columns[1], A2 = A->Columns[2], A3 = A->Columns[3];
+            __m128 R[4];
+            for(int32_t Col = 0; Col < 4; ++Col)
+                R[Col] = Mat4MulColumnSSE2(A0, A1, A2, A3, B->Columns[Col]);
+            for(int32_t Col = 0; Col < 4; ++Col)
+                Out->Columns[Col] = R[Col];
+        }
+        FM_TARGET_AVX2_FMA static auto Mat4MulFMA(const mat4* A, const mat4* B, mat4* Out) -> void {
+            __m128 A0 = A->Columns[0], A1 = A->Columns[1], A2 = A->Columns[2], A3 = A->Columns[3];
+            __m128 R[4];
+            for(int32_t Col = 0; Col < 4; ++Col)
+                R[Col] = Mat4MulColumnFMA(A0, A1, A2, A3, B->Columns[Col]);
+            for(int32_t Col = 0; Col < 4; ++Col)
+                Out->Columns[Col] = R[Col];
+        }
+        // NOTE: Two result columns per ymm, the columns of A are broadcasted to both halves.
+        //       Only used for arrays, a single result is read back as xmm columns and the 32 byte stores stall the store forwarding.
+        //       The terms are grouped like Mat4MulFMA, so both give the same bits.
+        FM_TARGET_AVX2_FMA static auto Mat4MulAVX2(const mat4* A, const mat4* B, mat4* Out) -> void {
+            __m256 A0 = _mm256_broadcast_ps(&A->Columns[0]);
+            __m256 A1 = _mm256_broadcast_ps(&A->Columns[1]);
+            __m256 A2 = _mm256_broadcast_ps(&A->Columns[2]);
+            __m256 A3 = _mm256_broadcast_ps(&A->Columns[3]);
+            __m256 B01 = _mm256_loadu_ps((const float*)&B->Columns[0]);
+            __m256 B23 = _mm256_loadu_ps((const float*)&B->Columns[2]);
+            __m256 R01Lo = _mm256_mul_ps(A0, _mm256_permute_ps(B01, _MM_SHUFFLE(0, 0, 0, 0)));
+            __m256 R01Hi = _mm256_mul_ps(A2, _mm256_permute_ps(B01, _MM_SHUFFLE(2, 2, 2, 2)));
+            __m256 R23Lo = _mm256_mul_ps(A0, _mm256_permute_ps(B23, _MM_SHUFFLE(0, 0, 0, 0)));
+            __m256 R23Hi = _mm256_mul_ps(A2, _mm256_permute_ps(B23, _MM_SHUFFLE(2, 2, 2, 2)));
+            R01Lo = _mm256_fmadd_ps(A1, _mm256_permute_ps(B01, _MM_SHUFFLE(1, 1, 1, 1)), R01Lo);
+            R01Hi = _mm256_fmadd_ps(A3, _mm256_permute_ps(B01, _MM_SHUFFLE(3, 3, 3, 3)), R01Hi);
+            R23Lo = _mm256_fmadd_ps(A1, _mm256_permute_ps(B23, _MM_SHUFFLE(1, 1, 1, 1)), R23Lo);
+            R23Hi = _mm256_fmadd_ps(A3, _mm256_permute_ps(B23, _MM_SHUFFLE(3, 3, 3, 3)), R23Hi);
+            _mm256_storeu_ps((float*)&Out->Columns[0], _mm256_add_ps(R01Lo, R01Hi));
+            _mm256_storeu_ps((float*)&Out->Columns[2], _mm256_add_ps(R23Lo, R23Hi));
+        }
+
+        // NOTE: In place M = M * B for a B whose columns outside Columns are the ones of the identity. Bit I of Columns
+        //       selects column I of B, which is BI. The columns are passed in registers because building B in memory
+        //       was measured to cost as much as the multiply.
+        static auto Mat4MulColumnsSSE2(mat4* M, uint32_t Columns, __m128 B0, __m128 B1, __m128 B2) -> void {
+            FM_ASSERT(Columns != 0 && Columns < 8);
+            __m128 A0 = M->Columns[0], A1 = M->Columns[1], A2 = M->Columns[2], A3 = M->Columns[3];
+            __m128 B[3] = {B0, B1, B2};
+            __m128 R[3];
+            for(uint32_t Col = 0; Col < 3; ++Col)
+                if(Columns & (1u << Col))
+                    R[Col] = Mat4MulColumnSSE2(A0, A1, A2, A3, B[Col]);
+            for(uint32_t Col = 0; Col < 3; ++Col)
+                if(Columns & (1u << Col))
+                    M->Columns[Col] = R[Col];
+        }
+        FM_TARGET_AVX2_FMA static auto Mat4MulColumnsFMA(mat4* M, uint32_t Columns, __m128 B0, __m128 B1, __m128 B2) -> void {
+            FM_ASSERT(Columns != 0 && Columns < 8);
+            __m128 A0 = M->Columns[0], A1 = M->Columns[1], A2 = M->Columns[2], A3 = M->Columns[3];
+            __m128 B[3] = {B0, B1, B2};
+            __m128 R[3];
+            for(uint32_t Col = 0; Col < 3; ++Col)
+                if(Columns & (1u << Col))
+                    R[Col] = Mat4MulColumnFMA(A0, A1, A2, A3, B[Col]);
+            for(uint32_t Col = 0; Col < 3; ++Col)
+                if(Columns & (1u << Col))
+                    M->Columns[Col] = R[Col];
+        }
+        
+        static auto Mat4MulArraySSE2(const mat4* A, const mat4* B, mat4* Out, size_t Count) -> void {
+            for(size_t i = 0; i < Count; ++i)
+                Mat4MulSSE2(A + i, B + i, Out + i);
+        }
+        FM_TARGET_AVX2_FMA static auto Mat4MulArrayAVX2(const mat4* A, const mat4* B, mat4* Out, size_t Count) -> void {
+            for(size_t i = 0; i < Count; ++i)
+                Mat4MulAVX2(A + i, B + i, Out + i);
+        }
+        
+        /////////////////////////////
+        // batch transform kernels //
+        /////////////////////////////
+        enum transform_layout : uint32_t
+        {
+            TransformLayout_V3,
+            TransformLayout_Vec3,
+            TransformLayout_V4
+        };
+        
+        template<uint32_t OutStride, uint32_t OutComponents, bool Stream>
+            FM_SINL void FM_CALL StoreTransformed(float* Out, __m128 R, __m128 XYZMask) {
+            if constexpr(OutStride == 3)
+            {
+                _mm_storel_pi((__m64*)Out, R);
+                _mm_store_ss(Out + 2, _mm_movehl_ps(R, R));
+            }
+            else
+            {
+                if constexpr(OutComponents == 3)
+                    R = _mm_and_ps(R, XYZMask);
+                if constexpr(Stream)
+                    _mm_stream_ps(Out, R);
+                else
+                    _mm_storeu_ps(Out, R);
+            }
+        }
+        
+        // NOTE: Every result is a linear combination of the matrix columns, so the columns are loaded once
+        //       and only the input elements get broadcasted. W is 1 for points and 0 for directions.
+        struct transform_kernel_sse2
+        {
+            template<uint32_t InStride, uint32_t OutStride, uint32_t OutComponents, bool Project, bool Stream>
+                static auto Run(const mat4* M, float W, const float* In, float* Out, size_t Count) -> void {
+                __m128 C0 = M->Columns[0], C1 = M->Columns[1], C2 = M->Columns[2];
+                __m128 C3W = _mm_mul_ps(M->Columns[3], _mm_set1_ps(W));
+                __m128 XYZMask = _mm_castsi128_ps(_mm_setr_epi32(-1, -1, -1, 0));
+                for(size_t i = 0; i < Count; ++i, In += InStride, Out += OutStride)
+                {
+                    __m128 R = _mm_add_ps(_mm_mul_ps(C0, _mm_load1_ps(In)), C3W);
+                    R = _mm_add_ps(R, _mm_mul_ps(C1, _mm_load1_ps(In + 1)));
+                    R = _mm_add_ps(R, _mm_mul_ps(C2, _mm_load1_ps(In + 2)));
+                    if constexpr(Project)
+                        R = _mm_div_ps(R, _mm_shuffle_ps(R, R, _MM_SHUFFLE(3, 3, 3, 3)));
+                    StoreTransformed<OutStride, OutComponents, Stream>(Out, R, XYZMask);
+                }
+            }
+        };
+        
+        // NOTE: 16 byte strided arrays are processed two vectors per ymm register
+        struct transform_kernel_avx2
+        {
+            template<uint32_t InStride, uint32_t OutStride, uint32_t OutComponents, bool Project, bool Stream>
+                FM_TARGET_AVX2_FMA static auto Run(const mat4* M, float W, const float* In, float* Out, size_t Count) -> void {
+                size_t i = 0;
+                if constexpr(InStride == 4 && OutStride == 4)
+                {
+                    __m256 C0 = _mm256_broadcast_ps(&M->Columns[0]);
+                    __m256 C1 = _mm256_broadcast_ps(&M->Columns[1]);
+                    __m256 C2 = _mm256_broadcast_ps(&M->Columns[2]);
+                    __m256 C3W = _mm256_mul_ps(_mm256_broadcast_ps(&M->Columns[3]), _mm256_set1_ps(W));
+                    __m256 XYZMask = _mm256_castsi256_ps(_mm256_setr_epi32(-1, -1, -1, 0, -1, -1, -1, 0));
+                    for(; i + 2 <= Count; i += 2, In += 8, Out += 8)
+                    {
+                        __m256 V = _mm256_loadu_ps(In);
+                        __m256 R = _mm256_fmadd_ps(C0, _mm256_permute_ps(V, _MM_SHUFFLE(0, 0, 0, 0)), C3W);
+                        R = _mm256_fmadd_ps(C1, _mm256_permute_ps(V, _MM_SHUFFLE(1, 1, 1, 1)), R);
+                        R = _mm256_fmadd_ps(C2, _mm256_permute_ps(V, _MM_SHUFFLE(2, 2, 2, 2)), R);
+                        if constexpr(Project)
+                            R = _mm256_div_ps(R, _mm256_permute_ps(R, _MM_SHUFFLE(3, 3, 3, 3)));
+                        if constexpr(OutComponents == 3)
+                            R = _mm256_and_ps(R, XYZMask);
+                        if constexpr(Stream)
+                        {
+                            // NOTE: Out is only guaranteed to be 16 byte aligned
+                            _mm_stream_ps(Out, _mm256_castps256_ps128(R));
+                            _mm_stream_ps(Out + 4, _mm256_extractf128_ps(R, 1));
+                        }
+                        else
+                        {
+                            _mm256_storeu_ps(Out, R);
+                        }
+                    }
+                }
+                
+                __m128 C0 = M->Columns[0], C1 = M->Columns[1], C2 = M->Columns[2];
+                __m128 C3W = _mm_mul_ps(M->Columns[3], _mm_set1_ps(W));
+                __m128 XYZMask = _mm_castsi128_ps(_mm_setr_epi32(-1, -1, -1, 0));
+                for(; i < Count; ++i, In += InStride, Out += OutStride)
+                {
+                    __m128 R = _mm_fmadd_ps(C0, _mm_broadcast_ss(In), C3W);
+                    R = _mm_fmadd_ps(C1, _mm_broadcast_ss(In + 1), R);
+                    R = _mm_fmadd_ps(C2, _mm_broadcast_ss(In + 2), R);
+                    if constexpr(Project)
+                        R = _mm_div_ps(R, _mm_permute_ps(R, _MM_SHUFFLE(3, 3, 3, 3)));
+                    StoreTransformed<OutStride, OutComponents, Stream>(Out, R, XYZMask);
+                }
+            }
+        };
+        
+        template<class kernel, uint32_t InStride, uint32_t OutStride, uint32_t OutComponents>
+            static auto TransformLayout(const mat4* M, float W, bool Project, const float* In, float* Out, size_t Count) -> void {
+            bool Stream = OutStride == 4 && ((uintptr_t)Out & 15) == 0 &&
+                Count * OutStride * sizeof(float) >= FM_STREAMING_STORES_MIN_BYTES;
+            if(Stream)
+            {
+                if(Project)
+                    kernel::template Run<InStride, OutStride, OutComponents, true, true>(M, W, In, Out, Count);
+                else
+                    kernel::template Run<InStride, OutStride, OutComponents, false, true>(M, W, In, Out, Count);
+                _mm_sfence();
+            }
+            else
+            {
+                if(Project)
+                    kernel::template Run<InStride, OutStride, OutComponents, true, false>(M, W, In, Out, Count);
+                else
+                    kernel::template Run<InStride, OutStride, OutComponents, false, false>(M, W, In, Out, Count);
+            }
+        }
+        template<class kernel>
+            static auto Transform(const mat4* M, transform_layout Layout, float W, bool Project,
+                                  const float* In, float* Out, size_t Count) -> void {
+            switch(Layout)
+            {
+                case TransformLayout_V3: TransformLayout<kernel, 3, 3, 3>(M, W, Project, In, Out, Count); break;
+                case TransformLayout_Vec3: TransformLayout<kernel, 4, 4, 3>(M, W, Project, In, Out, Count); break;
+                case TransformLayout_V4: TransformLayout<kernel, 4, 4, 4>(M, W, Project, In, Out, Count); break;
+            }
+        }
+        
+        ////////////////////////
+        // quat blend kernels //
+        ////////////////////////
+        enum quat_blend : uint32_t
+        {
+            QuatBlend_Nlerp,
+            QuatBlend_Slerp
+        };
+        
+        // NOTE: sin(T * Angle) / sin(Angle) = T + sum of C_i(T) * (cos(Angle) - 1)^i, where C_0 = T and
+        //       C_i = C_i-1 * (T^2 - i^2) / (i * (2i + 1)). T is the same for every quat of the array, so the coefficients
+        //       are computed once and only the polynomial is left per quat. The last coefficient is scaled to make up
+        //       for the dropped terms, which keeps the error below 1e-6 up to a 180 degree rotation (cos(Angle) = 0).
+        constexpr uint32_t SlerpTerms = 12;
+        constexpr double SlerpLastTermScale = 1.894;
+        struct quat_blend_weights
+        {
+            float A[SlerpTerms + 1]; // NOTE: Coefficients of 1 - T
+            float B[SlerpTerms + 1]; // NOTE: Coefficients of T
+        };
+        static auto QuatBlendWeights(float T) -> quat_blend_weights {
+            quat_blend_weights R;
+            double CA = 1.0 - T, CB = T;
+            R.A[0] = (float)CA;
+            R.B[0] = (float)CB;
+            for(uint32_t i = 1; i <= SlerpTerms; ++i)
+            {
+                double U = 1.0 / (i * (2.0 * i + 1.0));
+                double V = i / (2.0 * i + 1.0);
+                if(i == SlerpTerms)
+                {
+                    U *= SlerpLastTermScale;
+                    V *= SlerpLastTermScale;
+                }
+                CA *= U * (1.0 - T) * (1.0 - T) - V;
+                CB *= U * T * T - V;
+                R.A[i] = (float)CA;
+                R.B[i] = (float)CB;
+            }
+            return R;
+        }
+        
+        // NOTE: The quats are transposed into registers of X, Y, Z and W, so every lane blends one quat
+        struct quat_blend_kernel_sse2
+        {
+            static constexpr uint32_t Width = 4;
+            
+            template<quat_blend Blend>
+                static auto Run(const quat* A, const quat* B, const quat_blend_weights* Weights, quat* Out, size_t Count) -> void {
+                __m128 SignMask = _mm_set1_ps(-0.f);
+                for(size_t i = 0; i < Count; i += Width)
+                {
+                    __m128 AX, AY, AZ, AW, BX, BY, BZ, BW;
+                    TransposeLoad4x4((const float*)(A + i), 4, &AX, &AY, &AZ, &AW);
+                    TransposeLoad4x4((const float*)(B + i), 4, &BX, &BY, &BZ, &BW);
+                    __m128 Cos = _mm_add_ps(_mm_add_ps(_mm_mul_ps(AX, BX), _mm_mul_ps(AY, BY)),
+                                            _mm_add_ps(_mm_mul_ps(AZ, BZ), _mm_mul_ps(AW, BW)));
+                    __m128 Sign = _mm_and_ps(Cos, SignMask);
+                    BX = _mm_xor_ps(BX, Sign);
+                    BY = _mm_xor_ps(BY, Sign);
+                    BZ = _mm_xor_ps(BZ, Sign);
+                    BW = _mm_xor_ps(BW, Sign);
+                    
+                    __m128 WA = _mm_set1_ps(Weights->A[0]);
+                    __m128 WB = _mm_set1_ps(Weights->B[0]);
+                    if constexpr(Blend == QuatBlend_Slerp)
+                    {
+                        __m128 X = _mm_sub_ps(_mm_xor_ps(Cos, Sign), _mm_set1_ps(1.f));
+                        WA = _mm_set1_ps(Weights->A[SlerpTerms]);
+                        WB = _mm_set1_ps(Weights->B[SlerpTerms]);
+                        for(int32_t Term = SlerpTerms - 1; Term >= 0; --Term)
+                        {
+                            WA = _mm_add_ps(_mm_mul_ps(WA, X), _mm_set1_ps(Weights->A[Term]));
+                            WB = _mm_add_ps(_mm_mul_ps(WB, X), _mm_set1_ps(Weights->B[Term]));
+                        }
+                    }
+                    __m128 RX = _mm_add_ps(_mm_mul_ps(AX, WA), _mm_mul_ps(BX, WB));
+                    __m128 RY = _mm_add_ps(_mm_mul_ps(AY, WA), _mm_mul_ps(BY, WB));
+                    __m128 RZ = _mm_add_ps(_mm_mul_ps(AZ, WA), _mm_mul_ps(BZ, WB));
+                    __m128 RW = _mm_add_ps(_mm_mul_ps(AW, WA), _mm_mul_ps(BW, WB));
+                    if constexpr(Blend == QuatBlend_Nlerp)
+                    {
+                        __m128 LengthSq = _mm_add_ps(_mm_add_ps(_mm_mul_ps(RX, RX), _mm_mul_ps(RY, RY)),
+                                                     _mm_add_ps(_mm_mul_ps(RZ, RZ), _mm_mul_ps(RW, RW)));
+                        // NOTE: One Newton-Raphson step after rsqrt
+                        __m128 InvLength = _mm_rsqrt_ps(LengthSq);
+                        InvLength = _mm_mul_ps(_mm_mul_ps(_mm_set1_ps(0.5f), InvLength),
+                                               _mm_sub_ps(_mm_set1_ps(3.f), _mm_mul_ps(LengthSq, _mm_mul_ps(InvLength, InvLength))));
+                        RX = _mm_mul_ps(RX, InvLength);
+                        RY = _mm_mul_ps(RY, InvLength);
+                        RZ = _mm_mul_ps(RZ, InvLength);
+                        RW = _mm_mul_ps(RW, InvLength);
+                    }
+                    TransposeStore4x4((float*)(Out + i), 4, RX, RY, RZ, RW);
+                }
+            }
+        };
+        
+        // NOTE: Quats I and I + 4 share a ymm register, so the in lane shuffles transpose 8 quats at once
+        FM_TARGET_AVX2_FMA FM_SINL void FM_CALL TransposeQuats8(__m256* R0, __m256* R1, __m256* R2, __m256* R3) {
+            __m256 T0 = _mm256_unpacklo_ps(*R0, *R1);
+            __m256 T1 = _mm256_unpacklo_ps(*R2, *R3);
+            __m256 T2 = _mm256_unpackhi_ps(*R0, *R1);
+            __m256 T3 = _mm256_unpackhi_ps(*R2, *R3);
+            *R0 = _mm256_shuffle_ps(T0, T1, _MM_SHUFFLE(1, 0, 1, 0));
+            *R1 = _mm256_shuffle_ps(T0, T1, _MM_SHUFFLE(3, 2, 3, 2));
+            *R2 = _mm256_shuffle_ps(T2, T3, _MM_SHUFFLE(1, 0, 1, 0));
+            *R3 = _mm256_shuffle_ps(T2, T3, _MM_SHUFFLE(3, 2, 3, 2));
+        }
+        FM_TARGET_AVX2_FMA FM_SINL void FM_CALL TransposeLoadQuats8(const quat* Q, __m256* X, __m256* Y, __m256* Z, __m256* W) {
+            *X = _mm256_insertf128_ps(_mm256_castps128_ps256(_mm_loadu_ps((const float*)(Q + 0))), _mm_loadu_ps((const float*)(Q + 4)), 1);
+            *Y = _mm256_insertf128_ps(_mm256_castps128_ps256(_mm_loadu_ps((const float*)(Q + 1))), _mm_loadu_ps((const float*)(Q + 5)), 1);
+            *Z = _mm256_insertf128_ps(_mm256_castps128_ps256(_mm_loadu_ps((const float*)(Q + 2))), _mm_loadu_ps((const float*)(Q + 6)), 1);
+            *W = _mm256_insertf128_ps(_mm256_castps128_ps256(_mm_loadu_ps((const float*)(Q + 3))), _mm_loadu_ps((const float*)(Q + 7)), 1);
+            TransposeQuats8(X, Y, Z, W);
+        }
+        FM_TARGET_AVX2_FMA FM_SINL void FM_CALL TransposeStoreQuats8(quat* Q, __m256 X, __m256 Y, __m256 Z, __m256 W) {
+            TransposeQuats8(&X, &Y, &Z, &W);
+            _mm_storeu_ps((float*)(Q + 0), _mm256_castps256_ps128(X));
+            _mm_storeu_ps((float*)(Q + 1), _mm256_castps256_ps128(Y));
+            _mm_storeu_ps((float*)(Q + 2), _mm256_castps256_ps128(Z));
+            _mm_storeu_ps((float*)(Q + 3), _mm256_castps256_ps128(W));
+            _mm_storeu_ps((float*)(Q + 4), _mm256_extractf128_ps(X, 1));
+            _mm_storeu_ps((float*)(Q + 5), _mm256_extractf128_ps(Y, 1));
+            _mm_storeu_ps((float*)(Q + 6), _mm256_extractf128_ps(Z, 1));
+            _mm_storeu_ps((float*)(Q + 7), _mm256_extractf128_ps(W, 1));
+        }
+        
+        struct quat_blend_kernel_avx2
         {
-            if(Vec4(A.Columns[Col]) != Vec4(B.Columns[Col]))
+            static constexpr uint32_t Width = 8;
+            
+            template<quat_blend Blend>
+                FM_TARGET_AVX2_FMA static auto Run(const quat* A, const quat* B, const quat_blend_weights* Weights, quat* Out, size_t Count) -> void {
+                __m256 SignMask = _mm256_set1_ps(-0.f);
+                for(size_t i = 0; i < Count; i += Width)
+                {
+                    __m256 AX, AY, AZ, AW, BX, BY, BZ, BW;
+                    TransposeLoadQuats8(A + i, &AX, &AY, &AZ, &AW);
+                    TransposeLoadQuats8(B + i, &BX, &BY, &BZ, &BW);
+                    __m256 Cos = _mm256_fmadd_ps(AX, BX, _mm256_mul_ps(AY, BY));
+                    Cos = _mm256_fmadd_ps(AZ, BZ, Cos);
+                    Cos = _mm256_fmadd_ps(AW, BW, Cos);
+                    __m256 Sign = _mm256_and_ps(Cos, SignMask);
+                    BX = _mm256_xor_ps(BX, Sign);
+                    BY = _mm256_xor_ps(BY, Sign);
+                    BZ = _mm256_xor_ps(BZ, Sign);
+                    BW = _mm256_xor_ps(BW, Sign);
+                    
+                    __m256 WA = _mm256_set1_ps(Weights->A[0]);
+                    __m256 WB = _mm256_set1_ps(Weights->B[0]);
+                    if constexpr(Blend == QuatBlend_Slerp)
+                    {
+                        __m256 X = _mm256_sub_ps(_mm256_xor_ps(Cos, Sign), _mm256_set1_ps(1.f));
+                        WA = _mm256_set1_ps(Weights->A[SlerpTerms]);
+                        WB = _mm256_set1_ps(Weights->B[SlerpTerms]);
+                        for(int32_t Term = SlerpTerms - 1; Term >= 0; --Term)
+                        {
+                            WA = _mm256_fmadd_ps(WA, X, _mm256_set1_ps(Weights->A[Term]));
+                            WB = _mm256_fmadd_ps(WB, X, _mm256_set1_ps(Weights->B[Term]));
+                        }
+                    }
+                    __m256 RX = _mm256_fmadd_ps(AX, WA, _mm256_mul_ps(BX, WB));
+                    __m256 RY = _mm256_fmadd_ps(AY, WA, _mm256_mul_ps(BY, WB));
+                    __m256 RZ = _mm256_fmadd_ps(AZ, WA, _mm256_mul_ps(BZ, WB));
+                    __m256 RW = _mm256_fmadd_ps(AW, WA, _mm256_mul_ps(BW, WB));
+                    if constexpr(Blend == QuatBlend_Nlerp)
+                    {
+                        __m256 LengthSq = _mm256_fmadd_ps(RX, RX, _mm256_mul_ps(RY, RY));
+                        LengthSq = _mm256_fmadd_ps(RZ, RZ, LengthSq);
+                        LengthSq = _mm256_fmadd_ps(RW, RW, LengthSq);
+                        __m256 InvLength = _mm256_rsqrt_ps(LengthSq);
+                        InvLength = _mm256_mul_ps(_mm256_mul_ps(_mm256_set1_ps(0.5f), InvLength),
+                                                  _mm256_fnmadd_ps(LengthSq, _mm256_mul_ps(InvLength, InvLength), _mm256_set1_ps(3.f)));
+                        RX = _mm256_mul_ps(RX, InvLength);
+                        RY = _mm256_mul_ps(RY, InvLength);
+                        RZ = _mm256_mul_ps(RZ, InvLength);
+                        RW = _mm256_mul_ps(RW, InvLength);
+                    }
+                    TransposeStoreQuats8(Out + i, RX, RY, RZ, RW);
+                }
+            }
+        };
+        
+        // NOTE: The kernels only take whole packets, the tail goes through a copy padded with identities
+        template<class kernel, quat_blend Blend>
+            static auto BlendQuatsWith(const quat* A, const quat* B, const quat_blend_weights* Weights, quat* Out, size_t Count) -> void {
+            size_t WholeCount = Count - Count % kernel::Width;
+            kernel::template Run<Blend>(A, B, Weights, Out, WholeCount);
+            if(WholeCount < Count)
             {
-                R = false;
-                break;
+                quat TailA[kernel::Width], TailB[kernel::Width], TailOut[kernel::Width];
+                for(uint32_t i = 0; i < kernel::Width; ++i)
+                {
+                    bool InRange = WholeCount + i < Count;
+                    TailA[i] = InRange ? A[WholeCount + i] : QuatIdentity();
+                    TailB[i] = InRange ? B[WholeCount + i] : QuatIdentity();
+                }
+                kernel::template Run<Blend>(TailA, TailB, Weights, TailOut, kernel::Width);
+                for(size_t i = WholeCount; i < Count; ++i)
+                    Out[i] = TailOut[i - WholeCount];
             }
         }
-        return R;
-    }
-    FM_FUN_SIC operator!=(mat4 A, mat4 B) -> bool {
-        return !(A == B);
-    }
-    FM_FUN_SIC Transpose(mat4* M) -> void {
-        _MM_TRANSPOSE4_PS(M->Columns[0], M->Columns[1], M->Columns[2], M->Columns[3]);
-    }
-    FM_FUN_SIC Transpose(mat4 M) -> mat4 {
-        _MM_TRANSPOSE4_PS(M.Columns[0], M.Columns[1], M.Columns[2], M.Columns[3]);
-        return M;
-    }
-    FM_FUN_SIC Mat4Translation(float X, float Y, float Z) -> mat4 {
-        return Mat4FromRows(
-                            1.f, 0.f, 0.f, X,
-                            0.f, 1.f, 0.f, Y,
-                            0.f, 0.f, 1.f, Z,
-                            0.f, 0.f, 0.f, 1.f);
-    }
-    FM_FUN_SIC Mat4Translation(v3 Translation) -> mat4 {
-        return Mat4FromRows(
-                            1.f, 0.f, 0.f, Translation.X,
-                            0.f, 1.f, 0.f, Translation.Y,
-                            0.f, 0.f, 1.f, Translation.Z,
-                            0.f, 0.f, 0.f, 1.f);
-    }
-    FM_FUN_SIC Mat4Translation(vec3 Translation) -> mat4 {
-        return Mat4Translation(CastToV3(Translation));
-    }
-    FM_FUN_SIC Mat4Translation(float Translation) -> mat4 {
-        return Mat4FromRows(
-                            1.f, 0.f, 0.f, Translation,
-                            0.f, 1.f, 0.f, Translation,
-                            0.f, 0.f, 1.f, Translation,
-                            0.f, 0.f, 0.f, 1.f);
-    }
-    FM_FUN_SIC Translate(mat4* M, float X, float Y, float Z) -> void {
-        M->Columns[3] = _mm_add_ps(M->Columns[3], _mm_set_ps(0.f, Z, Y, X));
-    }
-    FM_FUN_SIC Translate(mat4* M, vec3 Trans) -> void {
-        M->Columns[3] = _mm_add_ps(M->Columns[3], Trans.M);
-    }
-    FM_FUN_SIC Translate(mat4* M, v3 Trans) -> void {
-        Translate(M, CastToVec3(Trans));
-    }
-    FM_FUN_SIC Translate(mat4* M, float Trans) -> void {
-        M->Columns[3] = _mm_add_ps(M->Columns[3], _mm_set_ps(0.f, Trans, Trans, Trans));
-    }
-    FM_FUN_SIC Mat4Scale(float Scalar) -> mat4 {
-        return Mat4Diagonal(Scalar, Scalar, Scalar, 1.f);
-    } 
-    FM_FUN_SIC Mat4Scale(float ScalarX, float ScalarY, float ScalarZ) -> mat4 {
-        return Mat4Diagonal(ScalarX, ScalarY, ScalarZ, 1.f);
-    } 
-    FM_FUN_SIC Mat4Scale(v3 Scalar) -> mat4 {
-        return Mat4Diagonal(Scalar.X, Scalar.Y, Scalar.Z, 1.f); 
-    }
-    FM_FUN_SIC Mat4Scale(vec3 Scalar) -> mat4 {
-        return Mat4Diagonal(Scalar.X(), Scalar.Y(), Scalar.Z(), 1.f); 
-    }
-    FM_FUN_SIC Scale(mat4* M, float X, float Y, float Z) -> void {
-        // TODO: Try to Cast to vec and v back and forth and Profile!
-        v4 MainDiag = M->GetMainDiagonalV4();
-        v4 ScalarVec(X, Y, Z, 1.f);
-        MainDiag = HadamardMul(MainDiag, ScalarVec);
-        M->SetMainDiagonal(MainDiag);
+        template<class kernel>
+            static auto BlendQuats(const quat* A, const quat* B, float T, quat_blend Blend, quat* Out, size_t Count) -> void {
+            quat_blend_weights Weights = QuatBlendWeights(T);
+            if(Blend == QuatBlend_Slerp)
+                BlendQuatsWith<kernel, QuatBlend_Slerp>(A, B, &Weights, Out, Count);
+            else
+                BlendQuatsWith<kernel, QuatBlend_Nlerp>(A, B, &Weights, Out, Count);
+        }
+        
+        //////////////////////
+        // skinning kernels //
+        //////////////////////
+        // NOTE: W of the result is 0
+        FM_SINL __m128 FM_CALL Cross3(__m128 A, __m128 B) {
+            __m128 AYZX = _mm_shuffle_ps(A, A, _MM_SHUFFLE(3, 0, 2, 1));
+            __m128 BYZX = _mm_shuffle_ps(B, B, _MM_SHUFFLE(3, 0, 2, 1));
+            __m128 R = _mm_sub_ps(_mm_mul_ps(A, BYZX), _mm_mul_ps(AYZX, B));
+            return _mm_shuffle_ps(R, R, _MM_SHUFFLE(3, 0, 2, 1));
+        }
+        FM_SINL __m128 FM_CALL LoadV3(const v3* V) {
+            const float* Mem = V->Elements;
+            return _mm_movelh_ps(_mm_loadl_pi(_mm_setzero_ps(), (const __m64*)Mem), _mm_load_ss(Mem + 2));
+        }
+        FM_SINL void FM_CALL StoreV3(v3* V, __m128 R) {
+            _mm_storel_pi((__m64*)V->Elements, R);
+            _mm_store_ss(V->Elements + 2, _mm_movehl_ps(R, R));
+        }
+        FM_SINL __m128 FM_CALL NormalizeV3(__m128 V) {
+            __m128 LengthSq = _mm_mul_ps(V, V);
+            LengthSq = _mm_add_ps(LengthSq, _mm_shuffle_ps(LengthSq, LengthSq, _MM_SHUFFLE(2, 3, 0, 1)));
+            LengthSq = _mm_add_ps(LengthSq, _mm_shuffle_ps(LengthSq, LengthSq, _MM_SHUFFLE(1, 0, 3, 2)));
+            return _mm_div_ps(V, _mm_sqrt_ps(LengthSq));
+        }
+        // NOTE: V + W * T + Cross(Q.XYZ, T) where T = 2 * Cross(Q.XYZ, V), W of V has to be 0
+        FM_SINL __m128 FM_CALL QuatRotate(__m128 Q, __m128 V) {
+            __m128 T = Cross3(Q, V);
+            T = _mm_add_ps(T, T);
+            __m128 R = _mm_add_ps(V, _mm_mul_ps(_mm_shuffle_ps(Q, Q, _MM_SHUFFLE(3, 3, 3, 3)), T));
+            return _mm_add_ps(R, Cross3(Q, T));
+        }
+        // NOTE: 2 * (W_r * D.XYZ - W_d * R.XYZ + Cross(R.XYZ, D.XYZ)), W of the result is 0
+        FM_SINL __m128 FM_CALL DualQuatTranslation(__m128 Real, __m128 Dual) {
+            __m128 XYZMask = _mm_castsi128_ps(_mm_setr_epi32(-1, -1, -1, 0));
+            __m128 T = _mm_sub_ps(_mm_mul_ps(_mm_shuffle_ps(Real, Real, _MM_SHUFFLE(3, 3, 3, 3)), Dual),
+                                  _mm_mul_ps(_mm_shuffle_ps(Dual, Dual, _MM_SHUFFLE(3, 3, 3, 3)), Real));
+            T = _mm_add_ps(_mm_and_ps(T, XYZMask), Cross3(Real, Dual));
+            return _mm_add_ps(T, T);
+        }
+        
+        // NOTE: The palette matrices are blended first, so every vertex is transformed once instead of once per bone
+        static auto SkinLinearSSE2(const mat4* Palette, const v4u16* BoneIndices, const v4* BoneWeights,
+                                   const v3* Positions, const v3* Normals, v3* OutPositions, v3* OutNormals, size_t Count) -> void {
+            for(size_t i = 0; i < Count; ++i)
+            {
+                const uint16_t* Indices = BoneIndices[i].Elements;
+                const float* Weights = BoneWeights[i].Elements;
+                __m128 C[4];
+                for(int32_t Col = 0; Col < 4; ++Col)
+                {
+                    __m128 R01 = _mm_mul_ps(Palette[Indices[0]].Columns[Col], _mm_load1_ps(Weights));
+                    __m128 R23 = _mm_mul_ps(Palette[Indices[2]].Columns[Col], _mm_load1_ps(Weights + 2));
+                    R01 = _mm_add_ps(R01, _mm_mul_ps(Palette[Indices[1]].Columns[Col], _mm_load1_ps(Weights + 1)));
+                    R23 = _mm_add_ps(R23, _mm_mul_ps(Palette[Indices[3]].Columns[Col], _mm_load1_ps(Weights + 3)));
+                    C[Col] = _mm_add_ps(R01, R23);
+                }
+                
+                const float* P = Positions[i].Elements;
+                __m128 R = _mm_add_ps(_mm_mul_ps(C[0], _mm_load1_ps(P)), C[3]);
+                R = _mm_add_ps(R, _mm_mul_ps(C[1], _mm_load1_ps(P + 1)));
+                R = _mm_add_ps(R, _mm_mul_ps(C[2], _mm_load1_ps(P + 2)));
+                StoreV3(OutPositions + i, R);
+                if(Normals)
+                {
+                    const float* N = Normals[i].Elements;
+                    __m128 XYZMask = _mm_castsi128_ps(_mm_setr_epi32(-1, -1, -1, 0));
+                    R = _mm_mul_ps(C[0], _mm_load1_ps(N));
+                    R = _mm_add_ps(R, _mm_mul_ps(C[1], _mm_load1_ps(N + 1)));
+                    R = _mm_add_ps(R, _mm_mul_ps(C[2], _mm_load1_ps(N + 2)));
+                    StoreV3(OutNormals + i, NormalizeV3(_mm_and_ps(R, XYZMask)));
+                }
+            }
+        }
+        // NOTE: Two blended columns per ymm register
+        FM_TARGET_AVX2_FMA static auto SkinLinearAVX2(const mat4* Palette, const v4u16* BoneIndices, const v4* BoneWeights,
+                                                      const v3* Positions, const v3* Normals, v3* OutPositions, v3* OutNormals, size_t Count) -> void {
+            for(size_t i = 0; i < Count; ++i)
+            {
+                const uint16_t* Indices = BoneIndices[i].Elements;
+                const float* Weights = BoneWeights[i].Elements;
+                const mat4* M0 = Palette + Indices[0];
+                const mat4* M1 = Palette + Indices[1];
+                const mat4* M2 = Palette + Indices[2];
+                const mat4* M3 = Palette + Indices[3];
+                __m256 W0 = _mm256_broadcast_ss(Weights), W1 = _mm256_broadcast_ss(Weights + 1);
+                __m256 W2 = _mm256_broadcast_ss(Weights + 2), W3 = _mm256_broadcast_ss(Weights + 3);
+                __m256 C01 = _mm256_mul_ps(_mm256_loadu_ps((const float*)&M0->Columns[0]), W0);
+                __m256 C23 = _mm256_mul_ps(_mm256_loadu_ps((const float*)&M0->Columns[2]), W0);
+                C01 = _mm256_fmadd_ps(_mm256_loadu_ps((const float*)&M1->Columns[0]), W1, C01);
+                C23 = _mm256_fmadd_ps(_mm256_loadu_ps((const float*)&M1->Columns[2]), W1, C23);
+                C01 = _mm256_fmadd_ps(_mm256_loadu_ps((const float*)&M2->Columns[0]), W2, C01);
+                C23 = _mm256_fmadd_ps(_mm256_loadu_ps((const float*)&M2->Columns[2]), W2, C23);
+                C01 = _mm256_fmadd_ps(_mm256_loadu_ps((const float*)&M3->Columns[0]), W3, C01);
+                C23 = _mm256_fmadd_ps(_mm256_loadu_ps((const float*)&M3->Columns[2]), W3, C23);
+                
+                // NOTE: (X, X, X, X, Y, Y, Y, Y) * (C0, C1) + (Z, Z, Z, Z, 1, 1, 1, 1) * (C2, C3), then both halves are added
+                const float* P = Positions[i].Elements;
+                __m256 XY = _mm256_insertf128_ps(_mm256_castps128_ps256(_mm_broadcast_ss(P)), _mm_broadcast_ss(P + 1), 1);
+                __m256 Z1 = _mm256_insertf128_ps(_mm256_castps128_ps256(_mm_broadcast_ss(P + 2)), _mm_set1_ps(1.f), 1);
+                __m256 R = _mm256_fmadd_ps(C01, XY, _mm256_mul_ps(C23, Z1));
+                StoreV3(OutPositions + i, _mm_add_ps(_mm256_castps256_ps128(R), _mm256_extractf128_ps(R, 1)));
+                if(Normals)
+                {
+                    const float* N = Normals[i].Elements;
+                    __m128 XYZMask = _mm_castsi128_ps(_mm_setr_epi32(-1, -1, -1, 0));
+                    XY = _mm256_insertf128_ps(_mm256_castps128_ps256(_mm_broadcast_ss(N)), _mm_broadcast_ss(N + 1), 1);
+                    __m256 Z0 = _mm256_castps128_ps256(_mm_broadcast_ss(N + 2));
+                    Z0 = _mm256_insertf128_ps(Z0, _mm_setzero_ps(), 1);
+                    R = _mm256_fmadd_ps(C01, XY, _mm256_mul_ps(C23, Z0));
+                    __m128 RN = _mm_add_ps(_mm256_castps256_ps128(R), _mm256_extractf128_ps(R, 1));
+                    StoreV3(OutNormals + i, NormalizeV3(_mm_and_ps(RN, XYZMask)));
+                }
+            }
+        }
+        
+        // NOTE: Influences on the other side of the hypersphere than the first one are negated before the blend,
+        //       the blend is normalized by the length of its real part
+        static auto SkinDualQuatSSE2(const dual_quat* Palette, const v4u16* BoneIndices, const v4* BoneWeights,
+                                     const v3* Positions, const v3* Normals, v3* OutPositions, v3* OutNormals, size_t Count) -> void {
+            __m128 SignMask = _mm_set1_ps(-0.f);
+            for(size_t i = 0; i < Count; ++i)
+            {
+                const uint16_t* Indices = BoneIndices[i].Elements;
+                const float* Weights = BoneWeights[i].Elements;
+                __m128 Real0 = Palette[Indices[0]].Real.M;
+                __m128 Real = _mm_setzero_ps(), Dual = _mm_setzero_ps();
+                for(int32_t Bone = 0; Bone < 4; ++Bone)
+                {
+                    const dual_quat* Q = Palette + Indices[Bone];
+                    __m128 Dot = _mm_mul_ps(Q->Real.M, Real0);
+                    Dot = _mm_add_ps(Dot, _mm_shuffle_ps(Dot, Dot, _MM_SHUFFLE(2, 3, 0, 1)));
+                    Dot = _mm_add_ps(Dot, _mm_shuffle_ps(Dot, Dot, _MM_SHUFFLE(1, 0, 3, 2)));
+                    __m128 W = _mm_xor_ps(_mm_load1_ps(Weights + Bone), _mm_and_ps(Dot, SignMask));
+                    Real = _mm_add_ps(Real, _mm_mul_ps(Q->Real.M, W));
+                    Dual = _mm_add_ps(Dual, _mm_mul_ps(Q->Dual.M, W));
+                }
+                __m128 LengthSq = _mm_mul_ps(Real, Real);
+                LengthSq = _mm_add_ps(LengthSq, _mm_shuffle_ps(LengthSq, LengthSq, _MM_SHUFFLE(2, 3, 0, 1)));
+                LengthSq = _mm_add_ps(LengthSq, _mm_shuffle_ps(LengthSq, LengthSq, _MM_SHUFFLE(1, 0, 3, 2)));
+                __m128 InvLength = _mm_div_ps(_mm_set1_ps(1.f), _mm_sqrt_ps(LengthSq));
+                Real = _mm_mul_ps(Real, InvLength);
+                Dual = _mm_mul_ps(Dual, InvLength);
+                
+                __m128 R = QuatRotate(Real, LoadV3(Positions + i));
+                StoreV3(OutPositions + i, _mm_add_ps(R, DualQuatTranslation(Real, Dual)));
+                if(Normals)
+                    StoreV3(OutNormals + i, QuatRotate(Real, LoadV3(Normals + i)));
+            }
+        }
+        // NOTE: A dual quat fills a ymm register, so the blend takes one fma per influence
+        FM_TARGET_AVX2_FMA static auto SkinDualQuatAVX2(const dual_quat* Palette, const v4u16* BoneIndices, const v4* BoneWeights,
+                                                        const v3* Positions, const v3* Normals, v3* OutPositions, v3* OutNormals, size_t Count) -> void {
+            __m128 SignMask = _mm_set1_ps(-0.f);
+            for(size_t i = 0; i < Count; ++i)
+            {
+                const uint16_t* Indices = BoneIndices[i].Elements;
+                const float* Weights = BoneWeights[i].Elements;
+                __m128 Real0 = Palette[Indices[0]].Real.M;
+                __m256 Blend = _mm256_setzero_ps();
+                for(int32_t Bone = 0; Bone < 4; ++Bone)
+                {
+                    const dual_quat* Q = Palette + Indices[Bone];
+                    __m128 Sign = _mm_and_ps(_mm_dp_ps(Q->Real.M, Real0, 0xFF), SignMask);
+                    __m128 W = _mm_xor_ps(_mm_broadcast_ss(Weights + Bone), Sign);
+                    Blend = _mm256_fmadd_ps(_mm256_loadu_ps((const float*)Q), _mm256_insertf128_ps(_mm256_castps128_ps256(W), W, 1), Blend);
+                }
+                __m128 Real = _mm256_castps256_ps128(Blend);
+                __m128 Dual = _mm256_extractf128_ps(Blend, 1);
+                __m128 InvLength = _mm_div_ps(_mm_set1_ps(1.f), _mm_sqrt_ps(_mm_dp_ps(Real, Real, 0xFF)));
+                Real = _mm_mul_ps(Real, InvLength);
+                Dual = _mm_mul_ps(Dual, InvLength);
+                
+                __m128 R = QuatRotate(Real, LoadV3(Positions + i));
+                StoreV3(OutPositions + i, _mm_add_ps(R, DualQuatTranslation(Real, Dual)));
+                if(Normals)
+                    StoreV3(OutNormals + i, QuatRotate(Real, LoadV3(Normals + i)));
+            }
+        }
+        
+        ///////////////////////////////////////
+        // exponential and logarithm kernels //
+        ///////////////////////////////////////
+        enum float_map : uint32_t
+        {
+            FloatMap_Exp,
+            FloatMap_Exp2,
+            FloatMap_Log,
+            FloatMap_Log2,
+            FloatMap_Pow
+        };
+        
+        struct float_map_kernel_sse2
+        {
+            static constexpr uint32_t Width = 4;
+            
+            template<float_map Map>
+                static auto Run(const float* In, float Exponent, float* Out, size_t Count) -> void {
+                __m128 Y = _mm_set1_ps(Exponent);
+                for(size_t i = 0; i < Count; i += Width)
+                {
+                    __m128 X = _mm_loadu_ps(In + i);
+                    if constexpr(Map == FloatMap_Exp)
+                        X = ExpLanes<4>(X);
+                    else if constexpr(Map == FloatMap_Exp2)
+                        X = Exp2Lanes<4>(X);
+                    else if constexpr(Map == FloatMap_Log)
+                        X = LogLanes<4>(X);
+                    else if constexpr(Map == FloatMap_Log2)
+                        X = Log2Lanes<4>(X);
+                    else
+                        X = PowLanes<4>(X, Y);
+                    _mm_storeu_ps(Out + i, X);
+                }
+            }
+        };
+        
+        // NOTE: Same steps as the lane templates of the header part, written out with ymm registers and fma
+        FM_TARGET_AVX2_FMA FM_SINL __m256 FM_CALL Polynomial8(__m256 X, const float* Coefficients, uint32_t Count) {
+            __m256 R = _mm256_set1_ps(Coefficients[0]);
+            for(uint32_t i = 1; i < Count; ++i)
+                R = _mm256_fmadd_ps(R, X, _mm256_set1_ps(Coefficients[i]));
+            return R;
+        }
+        // NOTE: P * 2^N, 2^N is built from two halves like in RoundAndPowerOfTwo
+        FM_TARGET_AVX2_FMA FM_SINL __m256 FM_CALL ScaleByPowerOfTwo8(__m256 P, __m256 N) {
+            __m256i I = _mm256_cvtps_epi32(N);
+            __m256i ILo = _mm256_srai_epi32(I, 1);
+            __m256i Bias = _mm256_set1_epi32(127);
+            __m256 ScaleLo = _mm256_castsi256_ps(_mm256_slli_epi32(_mm256_add_epi32(ILo, Bias), 23));
+            __m256 ScaleHi = _mm256_castsi256_ps(_mm256_slli_epi32(_mm256_add_epi32(_mm256_sub_epi32(I, ILo), Bias), 23));
+            return _mm256_mul_ps(_mm256_mul_ps(P, ScaleLo), ScaleHi);
+        }
+        FM_TARGET_AVX2_FMA FM_SINL __m256 FM_CALL Exp8(__m256 X) {
+            X = _mm256_max_ps(_mm256_set1_ps(-104.f), _mm256_min_ps(_mm256_set1_ps(89.f), X));
+            __m256 N = _mm256_round_ps(_mm256_mul_ps(X, _mm256_set1_ps(1.44269504f)), _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC);
+            __m256 R = _mm256_fnmadd_ps(N, _mm256_set1_ps(Ln2Hi), X);
+            R = _mm256_fnmadd_ps(N, _mm256_set1_ps(Ln2Lo), R);
+            __m256 P = _mm256_fmadd_ps(_mm256_mul_ps(R, R), Polynomial8(R, ExpPolynomial, 6), R);
+            return ScaleByPowerOfTwo8(_mm256_add_ps(P, _mm256_set1_ps(1.f)), N);
+        }
+        FM_TARGET_AVX2_FMA FM_SINL __m256 FM_CALL Exp2_8(__m256 X) {
+            X = _mm256_max_ps(_mm256_set1_ps(-151.f), _mm256_min_ps(_mm256_set1_ps(129.f), X));
+            __m256 N = _mm256_round_ps(X, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC);
+            __m256 F = _mm256_sub_ps(X, N);
+            __m256 P = _mm256_fmadd_ps(F, Polynomial8(F, Exp2Polynomial, 6), _mm256_set1_ps(1.f));
+            return ScaleByPowerOfTwo8(P, N);
+        }
+        // NOTE: Returns M - 1 and E like LogReduce, then Y = (M - 1)^3 * P(M - 1) - (M - 1)^2 / 2
+        FM_TARGET_AVX2_FMA FM_SINL __m256 FM_CALL LogReduce8(__m256 X, __m256* E, __m256* Y) {
+            __m256 Denormal = _mm256_cmp_ps(X, _mm256_set1_ps(MinNormalF32), _CMP_LT_OQ);
+            X = _mm256_blendv_ps(X, _mm256_mul_ps(X, _mm256_set1_ps(8388608.f)), Denormal);
+            __m256i Bits = _mm256_castps_si256(X);
+            __m256 M = _mm256_castsi256_ps(_mm256_or_si256(_mm256_and_si256(Bits, _mm256_set1_epi32(0x007FFFFF)), _mm256_set1_epi32(0x3F000000)));
+            __m256 Exponent = _mm256_cvtepi32_ps(_mm256_sub_epi32(_mm256_srli_epi32(Bits, 23), _mm256_set1_epi32(126)));
+            __m256 Below = _mm256_cmp_ps(M, _mm256_set1_ps(0.707106781f), _CMP_LT_OQ);
+            Exponent = _mm256_sub_ps(Exponent, _mm256_and_ps(Below, _mm256_set1_ps(1.f)));
+            *E = _mm256_sub_ps(Exponent, _mm256_and_ps(Denormal, _mm256_set1_ps(23.f)));
+            M = _mm256_sub_ps(_mm256_add_ps(M, _mm256_and_ps(Below, M)), _mm256_set1_ps(1.f));
+            __m256 Z = _mm256_mul_ps(M, M);
+            *Y = _mm256_fmadd_ps(Z, _mm256_set1_ps(-0.5f), _mm256_mul_ps(_mm256_mul_ps(M, Z), Polynomial8(M, LogPolynomial, 9)));
+            return M;
+        }
+        FM_TARGET_AVX2_FMA FM_SINL __m256 FM_CALL LogSpecialCases8(__m256 X, __m256 R) {
+            __m256 Zero = _mm256_setzero_ps();
+            __m256 Infinity = _mm256_set1_ps(INFINITY);
+            R = _mm256_blendv_ps(R, Infinity, _mm256_cmp_ps(X, Infinity, _CMP_EQ_OQ));
+            R = _mm256_blendv_ps(R, _mm256_set1_ps(-INFINITY), _mm256_cmp_ps(X, Zero, _CMP_EQ_OQ));
+            return _mm256_or_ps(R, _mm256_andnot_ps(_mm256_cmp_ps(X, Zero, _CMP_GE_OQ), _mm256_set1_ps(NAN)));
+        }
+        FM_TARGET_AVX2_FMA FM_SINL __m256 FM_CALL Log8(__m256 X) {
+            __m256 E, Y;
+            __m256 M = LogReduce8(X, &E, &Y);
+            Y = _mm256_fmadd_ps(E, _mm256_set1_ps(Ln2Lo), Y);
+            __m256 R = _mm256_fmadd_ps(E, _mm256_set1_ps(Ln2Hi), _mm256_add_ps(M, Y));
+            return LogSpecialCases8(X, R);
+        }
+        FM_TARGET_AVX2_FMA FM_SINL __m256 FM_CALL Log2_8(__m256 X) {
+            __m256 E, Y;
+            __m256 M = LogReduce8(X, &E, &Y);
+            __m256 L = _mm256_set1_ps(Log2EMinusOne);
+            __m256 R = _mm256_fmadd_ps(M, L, _mm256_mul_ps(Y, L));
+            R = _mm256_add_ps(_mm256_add_ps(_mm256_add_ps(R, Y), M), E);
+            return LogSpecialCases8(X, R);
+        }
+        
+        struct float_map_kernel_avx2
+        {
+            static constexpr uint32_t Width = 8;
+            
+            template<float_map Map>
+                FM_TARGET_AVX2_FMA static auto Run(const float* In, float Exponent, float* Out, size_t Count) -> void {
+                __m256 Y = _mm256_set1_ps(Exponent);
+                // NOTE: Exponent is the same for every lane, so the negative base rules of PowLanes reduce to two masks
+                float AbsExponent = Abs(Exponent);
+                bool IntegerExponent = AbsExponent < 8388608.f ? Exponent == (float)(int32_t)Exponent : AbsExponent == AbsExponent;
+                bool OddExponent = IntegerExponent && AbsExponent < 16777216.f && ((int32_t)Exponent & 1);
+                __m256 SignMask = _mm256_set1_ps(-0.f);
+                __m256 OddSign = OddExponent ? SignMask : _mm256_setzero_ps();
+                __m256 NegativeNaN = IntegerExponent ? _mm256_setzero_ps() : _mm256_set1_ps(NAN);
+                // NOTE: Lanes with this absolute value give 1, like PowLanes does for Pow(1, Y) and Pow(-1, +-infinity)
+                __m256 UnitAbsX = _mm256_set1_ps(AbsExponent == INFINITY ? 1.f : -1.f);
+                for(size_t i = 0; i < Count; i += Width)
+                {
+                    __m256 X = _mm256_loadu_ps(In + i);
+                    if constexpr(Map == FloatMap_Exp)
+                        X = Exp8(X);
+                    else if constexpr(Map == FloatMap_Exp2)
+                        X = Exp2_8(X);
+                    else if constexpr(Map == FloatMap_Log)
+                        X = Log8(X);
+                    else if constexpr(Map == FloatMap_Log2)
+                        X = Log2_8(X);
+                    else if(Exponent == 0.f)
+                        X = _mm256_set1_ps(1.f);
+                    else
+                    {
+                        __m256 Sign = _mm256_and_ps(X, SignMask);
+                        __m256 R = Exp2_8(_mm256_mul_ps(Y, Log2_8(_mm256_xor_ps(X, Sign))));
+                        R = _mm256_xor_ps(R, _mm256_and_ps(Sign, OddSign));
+                        R = _mm256_or_ps(R, _mm256_and_ps(_mm256_cmp_ps(X, _mm256_setzero_ps(), _CMP_LT_OQ), NegativeNaN));
+                        __m256 UnitX = _mm256_or_ps(_mm256_cmp_ps(X, _mm256_set1_ps(1.f), _CMP_EQ_OQ),
+                                                    _mm256_cmp_ps(_mm256_xor_ps(X, Sign), UnitAbsX, _CMP_EQ_OQ));
+                        X = _mm256_blendv_ps(R, _mm256_set1_ps(1.f), UnitX);
+                    }
+                    _mm256_storeu_ps(Out + i, X);
+                }
+            }
+        };
+        
+        // NOTE: The kernels only take whole packets, the tail goes through a copy padded with ones
+        template<class kernel, float_map Map>
+            static auto MapFloatsWith(const float* In, float Exponent, float* Out, size_t Count) -> void {
+            size_t WholeCount = Count - Count % kernel::Width;
+            kernel::template Run<Map>(In, Exponent, Out, WholeCount);
+            if(WholeCount < Count)
+            {
+                float TailIn[kernel::Width], TailOut[kernel::Width];
+                for(uint32_t i = 0; i < kernel::Width; ++i)
+                    TailIn[i] = WholeCount + i < Count ? In[WholeCount + i] : 1.f;
+                kernel::template Run<Map>(TailIn, Exponent, TailOut, kernel::Width);
+                for(size_t i = WholeCount; i < Count; ++i)
+                    Out[i] = TailOut[i - WholeCount];
+            }
+        }
+        template<class kernel>
+            static auto MapFloats(float_map Map, const float* In, float Exponent, float* Out, size_t Count) -> void {
+            switch(Map)
+            {
+                case FloatMap_Exp: MapFloatsWith<kernel, FloatMap_Exp>(In, Exponent, Out, Count); break;
+                case FloatMap_Exp2: MapFloatsWith<kernel, FloatMap_Exp2>(In, Exponent, Out, Count); break;
+                case FloatMap_Log: MapFloatsWith<kernel, FloatMap_Log>(In, Exponent, Out, Count); break;
+                case FloatMap_Log2: MapFloatsWith<kernel, FloatMap_Log2>(In, Exponent, Out, Count); break;
+                default: MapFloatsWith<kernel, FloatMap_Pow>(In, Exponent, Out, Count); break;
+            }
+        }
+        
+        ///////////////////////
+        // normalize kernels //
+        ///////////////////////
+        // NOTE: Vectors whose squared length is below the smallest normal float get a zero scale
+        struct normalize_kernel_sse2
+        {
+            static constexpr uint32_t Width = 4;
+            
+            template<class t> static auto Run(const t* In, t* Out, size_t Count) -> void {
+                for(size_t i = 0; i < Count; i += Width)
+                {
+                    v3x4 P = V3x4FromMemory(In + i);
+                    __m128 LengthSquared = Dot(P, P);
+                    __m128 Valid = _mm_cmpge_ps(LengthSquared, _mm_set1_ps(1.17549435e-38f));
+                    Store(Out + i, P * _mm_and_ps(Valid, ReciprocalSqrt(LengthSquared)));
+                }
+            }
+        };
+        
+        // NOTE: Two v3x4 packets are transposed with 128 bit shuffles and joined, the length and scale are done in ymm registers
+        struct normalize_kernel_avx2
+        {
+            static constexpr uint32_t Width = 8;
+            
+            template<class t> FM_TARGET_AVX2_FMA static auto Run(const t* In, t* Out, size_t Count) -> void {
+                for(size_t i = 0; i < Count; i += Width)
+                {
+                    v3x4 Lo = V3x4FromMemory(In + i);
+                    v3x4 Hi = V3x4FromMemory(In + i + 4);
+                    __m256 X = _mm256_insertf128_ps(_mm256_castps128_ps256(Lo.X), Hi.X, 1);
+                    __m256 Y = _mm256_insertf128_ps(_mm256_castps128_ps256(Lo.Y), Hi.Y, 1);
+                    __m256 Z = _mm256_insertf128_ps(_mm256_castps128_ps256(Lo.Z), Hi.Z, 1);
+                    __m256 LengthSquared = _mm256_fmadd_ps(Z, Z, _mm256_fmadd_ps(Y, Y, _mm256_mul_ps(X, X)));
+                    __m256 R = _mm256_rsqrt_ps(LengthSquared);
+                    R = _mm256_mul_ps(_mm256_mul_ps(_mm256_set1_ps(0.5f), R),
+                                      _mm256_fnmadd_ps(_mm256_mul_ps(LengthSquared, R), R, _mm256_set1_ps(3.f)));
+                    R = _mm256_and_ps(_mm256_cmp_ps(LengthSquared, _mm256_set1_ps(1.17549435e-38f), _CMP_GE_OQ), R);
+                    X = _mm256_mul_ps(X, R);
+                    Y = _mm256_mul_ps(Y, R);
+                    Z = _mm256_mul_ps(Z, R);
+                    Store(Out + i, V3x4(_mm256_castps256_ps128(X), _mm256_castps256_ps128(Y), _mm256_castps256_ps128(Z)));
+                    Store(Out + i + 4, V3x4(_mm256_extractf128_ps(X, 1), _mm256_extractf128_ps(Y, 1), _mm256_extractf128_ps(Z, 1)));
+                }
+            }
+        };
+        
+        // NOTE: The kernels only take whole packets, the tail goes through a copy padded with the first vector
+        template<class kernel, class t> static auto NormalizeV3With(const t* In, t* Out, size_t Count) -> void {
+            size_t WholeCount = Count - Count % kernel::Width;
+            kernel::template Run<t>(In, Out, WholeCount);
+            if(WholeCount < Count)
+            {
+                t TailIn[kernel::Width], TailOut[kernel::Width];
+                for(uint32_t i = 0; i < kernel::Width; ++i)
+                    TailIn[i] = WholeCount + i < Count ? In[WholeCount + i] : In[0];
+                kernel::template Run<t>(TailIn, TailOut, kernel::Width);
+                for(size_t i = WholeCount; i < Count; ++i)
+                    Out[i] = TailOut[i - WholeCount];
+            }
+        }
+        // NOTE: Stride is 3 for v3 and 4 for vec3 arrays
+        template<class kernel> static auto NormalizeV3(const float* In, float* Out, uint32_t Stride, size_t Count) -> void {
+            if(Stride == 3)
+                NormalizeV3With<kernel>((const v3*)In, (v3*)Out, Count);
+            else
+                NormalizeV3With<kernel>((const vec3*)In, (vec3*)Out, Count);
+        }
+        
+        ////////////////////////////
+        // half precision kernels //
+        ////////////////////////////
+        static auto PackHalfSSE2(const float* In, uint16_t* Out, size_t Count) -> void {
+            size_t i = 0;
+            for(; i + 8 <= Count; i += 8)
+            {
+                __m128i Lo = HalfFromFloat4(_mm_loadu_ps(In + i));
+                __m128i Hi = HalfFromFloat4(_mm_loadu_ps(In + i + 4));
+                _mm_storeu_si128((__m128i*)(Out + i), _mm_packs_epi32(Lo, Hi));
+            }
+            for(; i < Count; ++i)
+                Out[i] = HalfFromFloat(In[i]);
+        }
+        static auto UnpackHalfSSE2(const uint16_t* In, float* Out, size_t Count) -> void {
+            size_t i = 0;
+            for(; i + 8 <= Count; i += 8)
+            {
+                __m128i H = _mm_loadu_si128((const __m128i*)(In + i));
+                _mm_storeu_ps(Out + i, FloatFromHalf4(_mm_unpacklo_epi16(H, _mm_setzero_si128())));
+                _mm_storeu_ps(Out + i + 4, FloatFromHalf4(_mm_unpackhi_epi16(H, _mm_setzero_si128())));
+            }
+            for(; i < Count; ++i)
+                Out[i] = FloatFromHalf(In[i]);
+        }
+        FM_TARGET_AVX2_FMA static auto PackHalfF16C(const float* In, uint16_t* Out, size_t Count) -> void {
+            size_t i = 0;
+            for(; i + 8 <= Count; i += 8)
+                _mm_storeu_si128((__m128i*)(Out + i), _mm256_cvtps_ph(_mm256_loadu_ps(In + i), _MM_FROUND_TO_NEAREST_INT));
+            for(; i < Count; ++i)
+                Out[i] = (uint16_t)_mm_cvtsi128_si32(_mm_cvtps_ph(_mm_set_ss(In[i]), _MM_FROUND_TO_NEAREST_INT));
+        }
+        FM_TARGET_AVX2_FMA static auto UnpackHalfF16C(const uint16_t* In, float* Out, size_t Count) -> void {
+            size_t i = 0;
+            for(; i + 8 <= Count; i += 8)
+                _mm256_storeu_ps(Out + i, _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*)(In + i))));
+            for(; i < Count; ++i)
+                Out[i] = _mm_cvtss_f32(_mm_cvtph_ps(_mm_cvtsi32_si128(In[i])));
+        }
+        
+        ////////////////////
+        // dispatch table //
+        ////////////////////
+        struct dispatch_table
+        {
+            simd_tier Tier;
+            void (*Mat4Mul)(const mat4* A, const mat4* B, mat4* Out);
+            void (*Mat4MulArray)(const mat4* A, const mat4* B, mat4* Out, size_t Count);
+            void (*Mat4MulColumns)(mat4* M, uint32_t Columns, __m128 B0, __m128 B1, __m128 B2);
+            void (*Transform)(const mat4* M, transform_layout Layout, float W, bool Project,
+                              const float* In, float* Out, size_t Count);
+            void (*BlendQuats)(const quat* A, const quat* B, float T, quat_blend Blend, quat* Out, size_t Count);
+            void (*SkinLinear)(const mat4* Palette, const v4u16* BoneIndices, const v4* BoneWeights,
+                               const v3* Positions, const v3* Normals, v3* OutPositions, v3* OutNormals, size_t Count);
+            void (*SkinDualQuat)(const dual_quat* Palette, const v4u16* BoneIndices, const v4* BoneWeights,
+                                 const v3* Positions, const v3* Normals, v3* OutPositions, v3* OutNormals, size_t Count);
+            void (*MapFloats)(float_map Map, const float* In, float Exponent, float* Out, size_t Count);
+            void (*NormalizeV3)(const float* In, float* Out, uint32_t Stride, size_t Count);
+            void (*PackHalf)(const float* In, uint16_t* Out, size_t Count);
+            void (*UnpackHalf)(const uint16_t* In, float* Out, size_t Count);
+        };
+        
+        // NOTE: SSE4.1 dpps and AVX-512 zmm kernels were measured no faster than these, so there are no tiers for them
+        static constexpr dispatch_table DispatchTables[SimdTier_Count] = {
+            {SimdTier_SSE2, Mat4MulSSE2, Mat4MulArraySSE2, Mat4MulColumnsSSE2,
+             Transform<transform_kernel_sse2>,
+             BlendQuats<quat_blend_kernel_sse2>, SkinLinearSSE2, SkinDualQuatSSE2,
+             MapFloats<float_map_kernel_sse2>, NormalizeV3<normalize_kernel_sse2>,
+             PackHalfSSE2, UnpackHalfSSE2},
+            {SimdTier_AVX2_FMA, Mat4MulFMA, Mat4MulArrayAVX2, Mat4MulColumnsFMA,
+             Transform<transform_kernel_avx2>,
+             BlendQuats<quat_blend_kernel_avx2>, SkinLinearAVX2, SkinDualQuatAVX2,
+             MapFloats<float_map_kernel_avx2>, NormalizeV3<normalize_kernel_avx2>,
+             PackHalfF16C, UnpackHalfF16C},
+        };
+        // NOTE: Constant initialized with the SSE2 kernels, so calls made from other static initializers still work.
+        //       The tables never change, so switching the pointer with relaxed atomics is enough for other threads.
+        static std::atomic<const dispatch_table*> ActiveDispatchTable = &DispatchTables[SimdTier_SSE2];
+        static std::atomic<simd_tier> MaxSupportedTier = SimdTier_Count;
+        
+        FM_SINL auto Dispatch() -> const dispatch_table& {
+            return *ActiveDispatchTable.load(std::memory_order_relaxed);
+        }
+        static auto ResolveMaxSupportedTier() -> simd_tier {
+            simd_tier Tier = MaxSupportedTier.load(std::memory_order_relaxed);
+            if(Tier == SimdTier_Count)
+            {
+                Tier = DetectSimdTier();
+                MaxSupportedTier.store(Tier, std::memory_order_relaxed);
+            }
+            return Tier;
+        }
+        static const bool DispatchResolvedAtStartup = (ActiveDispatchTable.store(&DispatchTables[ResolveMaxSupportedTier()],
+                                                                                 std::memory_order_relaxed), true);
     }
-    FM_FUN_SIC Scale(mat4* M, float Scalar) -> void {
-        Scale(M, Scalar, Scalar, Scalar);
+    
+    FM_FUN GetMaxSupportedSimdTier() -> simd_tier {
+        return priv::ResolveMaxSupportedTier();
     }
-    FM_FUN_SIC Scale(mat4* M, vec3 Scalar) -> void {
-        // TODO: Try to Cast to vec and v back and forth and Profile!
-        vec4 MainDiag = M->GetMainDiagonalVec4();
-        MainDiag.M = _mm_mul_ps(MainDiag.M, Scalar.M);
-        MainDiag.M = priv::SetW(MainDiag.M, 1.f);
-        M->SetMainDiagonal(MainDiag);
+    FM_FUN GetSimdTier() -> simd_tier {
+        return priv::Dispatch().Tier;
     }
-    FM_FUN_SIC Scale(mat4* M, v3 Scalar) -> void {
-        return Scale(M, CastToVec3(Scalar));
+    FM_FUN SetSimdTier(simd_tier Tier) -> simd_tier {
+        simd_tier MaxTier = GetMaxSupportedSimdTier();
+        const priv::dispatch_table* Table = &priv::DispatchTables[Tier < MaxTier ? Tier : MaxTier];
+        priv::ActiveDispatchTable.store(Table, std::memory_order_relaxed);
+        return Table->Tier;
     }
-    FM_FUN_SIC Mat4RotationRadians(float Radians, float AxisX, float AxisY, float AxisZ) -> mat4 {
-        vec3 Normalized = Normalize(Vec3(AxisX, AxisY, AxisZ));
-        AxisX = Normalized.X();
-        AxisY = Normalized.Y();
-        AxisZ = Normalized.Z();
-        float SinTheta = sinf(Radians);
-        float CosTheta = cosf(Radians);
-        float CosVal = 1.f - CosTheta;
-        return Mat4FromColumns(
- (AxisX * AxisX * CosVal) + CosTheta,
- (AxisX * AxisY * CosVal) + (AxisZ * SinTheta),
- (AxisX * AxisZ * CosVal) - (AxisY * SinTheta),
-                               0.f,
- (AxisY * AxisX * CosVal) - (AxisZ * SinTheta),
- (AxisY * AxisY * CosVal) + CosTheta,
- (AxisY * AxisZ * CosVal) + (AxisX * SinTheta),
-                               0.f,
- (AxisZ * AxisX * CosVal) + (AxisY * SinTheta),
- (AxisZ * AxisY * CosVal) - (AxisX * SinTheta),
- (AxisZ * AxisZ * CosVal) + CosTheta,
-                               0.f,
-                               0.f, 0.f, 0.f, 1.f);
-    } 
-    FM_FUN_SIC Mat4RotationRadians(float Radians, v3 Axis) -> mat4 {
-        return Mat4RotationRadians(Radians, Axis.X, Axis.Y, Axis.Z);
+    FM_FUN GetSimdTierName(simd_tier Tier) -> const char* {
+        switch(Tier)
+        {
+            case SimdTier_SSE2: return "SSE2";
+            case SimdTier_AVX2_FMA: return "AVX2+FMA";
+            default: return "Unknown";
+        }
     }
-    FM_FUN_SIC Mat4RotationRadians(float Radians, vec3 Axis) -> mat4 {
-        return Mat4RotationRadians(Radians, Axis.X(), Axis.Y(), Axis.Z());
+    
+    /////////////////////////////////
+    // not inlined batch functions //
+    /////////////////////////////////
+    FM_FUN MultiplyMat4Arrays(const mat4* A, const mat4* B, mat4* Out, size_t Count) -> void {
+        priv::Dispatch().Mat4MulArray(A, B, Out, Count);
     }
-    FM_FUN_SIC Mat4RotationAroundXAxisRadians(float R) -> mat4 {
-        return Mat4FromRows(
-                            1.f, 0.f, 0.f, 0.f,
-                            0.f, cosf(R), -sinf(R), 0.f,
-                            0.f, sinf(R), cosf(R), 0.f,
-                            0.f, 0.f, 0.f, 1.f);
+    FM_FLATTEN FM_FUN InverseMat4Array(const mat4* In, mat4* Out, size_t Count) -> void {
+        for(size_t i = 0; i < Count; ++i)
+            Out[i] = Inverse(In[i]);
     }
-    FM_FUN_SIC Mat4RotationAroundYAxisRadians(float R) -> mat4 {
-        return Mat4FromRows(
-                            cosf(R), 0.f, sinf(R), 0.f,
-                            0.f, 1.f, 0.f, 0.f,
-                            -sinf(R), 0.f, cosf(R), 0.f,
-                            0.f, 0.f, 0.f, 1.f);
+    FM_FLATTEN FM_FUN InverseAffineMat4Array(const mat4* In, mat4* Out, size_t Count) -> void {
+        for(size_t i = 0; i < Count; ++i)
+            Out[i] = InverseAffine(In[i]);
     }
-    FM_FUN_SIC Mat4RotationAroundZAxisRadians(float R) -> mat4 {
-        return Mat4FromRows(
-                            cosf(R), -sinf(R), 0.f, 0.f,
-                            sinf(R), cosf(R), 0.f, 0.f,
-                            0.f, 0.f, 1.f, 0.f,
-                            0.f, 0.f, 0.f, 1.f);
+    FM_FLATTEN FM_FUN InverseRigidMat4Array(const mat4* In, mat4* Out, size_t Count) -> void {
+        for(size_t i = 0; i < Count; ++i)
+            Out[i] = InverseRigid(In[i]);
     }
-    FM_FUN_SIC Mat4RotationAroundAllAxesRadians(float R) -> mat4 {
-        return Mat4RotationRadians(R, 1.f, 1.f, 1.f);
+    FM_FUN NlerpQuatArray(const quat* A, const quat* B, float T, quat* Out, size_t Count) -> void {
+        priv::Dispatch().BlendQuats(A, B, T, priv::QuatBlend_Nlerp, Out, Count);
     }
-    FM_FUN_SIC RotateRadians(mat4* M, float Radians, float AxisX, float AxisY, float AxisZ) -> void {
-        *M = *M * Mat4RotationRadians(Radians, AxisX, AxisY, AxisZ);
+    FM_FUN SlerpQuatArray(const quat* A, const quat* B, float T, quat* Out, size_t Count) -> void {
+        priv::Dispatch().BlendQuats(A, B, T, priv::QuatBlend_Slerp, Out, Count);
     }
-    FM_FUN_SIC RotateRadians(mat4* M, float Radians, vec3 Axes) -> void {
-        *M = *M * Mat4RotationRadians(Radians, Axes);
+    FM_FUN SkinVerticesLinear(const mat4* Palette, const v4u16* BoneIndices, const v4* BoneWeights,
+                              const v3* Positions, const v3* Normals, v3* OutPositions, v3* OutNormals, size_t Count) -> void {
+        priv::Dispatch().SkinLinear(Palette, BoneIndices, BoneWeights, Positions, Normals, OutPositions, OutNormals, Count);
     }
-    FM_FUN_SIC RotateRadians(mat4* M, float Radians, v3 Axes) -> void {
-        *M = *M * Mat4RotationRadians(Radians, Axes);
+    FM_FUN SkinVerticesDualQuat(const dual_quat* Palette, const v4u16* BoneIndices, const v4* BoneWeights,
+                                const v3* Positions, const v3* Normals, v3* OutPositions, v3* OutNormals, size_t Count) -> void {
+        priv::Dispatch().SkinDualQuat(Palette, BoneIndices, BoneWeights, Positions, Normals, OutPositions, OutNormals, Count);
     }
-    FM_FUN_SIC RotateAroundXAxisRadians(mat4* M, float Radians) -> void {
-        *M = *M * Mat4RotationAroundXAxisRadians(Radians);	
+    FM_FUN NormalizeArray(const v3* In, v3* Out, size_t Count) -> void {
+        priv::Dispatch().NormalizeV3(In->Elements, Out->Elements, 3, Count);
     }
-    FM_FUN_SIC RotateAroundYAxisRadians(mat4* M, float Radians) -> void {
-        *M = *M * Mat4RotationAroundYAxisRadians(Radians);
+    FM_FUN NormalizeArray(const vec3* In, vec3* Out, size_t Count) -> void {
+        priv::Dispatch().NormalizeV3((const float*)In, (float*)Out, 4, Count);
     }
-    FM_FUN_SIC RotateAroundZAxisRadians(mat4* M, float Radians) -> void {
-        *M = *M * Mat4RotationAroundZAxisRadians(Radians);
+    FM_FUN ExpArray(const float* In, float* Out, size_t Count) -> void {
+        priv::Dispatch().MapFloats(priv::FloatMap_Exp, In, 0.f, Out, Count);
     }
-    FM_FUN_SIC RotateAroundAllAxesRadians(mat4* M, float Radians) -> void {
-        *M = *M * Mat4RotationAroundAllAxesRadians(Radians);
+    FM_FUN Exp2Array(const float* In, float* Out, size_t Count) -> void {
+        priv::Dispatch().MapFloats(priv::FloatMap_Exp2, In, 0.f, Out, Count);
     }
-    FM_FUN_SIC Mat4RotationDegrees(float Degrees, float AxisX, float AxisY, float AxisZ) -> mat4 {
-        return Mat4RotationRadians(DegreesToRadians(Degrees), AxisX, AxisY, AxisZ);
-    } 
-    FM_FUN_SIC Mat4RotationDegrees(float Degrees, v3 Axis) -> mat4 {
-        return Mat4RotationRadians(DegreesToRadians(Degrees), Axis);
+    FM_FUN LogArray(const float* In, float* Out, size_t Count) -> void {
+        priv::Dispatch().MapFloats(priv::FloatMap_Log, In, 0.f, Out, Count);
     }
-    FM_FUN_SIC Mat4RotationDegrees(float Degrees, vec3 Axis) -> mat4 {
-        return Mat4RotationRadians(DegreesToRadians(Degrees), Axis);
+    FM_FUN Log2Array(const float* In, float* Out, size_t Count) -> void {
+        priv::Dispatch().MapFloats(priv::FloatMap_Log2, In, 0.f, Out, Count);
     }
-    FM_FUN_SIC Mat4RotationAroundXAxisDegrees(float Degrees) -> mat4 {
-        return Mat4RotationAroundXAxisRadians(DegreesToRadians(Degrees));
+    FM_FUN PowArray(const float* In, float Exponent, float* Out, size_t Count) -> void {
+        priv::Dispatch().MapFloats(priv::FloatMap_Pow, In, Exponent, Out, Count);
     }
-    FM_FUN_SIC Mat4RotationAroundYAxisDegrees(float Degrees) -> mat4 {
-        return Mat4RotationAroundYAxisRadians(DegreesToRadians(Degrees));
+    FM_FUN ExpArray(const v4* In, v4* Out, size_t Count) -> void {
+        priv::Dispatch().MapFloats(priv::FloatMap_Exp, (const float*)In, 0.f, (float*)Out, Count * 4);
     }
-    FM_FUN_SIC Mat4RotationAroundZAxisDegrees(float Degrees) -> mat4 {
-        return Mat4RotationAroundZAxisRadians(DegreesToRadians(Degrees));
+    FM_FUN Exp2Array(const v4* In, v4* Out, size_t Count) -> void {
+        priv::Dispatch().MapFloats(priv::FloatMap_Exp2, (const float*)In, 0.f, (float*)Out, Count * 4);
     }
-    FM_FUN_SIC Mat4RotationAroundAllAxesDegrees(float Degrees) -> mat4 {
-        return Mat4RotationAroundAllAxesRadians(DegreesToRadians(Degrees));
+    FM_FUN LogArray(const v4* In, v4* Out, size_t Count) -> void {
+        priv::Dispatch().MapFloats(priv::FloatMap_Log, (const float*)In, 0.f, (float*)Out, Count * 4);
     }
-    FM_FUN_SIC RotateDegrees(mat4* M, float Degrees, float AxisX, float AxisY, float AxisZ) -> void {
-        RotateRadians(M, DegreesToRadians(Degrees), AxisX, AxisY, AxisZ);
-    } 
-    FM_FUN_SIC RotateDegrees(mat4* M, float Degrees, v3 Axis) -> void {
-        RotateRadians(M, DegreesToRadians(Degrees), Axis);
+    FM_FUN Log2Array(const v4* In, v4* Out, size_t Count) -> void {
+        priv::Dispatch().MapFloats(priv::FloatMap_Log2, (const float*)In, 0.f, (float*)Out, Count * 4);
     }
-    FM_FUN_SIC RotateDegrees(mat4* M, float Degrees, vec3 Axis) -> void {
-        RotateRadians(M, DegreesToRadians(Degrees), Axis);
+    FM_FUN PowArray(const v4* In, float Exponent, v4* Out, size_t Count) -> void {
+        priv::Dispatch().MapFloats(priv::FloatMap_Pow, (const float*)In, Exponent, (float*)Out, Count * 4);
     }
-    FM_FUN_SIC RotateAroundXAxisDegrees(mat4* M, float Degrees) -> void {
-        RotateAroundXAxisRadians(M, DegreesToRadians(Degrees));
+    FM_FUN PackHalfArray(const float* In, uint16_t* Out, size_t Count) -> void {
+        priv::Dispatch().PackHalf(In, Out, Count);
     }
-    FM_FUN_SIC RotateAroundYAxisDegrees(mat4* M, float Degrees) -> void {
-        RotateAroundYAxisRadians(M, DegreesToRadians(Degrees));
+    FM_FUN PackHalfArray(const v2* In, v2h* Out, size_t Count) -> void {
+        priv::Dispatch().PackHalf((const float*)In, (uint16_t*)Out, Count * 2);
     }
-    FM_FUN_SIC RotateAroundZAxisDegrees(mat4* M, float Degrees) -> void {
-        RotateAroundZAxisRadians(M, DegreesToRadians(Degrees));
+    FM_FUN PackHalfArray(const v3* In, v3h* Out, size_t Count) -> void {
+        priv::Dispatch().PackHalf((const float*)In, (uint16_t*)Out, Count * 3);
     }
-    FM_FUN_SIC RotateAroundAllAxesDegrees(mat4* M, float Degrees) -> void {
-        RotateAroundAllAxesRadians(M, DegreesToRadians(Degrees));
+    FM_FUN PackHalfArray(const v4* In, v4h* Out, size_t Count) -> void {
+        priv::Dispatch().PackHalf((const float*)In, (uint16_t*)Out, Count * 4);
     }
-    FM_FUN_SIC Mat4ShearXAxis(float Y, float Z) -> mat4 {
-        return Mat4FromRows(
-                            1.f, 0.f, 0.f, 0.f,
-                            Y,   1.f, 0.f, 0.f,
-                            Z,   0.f, 1.f, 0.f,
-                            0.f, 0.f, 0.f, 1.f);
+    FM_FUN PackHalfArray(const vec4* In, v4h* Out, size_t Count) -> void {
+        priv::Dispatch().PackHalf((const float*)In, (uint16_t*)Out, Count * 4);
     }
-    FM_FUN_SIC Mat4ShearYAxis(float X, float Z) -> mat4 {
-        return Mat4FromRows(
-                            1.f, X,   0.f, 0.f,
-                            0.f, 1.f, 0.f, 0.f,
-                            0.f, Z,   1.f, 0.f,
-                            0.f, 0.f, 0.f, 1.f);
+    FM_FUN UnpackHalfArray(const uint16_t* In, float* Out, size_t Count) -> void {
+        priv::Dispatch().UnpackHalf(In, Out, Count);
     }
-    FM_FUN_SIC Mat4ShearZAxis(float X, float Y) -> mat4 {
-        return Mat4FromRows(
-                            1.f, 0.f, X,   0.f,
-                            0.f, 1.f, Y,   0.f,
-                            0.f, 0.f, 1.f, 0.f,
-                            0.f, 0.f, 0.f, 1.f);
+    FM_FUN UnpackHalfArray(const v2h* In, v2* Out, size_t Count) -> void {
+        priv::Dispatch().UnpackHalf((const uint16_t*)In, (float*)Out, Count * 2);
     }
-    FM_FUN_SIC Mat4Shear(float XY, float XZ, float YX, float YZ, float ZX, float ZY) -> mat4 {
-        return Mat4FromRows(
-                            1.f, YX, ZX, 0.f,
-                            XY, 1.f, ZY, 0.f,
-                            XZ, YZ, 1.f, 0.f,
-                            0.f, 0.f, 0.f, 1.f);
+    FM_FUN UnpackHalfArray(const v3h* In, v3* Out, size_t Count) -> void {
+        priv::Dispatch().UnpackHalf((const uint16_t*)In, (float*)Out, Count * 3);
     }
-    FM_FUN_SIC ShearXAxis(mat4* M, float Y, float Z) -> void {
-        *M = *M * Mat4ShearXAxis(Y, Z);
+    FM_FUN UnpackHalfArray(const v4h* In, v4* Out, size_t Count) -> void {
+        priv::Dispatch().UnpackHalf((const uint16_t*)In, (float*)Out, Count * 4);
     }
-    FM_FUN_SIC ShearYAxis(mat4* M, float X, float Z) -> void {
-        *M = *M * Mat4ShearYAxis(X, Z);
-    } 
-    FM_FUN_SIC ShearZAxis(mat4* M, float X, float Y) -> void {
-        *M = *M * Mat4ShearZAxis(X, Y);
-    } 
-    FM_FUN_SIC Shear(mat4* M, float XY, float XZ, float YX, float YZ, float ZX, float ZY) -> void {
-        *M = *M * Mat4Shear(XY, XZ, YX, YZ, ZX, ZY);
+    FM_FUN UnpackHalfArray(const v4h* In, vec4* Out, size_t Count) -> void {
+        priv::Dispatch().UnpackHalf((const uint16_t*)In, (float*)Out, Count * 4);
     }
-    FM_FUN_SIC Mat4TranslationScaleRotationRadians(v3 Translation, v3 Scale, float Rotation, v3 RotationAxes) -> mat4 {
-        mat4 R = Mat4Scale(Scale);
-        RotateRadians(&R, Rotation, RotationAxes);
-        Translate(&R, Translation);
-        return R;
+    namespace priv {
+        FM_SINL void FM_CALL LoadOctahedralV3x4(const v3* In, __m128* X, __m128* Y, __m128* Z) {
+            TransposeLoadV3x4(In->Elements, X, Y, Z);
+        }
+        FM_SINL void FM_CALL LoadOctahedralV3x4(const vec3* In, __m128* X, __m128* Y, __m128* Z) {
+            __m128 W;
+            TransposeLoad4x4((const float*)In, 4, X, Y, Z, &W);
+        }
+        FM_SINL void FM_CALL StoreOctahedralV3x4(v3* Out, __m128 X, __m128 Y, __m128 Z) {
+            TransposeStoreV3x4(Out->Elements, X, Y, Z);
+        }
+        FM_SINL void FM_CALL StoreOctahedralV3x4(vec3* Out, __m128 X, __m128 Y, __m128 Z) {
+            TransposeStore4x4((float*)Out, 4, X, Y, Z, _mm_setzero_ps());
+        }
+        FM_SINL __m128i FM_CALL OctahedralFromV3x4(__m128 X, __m128 Y, __m128 Z, uint16_t*) {
+            return Octahedral16FromV3x4(X, Y, Z);
+        }
+        FM_SINL __m128i FM_CALL OctahedralFromV3x4(__m128 X, __m128 Y, __m128 Z, uint32_t*) {
+            return Octahedral32FromV3x4(X, Y, Z);
+        }
+        FM_SINL void FM_CALL StoreOctahedral4(uint16_t* Out, __m128i Code) {
+            Code = _mm_srai_epi32(_mm_slli_epi32(Code, 16), 16);
+            _mm_storel_epi64((__m128i*)Out, _mm_packs_epi32(Code, Code));
+        }
+        FM_SINL void FM_CALL StoreOctahedral4(uint32_t* Out, __m128i Code) {
+            _mm_storeu_si128((__m128i*)Out, Code);
+        }
+        FM_SINL void FM_CALL UnpackOctahedral4(const uint16_t* In, __m128* X, __m128* Y, __m128* Z) {
+            V3x4FromOctahedral16(_mm_unpacklo_epi16(_mm_loadl_epi64((const __m128i*)In), _mm_setzero_si128()), X, Y, Z);
+        }
+        FM_SINL void FM_CALL UnpackOctahedral4(const uint32_t* In, __m128* X, __m128* Y, __m128* Z) {
+            V3x4FromOctahedral32(_mm_loadu_si128((const __m128i*)In), X, Y, Z);
+        }
+        // NOTE: Tails go through padded local copies like NormalizeV3Array
+        template<class t, class code> static auto PackOctahedralV3Array(const t* In, code* Out, size_t Count) -> void {
+            size_t WholeCount = Count - Count % 4;
+            __m128 X, Y, Z;
+            for(size_t i = 0; i < WholeCount; i += 4)
+            {
+                LoadOctahedralV3x4(In + i, &X, &Y, &Z);
+                StoreOctahedral4(Out + i, OctahedralFromV3x4(X, Y, Z, Out));
+            }
+            if(WholeCount < Count)
+            {
+                t TailIn[4];
+                code TailOut[4];
+                for(uint32_t i = 0; i < 4; ++i)
+                    TailIn[i] = WholeCount + i < Count ? In[WholeCount + i] : In[0];
+                LoadOctahedralV3x4(TailIn, &X, &Y, &Z);
+                StoreOctahedral4(TailOut, OctahedralFromV3x4(X, Y, Z, Out));
+                for(size_t i = WholeCount; i < Count; ++i)
+                    Out[i] = TailOut[i - WholeCount];
+            }
+        }
+        template<class code, class t> static auto UnpackOctahedralV3Array(const code* In, t* Out, size_t Count) -> void {
+            size_t WholeCount = Count - Count % 4;
+            __m128 X, Y, Z;
+            for(size_t i = 0; i < WholeCount; i += 4)
+            {
+                UnpackOctahedral4(In + i, &X, &Y, &Z);
+                StoreOctahedralV3x4(Out + i, X, Y, Z);
+            }
+            if(WholeCount < Count)
+            {
+                code TailIn[4] = {};
+                t TailOut[4];
+                for(size_t i = WholeCount; i < Count; ++i)
+                    TailIn[i - WholeCount] = In[i];
+                UnpackOctahedral4(TailIn, &X, &Y, &Z);
+                StoreOctahedralV3x4(TailOut, X, Y, Z);
+                for(size_t i = WholeCount; i < Count; ++i)
+                    Out[i] = TailOut[i - WholeCount];
+            }
+        }
     }
-    FM_FUN_SIC Mat4TranslationScaleRotationRadians(vec3 Translation, vec3 Scale, float Rotation, vec3 RotationAxes) -> mat4 {
-        mat4 R = Mat4Scale(Scale);
-        RotateRadians(&R, Rotation, RotationAxes);
-        Translate(&R, Translation);
-        return R;
+    FM_FUN PackOctahedralArray(const v3* In, uint16_t* Out, size_t Count) -> void {
+        priv::PackOctahedralV3Array(In, Out, Count);
     }
-    FM_FUN_SIC Mat4TranslationScaleRotationDegrees(v3 Translation, v3 Scale, float Rotation, v3 RotationAxes) -> mat4 {
-        return Mat4TranslationScaleRotationRadians(Translation, Scale, DegreesToRadians(Rotation), RotationAxes);
+    FM_FUN PackOctahedralArray(const v3* In, uint32_t* Out, size_t Count) -> void {
+        priv::PackOctahedralV3Array(In, Out, Count);
     }
-    FM_FUN_SIC Mat4TranslationScaleRotationDegrees(vec3 Translation, vec3 Scale, float Rotation, vec3 RotationAxes) -> mat4 {
-        return Mat4TranslationScaleRotationRadians(Translation, Scale, DegreesToRadians(Rotation), RotationAxes);
+    FM_FUN PackOctahedralArray(const vec3* In, uint16_t* Out, size_t Count) -> void {
+        priv::PackOctahedralV3Array(In, Out, Count);
     }
-    FM_FUN_SIC Mat4TranslationScale(v3 Translation, v3 Scale) -> mat4 {
-        mat4 R = Mat4Scale(Scale);
-        Translate(&R, Translation);
-        return R;
+    FM_FUN PackOctahedralArray(const vec3* In, uint32_t* Out, size_t Count) -> void {
+        priv::PackOctahedralV3Array(In, Out, Count);
     }
-    FM_FUN_SIC Mat4TranslationScale(vec3 Translation, vec3 Scale) -> mat4 {
-        mat4 R = Mat4Scale(Scale);
-        Translate(&R, Translation);
-        return R;
+    FM_FUN UnpackOctahedralArray(const uint16_t* In, v3* Out, size_t Count) -> void {
+        priv::UnpackOctahedralV3Array(In, Out, Count);
     }
-    FM_FUN_SIC Mat4TranslationRotationRadians(v3 Translation, float Rotation, v3 RotationAxes) -> mat4 {
-        mat4 R = Mat4RotationRadians(Rotation, RotationAxes);
-        Translate(&R, Translation);
-        return R;
+    FM_FUN UnpackOctahedralArray(const uint32_t* In, v3* Out, size_t Count) -> void {
+        priv::UnpackOctahedralV3Array(In, Out, Count);
     }
-    FM_FUN_SIC Mat4TranslationRotationRadians(vec3 Translation, float Rotation, vec3 RotationAxes) -> mat4 {
-        mat4 R = Mat4RotationRadians(Rotation, RotationAxes);
-        Translate(&R, Translation);
-        return R;
+    FM_FUN UnpackOctahedralArray(const uint16_t* In, vec3* Out, size_t Count) -> void {
+        priv::UnpackOctahedralV3Array(In, Out, Count);
     }
-    FM_FUN_SIC Mat4TranslationRotationDegrees(v3 Translation, float Rotation, v3 RotationAxes) -> mat4 {
-        return Mat4TranslationRotationRadians(Translation, DegreesToRadians(Rotation), RotationAxes);
+    FM_FUN UnpackOctahedralArray(const uint32_t* In, vec3* Out, size_t Count) -> void {
+        priv::UnpackOctahedralV3Array(In, Out, Count);
     }
-    FM_FUN_SIC Mat4TranslationRotationDegrees(vec3 Translation, float Rotation, vec3 RotationAxes) -> mat4 {
-        return Mat4TranslationRotationRadians(Translation, DegreesToRadians(Rotation), RotationAxes);
+    namespace priv {
+        enum norm_format {
+            NormFormat_Unorm8,
+            NormFormat_Snorm8,
+            NormFormat_Unorm16,
+            NormFormat_Snorm16
+        };
+        // NOTE: Converts 4 pixels, 16 floats on one side and 16 or 32 bytes on the other
+        template<norm_format Format> FM_SINL void FM_CALL PackNorm4(const float* In, uint8_t* Out) {
+            __m128 A = _mm_loadu_ps(In), B = _mm_loadu_ps(In + 4), C = _mm_loadu_ps(In + 8), D = _mm_loadu_ps(In + 12);
+            if constexpr(Format == NormFormat_Unorm8)
+                _mm_storeu_si128((__m128i*)Out, Unorm8FromFloat16(A, B, C, D));
+            else if constexpr(Format == NormFormat_Snorm8)
+                _mm_storeu_si128((__m128i*)Out, Snorm8FromFloat16(A, B, C, D));
+            else if constexpr(Format == NormFormat_Unorm16)
+            {
+                _mm_storeu_si128((__m128i*)Out, Unorm16FromFloat8(A, B));
+                _mm_storeu_si128((__m128i*)Out + 1, Unorm16FromFloat8(C, D));
+            }
+            else
+            {
+                _mm_storeu_si128((__m128i*)Out, Snorm16FromFloat8(A, B));
+                _mm_storeu_si128((__m128i*)Out + 1, Snorm16FromFloat8(C, D));
+            }
+        }
+        template<norm_format Format> FM_SINL void FM_CALL UnpackNorm4(const uint8_t* In, float* Out) {
+            __m128 A, B, C, D;
+            if constexpr(Format == NormFormat_Unorm8)
+                Float16FromUnorm8(_mm_loadu_si128((const __m128i*)In), &A, &B, &C, &D);
+            else if constexpr(Format == NormFormat_Snorm8)
+                Float16FromSnorm8(_mm_loadu_si128((const __m128i*)In), &A, &B, &C, &D);
+            else if constexpr(Format == NormFormat_Unorm16)
+            {
+                Float8FromUnorm16(_mm_loadu_si128((const __m128i*)In), &A, &B);
+                Float8FromUnorm16(_mm_loadu_si128((const __m128i*)In + 1), &C, &D);
+            }
+            else
+            {
+                Float8FromSnorm16(_mm_loadu_si128((const __m128i*)In), &A, &B);
+                Float8FromSnorm16(_mm_loadu_si128((const __m128i*)In + 1), &C, &D);
+            }
+            _mm_storeu_ps(Out, A);
+            _mm_storeu_ps(Out + 4, B);
+            _mm_storeu_ps(Out + 8, C);
+            _mm_storeu_ps(Out + 12, D);
+        }
+        // NOTE: Count is in pixels, the tail goes through zero padded local copies
+        template<norm_format Format> static auto PackNormArray(const float* In, void* Out, size_t Count) -> void {
+            constexpr size_t PixelSize = Format == NormFormat_Unorm8 || Format == NormFormat_Snorm8 ? 4 : 8;
+            uint8_t* Bytes = (uint8_t*)Out;
+            size_t WholeCount = Count - Count % 4;
+            for(size_t i = 0; i < WholeCount; i += 4)
+                PackNorm4<Format>(In + i*4, Bytes + i*PixelSize);
+            if(WholeCount < Count)
+            {
+                float TailIn[16] = {};
+                uint8_t TailOut[4 * PixelSize];
+                memcpy(TailIn, In + WholeCount*4, (Count - WholeCount) * 4 * sizeof(float));
+                PackNorm4<Format>(TailIn, TailOut);
+                memcpy(Bytes + WholeCount*PixelSize, TailOut, (Count - WholeCount) * PixelSize);
+            }
+        }
+        template<norm_format Format> static auto UnpackNormArray(const void* In, float* Out, size_t Count) -> void {
+            constexpr size_t PixelSize = Format == NormFormat_Unorm8 || Format == NormFormat_Snorm8 ? 4 : 8;
+            const uint8_t* Bytes = (const uint8_t*)In;
+            size_t WholeCount = Count - Count % 4;
+            for(size_t i = 0; i < WholeCount; i += 4)
+                UnpackNorm4<Format>(Bytes + i*PixelSize, Out + i*4);
+            if(WholeCount < Count)
+            {
+                uint8_t TailIn[4 * PixelSize] = {};
+                float TailOut[16];
+                memcpy(TailIn, Bytes + WholeCount*PixelSize, (Count - WholeCount) * PixelSize);
+                UnpackNorm4<Format>(TailIn, TailOut);
+                memcpy(Out + WholeCount*4, TailOut, (Count - WholeCount) * 4 * sizeof(float));
+            }
+        }
     }
-    FM_FUN_SIC Mat4ScaleRotationRadians(v3 Scale, float Rotation, v3 RotationAxes) -> mat4 {
-        mat4 R = Mat4Scale(Scale);
-        RotateRadians(&R, Rotation, RotationAxes);
-        return R;
+    FM_FUN PackUnorm8Array(const v4* In, v4u8* Out, size_t Count) -> void {
+        priv::PackNormArray<priv::NormFormat_Unorm8>((const float*)In, Out, Count);
     }
-    FM_FUN_SIC Mat4ScaleRotationRadians(vec3 Scale, float Rotation, vec3 RotationAxes) -> mat4 {
-        mat4 R = Mat4Scale(Scale);
-        RotateRadians(&R, Rotation, RotationAxes);
-        return R;
+    FM_FUN PackUnorm8Array(const vec4* In, v4u8* Out, size_t Count) -> void {
+        priv::PackNormArray<priv::NormFormat_Unorm8>((const float*)In, Out, Count);
     }
-    FM_FUN_SIC Mat4ScaleRotationDegrees(v3 Scale, float Rotation, v3 RotationAxes) -> mat4 {
-        return Mat4ScaleRotationRadians(Scale, DegreesToRadians(Rotation), RotationAxes);
+    FM_FUN PackSnorm8Array(const v4* In, v4i8* Out, size_t Count) -> void {
+        priv::PackNormArray<priv::NormFormat_Snorm8>((const float*)In, Out, Count);
     }
-    FM_FUN_SIC Mat4ScaleRotationDegrees(vec3 Scale, float Rotation, vec3 RotationAxes) -> mat4 {
-        return Mat4ScaleRotationRadians(Scale, DegreesToRadians(Rotation), RotationAxes);
+    FM_FUN PackSnorm8Array(const vec4* In, v4i8* Out, size_t Count) -> void {
+        priv::PackNormArray<priv::NormFormat_Snorm8>((const float*)In, Out, Count);
     }
-    FM_FUN_SIC Mat4OrthographicTopDown(rect2 A) -> mat4 {
-        FM_Rect2ToMinMax(A, Min, Max);
-        return Mat4Orthographic(Min.X, Max.X, Max.Y, Min.Y);
+    FM_FUN PackUnorm16Array(const v4* In, v4u16* Out, size_t Count) -> void {
+        priv::PackNormArray<priv::NormFormat_Unorm16>((const float*)In, Out, Count);
     }
-    FM_FUN_SIC Mat4OrthographicBottomUp(rect2 A) -> mat4 {
-        FM_Rect2ToMinMax(A, Min, Max);
-        return Mat4Orthographic(Min.X, Max.X, Min.Y, Max.Y);
+    FM_FUN PackUnorm16Array(const vec4* In, v4u16* Out, size_t Count) -> void {
+        priv::PackNormArray<priv::NormFormat_Unorm16>((const float*)In, Out, Count);
     }
-    
-    //////////////////////////////////////
-    // invalid values - fast math types //
-    //////////////////////////////////////
-    static const v2 InvalidV2 = v2(InvalidF32, InvalidF32);
-    static const v3 InvalidV3 = v3(InvalidF32, InvalidF32, InvalidF32);
-    static const v4 InvalidV4 = v4(InvalidF32, InvalidF32, InvalidF32, InvalidF32);
-    static const v2d InvalidV2d = v2d(InvalidF64, InvalidF64);
-    static const v3d InvalidV3d = v3d(InvalidF64, InvalidF64, InvalidF64);
-    static const v4d InvalidV4d = v4d(InvalidF64, InvalidF64, InvalidF64, InvalidF64);
-    static const v2i InvalidV2i = v2i(InvalidI32, InvalidI32);
-    static const v3i InvalidV3i = v3i(InvalidI32, InvalidI32, InvalidI32);
-    static const v4i InvalidV4i = v4i(InvalidI32, InvalidI32, InvalidI32, InvalidI32);
-    static const v2u InvalidV2u = v2u(InvalidU32, InvalidU32);
-    static const v3u InvalidV3u = v3u(InvalidU32, InvalidU32, InvalidU32);
-    static const v4u InvalidV4u = v4u(InvalidU32, InvalidU32, InvalidU32, InvalidU32);
-    static const v2u16 InvalidV2u16 = v2u16(InvalidU16, InvalidU16);
-    static const v3u16 InvalidV3u16 = v3u16(InvalidU16, InvalidU16, InvalidU16);
-    static const v4u16 InvalidV4u16 = v4u16(InvalidU16, InvalidU16, InvalidU16, InvalidU16);
-    static const v2u8 InvalidV2u8 = v2u8(1, 111);
-    static const v3u8 InvalidV3u8 = v3u8(1, 111, 222);
-    static const v4u8 InvalidV4u8 = v4u8(1, 111, 222, 33);
-    static const rect2 InvalidRect2 = Rect2MinMax(InvalidF32, InvalidF32, InvalidF32, InvalidF32);
-    static const rect2d InvalidRect2d = Rect2dMinMax(InvalidF64, InvalidF64, InvalidF64, InvalidF64);
-    static const rect2i InvalidRect2i = Rect2iMinMax(InvalidI32, InvalidI32, InvalidI32, InvalidI32);
-    static const rect2u InvalidRect2u = Rect2uMinMax(InvalidU32, InvalidU32, InvalidU32, InvalidU32);
-    static const mat4 InvalidMat4 = Mat4Diagonal(InvalidF32, InvalidF32, InvalidF32, InvalidF32);
-    
-    FM_FUN_SI IsValid(uint16_t A) -> bool {
-        return A != InvalidU16;
+    FM_FUN PackSnorm16Array(const v4* In, v4i16* Out, size_t Count) -> void {
+        priv::PackNormArray<priv::NormFormat_Snorm16>((const float*)In, Out, Count);
     }
-    FM_FUN_SI IsValid(uint32_t A) -> bool {
-        return A != InvalidU32;
+    FM_FUN PackSnorm16Array(const vec4* In, v4i16* Out, size_t Count) -> void {
+        priv::PackNormArray<priv::NormFormat_Snorm16>((const float*)In, Out, Count);
     }
-    FM_FUN_SI IsValid(uint64_t A) -> bool {
-        return A != InvalidU64;
+    FM_FUN UnpackUnorm8Array(const v4u8* In, v4* Out, size_t Count) -> void {
+        priv::UnpackNormArray<priv::NormFormat_Unorm8>(In, (float*)Out, Count);
     }
-    FM_FUN_SI IsValid(int16_t A) -> bool {
-        return A != InvalidI16;
+    FM_FUN UnpackUnorm8Array(const v4u8* In, vec4* Out, size_t Count) -> void {
+        priv::UnpackNormArray<priv::NormFormat_Unorm8>(In, (float*)Out, Count);
     }
-    FM_FUN_SI IsValid(int32_t A) -> bool {
-        return A != InvalidI32;
+    FM_FUN UnpackSnorm8Array(const v4i8* In, v4* Out, size_t Count) -> void {
+        priv::UnpackNormArray<priv::NormFormat_Snorm8>(In, (float*)Out, Count);
     }
-    FM_FUN_SI IsValid(int64_t A) -> bool {
-        return A != InvalidI64;
+    FM_FUN UnpackSnorm8Array(const v4i8* In, vec4* Out, size_t Count) -> void {
+        priv::UnpackNormArray<priv::NormFormat_Snorm8>(In, (float*)Out, Count);
     }
-    FM_FUN_SI IsValid(float A) -> bool {
-        return A != InvalidF32;
+    FM_FUN UnpackUnorm16Array(const v4u16* In, v4* Out, size_t Count) -> void {
+        priv::UnpackNormArray<priv::NormFormat_Unorm16>(In, (float*)Out, Count);
     }
-    FM_FUN_SI IsValid(double A) -> bool {
-        return A != InvalidF64;
+    FM_FUN UnpackUnorm16Array(const v4u16* In, vec4* Out, size_t Count) -> void {
+        priv::UnpackNormArray<priv::NormFormat_Unorm16>(In, (float*)Out, Count);
     }
-    FM_FUN_SI IsValid(v2 A) -> bool {
-        return A.X != InvalidF32;
+    FM_FUN UnpackSnorm16Array(const v4i16* In, v4* Out, size_t Count) -> void {
+        priv::UnpackNormArray<priv::NormFormat_Snorm16>(In, (float*)Out, Count);
     }
-    FM_FUN_SI IsValid(v2d A) -> bool {
-        return A.X != InvalidF64;
+    FM_FUN UnpackSnorm16Array(const v4i16* In, vec4* Out, size_t Count) -> void {
+        priv::UnpackNormArray<priv::NormFormat_Snorm16>(In, (float*)Out, Count);
     }
-    FM_FUN_SI IsValid(v2i A) -> bool {
-        return A.X != InvalidI32;
+    namespace priv {
+        // NOTE: Ln and Exp in double for the constexpr table, X is split into M * 2^E with M in [0.5, 1)
+        FM_FUN_SIE ConstexprLn(double X) -> double {
+            double E = 0.0;
+            while(X < 0.5) { X *= 2.0; E -= 1.0; }
+            while(X >= 1.0) { X *= 0.5; E += 1.0; }
+            double Z = (X - 1.0) / (X + 1.0);
+            double Z2 = Z * Z, Term = Z, Sum = 0.0;
+            for(int32_t i = 1; i < 60; i += 2)
+            {
+                Sum += Term / i;
+                Term *= Z2;
+            }
+            return 2.0 * Sum + E * 0.69314718055994530942;
+        }
+        FM_FUN_SIE ConstexprExp(double X) -> double {
+            double Sum = 1.0, Term = 1.0;
+            for(int32_t i = 1; i < 40; ++i)
+            {
+                Term *= X / i;
+                Sum += Term;
+            }
+            return Sum;
+        }
+        FM_FUN_SIE MakeSrgb8ToLinearTable() -> srgb8_table {
+            srgb8_table R = {};
+            for(int32_t i = 0; i < 256; ++i)
+            {
+                double C = i / 255.0;
+                R.Values[i] = C <= 0.04045 ? (float)(C / 12.92) : (float)ConstexprExp(2.4 * ConstexprLn((C + 0.055) / 1.055));
+            }
+            return R;
+        }
+        constinit const srgb8_table Srgb8ToLinearTable = MakeSrgb8ToLinearTable();
+        
+        // NOTE: 4 pixels per iteration so PackSrgb8Array can narrow them with one packuswb
+        template<bool ToLinear> static auto SrgbArray(const float* In, float* Out, size_t Count) -> void {
+            for(size_t i = 0; i < Count; ++i)
+            {
+                __m128 V = _mm_loadu_ps(In + i*4);
+                __m128 R = ToLinear ? SrgbToLinearLanes<4>(V) : LinearToSrgbLanes<4>(V);
+                _mm_storeu_ps(Out + i*4, KeepAlpha(R, V));
+            }
+        }
+        static auto PackSrgb8Array(const float* In, v4u8* Out, size_t Count) -> void {
+            size_t WholeCount = Count - Count % 4;
+            for(size_t i = 0; i < WholeCount; i += 4)
+            {
+                __m128 Color[4];
+                for(uint32_t j = 0; j < 4; ++j)
+                {
+                    __m128 V = _mm_loadu_ps(In + (i + j)*4);
+                    Color[j] = KeepAlpha(LinearToSrgbLanes<4>(V), V);
+                }
+                _mm_storeu_si128((__m128i*)(Out + i), Unorm8FromFloat16(Color[0], Color[1], Color[2], Color[3]));
+            }
+            for(size_t i = WholeCount; i < Count; ++i)
+                Out[i] = PackSrgb8(Vec4FromMemory(In + i*4));
+        }
+        static auto UnpackSrgb8Array(const v4u8* In, float* Out, size_t Count) -> void {
+            const float* Table = Srgb8ToLinearTable.Values;
+            for(size_t i = 0; i < Count; ++i)
+            {
+                Out[i*4] = Table[In[i].X];
+                Out[i*4 + 1] = Table[In[i].Y];
+                Out[i*4 + 2] = Table[In[i].Z];
+                Out[i*4 + 3] = (float)In[i].W / 255.f;
+            }
+        }
     }
-    FM_FUN_SI IsValid(v2u A) -> bool {
-        return A.X != InvalidU32;
+    FM_FUN SrgbToLinearArray(const v4* In, v4* Out, size_t Count) -> void {
+        priv::SrgbArray<true>((const float*)In, (float*)Out, Count);
     }
-    FM_FUN_SI IsValid(v2u16 A) -> bool {
-        return A.X != InvalidU16;
+    FM_FUN SrgbToLinearArray(const vec4* In, vec4* Out, size_t Count) -> void {
+        priv::SrgbArray<true>((const float*)In, (float*)Out, Count);
     }
-    FM_FUN_SI IsValid(v2u8 A) -> bool {
-        return A != InvalidV2u8;
+    FM_FUN LinearToSrgbArray(const v4* In, v4* Out, size_t Count) -> void {
+        priv::SrgbArray<false>((const float*)In, (float*)Out, Count);
     }
-    FM_FUN_SI IsValid(v3 A) -> bool {
-        return A.X != InvalidF32;
+    FM_FUN LinearToSrgbArray(const vec4* In, vec4* Out, size_t Count) -> void {
+        priv::SrgbArray<false>((const float*)In, (float*)Out, Count);
     }
-    FM_FUN_SI IsValid(v3d A) -> bool {
-        return A.X != InvalidF64;
+    FM_FUN PackSrgb8Array(const v4* In, v4u8* Out, size_t Count) -> void {
+        priv::PackSrgb8Array((const float*)In, Out, Count);
     }
-    FM_FUN_SI IsValid(v3i A) -> bool {
-        return A.X != InvalidI32;
+    FM_FUN PackSrgb8Array(const vec4* In, v4u8* Out, size_t Count) -> void {
+        priv::PackSrgb8Array((const float*)In, Out, Count);
     }
-    FM_FUN_SI IsValid(v3u A) -> bool {
-        return A.X != InvalidU32;
+    FM_FUN UnpackSrgb8Array(const v4u8* In, v4* Out, size_t Count) -> void {
+        priv::UnpackSrgb8Array(In, (float*)Out, Count);
     }
-    FM_FUN_SI IsValid(v3u16 A) -> bool {
-        return A.X != InvalidU16;
+    FM_FUN UnpackSrgb8Array(const v4u8* In, vec4* Out, size_t Count) -> void {
+        priv::UnpackSrgb8Array(In, (float*)Out, Count);
     }
-    FM_FUN_SI IsValid(v3u8 A) -> bool {
-        return A != InvalidV3u8;
+    FM_FUN_C TransformPoints(mat4 M, const v3* In, v3* Out, size_t Count) -> void {
+        priv::Dispatch().Transform(&M, priv::TransformLayout_V3, 1.f, false, (const float*)In, (float*)Out, Count);
     }
-    FM_FUN_SI IsValid(v4 A) -> bool {
-        return A.X != InvalidF32;
+    FM_FUN_C TransformPoints(mat4 M, const vec3* In, vec3* Out, size_t Count) -> void {
+        priv::Dispatch().Transform(&M, priv::TransformLayout_Vec3, 1.f, false, (const float*)In, (float*)Out, Count);
     }
-    FM_FUN_SI IsValid(v4d A) -> bool {
-        return A.X != InvalidF64;
+    FM_FUN_C TransformPoints(mat4 M, const v4* In, v4* Out, size_t Count) -> void {
+        priv::Dispatch().Transform(&M, priv::TransformLayout_V4, 1.f, false, (const float*)In, (float*)Out, Count);
     }
-    FM_FUN_SI IsValid(v4i A) -> bool {
-        return A.X != InvalidI32;
+    FM_FUN_C TransformPoints(mat4 M, const vec4* In, vec4* Out, size_t Count) -> void {
+        priv::Dispatch().Transform(&M, priv::TransformLayout_V4, 1.f, false, (const float*)In, (float*)Out, Count);
     }
-    FM_FUN_SI IsValid(v4u A) -> bool {
-        return A.X != InvalidU32;
+    FM_FUN_C TransformDirections(mat4 M, const v3* In, v3* Out, size_t Count) -> void {
+        priv::Dispatch().Transform(&M, priv::TransformLayout_V3, 0.f, false, (const float*)In, (float*)Out, Count);
     }
-    FM_FUN_SI IsValid(v4u16 A) -> bool {
-        return A.X != InvalidU16;
+    FM_FUN_C TransformDirections(mat4 M, const vec3* In, vec3* Out, size_t Count) -> void {
+        priv::Dispatch().Transform(&M, priv::TransformLayout_Vec3, 0.f, false, (const float*)In, (float*)Out, Count);
     }
-    FM_FUN_SI IsValid(v4u8 A) -> bool {
-        return A != InvalidV4u8;
+    FM_FUN_C TransformDirections(mat4 M, const v4* In, v4* Out, size_t Count) -> void {
+        priv::Dispatch().Transform(&M, priv::TransformLayout_V4, 0.f, false, (const float*)In, (float*)Out, Count);
     }
-    FM_FUN_SI IsValid(rect2 A) -> bool {
-        return A.Min.X != InvalidF32;
+    FM_FUN_C TransformDirections(mat4 M, const vec4* In, vec4* Out, size_t Count) -> void {
+        priv::Dispatch().Transform(&M, priv::TransformLayout_V4, 0.f, false, (const float*)In, (float*)Out, Count);
     }
-    FM_FUN_SI IsValid(rect2d A) -> bool {
-        return A.Min.X != InvalidF64;
+    FM_FUN_C TransformAndProjectPoints(mat4 M, const v3* In, v3* Out, size_t Count) -> void {
+        priv::Dispatch().Transform(&M, priv::TransformLayout_V3, 1.f, true, (const float*)In, (float*)Out, Count);
     }
-    FM_FUN_SI IsValid(rect2i A) -> bool {
-        return A.Min.X != InvalidI32;
+    FM_FUN_C TransformAndProjectPoints(mat4 M, const vec3* In, vec3* Out, size_t Count) -> void {
+        priv::Dispatch().Transform(&M, priv::TransformLayout_Vec3, 1.f, true, (const float*)In, (float*)Out, Count);
     }
-    FM_FUN_SI IsValid(rect2u A) -> bool {
-        return A.Min.X != InvalidU32;
+    FM_FUN_C TransformAndProjectPoints(mat4 M, const v4* In, v4* Out, size_t Count) -> void {
+        priv::Dispatch().Transform(&M, priv::TransformLayout_V4, 1.f, true, (const float*)In, (float*)Out, Count);
     }
-    FM_FUN_SI IsValid(mat4 A) -> bool {
-        return A[0] != InvalidF32;
+    FM_FUN_C TransformAndProjectPoints(mat4 M, const vec4* In, vec4* Out, size_t Count) -> void {
+        priv::Dispatch().Transform(&M, priv::TransformLayout_V4, 1.f, true, (const float*)In, (float*)Out, Count);
     }
     
-}
-
-#endif // FAST_MATH_H
-
-#ifndef FM_IMPLEMENTATION_ALREADY_DEFINED
-#ifdef FM_IMPLEMENTATION
-#define FM_IMPLEMENTATION_ALREADY_DEFINED
-
-namespace fm {
+    // NOTE: The inverse works on 2x2 blocks of M, every __m128 holds one block as (00, 01, 10, 11).
+    //       The block formulas don't depend on the storage order, so the columns are used as they are.
+    namespace priv {
+        FM_SINL __m128 FM_CALL Mat2Mul(__m128 A, __m128 B) {
+            return _mm_add_ps(_mm_mul_ps(A, _mm_shuffle_ps(B, B, _MM_SHUFFLE(3, 0, 3, 0))),
+                              _mm_mul_ps(_mm_shuffle_ps(A, A, _MM_SHUFFLE(2, 3, 0, 1)), _mm_shuffle_ps(B, B, _MM_SHUFFLE(1, 2, 1, 2))));
+        }
+        // NOTE: Adjugate(A) * B
+        FM_SINL __m128 FM_CALL Mat2AdjMul(__m128 A, __m128 B) {
+            return _mm_sub_ps(_mm_mul_ps(_mm_shuffle_ps(A, A, _MM_SHUFFLE(0, 0, 3, 3)), B),
+                              _mm_mul_ps(_mm_shuffle_ps(A, A, _MM_SHUFFLE(2, 2, 1, 1)), _mm_shuffle_ps(B, B, _MM_SHUFFLE(1, 0, 3, 2))));
+        }
+        // NOTE: A * Adjugate(B)
+        FM_SINL __m128 FM_CALL Mat2MulAdj(__m128 A, __m128 B) {
+            return _mm_sub_ps(_mm_mul_ps(A, _mm_shuffle_ps(B, B, _MM_SHUFFLE(0, 3, 0, 3))),
+                              _mm_mul_ps(_mm_shuffle_ps(A, A, _MM_SHUFFLE(2, 3, 0, 1)), _mm_shuffle_ps(B, B, _MM_SHUFFLE(1, 2, 1, 2))));
+        }
+        struct mat4_blocks
+        {
+            __m128 A, B, C, D;
+            __m128 DetA, DetB, DetC, DetD;
+            __m128 AdjAB, AdjDC;
+            __m128 Det;
+        };
+        FM_SINL mat4_blocks FM_CALL Mat4Blocks(const mat4& M) {
+            mat4_blocks R;
+            R.A = _mm_movelh_ps(M.Columns[0], M.Columns[1]);
+            R.B = _mm_movehl_ps(M.Columns[1], M.Columns[0]);
+            R.C = _mm_movelh_ps(M.Columns[2], M.Columns[3]);
+            R.D = _mm_movehl_ps(M.Columns[3], M.Columns[2]);
+            
+            // NOTE: (|A|, |B|, |C|, |D|)
+            __m128 BlockDets = _mm_sub_ps(
+                _mm_mul_ps(_mm_shuffle_ps(M.Columns[0], M.Columns[2], _MM_SHUFFLE(2, 0, 2, 0)),
+                           _mm_shuffle_ps(M.Columns[1], M.Columns[3], _MM_SHUFFLE(3, 1, 3, 1))),
+                _mm_mul_ps(_mm_shuffle_ps(M.Columns[0], M.Columns[2], _MM_SHUFFLE(3, 1, 3, 1)),
+                           _mm_shuffle_ps(M.Columns[1], M.Columns[3], _MM_SHUFFLE(2, 0, 2, 0))));
+            R.DetA = _mm_shuffle_ps(BlockDets, BlockDets, _MM_SHUFFLE(0, 0, 0, 0));
+            R.DetB = _mm_shuffle_ps(BlockDets, BlockDets, _MM_SHUFFLE(1, 1, 1, 1));
+            R.DetC = _mm_shuffle_ps(BlockDets, BlockDets, _MM_SHUFFLE(2, 2, 2, 2));
+            R.DetD = _mm_shuffle_ps(BlockDets, BlockDets, _MM_SHUFFLE(3, 3, 3, 3));
+            
+            R.AdjDC = Mat2AdjMul(R.D, R.C);
+            R.AdjAB = Mat2AdjMul(R.A, R.B);
+            
+            // NOTE: |M| = |A||D| + |B||C| - tr(Adj(A)B Adj(D)C)
+            __m128 Trace = SplatSum<4>(_mm_mul_ps(R.AdjAB, _mm_shuffle_ps(R.AdjDC, R.AdjDC, _MM_SHUFFLE(3, 1, 2, 0))));
+            R.Det = _mm_sub_ps(_mm_add_ps(_mm_mul_ps(R.DetA, R.DetD), _mm_mul_ps(R.DetB, R.DetC)), Trace);
+            return R;
+        }
+        // NOTE: Turns the inverse of the upper 3x3 and the translation T into -(Inverse * T) with W = 1
+        FM_SINL __m128 FM_CALL InverseTranslation(const mat4& Inv, __m128 T) {
+            __m128 R = _mm_mul_ps(Inv.Columns[0], _mm_shuffle_ps(T, T, _MM_SHUFFLE(0, 0, 0, 0)));
+            R = _mm_add_ps(R, _mm_mul_ps(Inv.Columns[1], _mm_shuffle_ps(T, T, _MM_SHUFFLE(1, 1, 1, 1))));
+            R = _mm_add_ps(R, _mm_mul_ps(Inv.Columns[2], _mm_shuffle_ps(T, T, _MM_SHUFFLE(2, 2, 2, 2))));
+            return _mm_sub_ps(_mm_setr_ps(0.f, 0.f, 0.f, 1.f), R);
+        }
+    }
     
     ////////////////////////////////
     // not inlined mat4 functions //
     ////////////////////////////////
-    FM_FUN_C operator*(mat4 A, mat4 B) -> mat4 {
-        __m128 Row;
-		
-        Row = _mm_setr_ps(priv::GetX(A.Columns[0]), priv::GetX(A.Columns[1]),
-                          priv::GetX(A.Columns[2]), priv::GetX(A.Columns[3]));
-        float R11 = priv::SumOfElements(_mm_mul_ps(Row, B.Columns[0]));
-        float R12 = priv::SumOfElements(_mm_mul_ps(Row, B.Columns[1]));
-        float R13 = priv::SumOfElements(_mm_mul_ps(Row, B.Columns[2]));
-        float R14 = priv::SumOfElements(_mm_mul_ps(Row, B.Columns[3]));
-		
-        Row = _mm_setr_ps(priv::GetY(A.Columns[0]), priv::GetY(A.Columns[1]),
-                          priv::GetY(A.Columns[2]), priv::GetY(A.Columns[3]));
-        float R21 = priv::SumOfElements(_mm_mul_ps(Row, B.Columns[0]));
-        float R22 = priv::SumOfElements(_mm_mul_ps(Row, B.Columns[1]));
-        float R23 = priv::SumOfElements(_mm_mul_ps(Row, B.Columns[2]));
-        float R24 = priv::SumOfElements(_mm_mul_ps(Row, B.Columns[3]));
-		
-        Row = _mm_setr_ps(priv::GetZ(A.Columns[0]), priv::GetZ(A.Columns[1]),
-                          priv::GetZ(A.Columns[2]), priv::GetZ(A.Columns[3]));
-        float R31 = priv::SumOfElements(_mm_mul_ps(Row, B.Columns[0]));
-        float R32 = priv::SumOfElements(_mm_mul_ps(Row, B.Columns[1]));
-        float R33 = priv::SumOfElements(_mm_mul_ps(Row, B.Columns[2]));
-        float R34 = priv::SumOfElements(_mm_mul_ps(Row, B.Columns[3]));
-		
-        Row = _mm_setr_ps(priv::GetW(A.Columns[0]), priv::GetW(A.Columns[1]),
-                          priv::GetW(A.Columns[2]), priv::GetW(A.Columns[3]));
-        float R41 = priv::SumOfElements(_mm_mul_ps(Row, B.Columns[0]));
-        float R42 = priv::SumOfElements(_mm_mul_ps(Row, B.Columns[1]));
-        float R43 = priv::SumOfElements(_mm_mul_ps(Row, B.Columns[2]));
-        float R44 = priv::SumOfElements(_mm_mul_ps(Row, B.Columns[3]));
-		
-        return Mat4FromColumns(
-                               R11, R21, R31, R41,
-                               R12, R22, R32, R42,
-                               R13, R23, R33, R43,
-                               R14, R24, R34, R44);
+    FM_FLATTEN FM_FUN_C operator*(mat4 A, mat4 B) -> mat4 {
+        mat4 R;
+        priv::Dispatch().Mat4Mul(&A, &B, &R);
+        return R;
+    }
+    FM_FUN_C RotateAroundXAxisRadians(mat4* M, float Radians) -> void {
+        float S, C;
+        SinCos(Radians, &S, &C);
+        __m128 Unused = _mm_setzero_ps();
+        priv::Dispatch().Mat4MulColumns(M, 6, Unused, _mm_setr_ps(0.f, C, S, 0.f), _mm_setr_ps(0.f, -S, C, 0.f));
+    }
+    FM_FUN_C RotateAroundYAxisRadians(mat4* M, float Radians) -> void {
+        float S, C;
+        SinCos(Radians, &S, &C);
+        __m128 Unused = _mm_setzero_ps();
+        priv::Dispatch().Mat4MulColumns(M, 5, _mm_setr_ps(C, 0.f, -S, 0.f), Unused, _mm_setr_ps(S, 0.f, C, 0.f));
+    }
+    FM_FUN_C RotateAroundZAxisRadians(mat4* M, float Radians) -> void {
+        float S, C;
+        SinCos(Radians, &S, &C);
+        __m128 Unused = _mm_setzero_ps();
+        priv::Dispatch().Mat4MulColumns(M, 3, _mm_setr_ps(C, S, 0.f, 0.f), _mm_setr_ps(-S, C, 0.f, 0.f), Unused);
+    }
+    FM_FUN_C ShearXAxis(mat4* M, float Y, float Z) -> void {
+        __m128 Unused = _mm_setzero_ps();
+        priv::Dispatch().Mat4MulColumns(M, 1, _mm_setr_ps(1.f, Y, Z, 0.f), Unused, Unused);
+    }
+    FM_FUN_C ShearYAxis(mat4* M, float X, float Z) -> void {
+        __m128 Unused = _mm_setzero_ps();
+        priv::Dispatch().Mat4MulColumns(M, 2, Unused, _mm_setr_ps(X, 1.f, Z, 0.f), Unused);
+    }
+    FM_FUN_C ShearZAxis(mat4* M, float X, float Y) -> void {
+        __m128 Unused = _mm_setzero_ps();
+        priv::Dispatch().Mat4MulColumns(M, 4, Unused, Unused, _mm_setr_ps(X, Y, 1.f, 0.f));
+    }
+    FM_FUN_C Shear(mat4* M, float XY, float XZ, float YX, float YZ, float ZX, float ZY) -> void {
+        priv::Dispatch().Mat4MulColumns(M, 7, _mm_setr_ps(1.f, XY, XZ, 0.f), _mm_setr_ps(YX, 1.f, YZ, 0.f), _mm_setr_ps(ZX, ZY, 1.f, 0.f));
+    }
+    FM_FLATTEN FM_FUN_C Determinant(mat4 M) -> float {
+        return _mm_cvtss_f32(priv::Mat4Blocks(M).Det);
+    }
+    FM_FLATTEN FM_FUN_C Inverse(mat4 M) -> mat4 {
+        priv::mat4_blocks Blocks = priv::Mat4Blocks(M);
+        
+        // NOTE: Inverse(M) = 1/|M| * | X Y |, every block below is the adjugate of the final one
+        //                            | Z W |
+        __m128 X = _mm_sub_ps(_mm_mul_ps(Blocks.DetD, Blocks.A), priv::Mat2Mul(Blocks.B, Blocks.AdjDC));
+        __m128 W = _mm_sub_ps(_mm_mul_ps(Blocks.DetA, Blocks.D), priv::Mat2Mul(Blocks.C, Blocks.AdjAB));
+        __m128 Y = _mm_sub_ps(_mm_mul_ps(Blocks.DetB, Blocks.C), priv::Mat2MulAdj(Blocks.D, Blocks.AdjAB));
+        __m128 Z = _mm_sub_ps(_mm_mul_ps(Blocks.DetC, Blocks.B), priv::Mat2MulAdj(Blocks.A, Blocks.AdjDC));
+        
+        __m128 InvDet = _mm_div_ps(_mm_setr_ps(1.f, -1.f, -1.f, 1.f), Blocks.Det);
+        X = _mm_mul_ps(X, InvDet);
+        Y = _mm_mul_ps(Y, InvDet);
+        Z = _mm_mul_ps(Z, InvDet);
+        W = _mm_mul_ps(W, InvDet);
+        
+        // NOTE: Taking the adjugates and putting the blocks back in place are merged into these shuffles
+        mat4 R;
+        R.Columns[0] = _mm_shuffle_ps(X, Y, _MM_SHUFFLE(1, 3, 1, 3));
+        R.Columns[1] = _mm_shuffle_ps(X, Y, _MM_SHUFFLE(0, 2, 0, 2));
+        R.Columns[2] = _mm_shuffle_ps(Z, W, _MM_SHUFFLE(1, 3, 1, 3));
+        R.Columns[3] = _mm_shuffle_ps(Z, W, _MM_SHUFFLE(0, 2, 0, 2));
+        return R;
+    }
+    FM_FLATTEN FM_FUN_C InverseAffine(mat4 M) -> mat4 {
+        __m128 Zero = _mm_setzero_ps();
+        __m128 XYZMask = _mm_castsi128_ps(_mm_setr_epi32(-1, -1, -1, 0));
+        __m128 C0 = _mm_and_ps(M.Columns[0], XYZMask);
+        __m128 C1 = _mm_and_ps(M.Columns[1], XYZMask);
+        __m128 C2 = _mm_and_ps(M.Columns[2], XYZMask);
+        
+        // NOTE: Rows of the inverse of the upper 3x3 are the cross products of its columns divided by the determinant
+        __m128 Row0 = priv::Cross3(C1, C2);
+        __m128 Row1 = priv::Cross3(C2, C0);
+        __m128 Row2 = priv::Cross3(C0, C1);
+        __m128 InvDet = _mm_div_ps(_mm_set1_ps(1.f), priv::SplatSum<4>(_mm_mul_ps(C0, Row0)));
+        
+        mat4 R;
+        R.Columns[0] = _mm_mul_ps(Row0, InvDet);
+        R.Columns[1] = _mm_mul_ps(Row1, InvDet);
+        R.Columns[2] = _mm_mul_ps(Row2, InvDet);
+        R.Columns[3] = Zero;
+        _MM_TRANSPOSE4_PS(R.Columns[0], R.Columns[1], R.Columns[2], R.Columns[3]);
+        R.Columns[3] = priv::InverseTranslation(R, M.Columns[3]);
+        return R;
     }
-    FM_FUN Mat4Orthographic(float Left, float Right, float Bottom, float Top, float Near, float Far) -> mat4 {
+    FM_FLATTEN FM_FUN_C InverseRigid(mat4 M) -> mat4 {
+        // NOTE: The inverse of a rotation is its transpose, the W of the first 3 columns is 0
+        __m128 T0 = _mm_movelh_ps(M.Columns[0], M.Columns[1]);
+        __m128 T1 = _mm_movehl_ps(M.Columns[1], M.Columns[0]);
+        mat4 R;
+        R.Columns[0] = _mm_shuffle_ps(T0, M.Columns[2], _MM_SHUFFLE(3, 0, 2, 0));
+        R.Columns[1] = _mm_shuffle_ps(T0, M.Columns[2], _MM_SHUFFLE(3, 1, 3, 1));
+        R.Columns[2] = _mm_shuffle_ps(T1, M.Columns[2], _MM_SHUFFLE(3, 2, 2, 0));
+        R.Columns[3] = priv::InverseTranslation(R, M.Columns[3]);
+        return R;
+    }
+    FM_FLATTEN FM_FUN Mat4Orthographic(float Left, float Right, float Bottom, float Top, float Near, float Far) -> mat4 {
         float RL = Right - Left;
         float TB = Top - Bottom;
         float FN = Far - Near; 
@@ -4560,7 +9735,7 @@ namespace fm {
                             0.f, 0.f, -2.f / FN, -((Far + Near) / FN),
                             0.f, 0.f, 0.f, 1.f);
     }
-    FM_FUN Mat4Perspective(float Fov, float AspectRatio, float Near, float Far) -> mat4 {
+    FM_FLATTEN FM_FUN Mat4Perspective(float Fov, float AspectRatio, float Near, float Far) -> mat4 {
         float Cotangent = 1.f / tanf(Fov * Pi32 / 360.f);
         float NF = Near - Far;
 		
@@ -4572,23 +9747,23 @@ namespace fm {
  (2 * Near * Far) / NF,
                             0.f, 0.f, -1.f, 0.f);
     }
-    FM_FUN Mat4LookAt(vec3 Eye, vec3 At, vec3 Up) -> mat4 {
+    FM_FLATTEN FM_FUN Mat4LookAt(vec3 Eye, vec3 At, vec3 Up) -> mat4 {
         vec3 Forward = Normalize(At - Eye);
-        vec3 Right = Cross(Forward, Up); // TODO(docs): We assume that Up is normalized
+        vec3 Right = Normalize(Cross(Forward, Up)); // NOTE: Up doesn't have to be perpendicular to Forward
         Up = Cross(Right, Forward);
         return Mat4FromColumns(
                                Right, Up, -Forward,
                                Vec3(-Dot(Right, Eye), -Dot(Up, Eye), Dot(Forward, Eye)));
     }
-    FM_FUN Mat4LookAt(v3 Eye, v3 At, v3 Up) -> mat4 {
+    FM_FLATTEN FM_FUN Mat4LookAt(v3 Eye, v3 At, v3 Up) -> mat4 {
         v3 Forward = Normalize(At - Eye);
-        v3 Right = Cross(Forward, Up); // TODO(docs): We assume that Up is normalized
+        v3 Right = Normalize(Cross(Forward, Up)); // NOTE: Up doesn't have to be perpendicular to Forward
         Up = Cross(Right, Forward);
         return Mat4FromColumns(
                                Right, Up, -Forward,
                                v3(-Dot(Right, Eye), -Dot(Up, Eye), Dot(Forward, Eye)));
     }
-    FM_FUN_C mat4::GetRowV4(uint32_t Index) -> v4 {
+    FM_FLATTEN FM_FUN_C mat4::GetRowV4(uint32_t Index) -> v4 {
         FM_ASSERT(Index >= 0 && Index <= 3);
         switch(Index)
         {
@@ -4622,7 +9797,7 @@ namespace fm {
             }
         }
     }
-    FM_FUN_C mat4::SetRow(uint32_t Index, v4 Row) -> void {
+    FM_FLATTEN FM_FUN_C mat4::SetRow(uint32_t Index, v4 Row) -> void {
         FM_ASSERT(Index >= 0 && Index <= 3);
         switch(Index)
         {
@@ -4660,6 +9835,52 @@ namespace fm {
         }	
     }
     
+    namespace priv {
+        // NOTE: Builds the inverse from the columns of the inverted 3x3, the translation becomes -(Inverse * T)
+        FM_SINL mat3x4 FM_CALL Mat3x4InverseFromColumns(const mat3x4& M, __m128 C0, __m128 C1, __m128 C2) {
+            __m128 T = _mm_mul_ps(C0, _mm_shuffle_ps(M.Rows[0], M.Rows[0], _MM_SHUFFLE(3, 3, 3, 3)));
+            T = _mm_add_ps(T, _mm_mul_ps(C1, _mm_shuffle_ps(M.Rows[1], M.Rows[1], _MM_SHUFFLE(3, 3, 3, 3))));
+            T = _mm_add_ps(T, _mm_mul_ps(C2, _mm_shuffle_ps(M.Rows[2], M.Rows[2], _MM_SHUFFLE(3, 3, 3, 3))));
+            T = _mm_sub_ps(_mm_setzero_ps(), T);
+            _MM_TRANSPOSE4_PS(C0, C1, C2, T);
+            mat3x4 R;
+            R.Rows[0] = C0;
+            R.Rows[1] = C1;
+            R.Rows[2] = C2;
+            return R;
+        }
+    }
+    
+    //////////////////////////////////
+    // not inlined mat3x4 functions //
+    //////////////////////////////////
+    FM_FLATTEN FM_FUN_C Determinant(mat3x4 M) -> float {
+        __m128 XYZMask = _mm_castsi128_ps(_mm_setr_epi32(-1, -1, -1, 0));
+        __m128 R0 = _mm_and_ps(M.Rows[0], XYZMask);
+        __m128 R1 = _mm_and_ps(M.Rows[1], XYZMask);
+        __m128 R2 = _mm_and_ps(M.Rows[2], XYZMask);
+        return _mm_cvtss_f32(priv::SplatSum<4>(_mm_mul_ps(R0, priv::Cross3(R1, R2))));
+    }
+    FM_FLATTEN FM_FUN_C Inverse(mat3x4 M) -> mat3x4 {
+        __m128 XYZMask = _mm_castsi128_ps(_mm_setr_epi32(-1, -1, -1, 0));
+        __m128 R0 = _mm_and_ps(M.Rows[0], XYZMask);
+        __m128 R1 = _mm_and_ps(M.Rows[1], XYZMask);
+        __m128 R2 = _mm_and_ps(M.Rows[2], XYZMask);
+        
+        // NOTE: Columns of the inverse of the 3x3 are the cross products of its rows divided by the determinant
+        __m128 C0 = priv::Cross3(R1, R2);
+        __m128 C1 = priv::Cross3(R2, R0);
+        __m128 C2 = priv::Cross3(R0, R1);
+        __m128 InvDet = _mm_div_ps(_mm_set1_ps(1.f), priv::SplatSum<4>(_mm_mul_ps(R0, C0)));
+        return priv::Mat3x4InverseFromColumns(M, _mm_mul_ps(C0, InvDet), _mm_mul_ps(C1, InvDet), _mm_mul_ps(C2, InvDet));
+    }
+    FM_FLATTEN FM_FUN_C InverseRigid(mat3x4 M) -> mat3x4 {
+        // NOTE: The inverse of a rotation is its transpose, so its columns are the rows of M
+        __m128 XYZMask = _mm_castsi128_ps(_mm_setr_epi32(-1, -1, -1, 0));
+        return priv::Mat3x4InverseFromColumns(M, _mm_and_ps(M.Rows[0], XYZMask), _mm_and_ps(M.Rows[1], XYZMask),
+                                              _mm_and_ps(M.Rows[2], XYZMask));
+    }
+    
 } // !namespace fm
 
 #endif // FM_IMPLEMENTATION
@@ -1,5 +1,5 @@
 #define ANKERL_NANOBENCH_IMPLEMENT
-#include "nanoBench.h"
+#include "nanobench.h"
 
 #define FM_IMPLEMENTATION
 #include "../../FastMath.h"
@@ -9,6 +9,13 @@ using namespace fm;
 #define Benchmark(name, expRession, Result) Bench.run(name, [&]{Result = expRession;}).doNotOptimizeAway(Result);
 #define BenchmarkNoAssign(name, expRession, Result) Bench.run(name, [&]{expRession;}).doNotOptimizeAway(Result);
 
+// NOTE: Inlined functions pick fused multiply-add at compile time, runBenchmarksGCCWithFMA.sh builds the other variant
+#ifdef FM_USE_FMA
+static const std::string InlineTier = " (FMA)";
+#else
+static const std::string InlineTier = " (no FMA)";
+#endif
+
 int32_t main() 
 {
 	ankerl::nanobench::Bench Bench;
@@ -54,109 +61,750 @@ int32_t main()
 		Benchmark("vec2 scalar division", A / 5.f, Res);
 	}
 
-	// v2
+	// vec2
 	{
-		v2 A = V2(1.f, 2.f);
-		v2 B = V2(-5.f, 10.f);
-		v2 Res;
+		vec2 A = Vec2(1.f, 2.f);
+		vec2 B = Vec2(-5.f, 10.f);
+		vec2 Res = Vec2();
 		float Res2;
 
-		BenchmarkNoAssign("v2 SetX", Res.SetX(5.f), Res);
-		BenchmarkNoAssign("v2 SetY", Res.SetY(5.f), Res);
+		BenchmarkNoAssign("vec2 SetX", Res.SetX(5.f), Res);
+		BenchmarkNoAssign("vec2 SetY", Res.SetY(5.f), Res);
 
-		Benchmark("v2 x()", A.X(), Res2);
-		Benchmark("v2 u()", A.U(), Res2);
-		Benchmark("v2 y()", A.Y(), Res2);
-		Benchmark("v2 v()", A.V(), Res2);
-		Benchmark("v2 yx()", A.YX(), Res);
-		Benchmark("v2 xx()", A.XX(), Res);
-		Benchmark("v2 yy()", A.YY(), Res);
+		Benchmark("vec2 X()", A.X(), Res2);
+		Benchmark("vec2 U()", A.U(), Res2);
+		Benchmark("vec2 Y()", A.Y(), Res2);
+		Benchmark("vec2 V()", A.V(), Res2);
 
 		float Arr[2] = {1.f, 2.f};
 		__m128 M = _mm_set1_ps(5.f);
-		Benchmark("V2FromMemory", V2FromMemory(Arr), Res);
-		Benchmark("V2(x, y)", V2(1.f, 2.f), Res);
-		Benchmark("V2(a)", V2(5.f), Res);
-		Benchmark("V2(__m128)", V2(M), Res);
-		Benchmark("V2()", V2(), Res);
+		Benchmark("Vec2FromMemory", Vec2FromMemory(Arr), Res);
+		Benchmark("Vec2(x, y)", Vec2(1.f, 2.f), Res);
+		Benchmark("Vec2(a)", Vec2(5.f), Res);
+		Benchmark("Vec2(__m128)", Vec2(M), Res);
+		Benchmark("Vec2()", Vec2(), Res);
 
 		float Storage[2];
-		BenchmarkNoAssign("v2 Store", Store(Storage, A), Storage);
-
-		Benchmark("v2 addition", A + B, Res);
-		Benchmark("v2 subtraction", A - B, Res);
-		Benchmark("v2 addition with assignement", Res += A, Res);
-		Benchmark("v2 subtraction with assignement", Res -= A, Res);
-		Benchmark("v2 Hadamard multiplication", HadamardMul(A, B), Res);
-		Benchmark("v2 Hadamard division", HadamardDiv(A, B), Res);
-		Benchmark("v2 scalar multiplication", A * 5.f, Res);
-		Benchmark("v2 scalar division", A / 5.f, Res);
-		Benchmark("v2 negation", Res = -A, Res);
-		Benchmark("v2 dot product", Dot(A, B), Res2);
-		Benchmark("v2 Min", Min(A, B), Res);
-		Benchmark("v2 Max", Max(A, B), Res);
-		Benchmark("v2 Abs", Abs(A), Res);
-		Benchmark("v2 SumOfElements", SumOfElements(A), Res2);
-		Benchmark("v2 Length", Length(A), Res2);
-		Benchmark("v2 LengthSquared", LengthSquared(A), Res2);
-		Benchmark("v2 Normalize", Normalize(A), Res);
-		Benchmark("v2 Clamp", Clamp(A, A, B), Res);
-		Benchmark("v2 Lerp", Lerp(A, B, 0.5f), Res);
+		BenchmarkNoAssign("vec2 Store", Store(Storage, A), Storage);
+
+		Benchmark("vec2 addition with assignement", Res += A, Res);
+		Benchmark("vec2 subtraction with assignement", Res -= A, Res);
+		Benchmark("vec2 Hadamard multiplication", HadamardMul(A, B), Res);
+		Benchmark("vec2 Hadamard division", HadamardDiv(A, B), Res);
+		Benchmark("vec2 negation", Res = -A, Res);
+		Benchmark("vec2 dot product", Dot(A, B), Res2);
+		Benchmark("vec2 Min", Min(A, B), Res);
+		Benchmark("vec2 Max", Max(A, B), Res);
+		Benchmark("vec2 Abs", Abs(A), Res);
+		Benchmark("vec2 SumOfElements", SumOfElements(A), Res2);
+		Benchmark("vec2 Length", Length(A), Res2);
+		Benchmark("vec2 LengthSquared", LengthSquared(A), Res2);
+		Benchmark("vec2 Normalize", Normalize(A), Res);
+		Benchmark("vec2 Clamp", Clamp(A, A, B), Res);
+		Benchmark("vec2 Lerp", Lerp(A, B, 0.5f), Res);
 
 		bool Res3;
-		Benchmark("v2 ==", A == B, Res3);
-		Benchmark("v2 !=", A != B, Res3);
-		Benchmark("v2 EqualsMask", EqualsMask(A, B), Res);
-		Benchmark("v2 GreaterMask", GreaterMask(A, B), Res);
-		Benchmark("v2 GreaterOrEqualMask", GreaterOrEqualMask(A, B), Res);
-		Benchmark("v2 LesserMask", LesserMask(A, B), Res);
-		Benchmark("v2 LesserOrEqualMask", LesserOrEqualMask(A, B), Res);
+		Benchmark("vec2 ==", A == B, Res3);
+		Benchmark("vec2 !=", A != B, Res3);
+		Benchmark("vec2 EqualsMask", EqualsMask(A, B), Res);
+		Benchmark("vec2 GreaterMask", GreaterMask(A, B), Res);
+		Benchmark("vec2 GreaterOrEqualMask", GreaterOrEqualMask(A, B), Res);
+		Benchmark("vec2 LesserMask", LesserMask(A, B), Res);
+		Benchmark("vec2 LesserOrEqualMask", LesserOrEqualMask(A, B), Res);
 	}
 
-	// v2d
+	// vec2d
 	{
-		v2d A = V2d(1.0, 2.0);
-		v2d B = V2d(-5.0, 10.0);
-		v2d Res;
-		double Res2;
-
-		Benchmark("v2d addition", A + B, Res);
-		Benchmark("v2d subtraction", A - B, Res);
-		Benchmark("v2d scalar multiplication", A * 5.0, Res);
-		Benchmark("v2d scalar division", A / 5.0, Res);
-		Benchmark("v2d Hadamard multiplication", HadamardMul(A, B), Res);
-		Benchmark("v2d Hadamard division", HadamardDiv(A, B), Res);
+		vec2d A = Vec2d(1.0, 2.0);
+		vec2d B = Vec2d(-5.0, 10.0);
+		vec2d Res;
+
+		Benchmark("vec2d addition", A + B, Res);
+		Benchmark("vec2d subtraction", A - B, Res);
+		Benchmark("vec2d scalar multiplication", A * 5.0, Res);
+		Benchmark("vec2d scalar division", A / 5.0, Res);
+		Benchmark("vec2d Hadamard multiplication", HadamardMul(A, B), Res);
+		Benchmark("vec2d Hadamard division", HadamardDiv(A, B), Res);
 	}
 
-	// v2i
+	// vec2i
 	{
-		v2i A = V2i(1, 2);
-		v2i B = V2i(-5, 10);
-		v2i Res;
-		int32_t Res2;
-
-		Benchmark("v2i addition", A + B, Res);
-		Benchmark("v2i subtraction", A - B, Res);
-		Benchmark("v2i scalar multiplication", A * 5.0, Res);
-		Benchmark("v2i Hadamard multiplication", HadamardMul(A, B), Res);
+		vec2i A = Vec2i(1, 2);
+		vec2i B = Vec2i(-5, 10);
+		vec2i Res;
+
+		Benchmark("vec2i addition", A + B, Res);
+		Benchmark("vec2i subtraction", A - B, Res);
+		Benchmark("vec2i scalar multiplication", A * 5, Res);
+		Benchmark("vec2i Hadamard multiplication", HadamardMul(A, B), Res);
 	}
 
-	// v2u
+	// vec2u
 	{
-		v2u A = V2u(1, 2);
-		v2u B = V2u(5, 10);
-		v2u Res;
-
-		Benchmark("v2u addition", A + B, Res);
-		Benchmark("v2u subtraction", A - B, Res);
-		Benchmark("v2u scalar multiplication", A * 5.0, Res);
-		Benchmark("v2u Hadamard multiplication", HadamardMul(A, B), Res);
+		vec2u A = Vec2u(1, 2);
+		vec2u B = Vec2u(5, 10);
+		vec2u Res;
+
+		Benchmark("vec2u addition", A + B, Res);
+		Benchmark("vec2u subtraction", A - B, Res);
+		Benchmark("vec2u scalar multiplication", A * 5u, Res);
+		Benchmark("vec2u Hadamard multiplication", HadamardMul(A, B), Res);
 	}
 
 	// mat4
 	{
 		mat4 I = Mat4Identity();
 		BenchmarkNoAssign("RotateDegrees()", RotateDegrees(&I, 50.f, 1.f, 0.5f, 0.f), I);
+		// NOTE: The angle changes every run so the rotation can't be hoisted out of the benchmark loop
+		float StepAngle = 0.3f;
+		BenchmarkNoAssign("RotateAroundXAxisRadians()", RotateAroundXAxisRadians(&I, StepAngle += 0.001f), I);
+		BenchmarkNoAssign("mat4 * Mat4RotationAroundXAxisRadians()", I = I * Mat4RotationAroundXAxisRadians(StepAngle += 0.001f), I);
+		BenchmarkNoAssign("RotateAroundZAxisRadians()", RotateAroundZAxisRadians(&I, StepAngle += 0.001f), I);
+		BenchmarkNoAssign("mat4 * Mat4RotationAroundZAxisRadians()", I = I * Mat4RotationAroundZAxisRadians(StepAngle += 0.001f), I);
+		BenchmarkNoAssign("ShearXAxis()", ShearXAxis(&I, 0.01f, -0.01f), I);
+		BenchmarkNoAssign("mat4 * Mat4ShearXAxis()", I = I * Mat4ShearXAxis(0.01f, -0.01f), I);
+		BenchmarkNoAssign("Scale()", Scale(&I, 1.001f, 0.999f, 1.f), I);
+
+		mat4 A = Mat4RotationDegrees(30.f, 0.f, 1.f, 0.f);
+		mat4 B = Mat4Translation(1.f, 2.f, 3.f);
+		mat4 ResM;
+		for(uint32_t Tier = SimdTier_SSE2; Tier <= GetMaxSupportedSimdTier(); ++Tier)
+		{
+			SetSimdTier((simd_tier)Tier);
+			std::string Name = std::string("mat4 * mat4 ") + GetSimdTierName((simd_tier)Tier);
+			Benchmark(Name, A * B, ResM);
+		}
+		SetSimdTier(GetMaxSupportedSimdTier());
+
+		constexpr uint32_t Count = 4096;
+		vec4* InVec4 = new vec4[Count];
+		vec4* OutVec4 = new vec4[Count];
+		v3* InV3 = new v3[Count];
+		v3* OutV3 = new v3[Count];
+		for(uint32_t i = 0; i < Count; ++i)
+		{
+			InVec4[i] = Vec4((float)i, 1.f, 2.f, 1.f);
+			InV3[i] = v3((float)i, 1.f, 2.f);
+		}
+		mat4 Persp = Mat4Perspective(90.f, 1.f, 0.1f, 100.f);
+
+		BenchmarkNoAssign("mat4 * vec4 loop (4096)" + InlineTier, for(uint32_t i = 0; i < Count; ++i) OutVec4[i] = A * InVec4[i], OutVec4[0]);
+		vec4 ChainV4 = InVec4[3];
+		Benchmark("mat4 * vec4 latency" + InlineTier, A * ChainV4, ChainV4);
+		mat4 ResRot;
+		float RotAngle = 0.3f;
+		Benchmark("Mat4RotationRadians()" + InlineTier, Mat4RotationRadians(RotAngle += 0.001f, 1.f, 0.5f, 0.2f), ResRot);
+		float ResDot = 0.f;
+		BenchmarkNoAssign("vec4 Dot loop (4096)" + InlineTier, for(uint32_t i = 0; i < Count; ++i) ResDot += Dot(InVec4[i], OutVec4[i]), ResDot);
+		BenchmarkNoAssign("vec4 Lerp loop (4096)" + InlineTier, for(uint32_t i = 0; i < Count; ++i) OutVec4[i] = Lerp(InVec4[i], OutVec4[i], 0.25f), OutVec4[0]);
+		BenchmarkNoAssign("TransformPoints() vec4 (4096)", TransformPoints(A, InVec4, OutVec4, Count), OutVec4[0]);
+		BenchmarkNoAssign("TransformPoints() v3 (4096)", TransformPoints(A, InV3, OutV3, Count), OutV3[0]);
+		BenchmarkNoAssign("TransformAndProjectPoints() vec4 (4096)", TransformAndProjectPoints(Persp, InVec4, OutVec4, Count), OutVec4[0]);
+
+		vec3* InVec3 = new vec3[Count];
+		vec3* OutVec3 = new vec3[Count];
+		for(uint32_t i = 0; i < Count; ++i)
+			InVec3[i] = Vec3(InV3[i].X, InV3[i].Y, InV3[i].Z);
+		// NOTE: Every call depends on the previous result, so these rows measure latency
+		vec3 Chain = InVec3[50];
+		Benchmark("vec3 Normalize latency", Normalize(Chain + InVec3[7]), Chain);
+		Benchmark("vec3 NormalizeFast latency", NormalizeFast(Chain + InVec3[7]), Chain);
+		Benchmark("vec3 NormalizeSafe latency", NormalizeSafe(Chain + InVec3[7]), Chain);
+		BenchmarkNoAssign("vec3 Normalize loop (4096)", for(uint32_t i = 0; i < Count; ++i) OutVec3[i] = Normalize(InVec3[i]), OutVec3[0]);
+		BenchmarkNoAssign("vec3 NormalizeFast loop (4096)", for(uint32_t i = 0; i < Count; ++i) OutVec3[i] = NormalizeFast(InVec3[i]), OutVec3[0]);
+		BenchmarkNoAssign("vec3 NormalizeSafe loop (4096)", for(uint32_t i = 0; i < Count; ++i) OutVec3[i] = NormalizeSafe(InVec3[i]), OutVec3[0]);
+		BenchmarkNoAssign("NormalizeArray() vec3 (4096)", NormalizeArray(InVec3, OutVec3, Count), OutVec3[0]);
+		BenchmarkNoAssign("NormalizeArray() v3 (4096)", NormalizeArray(InV3, OutV3, Count), OutV3[0]);
+		delete[] InVec3;
+		delete[] OutVec3;
+
+		constexpr uint32_t MatCount = 1024;
+		mat4* MatsA = new mat4[MatCount];
+		mat4* MatsB = new mat4[MatCount];
+		mat4* MatsOut = new mat4[MatCount];
+		for(uint32_t i = 0; i < MatCount; ++i)
+		{
+			MatsA[i] = Mat4Translation((float)i, 1.f, 2.f);
+			MatsB[i] = Mat4RotationDegrees((float)i, 0.f, 1.f, 0.f);
+		}
+		BenchmarkNoAssign("mat4 * mat4 loop (1024)", for(uint32_t i = 0; i < MatCount; ++i) MatsOut[i] = MatsA[i] * MatsB[i], MatsOut[0]);
+		for(uint32_t Tier = SimdTier_SSE2; Tier <= GetMaxSupportedSimdTier(); ++Tier)
+		{
+			SetSimdTier((simd_tier)Tier);
+			std::string Name = std::string("MultiplyMat4Arrays() (1024) ") + GetSimdTierName((simd_tier)Tier);
+			BenchmarkNoAssign(Name, MultiplyMat4Arrays(MatsA, MatsB, MatsOut, MatCount), MatsOut[0]);
+		}
+		SetSimdTier(GetMaxSupportedSimdTier());
+
+		mat4 RigidM = Mat4TranslationRotationDegrees(v3(1.f, 2.f, 3.f), 30.f, v3(0.f, 1.f, 0.f));
+		Benchmark("Inverse()", Inverse(RigidM), ResM);
+		Benchmark("InverseAffine()", InverseAffine(RigidM), ResM);
+		Benchmark("InverseRigid()", InverseRigid(RigidM), ResM);
+		BenchmarkNoAssign("InverseMat4Array() (1024)", InverseMat4Array(MatsB, MatsOut, MatCount), MatsOut[0]);
+		BenchmarkNoAssign("InverseAffineMat4Array() (1024)", InverseAffineMat4Array(MatsB, MatsOut, MatCount), MatsOut[0]);
+		BenchmarkNoAssign("InverseRigidMat4Array() (1024)", InverseRigidMat4Array(MatsB, MatsOut, MatCount), MatsOut[0]);
+
+		mat3x4 A3x4 = Mat3x4FromMat4(A);
+		mat3x4 B3x4 = Mat3x4FromMat4(B);
+		mat3x4 Res3x4;
+		Benchmark("mat3x4 * mat3x4", A3x4 * B3x4, Res3x4);
+		Benchmark("Inverse() mat3x4", Inverse(A3x4), Res3x4);
+		Benchmark("InverseRigid() mat3x4", InverseRigid(A3x4), Res3x4);
+		v3 ResV3;
+		Benchmark("TransformPoint() mat3x4 v3", TransformPoint(A3x4, InV3[7]), ResV3);
+		mat3x4* Mats3x4A = new mat3x4[MatCount];
+		mat3x4* Mats3x4B = new mat3x4[MatCount];
+		mat3x4* Mats3x4Out = new mat3x4[MatCount];
+		for(uint32_t i = 0; i < MatCount; ++i)
+		{
+			Mats3x4A[i] = Mat3x4FromMat4(MatsA[i]);
+			Mats3x4B[i] = Mat3x4FromMat4(MatsB[i]);
+		}
+		BenchmarkNoAssign("mat3x4 * mat3x4 loop (1024)", for(uint32_t i = 0; i < MatCount; ++i) Mats3x4Out[i] = Mats3x4A[i] * Mats3x4B[i], Mats3x4Out[0]);
+		delete[] Mats3x4A;
+		delete[] Mats3x4B;
+		delete[] Mats3x4Out;
+
+		float Angle = InV3[50].X;
+		quat QA = QuatRotationDegrees(Angle, 0.f, 1.f, 0.f);
+		quat QB = QuatRotationDegrees(50.f, 1.f, 0.5f, 0.f);
+		quat ResQ;
+		Benchmark("quat * quat", QA * QB, ResQ);
+		Benchmark("QuatRotationDegrees()", QuatRotationDegrees(Angle, 1.f, 0.5f, 0.f), ResQ);
+		Benchmark("Mat4RotationDegrees()", Mat4RotationDegrees(Angle, 1.f, 0.5f, 0.f), ResM);
+		Benchmark("Mat4FromQuat()", Mat4FromQuat(QA), ResM);
+		Benchmark("Mat3x4FromQuat()", Mat3x4FromQuat(QA), Res3x4);
+		Benchmark("Mat4TranslationScaleRotation() quat", Mat4TranslationScaleRotation(v3(1.f, 2.f, 3.f), v3(2.f), QA), ResM);
+		Benchmark("Rotate() quat v3", Rotate(QA, InV3[7]), ResV3);
+
+		constexpr uint32_t QuatCount = 100000;
+		quat* QuatsA = new quat[QuatCount];
+		quat* QuatsB = new quat[QuatCount];
+		quat* QuatsOut = new quat[QuatCount];
+		for(uint32_t i = 0; i < QuatCount; ++i)
+		{
+			QuatsA[i] = QuatEulerDegrees((float)i, (float)(i * 3), (float)(i * 7));
+			QuatsB[i] = QuatEulerDegrees((float)(i * 5), (float)(i * 2), (float)i);
+		}
+		BenchmarkNoAssign("Slerp() loop (100k)", for(uint32_t i = 0; i < QuatCount; ++i) QuatsOut[i] = Slerp(QuatsA[i], QuatsB[i], 0.3f), QuatsOut[0]);
+		BenchmarkNoAssign("Nlerp() loop (100k)", for(uint32_t i = 0; i < QuatCount; ++i) QuatsOut[i] = Nlerp(QuatsA[i], QuatsB[i], 0.3f), QuatsOut[0]);
+		for(uint32_t Tier = SimdTier_SSE2; Tier <= GetMaxSupportedSimdTier(); ++Tier)
+		{
+			SetSimdTier((simd_tier)Tier);
+			std::string TierName = GetSimdTierName((simd_tier)Tier);
+			BenchmarkNoAssign("SlerpQuatArray() (100k) " + TierName, SlerpQuatArray(QuatsA, QuatsB, 0.3f, QuatsOut, QuatCount), QuatsOut[0]);
+			BenchmarkNoAssign("NlerpQuatArray() (100k) " + TierName, NlerpQuatArray(QuatsA, QuatsB, 0.3f, QuatsOut, QuatCount), QuatsOut[0]);
+		}
+		SetSimdTier(GetMaxSupportedSimdTier());
+		delete[] QuatsA;
+		delete[] QuatsB;
+		delete[] QuatsOut;
+
+		Benchmark("Mat4RotationAroundXAxisDegrees()", Mat4RotationAroundXAxisDegrees(Angle), ResM);
+		Benchmark("QuatEulerDegrees()", QuatEulerDegrees(Angle, 2.f * Angle, 30.f), ResQ);
+
+		constexpr uint32_t AngleCount = 4096;
+		float* Angles = new float[AngleCount];
+		float* Sines = new float[AngleCount];
+		float* Cosines = new float[AngleCount];
+		for(uint32_t i = 0; i < AngleCount; ++i)
+			Angles[i] = (float)i * 0.01f - 20.f + Angle * 0.001f;
+		auto SinCosLoop = [&]() {
+			for(uint32_t i = 0; i < AngleCount; ++i)
+			{
+				Sines[i] = sinf(Angles[i]);
+				Cosines[i] = cosf(Angles[i]);
+			}
+		};
+		auto SinCosLanes = [&]() {
+			for(uint32_t i = 0; i < AngleCount; i += 4)
+			{
+				__m128 S, C;
+				SinCos(_mm_loadu_ps(Angles + i), &S, &C);
+				_mm_storeu_ps(Sines + i, S);
+				_mm_storeu_ps(Cosines + i, C);
+			}
+		};
+		auto FastSinCosLanes = [&]() {
+			for(uint32_t i = 0; i < AngleCount; i += 4)
+			{
+				__m128 S, C;
+				FastSinCos(_mm_loadu_ps(Angles + i), &S, &C);
+				_mm_storeu_ps(Sines + i, S);
+				_mm_storeu_ps(Cosines + i, C);
+			}
+		};
+		auto Atan2Loop = [&]() {
+			for(uint32_t i = 0; i < AngleCount; ++i)
+				Sines[i] = atan2f(Angles[i], Cosines[i]);
+		};
+		auto Atan2Lanes = [&]() {
+			for(uint32_t i = 0; i < AngleCount; i += 4)
+				_mm_storeu_ps(Sines + i, Atan2(_mm_loadu_ps(Angles + i), _mm_loadu_ps(Cosines + i)));
+		};
+		auto AcosLoop = [&]() {
+			for(uint32_t i = 0; i < AngleCount; ++i)
+				Sines[i] = acosf(Cosines[i]);
+		};
+		auto AcosLanes = [&]() {
+			for(uint32_t i = 0; i < AngleCount; i += 4)
+				_mm_storeu_ps(Sines + i, Acos(_mm_loadu_ps(Cosines + i)));
+		};
+		BenchmarkNoAssign("sinf() and cosf() loop (4096)", SinCosLoop(), Sines[0]);
+		BenchmarkNoAssign("SinCos() __m128 (4096)", SinCosLanes(), Sines[0]);
+		BenchmarkNoAssign("FastSinCos() __m128 (4096)", FastSinCosLanes(), Sines[0]);
+		BenchmarkNoAssign("atan2f() loop (4096)", Atan2Loop(), Sines[0]);
+		BenchmarkNoAssign("Atan2() __m128 (4096)", Atan2Lanes(), Sines[0]);
+		BenchmarkNoAssign("acosf() loop (4096)", AcosLoop(), Sines[0]);
+		BenchmarkNoAssign("Acos() __m128 (4096)", AcosLanes(), Sines[0]);
+		delete[] Angles;
+		delete[] Sines;
+		delete[] Cosines;
+
+		constexpr uint32_t ValueCount = 100000;
+		float* Values = new float[ValueCount];
+		float* Mapped = new float[ValueCount];
+		for(uint32_t i = 0; i < ValueCount; ++i)
+			Values[i] = (float)i * 0.0004f + 0.001f + Angle * 0.0001f;
+		auto ExpLoop = [&]() {
+			for(uint32_t i = 0; i < ValueCount; ++i)
+				Mapped[i] = expf(Values[i]);
+		};
+		auto LogLoop = [&]() {
+			for(uint32_t i = 0; i < ValueCount; ++i)
+				Mapped[i] = logf(Values[i]);
+		};
+		auto PowLoop = [&]() {
+			for(uint32_t i = 0; i < ValueCount; ++i)
+				Mapped[i] = powf(Values[i], 1.f / 2.4f);
+		};
+		BenchmarkNoAssign("expf() loop (100k)", ExpLoop(), Mapped[0]);
+		BenchmarkNoAssign("logf() loop (100k)", LogLoop(), Mapped[0]);
+		BenchmarkNoAssign("powf() loop (100k)", PowLoop(), Mapped[0]);
+		for(uint32_t Tier = SimdTier_SSE2; Tier <= GetMaxSupportedSimdTier(); ++Tier)
+		{
+			SetSimdTier((simd_tier)Tier);
+			std::string TierName = GetSimdTierName((simd_tier)Tier);
+			BenchmarkNoAssign("ExpArray() (100k) " + TierName, ExpArray(Values, Mapped, ValueCount), Mapped[0]);
+			BenchmarkNoAssign("LogArray() (100k) " + TierName, LogArray(Values, Mapped, ValueCount), Mapped[0]);
+			BenchmarkNoAssign("PowArray() (100k) " + TierName, PowArray(Values, 1.f / 2.4f, Mapped, ValueCount), Mapped[0]);
+		}
+		SetSimdTier(GetMaxSupportedSimdTier());
+		delete[] Values;
+		delete[] Mapped;
+
+		constexpr uint32_t BoneCount = 64;
+		constexpr uint32_t VertexCount = 10000;
+		mat4* BoneMatrices = new mat4[BoneCount];
+		dual_quat* BoneDualQuats = new dual_quat[BoneCount];
+		for(uint32_t i = 0; i < BoneCount; ++i)
+		{
+			BoneDualQuats[i] = DualQuat(QuatRotationDegrees((float)i, 1.f, 0.5f, 0.f), v3((float)i, 1.f, 2.f));
+			BoneMatrices[i] = Mat4FromDualQuat(BoneDualQuats[i]);
+		}
+		v4u16* BoneIndices = new v4u16[VertexCount];
+		v4* BoneWeights = new v4[VertexCount];
+		v3* SkinPositions = new v3[VertexCount];
+		v3* SkinNormals = new v3[VertexCount];
+		v3* SkinnedPositions = new v3[VertexCount];
+		v3* SkinnedNormals = new v3[VertexCount];
+		for(uint32_t i = 0; i < VertexCount; ++i)
+		{
+			BoneIndices[i] = v4u16(i % BoneCount, (i * 7) % BoneCount, (i * 13) % BoneCount, (i * 29) % BoneCount);
+			BoneWeights[i] = v4(0.4f, 0.3f, 0.2f, 0.1f);
+			SkinPositions[i] = v3((float)i, 1.f, 2.f);
+			SkinNormals[i] = v3(0.f, 1.f, 0.f);
+		}
+		auto SkinWithMat4Vec4Mul = [&]() {
+			for(uint32_t i = 0; i < VertexCount; ++i)
+			{
+				vec4 P = Vec4(0.f);
+				vec4 N = Vec4(0.f);
+				for(uint32_t Bone = 0; Bone < 4; ++Bone)
+				{
+					const mat4& M = BoneMatrices[BoneIndices[i].Elements[Bone]];
+					P += (M * Vec4(CastToVec3(SkinPositions[i]), 1.f)) * BoneWeights[i].Elements[Bone];
+					N += (M * Vec4(CastToVec3(SkinNormals[i]), 0.f)) * BoneWeights[i].Elements[Bone];
+				}
+				SkinnedPositions[i] = v3(P.X(), P.Y(), P.Z());
+				SkinnedNormals[i] = CastToV3(Normalize(Vec3(N.X(), N.Y(), N.Z())));
+			}
+		};
+		BenchmarkNoAssign("mat4 * vec4 per influence skinning (10k)", SkinWithMat4Vec4Mul(), SkinnedPositions[0]);
+		for(uint32_t Tier = SimdTier_SSE2; Tier <= GetMaxSupportedSimdTier(); ++Tier)
+		{
+			SetSimdTier((simd_tier)Tier);
+			std::string TierName = GetSimdTierName((simd_tier)Tier);
+			BenchmarkNoAssign("SkinVerticesLinear() (10k) " + TierName,
+				SkinVerticesLinear(BoneMatrices, BoneIndices, BoneWeights, SkinPositions, SkinNormals, SkinnedPositions, SkinnedNormals, VertexCount),
+				SkinnedPositions[0]);
+			BenchmarkNoAssign("SkinVerticesDualQuat() (10k) " + TierName,
+				SkinVerticesDualQuat(BoneDualQuats, BoneIndices, BoneWeights, SkinPositions, SkinNormals, SkinnedPositions, SkinnedNormals, VertexCount),
+				SkinnedPositions[0]);
+		}
+		SetSimdTier(GetMaxSupportedSimdTier());
+		delete[] BoneMatrices;
+		delete[] BoneDualQuats;
+		delete[] BoneIndices;
+		delete[] BoneWeights;
+		delete[] SkinPositions;
+		delete[] SkinNormals;
+		delete[] SkinnedPositions;
+		delete[] SkinnedNormals;
+
+		delete[] MatsA;
+		delete[] MatsB;
+		delete[] MatsOut;
+
+		delete[] InVec4;
+		delete[] OutVec4;
+		delete[] InV3;
+		delete[] OutV3;
+	}
+
+	// transform_builder
+	{
+		// NOTE: The angle changes every run so the steps can't be folded at compile time
+		float Angle = 0.3f;
+		mat4 Res;
+		auto ChainedMat4 = [&]() {
+			Angle += 0.001f;
+			mat4 M = Mat4Translation(1.f, 2.f, 3.f);
+			RotateRadians(&M, Angle, 0.f, 1.f, 0.f);
+			RotateRadians(&M, Angle * 0.5f, 1.f, 0.f, 0.f);
+			RotateRadians(&M, -Angle, 0.f, 0.f, 1.f);
+			M = M * Mat4Scale(2.f, 1.f, 0.5f);
+			return M;
+		};
+		auto Builder = [&]() {
+			Angle += 0.001f;
+			transform_builder B = TransformBuilder();
+			Translate(&B, 1.f, 2.f, 3.f);
+			RotateRadians(&B, Angle, 0.f, 1.f, 0.f);
+			RotateRadians(&B, Angle * 0.5f, 1.f, 0.f, 0.f);
+			RotateRadians(&B, -Angle, 0.f, 0.f, 1.f);
+			Scale(&B, 2.f, 1.f, 0.5f);
+			return Mat4FromTransformBuilder(B);
+		};
+		Benchmark("translate, 3 rotations, scale: chained mat4", ChainedMat4(), Res);
+		Benchmark("translate, 3 rotations, scale: transform_builder", Builder(), Res);
+		Benchmark("Mat4TranslationScaleRotationRadians()",
+			Mat4TranslationScaleRotationRadians(v3(1.f, 2.f, 3.f), v3(2.f, 1.f, 0.5f), Angle += 0.001f, v3(1.f, 1.f, 0.f)), Res);
+		auto BuilderTSR = [&]() {
+			transform_builder B = TransformBuilder();
+			Scale(&B, 2.f, 1.f, 0.5f);
+			RotateRadians(&B, Angle += 0.001f, 1.f, 1.f, 0.f);
+			Translate(&B, 1.f, 2.f, 3.f);
+			return Mat4FromTransformBuilder(B);
+		};
+		Benchmark("scale, rotation, translate: transform_builder", BuilderTSR(), Res);
+	}
+
+	// aligned containers
+	{
+		constexpr uint32_t Count = 1 << 20;
+		aligned_array<v3> AoSA(Count), AoSB(Count), AoSOut(Count);
+		soa_array<v3> SoAA(Count), SoAB(Count), SoAOut(Count);
+		aligned_array<float> Dots(Count);
+		for(uint32_t i = 0; i < Count; ++i)
+		{
+			v3 A((float)(i % 7) + 1.f, (float)(i % 5) - 2.f, 0.5f);
+			v3 B(0.25f, (float)(i % 3), (float)(i % 11) - 5.f);
+			AoSA[i] = A;
+			AoSB[i] = B;
+			SoAA.Set(i, A);
+			SoAB.Set(i, B);
+		}
+
+		Bench.minEpochIterations(5);
+		BenchmarkNoAssign("v3 Dot AoS loop (1M)", for(uint32_t i = 0; i < Count; ++i) Dots[i] = Dot(AoSA[i], AoSB[i]), Dots.Data[0]);
+		auto DotAoSPackets = [&]() {
+			for(uint32_t i = 0; i < Count; i += 4)
+				_mm_store_ps(Dots.Data + i, Dot(V3x4FromMemory(AoSA.Data + i), V3x4FromMemory(AoSB.Data + i)));
+		};
+		BenchmarkNoAssign("v3 Dot AoS transposed to v3x4 (1M)", DotAoSPackets(), Dots.Data[0]);
+		auto DotSoA4 = [&]() {
+			for(size_t i = 0; i < SoAA.PacketCount<4>(); ++i)
+				Dots.Packet<4>(i) = Dot(SoAA.GetPacket<4>(i), SoAB.GetPacket<4>(i));
+		};
+		BenchmarkNoAssign("v3 Dot soa_array v3x4 (1M)", DotSoA4(), Dots.Data[0]);
+#ifdef __AVX__
+		auto DotSoA8 = [&]() {
+			for(size_t i = 0; i < SoAA.PacketCount<8>(); ++i)
+				Dots.Packet<8>(i) = Dot(SoAA.GetPacket<8>(i), SoAB.GetPacket<8>(i));
+		};
+		BenchmarkNoAssign("v3 Dot soa_array v3x8 (1M)", DotSoA8(), Dots.Data[0]);
+#endif
+
+		BenchmarkNoAssign("v3 Normalize AoS loop (1M)", for(uint32_t i = 0; i < Count; ++i) AoSOut[i] = Normalize(AoSA[i]), AoSOut.Data[0]);
+		BenchmarkNoAssign("NormalizeArray() v3 AoS (1M)", NormalizeArray(AoSA.Data, AoSOut.Data, Count), AoSOut.Data[0]);
+		auto NormalizeSoA4 = [&]() {
+			for(size_t i = 0; i < SoAA.PacketCount<4>(); ++i)
+				SoAOut.SetPacket<4>(i, Normalize(SoAA.GetPacket<4>(i)));
+		};
+		BenchmarkNoAssign("v3 Normalize soa_array v3x4 (1M)", NormalizeSoA4(), SoAOut.Data[0]);
+#ifdef __AVX__
+		auto NormalizeSoA8 = [&]() {
+			for(size_t i = 0; i < SoAA.PacketCount<8>(); ++i)
+				SoAOut.SetPacket<8>(i, Normalize(SoAA.GetPacket<8>(i)));
+		};
+		BenchmarkNoAssign("v3 Normalize soa_array v3x8 (1M)", NormalizeSoA8(), SoAOut.Data[0]);
+#endif
+	}
+
+	// frame_arena and pool
+	{
+		Bench.minEpochIterations(1);
+		mat4* Mats;
+		auto NewDeleteMat4Array = [&]() {
+			Mats = new mat4[1024];
+			delete[] Mats;
+		};
+		frame_arena Arena = FrameArena(1024 * 1024);
+		auto ArenaMat4Array = [&]() {
+			Mats = AllocMat4Array(&Arena, 1024);
+			Reset(&Arena);
+		};
+		Reset(ThreadFrameArena()); // NOTE: The first call reserves the thread's arena
+		auto ThreadArenaMat4Array = [&]() {
+			Mats = AllocMat4Array(ThreadFrameArena(), 1024);
+			Reset(ThreadFrameArena());
+		};
+		BenchmarkNoAssign("new + delete mat4[1024]", NewDeleteMat4Array(), Mats);
+		BenchmarkNoAssign("AllocMat4Array(1024) + Reset frame_arena", ArenaMat4Array(), Mats);
+		BenchmarkNoAssign("AllocMat4Array(1024) + Reset ThreadFrameArena()", ThreadArenaMat4Array(), Mats);
+
+		// NOTE: 8 batches of temporaries per frame, the arena is reset once at the end
+		auto NewDeleteFrame = [&]() {
+			mat4* Batches[8];
+			for(uint32_t i = 0; i < 8; ++i)
+				Batches[i] = new mat4[256];
+			for(uint32_t i = 0; i < 8; ++i)
+				delete[] Batches[i];
+			Mats = Batches[7];
+		};
+		auto ArenaFrame = [&]() {
+			for(uint32_t i = 0; i < 8; ++i)
+				Mats = AllocMat4Array(&Arena, 256);
+			Reset(&Arena);
+		};
+		BenchmarkNoAssign("8 mat4 batches per frame: new + delete", NewDeleteFrame(), Mats);
+		BenchmarkNoAssign("8 mat4 batches per frame: frame_arena", ArenaFrame(), Mats);
+
+		mat4* Mat;
+		mat4_pool MatPool = Pool<mat4>(64);
+		auto NewDeleteMat4 = [&]() {
+			Mat = new mat4;
+			delete Mat;
+		};
+		auto PoolMat4 = [&]() {
+			Mat = Alloc(&MatPool);
+			Release(&MatPool, Mat);
+		};
+		BenchmarkNoAssign("new + delete mat4", NewDeleteMat4(), Mat);
+		BenchmarkNoAssign("Alloc + Release mat4_pool", PoolMat4(), Mat);
+
+		quat* Quat;
+		quat_pool QuatPool = Pool<quat>(64);
+		auto NewDeleteQuat = [&]() {
+			Quat = new quat;
+			delete Quat;
+		};
+		auto PoolQuat = [&]() {
+			Quat = Alloc(&QuatPool);
+			Release(&QuatPool, Quat);
+		};
+		BenchmarkNoAssign("new + delete quat", NewDeleteQuat(), Quat);
+		BenchmarkNoAssign("Alloc + Release quat_pool", PoolQuat(), Quat);
+
+		Free(&Arena);
+		Free(&MatPool);
+		Free(&QuatPool);
+	}
+
+	// half precision
+	{
+		constexpr uint32_t Count = 1 << 20;
+		aligned_array<v4> Floats(Count);
+		aligned_array<v4h> Halfs(Count);
+		for(uint32_t i = 0; i < Count; ++i)
+			Floats[i] = v4((float)i * 0.001f, -(float)(i % 1000), 1.f / (float)(i + 1), 0.5f);
+
+		auto PackLoop = [&]() {
+			for(uint32_t i = 0; i < Count; ++i)
+				Halfs[i] = CastToV4h(Floats[i]);
+		};
+		auto UnpackLoop = [&]() {
+			for(uint32_t i = 0; i < Count; ++i)
+				Floats[i] = CastToV4(Halfs[i]);
+		};
+		BenchmarkNoAssign("CastToV4h() loop (1M v4)", PackLoop(), Halfs.Data[0]);
+		BenchmarkNoAssign("CastToV4() loop (1M v4h)", UnpackLoop(), Floats.Data[0]);
+		for(uint32_t Tier = SimdTier_SSE2; Tier <= GetMaxSupportedSimdTier(); ++Tier)
+		{
+			SetSimdTier((simd_tier)Tier);
+			std::string TierName = GetSimdTierName((simd_tier)Tier);
+			BenchmarkNoAssign("PackHalfArray() (1M v4) " + TierName, PackHalfArray(Floats.Data, Halfs.Data, Count), Halfs.Data[0]);
+			BenchmarkNoAssign("UnpackHalfArray() (1M v4h) " + TierName, UnpackHalfArray(Halfs.Data, Floats.Data, Count), Floats.Data[0]);
+		}
+		SetSimdTier(GetMaxSupportedSimdTier());
+	}
+
+	// octahedral normals
+	{
+		constexpr uint32_t Count = 1 << 20;
+		aligned_array<v3> Normals(Count);
+		aligned_array<v3> Decoded(Count);
+		aligned_array<uint16_t> Codes16(Count);
+		aligned_array<uint32_t> Codes32(Count);
+		for(uint32_t i = 0; i < Count; ++i)
+			Normals[i] = Normalize(v3((float)(i % 97) - 48.f, (float)(i % 89) - 44.f, (float)(i % 83) - 41.5f));
+		PackOctahedralArray(Normals.Data, Codes16.Data, Count);
+		PackOctahedralArray(Normals.Data, Codes32.Data, Count);
+
+		BenchmarkNoAssign("copy v3 array (1M v3)", memcpy(Decoded.Data, Normals.Data, Count * sizeof(v3)), Decoded.Data[0]);
+		BenchmarkNoAssign("PackOctahedralArray() (1M v3 -> u32)", PackOctahedralArray(Normals.Data, Codes32.Data, Count), Codes32.Data[0]);
+		BenchmarkNoAssign("UnpackOctahedralArray() (1M u16 -> v3)", UnpackOctahedralArray(Codes16.Data, Decoded.Data, Count), Decoded.Data[0]);
+		BenchmarkNoAssign("UnpackOctahedralArray() (1M u32 -> v3)", UnpackOctahedralArray(Codes32.Data, Decoded.Data, Count), Decoded.Data[0]);
+	}
+
+	// unorm and snorm conversions
+	{
+		constexpr uint32_t Count = 1 << 20;
+		aligned_array<v4> Colors(Count);
+		aligned_array<v4u8> Pixels(Count);
+		aligned_array<v4u16> Pixels16(Count);
+		for(uint32_t i = 0; i < Count; ++i)
+			Colors[i] = v4((float)(i % 256) / 255.f, (float)(i % 1000) / 999.f, 0.5f, 1.f);
+
+		auto PackLoop = [&]() {
+			for(uint32_t i = 0; i < Count; ++i)
+				Pixels[i] = v4u8(Colors[i].X * 255.f + 0.5f, Colors[i].Y * 255.f + 0.5f, Colors[i].Z * 255.f + 0.5f, Colors[i].W * 255.f + 0.5f);
+		};
+		auto UnpackLoop = [&]() {
+			for(uint32_t i = 0; i < Count; ++i)
+				Colors[i] = v4(Pixels[i]) * (1.f / 255.f);
+		};
+		BenchmarkNoAssign("v4u8 casting loop (1M v4 -> v4u8)", PackLoop(), Pixels.Data[0].X);
+		BenchmarkNoAssign("v4 casting loop (1M v4u8 -> v4)", UnpackLoop(), Colors.Data[0]);
+		BenchmarkNoAssign("PackUnorm8Array() (1M v4)", PackUnorm8Array(Colors.Data, Pixels.Data, Count), Pixels.Data[0].X);
+		BenchmarkNoAssign("UnpackUnorm8Array() (1M v4u8)", UnpackUnorm8Array(Pixels.Data, Colors.Data, Count), Colors.Data[0]);
+		BenchmarkNoAssign("PackUnorm16Array() (1M v4)", PackUnorm16Array(Colors.Data, Pixels16.Data, Count), Pixels16.Data[0].X);
+		BenchmarkNoAssign("UnpackUnorm16Array() (1M v4u16)", UnpackUnorm16Array(Pixels16.Data, Colors.Data, Count), Colors.Data[0]);
+	}
+
+	// srgb
+	{
+		constexpr uint32_t Count = 1 << 18;
+		aligned_array<v4> Colors(Count);
+		aligned_array<v4> Linear(Count);
+		aligned_array<v4u8> Pixels(Count);
+		for(uint32_t i = 0; i < Count; ++i)
+			Colors[i] = v4((float)(i % 256) / 255.f, (float)(i % 1000) / 999.f, 0.5f, 1.f);
+		PackSrgb8Array(Colors.Data, Pixels.Data, Count);
+
+		auto PowfLoop = [&]() {
+			for(uint32_t i = 0; i < Count; ++i)
+				for(uint32_t j = 0; j < 3; ++j)
+				{
+					float C = Colors[i].Elements[j];
+					Linear[i].Elements[j] = C <= 0.04045f ? C / 12.92f : powf((C + 0.055f) / 1.055f, 2.4f);
+				}
+		};
+		auto PowfPackLoop = [&]() {
+			for(uint32_t i = 0; i < Count; ++i)
+				for(uint32_t j = 0; j < 3; ++j)
+				{
+					float L = Colors[i].Elements[j];
+					float C = L <= 0.0031308f ? L * 12.92f : 1.055f * powf(L, 1.f / 2.4f) - 0.055f;
+					Pixels[i].Elements[j] = (uint8_t)(fminf(fmaxf(C, 0.f), 1.f) * 255.f + 0.5f);
+				}
+		};
+		BenchmarkNoAssign("srgb to linear powf loop (256K v4)", PowfLoop(), Linear.Data[0]);
+		BenchmarkNoAssign("SrgbToLinearArray() (256K v4)", SrgbToLinearArray(Colors.Data, Linear.Data, Count), Linear.Data[0]);
+		BenchmarkNoAssign("UnpackSrgb8Array() (256K v4u8)", UnpackSrgb8Array(Pixels.Data, Linear.Data, Count), Linear.Data[0]);
+		BenchmarkNoAssign("linear to srgb8 powf loop (256K v4)", PowfPackLoop(), Pixels.Data[0].X);
+		BenchmarkNoAssign("LinearToSrgbArray() (256K v4)", LinearToSrgbArray(Colors.Data, Linear.Data, Count), Linear.Data[0]);
+		BenchmarkNoAssign("PackSrgb8Array() (256K v4)", PackSrgb8Array(Colors.Data, Pixels.Data, Count), Pixels.Data[0].X);
+	}
+
+	// rect2 and rect2s
+	{
+		constexpr uint32_t Count = 4096;
+		rect2* Rects = new rect2[Count];
+		rect2s* RectsS = new rect2s[Count];
+		ankerl::nanobench::Rng Rng(42);
+		for(uint32_t i = 0; i < Count; ++i)
+		{
+			float X = (float)(Rng() % 50), Y = (float)(Rng() % 40);
+			Rects[i] = Rect2MinDim(X, Y, (float)(Rng() % 12) + 1.f, (float)(Rng() % 12) + 1.f);
+			RectsS[i] = CastToRect2s(Rects[i]);
+		}
+		rect2 Bounds = Rect2MinMax(10.f, 10.f, 40.f, 30.f);
+		rect2s BoundsS = CastToRect2s(Bounds);
+
+		auto UnionLoop = [&]() {
+			rect2 R = Rects[0];
+			for(uint32_t i = 1; i < Count; ++i)
+				R = Union(R, Rects[i]);
+			return R;
+		};
+		auto UnionLoopS = [&]() {
+			rect2s R = RectsS[0];
+			for(uint32_t i = 1; i < Count; ++i)
+				R = Union(R, RectsS[i]);
+			return R;
+		};
+		auto IntersectLoop = [&]() {
+			uint32_t Hits = 0;
+			for(uint32_t i = 0; i < Count; ++i)
+				Hits += Intersect(Bounds, Rects[i]);
+			return Hits;
+		};
+		auto IntersectLoopS = [&]() {
+			uint32_t Hits = 0;
+			for(uint32_t i = 0; i < Count; ++i)
+				Hits += Intersect(BoundsS, RectsS[i]);
+			return Hits;
+		};
+		auto IntersectionLoop = [&]() {
+			uint32_t Hits = 0;
+			rect2 R = {};
+			for(uint32_t i = 0; i < Count; ++i)
+				Hits += IntersectionRect(Bounds, Rects[i], &R);
+			return Hits + (uint32_t)R.Min.X;
+		};
+		auto IntersectionLoopS = [&]() {
+			uint32_t Hits = 0;
+			rect2s R = {};
+			for(uint32_t i = 0; i < Count; ++i)
+				Hits += IntersectionRect(BoundsS, RectsS[i], &R);
+			return Hits + (uint32_t)R.MinX();
+		};
+		auto FitLoop = [&]() {
+			float Sum = 0.f;
+			for(uint32_t i = 0; i < Count; ++i)
+				Sum += FitRectInsideBounds(Rects[i], Bounds).Min.X;
+			return Sum;
+		};
+		auto FitLoopS = [&]() {
+			float Sum = 0.f;
+			for(uint32_t i = 0; i < Count; ++i)
+				Sum += FitRectInsideBounds(RectsS[i], BoundsS).MinX();
+			return Sum;
+		};
+		uint32_t Hits;
+		float Sum;
+		Benchmark("Union() rect2 (4096)", UnionLoop().Max.X, Sum);
+		Benchmark("Union() rect2s (4096)", UnionLoopS().MaxX(), Sum);
+		Benchmark("Intersect() rect2 (4096)", IntersectLoop(), Hits);
+		Benchmark("Intersect() rect2s (4096)", IntersectLoopS(), Hits);
+		Benchmark("IntersectionRect() rect2 (4096)", IntersectionLoop(), Hits);
+		Benchmark("IntersectionRect() rect2s (4096)", IntersectionLoopS(), Hits);
+		Benchmark("FitRectInsideBounds() rect2 (4096)", FitLoop(), Sum);
+		Benchmark("FitRectInsideBounds() rect2s (4096)", FitLoopS(), Sum);
+		delete[] Rects;
+		delete[] RectsS;
 	}
 }
 
@@ -0,0 +1 @@
+rm -f unitTests benchmarks
@@ -0,0 +1,2 @@
+clang++ -std=c++20 -O2 -msse4.1 -ffast-math -DNDEBUG ../benchmarks/benchmarks.cpp -o benchmarks || exit 1
+./benchmarks
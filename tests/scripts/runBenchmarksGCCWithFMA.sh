@@ -0,0 +1,2 @@
+g++ -std=c++20 -O2 -mavx2 -mfma -ffast-math -DNDEBUG ../benchmarks/benchmarks.cpp -o benchmarks || exit 1
+./benchmarks
@@ -0,0 +1,2 @@
+g++ -std=c++20 -O2 -DFM_USE_SSE2_INSTEAD_OF_SSE4 -ffast-math -DNDEBUG ../benchmarks/benchmarks.cpp -o benchmarks || exit 1
+./benchmarks
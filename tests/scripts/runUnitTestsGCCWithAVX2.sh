@@ -0,0 +1,2 @@
+g++ -std=c++20 -Wall -Wextra -mavx2 -mfma -DDOCTEST_CONFIG_NO_POSIX_SIGNALS ../unitTests/unitTests.cpp -o unitTests || exit 1
+./unitTests
@@ -0,0 +1,2 @@
+cl /W4 /arch:AVX2 ../unitTests/unitTests.cpp /EHsc | more
+unitTests.exe
@@ -0,0 +1,98 @@
+
+TEST_CASE("aligned_array")
+{
+	aligned_array<float> A(37);
+	CHECK(A.Count == 37);
+	CHECK(A.Capacity == 48);
+	CHECK((uintptr_t)A.Data % 64 == 0);
+	for(u32 i = 0; i < A.Capacity; ++i)
+		CHECK(A.Data[i] == 0.f);
+
+	for(u32 i = 0; i < A.Count; ++i)
+		A[i] = (f32)i;
+	CHECK(A.PacketCount<4>() == 10);
+	A.ForEachPacket<4>([](__m128& P) { P = _mm_mul_ps(P, _mm_set1_ps(2.f)); });
+	f32 Sum = 0.f;
+	for(f32 F : A)
+		Sum += F;
+	CHECK(Sum == 2.f * 36.f * 37.f / 2.f);
+	CHECK(A.Data[37] == 0.f);
+
+	aligned_array<v3> V3s(5);
+	CHECK(V3s.Capacity == 5);
+	CHECK((uintptr_t)V3s.Data % 64 == 0);
+	V3s[4] = v3(1, 2, 3);
+
+	static_assert(std::is_nothrow_move_constructible_v<aligned_array<v3>> && std::is_nothrow_move_assignable_v<aligned_array<v3>>);
+	static_assert(std::is_nothrow_move_constructible_v<soa_array<v3>> && std::is_nothrow_move_assignable_v<soa_array<v3>>);
+	aligned_array<v3> Moved((aligned_array<v3>&&)V3s);
+	CHECK(V3s.Data == nullptr);
+	CHECK_V3(Moved[4], 1, 2, 3);
+	V3s = (aligned_array<v3>&&)Moved;
+	CHECK(Moved.Data == nullptr);
+	CHECK(V3s.Count == 5);
+
+	aligned_array<mat4> Mats(3);
+	CHECK((uintptr_t)&Mats[1] % 16 == 0);
+
+	aligned_array<float> Overflow((size_t)-1 / sizeof(float) + 2);
+	CHECK(Overflow.Data == nullptr);
+	CHECK(Overflow.Count == 0);
+	CHECK(Overflow.Capacity == 0);
+}
+
+TEST_CASE("soa_array")
+{
+	soa_array<v3> A(10);
+	CHECK(A.Capacity == 16);
+	CHECK((uintptr_t)A.Data % 64 == 0);
+	CHECK((uintptr_t)A.Y().data() % 64 == 0);
+	CHECK((uintptr_t)A.Z().data() % 64 == 0);
+	CHECK(A.Z().size() == 10);
+
+	for(u32 i = 0; i < A.Count; ++i)
+		A.Set(i, v3((f32)i, (f32)i * 2.f, (f32)i * 3.f));
+	CHECK_V3(A.Get(7), 7, 14, 21);
+	CHECK(A.Y()[3] == 6.f);
+
+	v3x4 P = A.GetPacket<4>(1);
+	CHECK_V3(P.GetV3(2), 6, 12, 18);
+	A.SetPacket<4>(1, Normalize(P));
+	CHECK_V3_APPROX(A.Get(6), Normalize(v3(6, 12, 18)).X, Normalize(v3(6, 12, 18)).Y, Normalize(v3(6, 12, 18)).Z);
+
+	A.ForEachPacket<4>([](__m128& X, __m128& Y, __m128& Z) {
+		X = _mm_add_ps(X, Y);
+		Z = _mm_setzero_ps();
+	});
+	CHECK_V3(A.Get(9), 27, 18, 0);
+	CHECK(A.X()[15] == 0.f);
+
+	soa_array<v2> B(3);
+	B.Set(2, v2(4, 5));
+	u32 Packets = 0;
+	B.ForEachPacket<4>([&](__m128& X, __m128& Y) {
+		X = _mm_mul_ps(X, Y);
+		++Packets;
+	});
+	CHECK(Packets == 1);
+	CHECK_V2(B.Get(2), 20, 5);
+
+	soa_array<v4> C(20);
+	C.Set(19, v4(1, 2, 3, 4));
+	CHECK(C.PacketCount<4>() == 5);
+	CHECK_V4(C.GetPacket<4>(4).GetV4(3), 1, 2, 3, 4);
+#ifdef __AVX__
+	CHECK(C.PacketCount<8>() == 3);
+	CHECK_V4(C.GetPacket<8>(2).GetV4(3), 1, 2, 3, 4);
+#endif
+
+	soa_array<v4> D((soa_array<v4>&&)C);
+	CHECK(C.Data == nullptr);
+	CHECK_V4(D.Get(19), 1, 2, 3, 4);
+
+	// NOTE: 3 * Capacity * sizeof(float) wraps around to 128 bytes
+	soa_array<v3> Overflow(((size_t)-1 / 192 + 1) * 16);
+	CHECK(Overflow.Data == nullptr);
+	CHECK(Overflow.Count == 0);
+	CHECK(Overflow.Capacity == 0);
+}
@@ -0,0 +1,173 @@
+// NOTE: UlpError, MaxUlpError4 and MaxUlpError8 come from trigonometry.cpp
+
+// NOTE: Pow error bound of the header, it grows with |Y * Log2(X)|
+static double PowUlpBound(double X, double Y)
+{
+	return 4.0 + 1.5 * fabs(Y * log2(X));
+}
+
+TEST_CASE("vector exponentials and logarithms accuracy")
+{
+	const int Count = 200000;
+	auto ExactExp = [](double X){ return exp(X); };
+	auto ExactExp2 = [](double X){ return exp2(X); };
+	auto ExactLog = [](double X){ return log(X); };
+	auto ExactLog2 = [](double X){ return log2(X); };
+
+	CHECK(MaxUlpError4(-103.f, 88.7f, Count, [](__m128 X){ return Exp(X); }, ExactExp) <= 1.5);
+	CHECK(MaxUlpError4(-149.f, 127.9f, Count, [](__m128 X){ return Exp2(X); }, ExactExp2) <= 1.5);
+	CHECK(MaxUlpError4(0.5f, 2.f, Count, [](__m128 X){ return Log(X); }, ExactLog) <= 1.5);
+	CHECK(MaxUlpError4(1e-30f, 1e30f, Count, [](__m128 X){ return Log(X); }, ExactLog) <= 1.5);
+	CHECK(MaxUlpError4(1e-45f, 1e-38f, Count, [](__m128 X){ return Log(X); }, ExactLog) <= 1.5);
+	CHECK(MaxUlpError4(0.5f, 2.f, Count, [](__m128 X){ return Log2(X); }, ExactLog2) <= 1.5);
+	CHECK(MaxUlpError4(1e-30f, 1e30f, Count, [](__m128 X){ return Log2(X); }, ExactLog2) <= 1.5);
+	CHECK(MaxUlpError4(1e-45f, 1e-38f, Count, [](__m128 X){ return Log2(X); }, ExactLog2) <= 1.5);
+
+	for(float Y : {1.f / 2.4f, 2.2f, -1.5f, 7.3f})
+	{
+		INFO("exponent " << Y);
+		double MaxRatio = 0.0;
+		for(int i = 0; i < Count; i += 4)
+		{
+			float In[4], Out[4];
+			for(int Lane = 0; Lane < 4; ++Lane)
+				In[Lane] = 1e-6f * powf(1e12f, (float)(i + Lane) / (float)Count);
+			_mm_storeu_ps(Out, Pow(_mm_loadu_ps(In), _mm_set1_ps(Y)));
+			for(int Lane = 0; Lane < 4; ++Lane)
+			{
+				double Exact = pow((double)In[Lane], (double)Y);
+				if(Exact < 3e38)
+					MaxRatio = fmax(MaxRatio, UlpError(Out[Lane], Exact) / PowUlpBound(In[Lane], Y));
+			}
+		}
+		CHECK(MaxRatio <= 1.0);
+	}
+
+#ifdef __AVX__
+	CHECK(MaxUlpError8(-103.f, 88.7f, Count, [](__m256 X){ return Exp(X); }, ExactExp) <= 1.5);
+	CHECK(MaxUlpError8(-149.f, 127.9f, Count, [](__m256 X){ return Exp2(X); }, ExactExp2) <= 1.5);
+	CHECK(MaxUlpError8(0.5f, 2.f, Count, [](__m256 X){ return Log(X); }, ExactLog) <= 1.5);
+	CHECK(MaxUlpError8(0.5f, 2.f, Count, [](__m256 X){ return Log2(X); }, ExactLog2) <= 1.5);
+	CHECK(MaxUlpError8(0.5f, 2.f, Count, [](__m256 X){ return Pow(X, _mm256_set1_ps(2.2f)); },
+		[](double X){ return pow(X, (double)2.2f); }) <= 6.0);
+#endif
+}
+
+TEST_CASE("vector exponentials and logarithms special values and vector types")
+{
+	CHECK_VEC4(Exp(Vec4(0.f, 1.f, -INFINITY, 100.f)), 1.f, FloatCmp(2.718282f), 0.f, INFINITY);
+	CHECK_VEC4(Exp2(Vec4(0.f, 10.f, -3.f, 200.f)), 1.f, 1024.f, 0.125f, INFINITY);
+	CHECK_VEC4(Log(Vec4(1.f, 0.f, INFINITY, 2.718282f)), 0.f, -INFINITY, INFINITY, FloatCmp(1.f));
+	CHECK_VEC4(Log2(Vec4(1.f, 1024.f, 0.125f, 1e-45f)), 0.f, 10.f, -3.f, -149.f);
+	CHECK(std::isnan(Log(Vec4(-1.f)).X()));
+	CHECK(std::isnan(Log2(Vec4(-0.5f)).X()));
+	CHECK(std::isnan(Exp(Vec4(NAN)).X()));
+	CHECK(std::isnan(Pow(Vec4(-2.f), 2.5f).X()));
+	CHECK_VEC4(Pow(Vec4(-2.f, -2.f, -0.5f, -0.f), Vec4(3.f, 2.f, -3.f, 3.f)), -8.f, 4.f, -8.f, -0.f);
+	CHECK(std::signbit(Pow(Vec4(-0.f), 3.f).X()));
+	CHECK(Pow(Vec4(-0.f), -3.f).X() == -INFINITY);
+	CHECK(Pow(Vec4(-3.f), 8388609.f).X() == -INFINITY);
+
+	CHECK_VEC4(Pow(Vec4(2.f, 0.f, 9.f, 0.f), Vec4(3.f, 2.f, 0.5f, 0.f)), 8.f, 0.f, 3.f, 1.f);
+	CHECK_VEC4(Pow(Vec4(0.f, 4.f, INFINITY, NAN), 0.f), 1.f, 1.f, 1.f, 1.f);
+	CHECK_VEC4(Pow(Vec4(1.f, 1.f, 1.f, 1.f), Vec4(INFINITY, -INFINITY, NAN, 2.5f)), 1.f, 1.f, 1.f, 1.f);
+	CHECK_VEC4(Pow(Vec4(-1.f, -1.f, -1.f, -1.f), Vec4(INFINITY, -INFINITY, 3.f, 2.f)), 1.f, 1.f, -1.f, 1.f);
+	CHECK(std::isnan(Pow(Vec4(-1.f), 0.5f).X()));
+	CHECK(Pow(Vec4(2.f), INFINITY).X() == INFINITY);
+	CHECK_VEC3_APPROX(Pow(Vec3(0.5f, 0.25f, 1.f), 2.2f), 0.217638f, 0.047366f, 1.f);
+	CHECK_VEC2_APPROX(Exp(Vec2(2.f, -2.f)), 7.389056f, 0.135335f);
+	CHECK_VEC2_APPROX(Log(Vec2(10.f, 0.1f)), 2.302585f, -2.302585f);
+	CHECK_VEC3_APPROX(Log2(Vec3(8.f, 0.5f, 3.f)), 3.f, -1.f, 1.584963f);
+	CHECK_VEC3_APPROX(Exp2(Vec3(0.5f, -0.5f, 1.5f)), 1.414214f, 0.707107f, 2.828427f);
+}
+
+TEST_CASE("exponential and logarithm arrays")
+{
+	const int Count = 1003;
+	static float In[Count], Out[Count];
+	static v4 Colors[Count / 4], ColorsOut[Count / 4];
+	for(int i = 0; i < Count; ++i)
+		In[i] = 0.001f + 20.f * (float)i / (float)Count;
+	memcpy(Colors, In, sizeof(Colors));
+
+	for(uint32_t Tier = SimdTier_SSE2; Tier <= GetMaxSupportedSimdTier(); ++Tier)
+	{
+		SetSimdTier((simd_tier)Tier);
+		INFO("tier " << GetSimdTierName((simd_tier)Tier));
+		double ExpError = 0.0, Exp2Error = 0.0, LogError = 0.0, Log2Error = 0.0, PowRatio = 0.0;
+		ExpArray(In, Out, Count);
+		for(int i = 0; i < Count; ++i)
+			ExpError = fmax(ExpError, UlpError(Out[i], exp((double)In[i])));
+		Exp2Array(In, Out, Count);
+		for(int i = 0; i < Count; ++i)
+			Exp2Error = fmax(Exp2Error, UlpError(Out[i], exp2((double)In[i])));
+		LogArray(In, Out, Count);
+		for(int i = 0; i < Count; ++i)
+			LogError = fmax(LogError, UlpError(Out[i], log((double)In[i])));
+		Log2Array(In, Out, Count);
+		for(int i = 0; i < Count; ++i)
+			Log2Error = fmax(Log2Error, UlpError(Out[i], log2((double)In[i])));
+		PowArray(In, 2.2f, Out, Count);
+		for(int i = 0; i < Count; ++i)
+			PowRatio = fmax(PowRatio, UlpError(Out[i], pow((double)In[i], (double)2.2f)) / PowUlpBound(In[i], 2.2f));
+		CHECK(ExpError <= 1.5);
+		CHECK(Exp2Error <= 1.5);
+		CHECK(LogError <= 1.5);
+		CHECK(Log2Error <= 1.5);
+		CHECK(PowRatio <= 1.0);
+
+		float Special[] = {0.f, -1.f, INFINITY, 1.f, 1e-45f};
+		float SpecialOut[5];
+		LogArray(Special, SpecialOut, 5);
+		CHECK(SpecialOut[0] == -INFINITY);
+		CHECK(std::isnan(SpecialOut[1]));
+		CHECK(SpecialOut[2] == INFINITY);
+		CHECK(SpecialOut[3] == 0.f);
+		CHECK(SpecialOut[4] == FloatCmp(-103.2789f));
+		PowArray(Special, 0.f, SpecialOut, 5);
+		CHECK_ARRAY4(SpecialOut, 1.f, 1.f, 1.f, 1.f);
+
+		float Negative[] = {-2.f, -0.5f, -0.f, 3.f, -1.f, -4.f, -3.f, -10.f, -1.5f};
+		float NegativeOut[9];
+		PowArray(Negative, 3.f, NegativeOut, 9);
+		CHECK_ARRAY4(NegativeOut, -8.f, -0.125f, -0.f, FloatCmp(27.f));
+		CHECK4(NegativeOut[4] == -1.f, NegativeOut[5] == -64.f, NegativeOut[6] == FloatCmp(-27.f), NegativeOut[7] == FloatCmp(-1000.f));
+		CHECK(NegativeOut[8] == FloatCmp(-3.375f));
+		CHECK(std::signbit(NegativeOut[2]));
+		PowArray(Negative, 2.f, NegativeOut, 9);
+		CHECK_ARRAY4(NegativeOut, 4.f, 0.25f, 0.f, FloatCmp(9.f));
+		CHECK(NegativeOut[8] == FloatCmp(2.25f));
+		PowArray(Negative, 8388609.f, NegativeOut, 9);
+		CHECK(NegativeOut[0] == -INFINITY);
+		CHECK(NegativeOut[3] == INFINITY);
+		PowArray(Negative, 0.5f, NegativeOut, 9);
+		CHECK(std::isnan(NegativeOut[0]));
+		CHECK(NegativeOut[2] == 0.f);
+		CHECK(std::isnan(NegativeOut[8]));
+
+		float Unit[] = {1.f, -1.f, 0.5f, 2.f, 1.f, -1.f, 1.f, -1.f, 1.f};
+		float UnitOut[9];
+		PowArray(Unit, INFINITY, UnitOut, 9);
+		CHECK_ARRAY4(UnitOut, 1.f, 1.f, 0.f, INFINITY);
+		CHECK(UnitOut[7] == 1.f);
+		CHECK(UnitOut[8] == 1.f);
+		PowArray(Unit, -INFINITY, UnitOut, 9);
+		CHECK_ARRAY4(UnitOut, 1.f, 1.f, INFINITY, 0.f);
+		PowArray(Unit, NAN, UnitOut, 9);
+		CHECK(UnitOut[0] == 1.f);
+		CHECK(std::isnan(UnitOut[1]));
+		CHECK(UnitOut[8] == 1.f);
+
+		PowArray(Colors, 1.f / 2.4f, ColorsOut, Count / 4);
+		PowArray(In, 1.f / 2.4f, Out, Count);
+		CHECK(memcmp(ColorsOut, Out, sizeof(ColorsOut)) == 0);
+
+		static float InPlace[Count];
+		memcpy(InPlace, In, sizeof(In));
+		ExpArray(InPlace, InPlace, Count);
+		ExpArray(In, Out, Count);
+		CHECK(memcmp(InPlace, Out, sizeof(Out)) == 0);
+		ExpArray(In, Out, 0);
+	}
+	SetSimdTier(GetMaxSupportedSimdTier());
+}
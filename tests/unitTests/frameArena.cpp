@@ -0,0 +1,104 @@
+
+TEST_CASE("frame_arena")
+{
+	frame_arena Arena = FrameArena(1000);
+	CHECK(Arena.Size == 1024);
+	CHECK((uintptr_t)Arena.Base % 64 == 0);
+
+	float* Floats = AllocFloatArray(&Arena, 3);
+	mat4* Mats = AllocMat4Array(&Arena, 4);
+	CHECK((uintptr_t)Floats % 64 == 0);
+	CHECK((uintptr_t)Mats % 64 == 0);
+	CHECK((uint8_t*)Mats - (uint8_t*)Floats == 64);
+	CHECK(Arena.Used == 64 + 4 * sizeof(mat4));
+
+	uint8_t* Byte = (uint8_t*)Push(&Arena, 1, 1);
+	CHECK(Byte == (uint8_t*)(Mats + 4));
+	CHECK(Push(&Arena, 1024) == nullptr);
+	size_t Used = Arena.Used;
+	CHECK(Push(&Arena, (size_t)-1 - 16) == nullptr);
+	CHECK(AllocMat4Array(&Arena, (size_t)-1 / sizeof(mat4) + 2) == nullptr);
+	CHECK(AllocFloatArray(&Arena, (size_t)-1 / 2) == nullptr);
+	CHECK(Arena.Used == Used);
+
+	for(u32 i = 0; i < 4; ++i)
+		Mats[i] = Mat4Translation((f32)i, 0.f, 0.f);
+	vec4* Points = AllocVec4Array(&Arena, 4);
+	for(u32 i = 0; i < 4; ++i)
+		Points[i] = Vec4(1.f, 2.f, 3.f, 1.f);
+	TransformPoints(Mats[3], Points, Points, 4);
+	CHECK_VEC4(Points[2], 4.f, 2.f, 3.f, 1.f);
+
+	Reset(&Arena);
+	CHECK(Arena.Used == 0);
+	CHECK((float*)AllocMat4Array(&Arena, 1) == Floats);
+	Free(&Arena);
+	CHECK(Arena.Base == nullptr);
+
+	alignas(64) static uint8_t Memory[256];
+	frame_arena External = FrameArena(Memory, sizeof(Memory));
+	CHECK((uint8_t*)AllocQuatArray(&External, 2) == Memory);
+	CHECK((uint8_t*)AllocMat4Array(&External, 3) == Memory + 64);
+	CHECK(AllocMat4Array(&External, 1) == nullptr);
+	Free(&External);
+
+	frame_arena Empty = FrameArena(0);
+	CHECK(Push(&Empty, 1, 1) == nullptr);
+	frame_arena Failed = FrameArena((size_t)1 << 62);
+	CHECK(Failed.Base == nullptr);
+	CHECK(Failed.Size == 0);
+	CHECK(AllocFloatArray(&Failed, 1) == nullptr);
+	Free(&Failed);
+
+	frame_arena* ThreadArena = ThreadFrameArena();
+	CHECK(ThreadArena == ThreadFrameArena());
+	CHECK(ThreadArena->Size == FM_THREAD_FRAME_ARENA_SIZE);
+	CHECK(AllocV3Array(ThreadArena, 100) != nullptr);
+	Reset(ThreadArena);
+}
+
+TEST_CASE("pool")
+{
+	mat4_pool Pool = fm::Pool<mat4>(3);
+	CHECK((uintptr_t)Pool.Slots % 64 == 0);
+
+	mat4* A = Alloc(&Pool);
+	mat4* B = Alloc(&Pool);
+	mat4* C = Alloc(&Pool);
+	CHECK(A != nullptr);
+	CHECK(B == A + 1);
+	CHECK(C == A + 2);
+	CHECK(Alloc(&Pool) == nullptr);
+
+	Release(&Pool, B);
+	Release(&Pool, A);
+	CHECK(Alloc(&Pool) == A);
+	CHECK(Alloc(&Pool) == B);
+	CHECK(Alloc(&Pool) == nullptr);
+
+	*C = Mat4Identity();
+	Release(&Pool, A);
+	*B = Mat4Scale(2.f);
+	CHECK(*C == Mat4Identity());
+
+	Reset(&Pool);
+	CHECK(Alloc(&Pool) == A);
+	Free(&Pool);
+	CHECK(Pool.Slots == nullptr);
+
+	quat_pool Quats = fm::Pool<quat>(2);
+	quat* Q = Alloc(&Quats);
+	*Q = QuatIdentity();
+	Release(&Quats, Q);
+	CHECK(Alloc(&Quats) == Q);
+	Free(&Quats);
+
+	mat4_pool Empty = fm::Pool<mat4>(0);
+	CHECK(Alloc(&Empty) == nullptr);
+	struct page { uint8_t Bytes[1 << 20]; };
+	pool<page> Failed = fm::Pool<page>(MaxU32);
+	CHECK(Failed.Slots == nullptr);
+	CHECK(Failed.Capacity == 0);
+	CHECK(Alloc(&Failed) == nullptr);
+	Free(&Failed);
+}
@@ -0,0 +1,117 @@
+
+static f32 FloatFromBits(u32 Bits)
+{
+	f32 F;
+	memcpy(&F, &Bits, sizeof(F));
+	return F;
+}
+
+TEST_CASE("half precision conversions")
+{
+	CHECK(HalfFromFloat(1.f) == 0x3C00);
+	CHECK(HalfFromFloat(-2.f) == 0xC000);
+	CHECK(HalfFromFloat(0.f) == 0x0000);
+	CHECK(HalfFromFloat(-0.f) == 0x8000);
+	CHECK(HalfFromFloat(65504.f) == 0x7BFF);
+	CHECK(HalfFromFloat(65519.f) == 0x7BFF);
+	CHECK(HalfFromFloat(65520.f) == 0x7C00);
+	CHECK(HalfFromFloat(INFINITY) == 0x7C00);
+	CHECK(HalfFromFloat(-INFINITY) == 0xFC00);
+	CHECK((HalfFromFloat(NAN) & 0x7C00) == 0x7C00);
+	CHECK((HalfFromFloat(NAN) & 0x3FF) != 0);
+	CHECK(HalfFromFloat(ldexpf(1.f, -24)) == 0x0001);
+	CHECK(HalfFromFloat(ldexpf(1.f, -25)) == 0x0000);
+	CHECK(HalfFromFloat(ldexpf(1.5f, -25)) == 0x0001);
+	CHECK(HalfFromFloat(ldexpf(3.f, -25)) == 0x0002);
+	CHECK(HalfFromFloat(ldexpf(1.f, -14)) == 0x0400);
+	CHECK(HalfFromFloat(1.f + ldexpf(1.f, -11)) == 0x3C00);
+	CHECK(HalfFromFloat(1.f + ldexpf(3.f, -11)) == 0x3C02);
+	CHECK(HalfFromFloat(FloatFromBits(1)) == 0x0000);
+
+	CHECK(FloatFromHalf(0x3C00) == 1.f);
+	CHECK(FloatFromHalf(0xC000) == -2.f);
+	CHECK(FloatFromHalf(0x7BFF) == 65504.f);
+	CHECK(FloatFromHalf(0x0001) == ldexpf(1.f, -24));
+	CHECK(FloatFromHalf(0x83FF) == -ldexpf(1023.f, -24));
+	CHECK(FloatFromHalf(0xFC00) == -INFINITY);
+	CHECK(std::isnan(FloatFromHalf(0x7E00)));
+
+	u32 RoundTripErrors = 0;
+	for(u32 H = 0; H <= 0xFFFF; ++H)
+	{
+		f32 F = FloatFromHalf((u16)H);
+		if(std::isnan(F))
+			RoundTripErrors += (H & 0x7C00) != 0x7C00 || (H & 0x3FF) == 0;
+		else
+			RoundTripErrors += HalfFromFloat(F) != H;
+	}
+	CHECK(RoundTripErrors == 0);
+
+	v4h H4 = CastToV4h(v4(1.f, -0.5f, 2048.f, 0.1f));
+	CHECK(H4.X == 0x3C00);
+	CHECK(H4.Y == 0xB800);
+	CHECK(H4.Z == 0x6800);
+	CHECK(H4.W == 0x2E66);
+	CHECK_V4(CastToV4(H4), 1.f, -0.5f, 2048.f, FloatFromHalf(0x2E66));
+	CHECK_VEC4(CastToVec4(CastToV4h(Vec4(3.f, 4.f, 5.f, 6.f))), 3.f, 4.f, 5.f, 6.f);
+	CHECK_V3(CastToV3(CastToV3h(v3(7.f, 8.f, 9.f))), 7.f, 8.f, 9.f);
+	CHECK_V2(CastToV2(CastToV2h(v2(-7.f, 0.25f))), -7.f, 0.25f);
+}
+
+TEST_CASE("half precision arrays give the same result on every simd tier")
+{
+	// NOTE: Random bit patterns cover every exponent, including subnormals, plus values near the rounding edges
+	constexpr u32 Count = 4099;
+	f32* In = new f32[Count];
+	u32 State = 12345;
+	for(u32 i = 0; i < Count; ++i)
+	{
+		State = State * 1664525u + 1013904223u;
+		f32 F = FloatFromBits(State);
+		In[i] = std::isnan(F) ? (f32)i : F;
+	}
+	In[0] = 65519.99f;
+	In[1] = ldexpf(1.f, -25);
+	In[2] = -ldexpf(1.00001f, -25);
+
+	u16* Expected = new u16[Count];
+	u16* Halfs = new u16[Count];
+	f32* Out = new f32[Count];
+	for(u32 i = 0; i < Count; ++i)
+		Expected[i] = HalfFromFloat(In[i]);
+
+	simd_tier MaxTier = GetMaxSupportedSimdTier();
+	for(uint32_t Tier = SimdTier_SSE2; Tier <= MaxTier; ++Tier)
+	{
+		INFO("Tier: " << GetSimdTierName((simd_tier)Tier));
+		SetSimdTier((simd_tier)Tier);
+		PackHalfArray(In, Halfs, Count);
+		CHECK(memcmp(Halfs, Expected, Count * sizeof(u16)) == 0);
+		UnpackHalfArray(Halfs, Out, Count);
+		u32 Mismatches = 0;
+		for(u32 i = 0; i < Count; ++i)
+			Mismatches += Out[i] != FloatFromHalf(Expected[i]);
+		CHECK(Mismatches == 0);
+
+		v3 V3s[5] = {v3(1.f, 2.f, 3.f), v3(-1.f), v3(0.5f), v3(4.f, 5.f, 6.f), v3(1000.f, -0.125f, 7.f)};
+		v3h V3hs[5];
+		v3 V3sOut[5];
+		PackHalfArray(V3s, V3hs, 5);
+		UnpackHalfArray(V3hs, V3sOut, 5);
+		CHECK_V3(V3sOut[4], 1000.f, -0.125f, 7.f);
+		CHECK(V3hs[3].Z == HalfFromFloat(6.f));
+
+		vec4 Vec4s[3] = {Vec4(1.f, 2.f, 3.f, 4.f), Vec4(5.f), Vec4(-6.f, 7.f, 8.f, 9.f)};
+		v4h V4hs[3];
+		PackHalfArray(Vec4s, V4hs, 3);
+		vec4 Vec4sOut[3];
+		UnpackHalfArray(V4hs, Vec4sOut, 3);
+		CHECK_VEC4(Vec4sOut[2], -6.f, 7.f, 8.f, 9.f);
+	}
+	SetSimdTier(MaxTier);
+
+	delete[] In;
+	delete[] Expected;
+	delete[] Halfs;
+	delete[] Out;
+}
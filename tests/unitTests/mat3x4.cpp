@@ -0,0 +1,134 @@
+
+#define CHECK_ALL_MAT3X4_ENTRIES(Mat, A, B, C, D, \
+                                      E, F, G, H, \
+                                      I, J, K, L) { \
+	mat3x4 _Mat3x4 = Mat; \
+	CHECK4(_Mat3x4[0] == A, _Mat3x4[1] == B, _Mat3x4[2] == C, _Mat3x4[3] == D); \
+	CHECK4(_Mat3x4[4] == E, _Mat3x4[5] == F, _Mat3x4[6] == G, _Mat3x4[7] == H); \
+	CHECK4(_Mat3x4[8] == I, _Mat3x4[9] == J, _Mat3x4[10] == K, _Mat3x4[11] == L); }
+
+TEST_CASE("mat3x4 construction and conversions")
+{
+	CHECK(sizeof(mat3x4) == 48);
+
+	CHECK_ALL_MAT3X4_ENTRIES(Mat3x4Identity(),
+		1.f, 0.f, 0.f, 0.f,
+		0.f, 1.f, 0.f, 0.f,
+		0.f, 0.f, 1.f, 0.f);
+
+	mat3x4 M = Mat3x4FromRows(
+		1.f, 2.f, 3.f, 4.f,
+		5.f, 6.f, 7.f, 8.f,
+		9.f, 10.f, 11.f, 12.f);
+	CHECK_ALL_MAT3X4_ENTRIES(M,
+		1.f, 2.f, 3.f, 4.f,
+		5.f, 6.f, 7.f, 8.f,
+		9.f, 10.f, 11.f, 12.f);
+	CHECK_V4(M.GetRowV4(1), 5.f, 6.f, 7.f, 8.f);
+	CHECK_VEC4(M.GetRowVec4(2), 9.f, 10.f, 11.f, 12.f);
+	CHECK_V3(M.GetTranslationV3(), 4.f, 8.f, 12.f);
+	CHECK_VEC3(M.GetTranslationVec3(), 4.f, 8.f, 12.f);
+
+	float Mem[12] = {1.f, 2.f, 3.f, 4.f, 5.f, 6.f, 7.f, 8.f, 9.f, 10.f, 11.f, 12.f};
+	CHECK(Mat3x4FromRowMajorMemory(Mem) == M);
+	CHECK(Mat3x4FromRows(v4(1.f, 2.f, 3.f, 4.f), v4(5.f, 6.f, 7.f, 8.f), v4(9.f, 10.f, 11.f, 12.f)) == M);
+	CHECK(Mat3x4FromRows(Vec4(1.f, 2.f, 3.f, 4.f), Vec4(5.f, 6.f, 7.f, 8.f), Vec4(9.f, 10.f, 11.f, 12.f)) == M);
+	CHECK(M != Mat3x4Identity());
+
+	CHECK_ALL_MATRIX_ENTRIES(Mat4FromMat3x4(M),
+		1.f, 2.f, 3.f, 4.f,
+		5.f, 6.f, 7.f, 8.f,
+		9.f, 10.f, 11.f, 12.f,
+		0.f, 0.f, 0.f, 1.f);
+	CHECK(Mat3x4FromMat4(Mat4FromMat3x4(M)) == M);
+
+	mat4 Affine = Mat4TranslationScaleRotationDegrees(v3(1.f, 2.f, 3.f), v3(2.f, 3.f, 4.f), 30.f, v3(0.f, 1.f, 0.f));
+	CHECK(Mat4FromMat3x4(Mat3x4FromMat4(Affine)) == Affine);
+
+	CHECK(Mat4FromMat3x4(Mat3x4Translation(1.f, 2.f, 3.f)) == Mat4Translation(1.f, 2.f, 3.f));
+	CHECK(Mat4FromMat3x4(Mat3x4Translation(v3(1.f, 2.f, 3.f))) == Mat4Translation(1.f, 2.f, 3.f));
+	CHECK(Mat4FromMat3x4(Mat3x4Translation(Vec3(1.f, 2.f, 3.f))) == Mat4Translation(1.f, 2.f, 3.f));
+	CHECK(Mat4FromMat3x4(Mat3x4Scale(2.f)) == Mat4Scale(2.f));
+	CHECK(Mat4FromMat3x4(Mat3x4Scale(2.f, 3.f, 4.f)) == Mat4Scale(2.f, 3.f, 4.f));
+	CHECK(Mat4FromMat3x4(Mat3x4Scale(v3(2.f, 3.f, 4.f))) == Mat4Scale(2.f, 3.f, 4.f));
+	CHECK(Mat4FromMat3x4(Mat3x4Scale(Vec3(2.f, 3.f, 4.f))) == Mat4Scale(2.f, 3.f, 4.f));
+	CHECK(Mat4FromMat3x4(Mat3x4RotationDegrees(30.f, 0.f, 1.f, 0.f)) == Mat4RotationDegrees(30.f, 0.f, 1.f, 0.f));
+	CHECK(Mat4FromMat3x4(Mat3x4RotationDegrees(30.f, v3(0.f, 1.f, 0.f))) == Mat4RotationDegrees(30.f, v3(0.f, 1.f, 0.f)));
+	CHECK(Mat4FromMat3x4(Mat3x4RotationRadians(1.f, Vec3(1.f, 0.f, 0.f))) == Mat4RotationRadians(1.f, Vec3(1.f, 0.f, 0.f)));
+}
+
+TEST_CASE("mat3x4 composition and transforms")
+{
+	mat4 A = Mat4Translation(1.f, -2.f, 3.f) * Mat4RotationDegrees(40.f, 1.f, 0.f, 0.f) * Mat4Scale(2.f, 3.f, 0.5f);
+	mat4 B = Mat4TranslationRotationDegrees(v3(4.f, 5.f, 6.f), 70.f, Normalize(v3(1.f, 1.f, 0.f)));
+	mat3x4 A3x4 = Mat3x4FromMat4(A);
+	mat3x4 B3x4 = Mat3x4FromMat4(B);
+
+	mat4 AB = A * B;
+	CHECK_ALL_MATRIX_ENTRIES_APPROX(Mat4FromMat3x4(A3x4 * B3x4),
+		AB[0], AB[4], AB[8], AB[12],
+		AB[1], AB[5], AB[9], AB[13],
+		AB[2], AB[6], AB[10], AB[14],
+		0.f, 0.f, 0.f, 1.f);
+
+	mat3x4 C = A3x4;
+	C *= B3x4;
+	CHECK(C == A3x4 * B3x4);
+
+	CHECK_ALL_MAT3X4_ENTRIES(Mat3x4Translation(1.f, 2.f, 3.f) * Mat3x4Scale(2.f),
+		2.f, 0.f, 0.f, 1.f,
+		0.f, 2.f, 0.f, 2.f,
+		0.f, 0.f, 2.f, 3.f);
+
+	v4 P = A * v4(1.f, 2.f, 3.f, 1.f);
+	v4 D = A * v4(1.f, 2.f, 3.f, 0.f);
+	CHECK_V3_APPROX(TransformPoint(A3x4, v3(1.f, 2.f, 3.f)), P.X, P.Y, P.Z);
+	CHECK_VEC3_APPROX(TransformPoint(A3x4, Vec3(1.f, 2.f, 3.f)), P.X, P.Y, P.Z);
+	CHECK_V3_APPROX(TransformDirection(A3x4, v3(1.f, 2.f, 3.f)), D.X, D.Y, D.Z);
+	CHECK_VEC3_APPROX(TransformDirection(A3x4, Vec3(1.f, 2.f, 3.f)), D.X, D.Y, D.Z);
+
+	// NOTE: The W of a vec3 register is not guaranteed to be 0
+	vec3 Dirty = Vec3(_mm_setr_ps(1.f, 2.f, 3.f, 100.f));
+	CHECK_VEC3_APPROX(TransformPoint(A3x4, Dirty), P.X, P.Y, P.Z);
+	CHECK_VEC3_APPROX(TransformDirection(A3x4, Dirty), D.X, D.Y, D.Z);
+}
+
+TEST_CASE("mat3x4 determinant and inverse")
+{
+	CHECK(Determinant(Mat3x4Identity()) == 1.f);
+	CHECK(Determinant(Mat3x4Scale(2.f, 3.f, 4.f)) == FloatCmp(24.f));
+	CHECK(Determinant(Mat3x4Translation(5.f, 6.f, 7.f)) == FloatCmp(1.f));
+
+	mat4 Affine = Mat4Translation(1.f, -2.f, 3.f) * Mat4RotationDegrees(40.f, 1.f, 0.f, 0.f) * Mat4Scale(2.f, 3.f, 0.5f);
+	Affine.SetColumn(1, Affine.GetColumnVec4(1) + Affine.GetColumnVec4(0)); // shear
+	mat4 Rigid = Mat4TranslationRotationDegrees(v3(4.f, 5.f, 6.f), 70.f, Normalize(v3(1.f, 1.f, 0.f)));
+	mat3x4 Affine3x4 = Mat3x4FromMat4(Affine);
+	mat3x4 Rigid3x4 = Mat3x4FromMat4(Rigid);
+
+	CHECK(Determinant(Affine3x4) == FloatCmp(Determinant(Affine)));
+
+	auto CheckIdentity = [](mat3x4 M) {
+		CHECK_ALL_MATRIX_ENTRIES_APPROX(Mat4FromMat3x4(M),
+			1.f, 0.f, 0.f, 0.f,
+			0.f, 1.f, 0.f, 0.f,
+			0.f, 0.f, 1.f, 0.f,
+			0.f, 0.f, 0.f, 1.f);
+	};
+	CheckIdentity(Inverse(Affine3x4) * Affine3x4);
+	CheckIdentity(Affine3x4 * Inverse(Affine3x4));
+	CheckIdentity(Inverse(Rigid3x4) * Rigid3x4);
+	CheckIdentity(InverseRigid(Rigid3x4) * Rigid3x4);
+	CheckIdentity(Rigid3x4 * InverseRigid(Rigid3x4));
+
+	mat4 Expected = InverseAffine(Affine);
+	CHECK_ALL_MATRIX_ENTRIES_APPROX(Mat4FromMat3x4(Inverse(Affine3x4)),
+		Expected[0], Expected[4], Expected[8], Expected[12],
+		Expected[1], Expected[5], Expected[9], Expected[13],
+		Expected[2], Expected[6], Expected[10], Expected[14],
+		0.f, 0.f, 0.f, 1.f);
+
+	CHECK_ALL_MAT3X4_ENTRIES(Inverse(Mat3x4Scale(2.f, 4.f, 8.f)),
+		0.5f, 0.f, 0.f, 0.f,
+		0.f, 0.25f, 0.f, 0.f,
+		0.f, 0.f, 0.125f, 0.f);
+}
@@ -520,6 +520,35 @@ TEST_CASE("mat4 Perspective projection")
 	CHECK_V4(Persp * P2, 2.5f, 5.f, -5.f, 5.f);
 }
 
+TEST_CASE("mat4 constant builders")
+{
+	constexpr mat4_constant Translation = Mat4TranslationConstant(1.f, 2.f, 3.f);
+	constexpr mat4_constant Ortho = Mat4OrthographicConstant(-10.f, 10.f, -5.f, 5.f, 0.f, -10.f);
+	constexpr mat4_constant Persp = Mat4PerspectiveConstant(90.0f, 2.0f, 5.0f, 15.0f);
+	static_assert(Translation.Columns[3] == v4(1.f, 2.f, 3.f, 1.f));
+	static_assert(Ortho.Columns[0].X == 0.1f);
+	static_assert(Persp.Columns[1].Y > 0.9999f && Persp.Columns[1].Y < 1.0001f);
+	
+	mat4 T = Mat4FromConstant(Translation);
+	mat4 Expected = Mat4Translation(1.f, 2.f, 3.f);
+	CHECK(memcmp(&T, &Expected, sizeof(mat4)) == 0);
+	
+	mat4 O = Mat4FromConstant(Ortho);
+	Expected = Mat4Orthographic(-10.f, 10.f, -5.f, 5.f, 0.f, -10.f);
+	CHECK(memcmp(&O, &Expected, sizeof(mat4)) == 0);
+	
+	mat4 P = Mat4FromConstant(Persp);
+	Expected = Mat4Perspective(90.0f, 2.0f, 5.0f, 15.0f);
+	for(uint32_t i = 0; i < 16; ++i)
+		CHECK(P[i] == FloatCmp(Expected[i]));
+	
+	for(float Fov = 10.f; Fov < 175.f; Fov += 15.f)
+	{
+		INFO("Fov: " << Fov);
+		CHECK(Mat4PerspectiveConstant(Fov, 1.f, 1.f, 10.f).Columns[1].Y == FloatCmp(Mat4Perspective(Fov, 1.f, 1.f, 10.f)[5]));
+	}
+}
+
 TEST_CASE("mat4 look at")
 {
 	mat4 ViewMat = Mat4LookAt(Vec3(0.f), Vec3(0.f, 0.f, 5.f));
@@ -530,3 +559,257 @@ TEST_CASE("mat4 look at")
 
 	// TODO: Make more tests for look at function
 }
+
+TEST_CASE("mat4 batch transforms")
+{
+	mat4 M = Mat4Translation(1.f, 2.f, 3.f) * Mat4RotationDegrees(90.f, 0.f, 0.f, 1.f) * Mat4Scale(2.f);
+	mat4 Persp = Mat4Perspective(90.0f, 2.0f, 5.0f, 15.0f);
+
+	// NOTE: Odd count, so the two-per-register loops also run their tails
+	constexpr uint32_t Count = 7;
+	v3 InV3[Count];
+	vec3 InVec3[Count];
+	v4 InV4[Count];
+	vec4 InVec4[Count];
+	for(uint32_t i = 0; i < Count; ++i)
+	{
+		InV3[i] = v3((float)i, (float)i + 1.f, -(float)i - 5.f);
+		InVec3[i] = CastToVec3(InV3[i]);
+		InV4[i] = v4(InV3[i], 7.f);
+		InVec4[i] = CastToVec4(InV4[i]);
+	}
+
+	simd_tier MaxTier = GetMaxSupportedSimdTier();
+	for(uint32_t Tier = SimdTier_SSE2; Tier <= MaxTier; ++Tier)
+	{
+		INFO("Tier: " << GetSimdTierName((simd_tier)Tier));
+		SetSimdTier((simd_tier)Tier);
+
+		v3 OutV3[Count];
+		vec3 OutVec3[Count];
+		v4 OutV4[Count];
+		vec4 OutVec4[Count];
+
+		TransformPoints(M, InV3, OutV3, Count);
+		TransformPoints(M, InVec3, OutVec3, Count);
+		TransformPoints(M, InV4, OutV4, Count);
+		TransformPoints(M, InVec4, OutVec4, Count);
+		for(uint32_t i = 0; i < Count; ++i)
+		{
+			vec4 Expected = M * Vec4(InVec3[i], 1.f);
+			CHECK_V3_APPROX(OutV3[i], Expected.X(), Expected.Y(), Expected.Z());
+			CHECK_VEC3_APPROX(OutVec3[i], Expected.X(), Expected.Y(), Expected.Z());
+			CHECK(_mm_cvtss_f32(_mm_shuffle_ps(OutVec3[i].M, OutVec3[i].M, _MM_SHUFFLE(3, 3, 3, 3))) == 0.f);
+			CHECK_V4_APPROX(OutV4[i], Expected.X(), Expected.Y(), Expected.Z(), Expected.W());
+			CHECK_VEC4_APPROX(OutVec4[i], Expected.X(), Expected.Y(), Expected.Z(), Expected.W());
+		}
+
+		TransformDirections(M, InV3, OutV3, Count);
+		TransformDirections(M, InVec4, OutVec4, Count);
+		for(uint32_t i = 0; i < Count; ++i)
+		{
+			vec4 Expected = M * Vec4(InVec3[i], 0.f);
+			CHECK_V3_APPROX(OutV3[i], Expected.X(), Expected.Y(), Expected.Z());
+			CHECK_VEC4_APPROX(OutVec4[i], Expected.X(), Expected.Y(), Expected.Z(), Expected.W());
+		}
+
+		TransformAndProjectPoints(Persp, InV3, OutV3, Count);
+		TransformAndProjectPoints(Persp, InV4, OutV4, Count);
+		for(uint32_t i = 0; i < Count; ++i)
+		{
+			vec4 Expected = Persp * Vec4(InVec3[i], 1.f);
+			Expected = Expected / Expected.W();
+			CHECK_V3_APPROX(OutV3[i], Expected.X(), Expected.Y(), Expected.Z());
+			CHECK_V4_APPROX(OutV4[i], Expected.X(), Expected.Y(), Expected.Z(), 1.f);
+		}
+
+		// in place
+		v3 InPlace[Count];
+		memcpy(InPlace, InV3, sizeof(InPlace));
+		TransformPoints(M, InPlace, InPlace, Count);
+		TransformPoints(M, InV3, OutV3, Count);
+		for(uint32_t i = 0; i < Count; ++i)
+			CHECK_V3(InPlace[i], OutV3[i].X, OutV3[i].Y, OutV3[i].Z);
+
+		// big enough output to use the streaming stores
+		constexpr uint32_t BigCount = (FM_STREAMING_STORES_MIN_BYTES / sizeof(vec4)) + 3;
+		vec4* Big = new vec4[BigCount];
+		for(uint32_t i = 0; i < BigCount; ++i)
+			Big[i] = Vec4((float)(i % 100), 1.f, 2.f, 0.f);
+		TransformPoints(M, Big, Big, BigCount);
+		for(uint32_t i = BigCount - 5; i < BigCount; ++i)
+		{
+			vec4 Expected = M * Vec4((float)(i % 100), 1.f, 2.f, 1.f);
+			CHECK_VEC4_APPROX(Big[i], Expected.X(), Expected.Y(), Expected.Z(), Expected.W());
+		}
+		delete[] Big;
+	}
+	SetSimdTier(MaxTier);
+}
+
+TEST_CASE("mat4 array multiplication")
+{
+	constexpr uint32_t Count = 5;
+	mat4 A[Count], B[Count], Out[Count];
+	for(uint32_t i = 0; i < Count; ++i)
+	{
+		A[i] = Mat4Translation((float)i, 2.f, 3.f) * Mat4Scale(1.f + (float)i);
+		B[i] = Mat4RotationDegrees(30.f * (float)i, 0.f, 1.f, 0.f);
+		// NOTE: Not exactly representable sums, so a different grouping of the terms shows up in the bits
+		for(uint32_t Element = 0; Element < 16; ++Element)
+		{
+			A[i][Element] += 0.1f * (float)Element;
+			B[i][Element] -= 0.07f * (float)(Element % 5);
+		}
+	}
+
+	simd_tier MaxTier = GetMaxSupportedSimdTier();
+	for(uint32_t Tier = SimdTier_SSE2; Tier <= MaxTier; ++Tier)
+	{
+		INFO("Tier: " << GetSimdTierName((simd_tier)Tier));
+		SetSimdTier((simd_tier)Tier);
+
+		MultiplyMat4Arrays(A, B, Out, Count);
+		for(uint32_t i = 0; i < Count; ++i)
+		{
+			vec4 P = Vec4(1.f, -2.f, 3.f, 1.f);
+			vec4 Expected = A[i] * (B[i] * P);
+			CHECK_VEC4_APPROX(Out[i] * P, Expected.X(), Expected.Y(), Expected.Z(), Expected.W());
+			mat4 Single = A[i] * B[i];
+			CHECK(memcmp(&Out[i], &Single, sizeof(mat4)) == 0);
+		}
+
+		// Out aliasing A
+		mat4 InPlace[Count];
+		memcpy(InPlace, A, sizeof(InPlace));
+		MultiplyMat4Arrays(InPlace, B, InPlace, Count);
+		for(uint32_t i = 0; i < Count; ++i)
+			for(uint32_t Element = 0; Element < 16; ++Element)
+				CHECK(InPlace[i][Element] == FloatCmp(Out[i][Element]));
+	}
+	SetSimdTier(MaxTier);
+}
+
+TEST_CASE("mat4 in place updates match the full product")
+{
+	mat4 M;
+	for(uint32_t i = 0; i < 16; ++i)
+		M[i] = 0.37f * (float)i - 2.9f + (i % 3 == 0 ? 0.11f : -0.05f);
+	const float Angle = 0.83f;
+
+	simd_tier MaxTier = GetMaxSupportedSimdTier();
+	for(uint32_t Tier = SimdTier_SSE2; Tier <= MaxTier; ++Tier)
+	{
+		INFO("Tier: " << GetSimdTierName((simd_tier)Tier));
+		SetSimdTier((simd_tier)Tier);
+
+		mat4 Got = M;
+		RotateAroundXAxisRadians(&Got, Angle);
+		mat4 Expected = M * Mat4RotationAroundXAxisRadians(Angle);
+		CHECK(memcmp(&Got, &Expected, sizeof(mat4)) == 0);
+
+		Got = M;
+		RotateAroundYAxisRadians(&Got, Angle);
+		Expected = M * Mat4RotationAroundYAxisRadians(Angle);
+		CHECK(memcmp(&Got, &Expected, sizeof(mat4)) == 0);
+
+		Got = M;
+		RotateAroundZAxisDegrees(&Got, 47.f);
+		Expected = M * Mat4RotationAroundZAxisDegrees(47.f);
+		CHECK(memcmp(&Got, &Expected, sizeof(mat4)) == 0);
+
+		Got = M;
+		ShearXAxis(&Got, 0.3f, -1.7f);
+		Expected = M * Mat4ShearXAxis(0.3f, -1.7f);
+		CHECK(memcmp(&Got, &Expected, sizeof(mat4)) == 0);
+
+		Got = M;
+		ShearYAxis(&Got, 2.1f, 0.45f);
+		Expected = M * Mat4ShearYAxis(2.1f, 0.45f);
+		CHECK(memcmp(&Got, &Expected, sizeof(mat4)) == 0);
+
+		Got = M;
+		ShearZAxis(&Got, -0.6f, 1.3f);
+		Expected = M * Mat4ShearZAxis(-0.6f, 1.3f);
+		CHECK(memcmp(&Got, &Expected, sizeof(mat4)) == 0);
+
+		Got = M;
+		Shear(&Got, 0.1f, 0.2f, 0.3f, -0.4f, 0.5f, -0.6f);
+		Expected = M * Mat4Shear(0.1f, 0.2f, 0.3f, -0.4f, 0.5f, -0.6f);
+		CHECK(memcmp(&Got, &Expected, sizeof(mat4)) == 0);
+	}
+	SetSimdTier(MaxTier);
+
+	// NOTE: Scale only touches the main diagonal
+	mat4 Got = M;
+	Scale(&Got, 1.5f, -2.f, 0.3f);
+	mat4 Expected = M;
+	Expected[0] *= 1.5f;
+	Expected[5] *= -2.f;
+	Expected[10] *= 0.3f;
+	CHECK(memcmp(&Got, &Expected, sizeof(mat4)) == 0);
+
+	Got = M;
+	Scale(&Got, Vec3(1.5f, -2.f, 0.3f));
+	Expected[15] = 1.f;
+	CHECK(memcmp(&Got, &Expected, sizeof(mat4)) == 0);
+}
+
+TEST_CASE("mat4 determinant and inverse")
+{
+	CHECK(Determinant(Mat4Identity()) == 1.f);
+	CHECK(Determinant(Mat4Scale(2.f, 3.f, 4.f)) == FloatCmp(24.f));
+	CHECK(Determinant(Mat4FromRows(
+		1.f, 2.f, 3.f, 4.f,
+		5.f, 6.f, 7.f, 8.f,
+		9.f, 10.f, 11.f, 12.f,
+		13.f, 14.f, 15.f, 16.f)) == FloatCmp(0.f));
+	CHECK(Determinant(Mat4FromRows(
+		2.f, 0.f, 1.f, 3.f,
+		1.f, 1.f, 0.f, 2.f,
+		0.f, 3.f, 1.f, 1.f,
+		4.f, 1.f, 2.f, 0.f)) == FloatCmp(-32.f));
+
+	mat4 General = Mat4FromRows(
+		2.f, 0.f, 1.f, 3.f,
+		1.f, 1.f, 0.f, 2.f,
+		0.f, 3.f, 1.f, 1.f,
+		4.f, 1.f, 2.f, 0.f);
+	mat4 Perspective = Mat4Perspective(90.0f, 2.0f, 5.0f, 15.0f) * Mat4LookAt(v3(1, 2, 3), v3(0, 0, 0));
+	mat4 Affine = Mat4Translation(1.f, -2.f, 3.f) * Mat4RotationDegrees(40.f, 1.f, 0.f, 0.f) * Mat4Scale(2.f, 3.f, 0.5f);
+	Affine.SetColumn(1, Affine.GetColumnVec4(1) + Affine.GetColumnVec4(0)); // shear
+	mat4 Rigid = Mat4TranslationRotationDegrees(v3(4.f, 5.f, 6.f), 70.f, Normalize(v3(1.f, 1.f, 0.f)));
+	mat4 View = Mat4LookAt(v3(1, 2, 3), v3(0, 0, 0));
+
+	auto CheckIdentity = [](mat4 M) {
+		CHECK_ALL_MATRIX_ENTRIES_APPROX(M,
+			1.f, 0.f, 0.f, 0.f,
+			0.f, 1.f, 0.f, 0.f,
+			0.f, 0.f, 1.f, 0.f,
+			0.f, 0.f, 0.f, 1.f);
+	};
+	CheckIdentity(Inverse(General) * General);
+	CheckIdentity(General * Inverse(General));
+	CheckIdentity(Inverse(Perspective) * Perspective);
+	CheckIdentity(Inverse(Affine) * Affine);
+	CheckIdentity(InverseAffine(Affine) * Affine);
+	CheckIdentity(InverseAffine(Rigid) * Rigid);
+	CheckIdentity(InverseRigid(Rigid) * Rigid);
+	CheckIdentity(InverseRigid(View) * View);
+
+	CHECK_ALL_MATRIX_ENTRIES_APPROX(Inverse(Mat4Scale(2.f, 4.f, 8.f)),
+		0.5f, 0.f, 0.f, 0.f,
+		0.f, 0.25f, 0.f, 0.f,
+		0.f, 0.f, 0.125f, 0.f,
+		0.f, 0.f, 0.f, 1.f);
+
+	mat4 In[3] = {General, Affine, Rigid};
+	mat4 Out[3];
+	InverseMat4Array(In, Out, 3);
+	CheckIdentity(Out[0] * General);
+	InverseAffineMat4Array(In + 1, Out, 2);
+	CheckIdentity(Out[0] * Affine);
+	CheckIdentity(Out[1] * Rigid);
+	InverseRigidMat4Array(In + 2, In + 2, 1);
+	CheckIdentity(In[2] * Rigid);
+}
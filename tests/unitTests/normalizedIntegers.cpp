@@ -0,0 +1,137 @@
+
+TEST_CASE("unorm and snorm conversions")
+{
+	CHECK(sizeof(v4u8) == 4);
+	CHECK(sizeof(v4u16) == 8);
+
+	v4u8 U8 = PackUnorm8(Vec4(0.f, 1.f, 0.5f, 2.f));
+	CHECK4(U8.X == 0, U8.Y == 255, U8.Z == 128, U8.W == 255);
+	U8 = PackUnorm8(v4(-1.f, NAN, 1.f / 255.f, 0.499f / 255.f));
+	CHECK4(U8.X == 0, U8.Y == 0, U8.Z == 1, U8.W == 0);
+	CHECK_VEC4(Vec4FromUnorm8(v4u8(0, 255, 51, 1)), 0.f, 1.f, 0.2f, 1.f / 255.f);
+
+	v4i8 I8 = PackSnorm8(Vec4(-1.f, 1.f, -3.f, 0.5f));
+	CHECK4(I8.X == -127, I8.Y == 127, I8.Z == -127, I8.W == 64);
+	I8 = PackSnorm8(v4(NAN, -0.f, INFINITY, -INFINITY));
+	CHECK4(I8.X == 0, I8.Y == 0, I8.Z == 127, I8.W == -127);
+	CHECK_V4(V4FromSnorm8(v4i8(-128, -127, 0, 127)), -1.f, -1.f, 0.f, 1.f);
+
+	v4u16 U16 = PackUnorm16(Vec4(0.f, 1.f, 0.5f, -2.f));
+	CHECK4(U16.X == 0, U16.Y == 65535, U16.Z == 32768, U16.W == 0);
+	CHECK_V4(V4FromUnorm16(v4u16(0, 65535, 13107, 1)), 0.f, 1.f, 0.2f, 1.f / 65535.f);
+
+	v4i16 I16 = PackSnorm16(v4(-1.f, 1.f, 0.25f, NAN));
+	CHECK4(I16.X == -32767, I16.Y == 32767, I16.Z == 8192, I16.W == 0);
+	CHECK_VEC4(Vec4FromSnorm16(v4i16(-32768, -32767, 0, 32767)), -1.f, -1.f, 0.f, 1.f);
+
+	u32 RoundTripErrors = 0;
+	for(u32 i = 0; i < 256; ++i)
+	{
+		v4u8 U = PackUnorm8(Vec4FromUnorm8(v4u8((u8)i, (u8)(255 - i), 0, 255)));
+		RoundTripErrors += U.X != i || U.Y != 255 - i || U.Z != 0 || U.W != 255;
+		i8 S = (i8)(i - 128);
+		v4i8 R = PackSnorm8(Vec4FromSnorm8(v4i8(S, 0, 0, 0)));
+		RoundTripErrors += R.X != (S == -128 ? -127 : S);
+	}
+	for(u32 i = 0; i < 65536; ++i)
+	{
+		v4u16 U = PackUnorm16(Vec4FromUnorm16(v4u16((u16)i, 0, 0, 0)));
+		RoundTripErrors += U.X != i;
+		i16 S = (i16)(i - 32768);
+		v4i16 R = PackSnorm16(Vec4FromSnorm16(v4i16(S, 0, 0, 0)));
+		RoundTripErrors += R.X != (S == -32768 ? -32767 : S);
+	}
+	CHECK(RoundTripErrors == 0);
+}
+
+TEST_CASE("unorm and snorm arrays match the single value functions")
+{
+	constexpr u32 Count = 1031;
+	v4* In = new v4[Count];
+	v4u8* U8s = new v4u8[Count + 1];
+	v4i8* I8s = new v4i8[Count];
+	v4u16* U16s = new v4u16[Count];
+	v4i16* I16s = new v4i16[Count];
+	v4* Out = new v4[Count];
+	vec4* Vec4sOut = new vec4[Count];
+	u32 State = 99;
+	for(u32 i = 0; i < Count; ++i)
+	{
+		for(u32 j = 0; j < 4; ++j)
+		{
+			State = State * 1664525u + 1013904223u;
+			In[i].Elements[j] = (f32)(State >> 8) / (f32)(1 << 22) - 2.f;
+		}
+	}
+	In[3] = v4(NAN, INFINITY, -INFINITY, -0.f);
+
+	for(u32 Tail = 0; Tail < 4; ++Tail)
+	{
+		u32 N = Count - Tail;
+		INFO("Count: " << N);
+		memset(U8s, 0xAB, (Count + 1) * sizeof(v4u8));
+		PackUnorm8Array(In, U8s, N);
+		PackSnorm8Array(In, I8s, N);
+		PackUnorm16Array(In, U16s, N);
+		PackSnorm16Array(In, I16s, N);
+		CHECK(U8s[N].X == 0xAB);
+		u32 Mismatches = 0;
+		for(u32 i = 0; i < N; ++i)
+		{
+			v4u8 U8 = PackUnorm8(In[i]);
+			v4i8 I8 = PackSnorm8(In[i]);
+			v4u16 U16 = PackUnorm16(In[i]);
+			v4i16 I16 = PackSnorm16(In[i]);
+			Mismatches += memcmp(&U8s[i], &U8, sizeof(U8)) != 0;
+			Mismatches += memcmp(&I8s[i], &I8, sizeof(I8)) != 0;
+			Mismatches += memcmp(&U16s[i], &U16, sizeof(U16)) != 0;
+			Mismatches += memcmp(&I16s[i], &I16, sizeof(I16)) != 0;
+		}
+		CHECK(Mismatches == 0);
+
+		Mismatches = 0;
+		UnpackUnorm8Array(U8s, Out, N);
+		for(u32 i = 0; i < N; ++i)
+		{
+			v4 Expected = V4FromUnorm8(U8s[i]);
+			Mismatches += memcmp(&Out[i], &Expected, sizeof(v4)) != 0;
+		}
+		UnpackSnorm8Array(I8s, Vec4sOut, N);
+		for(u32 i = 0; i < N; ++i)
+		{
+			v4 Expected = V4FromSnorm8(I8s[i]);
+			v4 Actual = CastToV4(Vec4sOut[i]);
+			Mismatches += memcmp(&Actual, &Expected, sizeof(v4)) != 0;
+		}
+		UnpackUnorm16Array(U16s, Out, N);
+		for(u32 i = 0; i < N; ++i)
+		{
+			v4 Expected = V4FromUnorm16(U16s[i]);
+			Mismatches += memcmp(&Out[i], &Expected, sizeof(v4)) != 0;
+		}
+		UnpackSnorm16Array(I16s, Out, N);
+		for(u32 i = 0; i < N; ++i)
+		{
+			v4 Expected = V4FromSnorm16(I16s[i]);
+			Mismatches += memcmp(&Out[i], &Expected, sizeof(v4)) != 0;
+		}
+		CHECK(Mismatches == 0);
+	}
+
+	vec4 Vec4s[3] = {Vec4(0.2f, 0.4f, 0.6f, 0.8f), Vec4(-0.5f), Vec4(1.5f, -1.5f, 0.f, 1.f)};
+	v4i16 Packed[3];
+	PackSnorm16Array(Vec4s, Packed, 3);
+	UnpackSnorm16Array(Packed, Vec4sOut, 3);
+	CHECK_VEC4(Vec4sOut[2], 1.f, -1.f, 0.f, 1.f);
+	v4u8 Colors[3];
+	PackUnorm8Array(Vec4s, Colors, 3);
+	CHECK4(Colors[0].X == 51, Colors[0].Y == 102, Colors[0].Z == 153, Colors[0].W == 204);
+
+	delete[] In;
+	delete[] U8s;
+	delete[] I8s;
+	delete[] U16s;
+	delete[] I16s;
+	delete[] Out;
+	delete[] Vec4sOut;
+}
@@ -0,0 +1,132 @@
+
+static v3 RandomUnitV3(u32* State)
+{
+	v3 V;
+	f32 LengthSquared;
+	do
+	{
+		for(u32 i = 0; i < 3; ++i)
+		{
+			*State = *State * 1664525u + 1013904223u;
+			V.Elements[i] = (f32)(*State >> 8) / (f32)(1 << 23) - 1.f;
+		}
+		LengthSquared = V.X*V.X + V.Y*V.Y + V.Z*V.Z;
+	} while(LengthSquared < 0.01f || LengthSquared > 1.f);
+	f32 InvLength = 1.f / sqrtf(LengthSquared);
+	return v3(V.X * InvLength, V.Y * InvLength, V.Z * InvLength);
+}
+
+static f32 AngleBetweenUnitV3(v3 A, v3 B)
+{
+	// NOTE: atan2 of the cross and dot products stays accurate for tiny angles, unlike acos of the dot product
+	f64 CX = (f64)A.Y*B.Z - (f64)A.Z*B.Y;
+	f64 CY = (f64)A.Z*B.X - (f64)A.X*B.Z;
+	f64 CZ = (f64)A.X*B.Y - (f64)A.Y*B.X;
+	return (f32)atan2(sqrt(CX*CX + CY*CY + CZ*CZ), (f64)A.X*B.X + (f64)A.Y*B.Y + (f64)A.Z*B.Z);
+}
+
+TEST_CASE("octahedral normals")
+{
+	v3 Axes[6] = {v3(1.f, 0.f, 0.f), v3(-1.f, 0.f, 0.f), v3(0.f, 1.f, 0.f), v3(0.f, -1.f, 0.f), v3(0.f, 0.f, 1.f), v3(0.f, 0.f, -1.f)};
+	for(v3 Axis : Axes)
+	{
+		INFO("Axis: " << Axis.X << ", " << Axis.Y << ", " << Axis.Z);
+		CHECK_V3_APPROX(V3FromOctahedral16(Octahedral16(Axis)), Axis.X, Axis.Y, Axis.Z);
+		CHECK_V3_APPROX(V3FromOctahedral32(Octahedral32(Axis)), Axis.X, Axis.Y, Axis.Z);
+	}
+	CHECK(Octahedral16(v3(0.f, 0.f, 1.f)) == 0x0000);
+	CHECK(Octahedral16(v3(1.f, 0.f, 0.f)) == 0x007F);
+	CHECK(Octahedral32(v3(0.f, 1.f, 0.f)) == 0x7FFF0000);
+	CHECK_V3_APPROX(V3FromOctahedral16(Octahedral16(v3(0.f))), 0.f, 0.f, 1.f);
+	CHECK_V3_APPROX(V3FromOctahedral32(Octahedral32(v3(0.f, 0.f, -5.f))), 0.f, 0.f, -1.f);
+	CHECK_V3_APPROX(V3FromOctahedral16(0x8080), 0.f, 0.f, -1.f);
+
+	vec3 Normal = Vec3(0.f, -3.f, 4.f);
+	CHECK(Octahedral16(Normal) == Octahedral16(v3(0.f, -0.6f, 0.8f)));
+	CHECK(Octahedral32(Normal) == Octahedral32(v3(0.f, -0.6f, 0.8f)));
+	vec3 Decoded = Vec3FromOctahedral32(Octahedral32(Normal));
+	CHECK(Decoded.X() == doctest::Approx(0.f).epsilon(0.0001));
+	CHECK(Decoded.Y() == doctest::Approx(-0.6f).epsilon(0.0001));
+	CHECK(Decoded.Z() == doctest::Approx(0.8f).epsilon(0.0001));
+
+	// NOTE: Bounds are the measured worst cases over a dense random sample with a small margin
+	u32 State = 777;
+	f32 MaxError16 = 0.f, MaxError32 = 0.f, MaxLengthError = 0.f;
+	for(u32 i = 0; i < 200000; ++i)
+	{
+		v3 N = RandomUnitV3(&State);
+		v3 D16 = V3FromOctahedral16(Octahedral16(N));
+		v3 D32 = V3FromOctahedral32(Octahedral32(N));
+		MaxError16 = fmaxf(MaxError16, AngleBetweenUnitV3(N, D16));
+		MaxError32 = fmaxf(MaxError32, AngleBetweenUnitV3(N, D32));
+		MaxLengthError = fmaxf(MaxLengthError, fabsf(sqrtf(D32.X*D32.X + D32.Y*D32.Y + D32.Z*D32.Z) - 1.f));
+	}
+	CHECK(MaxError16 < 0.017f);
+	CHECK(MaxError32 < 0.00007f);
+	CHECK(MaxLengthError < 0.000001f);
+}
+
+TEST_CASE("octahedral normal arrays match the single vector functions")
+{
+	constexpr u32 Count = 1027;
+	v3* Normals = new v3[Count];
+	vec3* Vec3s = new vec3[Count];
+	u16* Codes16 = new u16[Count];
+	u32* Codes32 = new u32[Count];
+	v3* Out = new v3[Count];
+	vec3* Vec3sOut = new vec3[Count];
+	u32 State = 4242;
+	for(u32 i = 0; i < Count; ++i)
+	{
+		Normals[i] = RandomUnitV3(&State);
+		Vec3s[i] = CastToVec3(Normals[i]);
+	}
+	Normals[5] = v3(0.f);
+
+	for(u32 Tail = 0; Tail < 4; ++Tail)
+	{
+		u32 N = Count - Tail;
+		INFO("Count: " << N);
+		memset(Codes16, 0xCD, Count * sizeof(u16));
+		PackOctahedralArray(Normals, Codes16, N);
+		UnpackOctahedralArray(Codes16, Out, N);
+		u32 Mismatches = 0;
+		for(u32 i = 0; i < N; ++i)
+		{
+			v3 Expected = V3FromOctahedral16(Octahedral16(Normals[i]));
+			Mismatches += Codes16[i] != Octahedral16(Normals[i]);
+			Mismatches += memcmp(&Out[i], &Expected, sizeof(v3)) != 0;
+		}
+		CHECK(Mismatches == 0);
+		CHECK((N == Count || Codes16[N] == 0xCDCD));
+
+		PackOctahedralArray(Normals, Codes32, N);
+		UnpackOctahedralArray(Codes32, Vec3sOut, N);
+		Mismatches = 0;
+		for(u32 i = 0; i < N; ++i)
+		{
+			v3 Expected = V3FromOctahedral32(Octahedral32(Normals[i]));
+			Mismatches += Codes32[i] != Octahedral32(Normals[i]);
+			Mismatches += Vec3sOut[i].X() != Expected.X || Vec3sOut[i].Y() != Expected.Y || Vec3sOut[i].Z() != Expected.Z;
+		}
+		CHECK(Mismatches == 0);
+	}
+
+	PackOctahedralArray(Vec3s, Codes32, Count);
+	UnpackOctahedralArray(Codes32, Out, Count);
+	u32 Mismatches = 0;
+	for(u32 i = 0; i < Count; ++i)
+		Mismatches += Codes32[i] != Octahedral32(Vec3s[i]);
+	CHECK(Mismatches == 0);
+	CHECK_V3(Out[3], V3FromOctahedral32(Codes32[3]).X, V3FromOctahedral32(Codes32[3]).Y, V3FromOctahedral32(Codes32[3]).Z);
+	PackOctahedralArray(Vec3s, Codes16, Count);
+	UnpackOctahedralArray(Codes16, Vec3sOut, Count);
+	CHECK(Vec3sOut[7].Z() == V3FromOctahedral16(Codes16[7]).Z);
+
+	delete[] Normals;
+	delete[] Vec3s;
+	delete[] Codes16;
+	delete[] Codes32;
+	delete[] Out;
+	delete[] Vec3sOut;
+}
@@ -0,0 +1,167 @@
+
+#define CHECK_QUAT_APPROX(_Q, _X, _Y, _Z, _W) { \
+	quat _Res = _Q; \
+	CHECK4(_Res.X() == FloatCmp(_X), _Res.Y() == FloatCmp(_Y), _Res.Z() == FloatCmp(_Z), _Res.W() == FloatCmp(_W)); }
+
+TEST_CASE("quat construction and getters")
+{
+	quat Q = Quat(1.f, 2.f, 3.f, 4.f);
+	CHECK4(Q.X() == 1.f, Q.Y() == 2.f, Q.Z() == 3.f, Q.W() == 4.f);
+	CHECK4(Q[0] == 1.f, Q[1] == 2.f, Q[2] == 3.f, Q[3] == 4.f);
+	Q[2] = 5.f;
+	CHECK(Q.Z() == 5.f);
+
+	CHECK(QuatIdentity() == Quat(0.f, 0.f, 0.f, 1.f));
+	CHECK(QuatIdentity() != Quat(0.f, 0.f, 0.f, -1.f));
+
+	float S = sinf(Pi32 / 4.f);
+	float C = cosf(Pi32 / 4.f);
+	CHECK_QUAT_APPROX(QuatRotationDegrees(90.f, 0.f, 2.f, 0.f), 0.f, S, 0.f, C);
+	CHECK_QUAT_APPROX(QuatRotationDegrees(90.f, v3(0.f, 0.f, 3.f)), 0.f, 0.f, S, C);
+	CHECK_QUAT_APPROX(QuatRotationRadians(Pi32 / 2.f, Vec3(1.f, 0.f, 0.f)), S, 0.f, 0.f, C);
+
+	quat EX = QuatRotationDegrees(30.f, 1.f, 0.f, 0.f);
+	quat EY = QuatRotationDegrees(45.f, 0.f, 1.f, 0.f);
+	quat EZ = QuatRotationDegrees(60.f, 0.f, 0.f, 1.f);
+	quat Expected = EZ * EY * EX;
+	CHECK_QUAT_APPROX(QuatEulerDegrees(30.f, 45.f, 60.f), Expected.X(), Expected.Y(), Expected.Z(), Expected.W());
+	CHECK_QUAT_APPROX(QuatEulerDegrees(v3(30.f, 45.f, 60.f)), Expected.X(), Expected.Y(), Expected.Z(), Expected.W());
+	CHECK_QUAT_APPROX(QuatEulerRadians(v3(DegreesToRadians(30.f), DegreesToRadians(45.f), DegreesToRadians(60.f))),
+		Expected.X(), Expected.Y(), Expected.Z(), Expected.W());
+}
+
+TEST_CASE("quat operations")
+{
+	quat A = Quat(1.f, 2.f, 3.f, 4.f);
+	quat B = Quat(5.f, 6.f, 7.f, 8.f);
+	CHECK_QUAT_APPROX(A * B, 24.f, 48.f, 48.f, -6.f);
+	CHECK_QUAT_APPROX(B * A, 32.f, 32.f, 56.f, -6.f);
+	quat C = A;
+	C *= B;
+	CHECK(C == A * B);
+
+	CHECK_QUAT_APPROX(-A, -1.f, -2.f, -3.f, -4.f);
+	CHECK_QUAT_APPROX(Conjugate(A), -1.f, -2.f, -3.f, 4.f);
+	CHECK(Dot(A, B) == FloatCmp(70.f));
+	CHECK(Length(Quat(1.f, 1.f, 1.f, 1.f)) == FloatCmp(2.f));
+	CHECK_QUAT_APPROX(Normalize(Quat(1.f, 1.f, 1.f, 1.f)), 0.5f, 0.5f, 0.5f, 0.5f);
+	CHECK_QUAT_APPROX(Inverse(A) * A, 0.f, 0.f, 0.f, 1.f);
+	CHECK_QUAT_APPROX(A * Inverse(A), 0.f, 0.f, 0.f, 1.f);
+
+	quat Rot90 = QuatRotationDegrees(90.f, 0.f, 0.f, 1.f);
+	CHECK_V3_APPROX(Rotate(Rot90, v3(1.f, 0.f, 0.f)), 0.f, 1.f, 0.f);
+	CHECK_VEC3_APPROX(Rotate(Rot90, Vec3(0.f, 1.f, 0.f)), -1.f, 0.f, 0.f);
+	CHECK_V3_APPROX(Rotate(Rot90 * Rot90, v3(1.f, 2.f, 3.f)), -1.f, -2.f, 3.f);
+
+	quat Q = QuatRotationDegrees(70.f, Normalize(v3(1.f, 2.f, 3.f)));
+	v4 Expected = Mat4RotationDegrees(70.f, Normalize(v3(1.f, 2.f, 3.f))) * v4(4.f, 5.f, 6.f, 0.f);
+	CHECK_V3_APPROX(Rotate(Q, v3(4.f, 5.f, 6.f)), Expected.X, Expected.Y, Expected.Z);
+}
+
+TEST_CASE("quat conversions to matrices")
+{
+	quat Q = QuatRotationDegrees(70.f, 1.f, 2.f, 3.f);
+	mat4 Expected = Mat4RotationDegrees(70.f, 1.f, 2.f, 3.f);
+	CHECK_ALL_MATRIX_ENTRIES_APPROX(Mat4FromQuat(Q),
+		Expected[0], Expected[4], Expected[8], Expected[12],
+		Expected[1], Expected[5], Expected[9], Expected[13],
+		Expected[2], Expected[6], Expected[10], Expected[14],
+		0.f, 0.f, 0.f, 1.f);
+	CHECK_ALL_MATRIX_ENTRIES_APPROX(Mat4FromMat3x4(Mat3x4FromQuat(Q)),
+		Expected[0], Expected[4], Expected[8], Expected[12],
+		Expected[1], Expected[5], Expected[9], Expected[13],
+		Expected[2], Expected[6], Expected[10], Expected[14],
+		0.f, 0.f, 0.f, 1.f);
+
+	CHECK_ALL_MATRIX_ENTRIES(Mat4FromQuat(QuatIdentity()),
+		1.f, 0.f, 0.f, 0.f,
+		0.f, 1.f, 0.f, 0.f,
+		0.f, 0.f, 1.f, 0.f,
+		0.f, 0.f, 0.f, 1.f);
+
+	Expected = Mat4TranslationScaleRotationDegrees(v3(1.f, 2.f, 3.f), v3(2.f, 3.f, 4.f), 70.f, v3(1.f, 2.f, 3.f));
+	CHECK_ALL_MATRIX_ENTRIES_APPROX(Mat4TranslationScaleRotation(v3(1.f, 2.f, 3.f), v3(2.f, 3.f, 4.f), Q),
+		Expected[0], Expected[4], Expected[8], Expected[12],
+		Expected[1], Expected[5], Expected[9], Expected[13],
+		Expected[2], Expected[6], Expected[10], Expected[14],
+		0.f, 0.f, 0.f, 1.f);
+	CHECK_ALL_MATRIX_ENTRIES_APPROX(Mat4TranslationScaleRotation(Vec3(1.f, 2.f, 3.f), Vec3(2.f, 3.f, 4.f), Q),
+		Expected[0], Expected[4], Expected[8], Expected[12],
+		Expected[1], Expected[5], Expected[9], Expected[13],
+		Expected[2], Expected[6], Expected[10], Expected[14],
+		0.f, 0.f, 0.f, 1.f);
+	CHECK_ALL_MATRIX_ENTRIES_APPROX(Mat4FromMat3x4(Mat3x4TranslationScaleRotation(v3(1.f, 2.f, 3.f), v3(2.f, 3.f, 4.f), Q)),
+		Expected[0], Expected[4], Expected[8], Expected[12],
+		Expected[1], Expected[5], Expected[9], Expected[13],
+		Expected[2], Expected[6], Expected[10], Expected[14],
+		0.f, 0.f, 0.f, 1.f);
+
+	// NOTE: Composing quaternions has to match composing their matrices
+	quat P = QuatEulerDegrees(10.f, 20.f, 30.f);
+	mat4 PQ = Mat4FromQuat(P) * Mat4FromQuat(Q);
+	CHECK_ALL_MATRIX_ENTRIES_APPROX(Mat4FromQuat(P * Q),
+		PQ[0], PQ[4], PQ[8], PQ[12],
+		PQ[1], PQ[5], PQ[9], PQ[13],
+		PQ[2], PQ[6], PQ[10], PQ[14],
+		0.f, 0.f, 0.f, 1.f);
+}
+
+TEST_CASE("quat lerps")
+{
+	quat A = QuatIdentity();
+	quat B = QuatRotationDegrees(90.f, 0.f, 0.f, 1.f);
+	quat Expected = QuatRotationDegrees(45.f, 0.f, 0.f, 1.f);
+	CHECK_QUAT_APPROX(Slerp(A, B, 0.5f), Expected.X(), Expected.Y(), Expected.Z(), Expected.W());
+	CHECK_QUAT_APPROX(Nlerp(A, B, 0.5f), Expected.X(), Expected.Y(), Expected.Z(), Expected.W());
+	CHECK_QUAT_APPROX(Slerp(A, -B, 0.5f), Expected.X(), Expected.Y(), Expected.Z(), Expected.W());
+	Expected = QuatRotationDegrees(30.f, 0.f, 0.f, 1.f);
+	CHECK_QUAT_APPROX(Slerp(A, B, 1.f / 3.f), Expected.X(), Expected.Y(), Expected.Z(), Expected.W());
+	CHECK_QUAT_APPROX(Slerp(A, B, 0.f), 0.f, 0.f, 0.f, 1.f);
+	CHECK_QUAT_APPROX(Slerp(B, B, 0.3f), B.X(), B.Y(), B.Z(), B.W());
+}
+
+TEST_CASE("quat batch lerps")
+{
+	constexpr uint32_t Count = 37;
+	quat A[Count], B[Count], Out[Count];
+	for(uint32_t i = 0; i < Count; ++i)
+	{
+		A[i] = QuatEulerDegrees((float)(i * 37), (float)(i * 11), (float)(i * 23));
+		B[i] = QuatEulerDegrees((float)(i * 13 + 5), (float)(i * 29), (float)(i * 7 + 90));
+	}
+	// NOTE: Opposite sides of the hypersphere and nearly opposite rotations
+	B[3] = -B[3];
+	B[4] = A[4] * QuatRotationDegrees(179.9f, 1.f, 2.f, 3.f);
+	B[5] = A[5];
+
+	auto CheckLanes = [&](quat (*Reference)(quat, quat, float), float T) {
+		for(uint32_t i = 0; i < Count; ++i)
+		{
+			quat R = Reference(A[i], B[i], T);
+			INFO("index " << i << ", T " << T);
+			CHECK4(Out[i].X() == doctest::Approx(R.X()).epsilon(1e-5), Out[i].Y() == doctest::Approx(R.Y()).epsilon(1e-5),
+				   Out[i].Z() == doctest::Approx(R.Z()).epsilon(1e-5), Out[i].W() == doctest::Approx(R.W()).epsilon(1e-5));
+		}
+	};
+	for(uint32_t Tier = SimdTier_SSE2; Tier <= GetMaxSupportedSimdTier(); ++Tier)
+	{
+		SetSimdTier((simd_tier)Tier);
+		INFO("tier " << GetSimdTierName((simd_tier)Tier));
+		for(float T : {0.f, 0.25f, 0.5f, 0.8f, 1.f})
+		{
+			SlerpQuatArray(A, B, T, Out, Count);
+			CheckLanes(Slerp, T);
+			NlerpQuatArray(A, B, T, Out, Count);
+			CheckLanes(Nlerp, T);
+		}
+
+		quat InPlace[Count];
+		memcpy(InPlace, A, sizeof(A));
+		SlerpQuatArray(InPlace, B, 0.5f, InPlace, Count);
+		SlerpQuatArray(A, B, 0.5f, Out, Count);
+		CHECK(memcmp(InPlace, Out, sizeof(Out)) == 0);
+
+		SlerpQuatArray(A, B, 0.5f, Out, 0);
+	}
+	SetSimdTier(GetMaxSupportedSimdTier());
+}
@@ -286,3 +286,21 @@ TEST_CASE("rect2 cast constructor")
 	CHECK_RECT2(B, 10, 20, 20, 30);
 }
 
+TEST_CASE("rect2 in constant expressions")
+{
+	constexpr rect2 A = Rect2MinMax(10, 20, 20, 30);
+	constexpr rect2 B = Rect2CenterDim(v2(0, 0), v2(4, 2));
+	constexpr rect2 U = Union(Union(A, B), v2(40, -5));
+	static_assert(U.Min == v2(-2, -5) && U.Max == v2(40, 30));
+	static_assert(rect2i(Rect2MinDim(v2(1, 2), v2(3, 4))).Max == v2i(4, 6));
+	CHECK_RECT2(U, -2, -5, 40, 30);
+}
+
+
+TEST_CASE("RayIntersectsCircle")
+{
+	CHECK(RayIntersectsCircle(v2(0.f, 0.f), v2(1.f, 0.f), v2(5.f, 0.5f), 1.f));
+	CHECK(RayIntersectsCircle(v2(0.f, 0.f), v2(0.f, 1.f), v2(0.5f, 5.f), 1.f));
+	CHECK_FALSE(RayIntersectsCircle(v2(0.f, 0.f), v2(1.f, 0.f), v2(5.f, 3.f), 1.f));
+	CHECK_FALSE(RayIntersectsCircle(v2(0.f, 0.f), v2(0.f, 1.f), v2(5.f, 0.f), 1.f));
+}
@@ -0,0 +1,173 @@
+
+static bool SameRect(rect2s A, rect2 B)
+{
+	rect2 R = CastToRect2(A);
+	return memcmp(&R, &B, sizeof(rect2)) == 0;
+}
+
+static bool SameV2(v2 A, v2 B)
+{
+	return memcmp(&A, &B, sizeof(v2)) == 0;
+}
+
+TEST_CASE("rect2s construction and access")
+{
+	rect2s R = Rect2sMinMax(-1.5f, 2.5f, 3.f, 4.f);
+	CHECK4(R.MinX() == -1.5f, R.MinY() == 2.5f, R.MaxX() == 3.f, R.MaxY() == 4.f);
+	CHECK_V2(R.Min(), -1.5f, 2.5f);
+	CHECK_V2(R.Max(), 3.f, 4.f);
+	CHECK_RECT2(CastToRect2(R), -1.5f, 2.5f, 3.f, 4.f);
+	CHECK(CastToRect2s(Rect2MinMax(1.f, 2.f, 3.f, 4.f)) == Rect2sMinMax(1.f, 2.f, 3.f, 4.f));
+
+	CHECK(SameRect(Rect2sMinMax(v2(-1.5f, 2.5f), v2(3.f, 4.f)), Rect2MinMax(v2(-1.5f, 2.5f), v2(3.f, 4.f))));
+	CHECK(SameRect(Rect2sMinDim(-1.5f, 2.5f, 3.f, 4.f), Rect2MinDim(-1.5f, 2.5f, 3.f, 4.f)));
+	CHECK(SameRect(Rect2sMinDim(v2(-1.5f, 2.5f), v2(3.f, 4.f)), Rect2MinDim(v2(-1.5f, 2.5f), v2(3.f, 4.f))));
+	CHECK(SameRect(Rect2sDimMax(v2(5.5f, 2.5f), v2(3.f, 4.f)), Rect2DimMax(v2(5.5f, 2.5f), v2(3.f, 4.f))));
+	CHECK(SameRect(Rect2sCenterRadius(v2(5.f, 3.f), 2.f), Rect2CenterRadius(v2(5.f, 3.f), 2.f)));
+	CHECK(SameRect(Rect2sCenterRadius(v2(5.f, 3.f), v2(2.f, 1.f)), Rect2CenterRadius(v2(5.f, 3.f), v2(2.f, 1.f))));
+	CHECK(SameRect(Rect2sCenterDim(v2(5.f, 3.f), 3.f), Rect2CenterDim(v2(5.f, 3.f), 3.f)));
+	CHECK(SameRect(Rect2sCenterDim(v2(5.f, 3.f), v2(3.f, 1.f)), Rect2CenterDim(v2(5.f, 3.f), v2(3.f, 1.f))));
+	CHECK(SameRect(Rect2sDim(7.f, 8.f), Rect2Dim(7.f, 8.f)));
+	CHECK(SameRect(Rect2sDim(v2(7.f, 8.f)), Rect2Dim(v2(7.f, 8.f))));
+
+	CHECK(GetWidth(R) == 4.5f);
+	CHECK(GetH(R) == 1.5f);
+	CHECK_V2(GetDim(R), 4.5f, 1.5f);
+	CHECK_V2(GetCenter(R), 0.75f, 3.25f);
+	CHECK(GetArea(R) == 6.75f);
+	CHECK(R != Rect2sMinMax(-1.5f, 2.5f, 3.f, 4.5f));
+	CHECK(Equal(R, Rect2sMinMax(-1.5f, 2.5f, 3.f, 4.00001f)));
+	CHECK_FALSE(Equal(R, Rect2sMinMax(-1.5f, 2.5f, 3.f, 4.1f)));
+
+	CHECK(Ptr(R)[0] == -1.5f);
+	CHECK(Ptr(R)[3] == 4.f);
+	CHECK(PtrMax(R)[0] == 3.f);
+	PtrMax(R)[1] = 5.f;
+	CHECK(R.MaxY() == 5.f);
+	CHECK(IsValid(R));
+	CHECK_FALSE(IsValid(InvalidRect2s));
+}
+
+TEST_CASE("rect2s matches rect2")
+{
+	// NOTE: Small integer coordinates make touching edges, empty and flipped rects common
+	u32 State = 31337;
+	auto RandomCoordinate = [&State]() {
+		State = State * 1664525u + 1013904223u;
+		return (f32)((State >> 16) % 9) - 4.f;
+	};
+	u32 Mismatches = 0;
+	for(u32 i = 0; i < 20000; ++i)
+	{
+		rect2 A = Rect2MinMax(RandomCoordinate(), RandomCoordinate(), RandomCoordinate(), RandomCoordinate());
+		rect2 B = Rect2MinMax(RandomCoordinate(), RandomCoordinate(), RandomCoordinate(), RandomCoordinate());
+		v2 P = v2(RandomCoordinate() * 0.5f, RandomCoordinate() * 0.5f);
+		rect2s AS = CastToRect2s(A);
+		rect2s BS = CastToRect2s(B);
+		rect2 Positive = MakeRectNotHaveNegativeDim(A);
+		rect2s PositiveS = MakeRectNotHaveNegativeDim(AS);
+
+		Mismatches += !SameRect(PositiveS, Positive);
+		Mismatches += Intersect(AS, P) != Intersect(A, P);
+		Mismatches += IntersectOrTouch(AS, P) != IntersectOrTouch(A, P);
+		Mismatches += IntersectFlipAllowed(AS, P) != IntersectFlipAllowed(A, P);
+		Mismatches += IntersectOrTouchFlipAllowed(AS, P) != IntersectOrTouchFlipAllowed(A, P);
+		Mismatches += Intersect(AS, BS) != Intersect(A, B);
+		Mismatches += IntersectOrTouch(AS, BS) != IntersectOrTouch(A, B);
+		Mismatches += FullyIntersect(AS, BS) != FullyIntersect(A, B);
+		Mismatches += FullyIntersectOrTouch(AS, BS) != FullyIntersectOrTouch(A, B);
+		Mismatches += IntersectFlipAllowed(AS, BS) != IntersectFlipAllowed(A, B);
+		Mismatches += IntersectOrTouchFlipAllowed(AS, BS) != IntersectOrTouchFlipAllowed(A, B);
+		Mismatches += FullyIntersectFlipAllowed(AS, BS) != FullyIntersectFlipAllowed(A, B);
+
+		rect2 Intersection = {};
+		rect2s IntersectionS = CastToRect2s(Intersection);
+		bool Overlaps = IntersectionRect(A, B, &Intersection);
+		Mismatches += IntersectionRect(AS, BS, &IntersectionS) != Overlaps;
+		Mismatches += !SameRect(IntersectionS, Intersection);
+
+		Mismatches += !SameRect(Union(AS, BS), Union(A, B));
+		Mismatches += !SameRect(Union(AS, P), Union(A, P));
+		Mismatches += HasArea(AS) != HasArea(A);
+		Mismatches += HasAreaFlipAllowed(AS) != HasAreaFlipAllowed(A);
+		Mismatches += HasNegativeDim(AS) != HasNegativeDim(A);
+		Mismatches += HasNegativeW(AS) != HasNegativeW(A);
+		Mismatches += HasNegativeH(AS) != HasNegativeH(A);
+		Mismatches += (AS == BS) != (A == B);
+
+		Mismatches += !SameV2(ClampToRect(P, PositiveS), ClampToRect(P, Positive));
+		Mismatches += !SameRect(FitRectInsideBounds(BS, PositiveS), FitRectInsideBounds(B, Positive));
+		Mismatches += !SameV2(GetDim(AS), GetDim(A));
+		Mismatches += !SameV2(GetCenter(AS), GetCenter(A));
+		Mismatches += !SameV2(GetRadius(AS), GetRadius(A));
+		Mismatches += GetArea(AS) != GetArea(A);
+		Mismatches += !SameV2(GetMaxXMinY(AS), GetMaxXMinY(A));
+		Mismatches += !SameV2(GetMinXMaxY(AS), GetMinXMaxY(A));
+		Mismatches += !SameRect(SetCenter(AS, P), SetCenter(A, P));
+		Mismatches += !SameRect(SetDimWithFixedCenter(AS, P), SetDimWithFixedCenter(A, P));
+		Mismatches += !SameRect(SetDimWithFixedMin(AS, P), SetDimWithFixedMin(A, P));
+		Mismatches += !SameRect(SetDimWithFixedMax(AS, P), SetDimWithFixedMax(A, P));
+		Mismatches += !SameRect(AddRadius(AS, P), AddRadius(A, P));
+		Mismatches += !SameRect(MoveRect(AS, P), MoveRect(A, P));
+		Mismatches += !SameRect(AS * 1.5f, A * 1.5f);
+		Mismatches += !SameRect(AS / 3.f, A / 3.f);
+		Mismatches += !SameRect(Lerp(AS, BS, 0.3f), Lerp(A, B, 0.3f));
+		Mismatches += !SameRect(FastLerp(AS, BS, 0.3f), FastLerp(A, B, 0.3f));
+
+		Mismatches += !SameV2(GetMinYCenter(AS), GetMinYCenter(A));
+		Mismatches += !SameV2(GetMaxYCenter(AS), GetMaxYCenter(A));
+		Mismatches += !SameV2(GetMinXCenter(AS), GetMinXCenter(A));
+		Mismatches += !SameV2(GetMaxXCenter(AS), GetMaxXCenter(A));
+		Mismatches += !SameRect(SetCenter(AS, P.X, P.Y), SetCenter(A, P.X, P.Y));
+		Mismatches += !SameRect(SetDimWithFixedCenter(AS, P.X, P.Y), SetDimWithFixedCenter(A, P.X, P.Y));
+		Mismatches += !SameRect(SetDimWithFixedMin(AS, P.X, P.Y), SetDimWithFixedMin(A, P.X, P.Y));
+		Mismatches += !SameRect(SetDimWithFixedMax(AS, P.X, P.Y), SetDimWithFixedMax(A, P.X, P.Y));
+		Mismatches += !SameRect(SetMin(AS, P), SetMin(A, P));
+		Mismatches += !SameRect(SetMax(AS, P), SetMax(A, P));
+		Mismatches += !SameRect(SetMaxXMinY(AS, P), SetMaxXMinY(A, P));
+		Mismatches += !SameRect(SetMinXMaxY(AS, P), SetMinXMaxY(A, P));
+		Mismatches += !SameRect(SetCenterXMinY(AS, P), SetCenterXMinY(A, P));
+		Mismatches += !SameRect(SetCenterXMaxY(AS, P), SetCenterXMaxY(A, P));
+		Mismatches += !SameRect(SetMinXCenterY(AS, P), SetMinXCenterY(A, P));
+		Mismatches += !SameRect(SetMaxXCenterY(AS, P), SetMaxXCenterY(A, P));
+		Mismatches += !SameRect(ScaleWithFixedMin(AS, P), ScaleWithFixedMin(A, P));
+		Mismatches += !SameRect(ScaleWithFixedMin(AS, 1.5f), ScaleWithFixedMin(A, 1.5f));
+		Mismatches += !SameRect(ScaleWithFixedMin(AS, GetDim(B), P), ScaleWithFixedMin(A, GetDim(B), P));
+		Mismatches += !SameRect(ScaleWithFixedMin(AS, GetDim(B), 1.5f), ScaleWithFixedMin(A, GetDim(B), 1.5f));
+		Mismatches += !SameRect(ScaleWithFixedMax(AS, P), ScaleWithFixedMax(A, P));
+		Mismatches += !SameRect(ScaleWithFixedMax(AS, 1.5f), ScaleWithFixedMax(A, 1.5f));
+		Mismatches += !SameRect(ScaleWithFixedMax(AS, GetDim(B), P), ScaleWithFixedMax(A, GetDim(B), P));
+		Mismatches += !SameRect(ScaleWithFixedMax(AS, GetDim(B), 1.5f), ScaleWithFixedMax(A, GetDim(B), 1.5f));
+		Mismatches += !SameRect(ScaleWithFixedCenter(AS, P), ScaleWithFixedCenter(A, P));
+		Mismatches += !SameRect(ScaleWithFixedCenter(AS, 1.5f), ScaleWithFixedCenter(A, 1.5f));
+		Mismatches += !SameRect(ScaleWithFixedCenter(AS, GetDim(B), P), ScaleWithFixedCenter(A, GetDim(B), P));
+		Mismatches += !SameRect(ScaleWithFixedCenter(AS, GetDim(B), 1.5f), ScaleWithFixedCenter(A, GetDim(B), 1.5f));
+		Mismatches += GetWidthHeightRatio(AS) != GetWidthHeightRatio(A);
+		Mismatches += GetHeightWidthRatio(AS) != GetHeightWidthRatio(A);
+		if(HasArea(Positive))
+		{
+			Mismatches += !SameRect(ExpandToDesiredWidthHeightRatioWithFixedCenter(PositiveS, 1.5f), ExpandToDesiredWidthHeightRatioWithFixedCenter(Positive, 1.5f));
+			Mismatches += !SameRect(ExpandToDesiredWidthHeightRatioWithFixedCenter(PositiveS, 0.25f), ExpandToDesiredWidthHeightRatioWithFixedCenter(Positive, 0.25f));
+		}
+	}
+	CHECK(Mismatches == 0);
+
+	rect2s R = Rect2sMinMax(0.f, 0.f, 2.f, 2.f);
+	MoveRect(&R, v2(1.f, -1.f));
+	Union(&R, v2(5.f, 0.f));
+	AddRadius(&R, 1.f);
+	CHECK(R == Rect2sMinMax(0.f, -2.f, 6.f, 2.f));
+	SetMin(&R, v2(1.f, 1.f));
+	CHECK(R == Rect2sMinMax(1.f, 1.f, 7.f, 5.f));
+	SetMaxXCenterY(&R, v2(0.f, 0.f));
+	CHECK(R == Rect2sMinMax(-6.f, -2.f, 0.f, 2.f));
+	ScaleWithFixedCenter(&R, v2(0.5f, 2.f));
+	CHECK(R == Rect2sMinMax(-4.5f, -4.f, -1.5f, 4.f));
+	SetDimWithFixedMin(&R, 2.f, 3.f);
+	CHECK(R == Rect2sMinMax(-4.5f, -4.f, -2.5f, -1.f));
+	ExpandToDesiredWidthHeightRatioWithFixedCenter(&R, 2.f);
+	CHECK(R == Rect2sMinMax(-6.5f, -4.f, -0.5f, -1.f));
+	v2 P = v2(7.f, -5.f);
+	ClampToRectFlipAllowed(&P, Rect2sMinMax(6.f, 2.f, 0.f, -2.f));
+	CHECK_V2(P, 6.f, -2.f);
+}
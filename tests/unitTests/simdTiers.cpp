@@ -0,0 +1,44 @@
+
+TEST_CASE("simd tier detection")
+{
+	simd_tier MaxTier = GetMaxSupportedSimdTier();
+	CHECK(MaxTier >= SimdTier_SSE2);
+	CHECK(MaxTier < SimdTier_Count);
+	CHECK(GetSimdTier() <= MaxTier);
+	CHECK(std::string(GetSimdTierName(SimdTier_SSE2)) == "SSE2");
+	CHECK(std::string(GetSimdTierName(SimdTier_AVX2_FMA)) == "AVX2+FMA");
+
+	CHECK(SetSimdTier(SimdTier_SSE2) == SimdTier_SSE2);
+	CHECK(GetSimdTier() == SimdTier_SSE2);
+	CHECK(SetSimdTier(SimdTier_AVX2_FMA) == MaxTier);
+	CHECK(GetSimdTier() == MaxTier);
+}
+
+TEST_CASE("mat4 multiplication gives the same result on every simd tier")
+{
+	mat4 A = Mat4FromRows(
+		1.f, 2.f, 3.f, 4.f,
+		5.f, 6.f, 7.f, 8.f,
+		9.f, 10.f, 11.f, 12.f,
+		13.f, 14.f, 15.f, 16.f);
+
+	mat4 B = Mat4FromRows(
+		-1.f, -2.f, -3.f, -4.f,
+		5.f, 6.f, 7.f, 8.f,
+		2.f, 2.f, 2.f, 2.f,
+		0.f, 0.f, 0.f, 0.f);
+
+	simd_tier MaxTier = GetMaxSupportedSimdTier();
+	for(uint32_t Tier = SimdTier_SSE2; Tier <= MaxTier; ++Tier)
+	{
+		INFO("Tier: " << GetSimdTierName((simd_tier)Tier));
+		CHECK(SetSimdTier((simd_tier)Tier) == Tier);
+		CHECK_ALL_MATRIX_ENTRIES(A * B,
+			15.f, 16.f, 17.f, 18.f,
+			39.f, 40.f, 41.f, 42.f,
+			63.f, 64.f, 65.f, 66.f,
+			87.f, 88.f, 89.f, 90.f
+		);
+	}
+	SetSimdTier(MaxTier);
+}
@@ -0,0 +1,102 @@
+
+TEST_CASE("dual_quat")
+{
+	quat Rotation = QuatRotationDegrees(70.f, 1.f, 2.f, 3.f);
+	dual_quat Q = DualQuat(Rotation, v3(4.f, 5.f, 6.f));
+	CHECK_V3_APPROX(GetTranslationV3(Q), 4.f, 5.f, 6.f);
+	CHECK_VEC3_APPROX(GetTranslationVec3(DualQuat(Rotation, Vec3(-1.f, 2.f, -3.f))), -1.f, 2.f, -3.f);
+	CHECK_V3_APPROX(GetTranslationV3(DualQuatIdentity()), 0.f, 0.f, 0.f);
+
+	mat4 Expected = Mat4Translation(4.f, 5.f, 6.f) * Mat4FromQuat(Rotation);
+	CHECK_ALL_MATRIX_ENTRIES_APPROX(Mat4FromDualQuat(Q),
+		Expected[0], Expected[4], Expected[8], Expected[12],
+		Expected[1], Expected[5], Expected[9], Expected[13],
+		Expected[2], Expected[6], Expected[10], Expected[14],
+		0.f, 0.f, 0.f, 1.f);
+	v4 P = Expected * v4(1.f, 2.f, 3.f, 1.f);
+	CHECK_V3_APPROX(TransformPoint(Q, v3(1.f, 2.f, 3.f)), P.X, P.Y, P.Z);
+}
+
+TEST_CASE("skinning")
+{
+	constexpr uint32_t BoneCount = 5;
+	dual_quat DualQuats[BoneCount];
+	mat4 Matrices[BoneCount];
+	for(uint32_t i = 0; i < BoneCount; ++i)
+	{
+		DualQuats[i] = DualQuat(QuatRotationDegrees(20.f * i, 1.f, (float)i, 0.5f), v3((float)i, -2.f, 0.5f * i));
+		Matrices[i] = Mat4FromDualQuat(DualQuats[i]);
+	}
+	// NOTE: Same rotation from the other side of the hypersphere
+	DualQuats[4].Real = -DualQuats[4].Real;
+	DualQuats[4].Dual = -DualQuats[4].Dual;
+
+	constexpr uint32_t Count = 6;
+	v4u16 Indices[Count] = {
+		v4u16(0, 0, 0, 0), v4u16(3, 0, 0, 0), v4u16(1, 2, 0, 0),
+		v4u16(4, 3, 2, 1), v4u16(2, 4, 0, 0), v4u16(1, 1, 3, 3)};
+	v4 Weights[Count] = {
+		v4(1.f, 0.f, 0.f, 0.f), v4(1.f, 0.f, 0.f, 0.f), v4(0.5f, 0.5f, 0.f, 0.f),
+		v4(0.1f, 0.2f, 0.3f, 0.4f), v4(0.25f, 0.75f, 0.f, 0.f), v4(0.3f, 0.3f, 0.2f, 0.2f)};
+	v3 Positions[Count], Normals[Count], OutPositions[Count], OutNormals[Count];
+	for(uint32_t i = 0; i < Count; ++i)
+	{
+		Positions[i] = v3((float)i, 1.f, -2.f + i);
+		Normals[i] = Normalize(v3(1.f, (float)i, 2.f));
+	}
+
+	for(uint32_t Tier = SimdTier_SSE2; Tier <= GetMaxSupportedSimdTier(); ++Tier)
+	{
+		SetSimdTier((simd_tier)Tier);
+		INFO("tier " << GetSimdTierName((simd_tier)Tier));
+
+		SkinVerticesLinear(Matrices, Indices, Weights, Positions, Normals, OutPositions, OutNormals, Count);
+		for(uint32_t i = 0; i < Count; ++i)
+		{
+			v4 P = {}, N = {};
+			for(uint32_t Bone = 0; Bone < 4; ++Bone)
+			{
+				P += Weights[i][Bone] * (Matrices[Indices[i][Bone]] * v4(Positions[i], 1.f));
+				N += Weights[i][Bone] * (Matrices[Indices[i][Bone]] * v4(Normals[i], 0.f));
+			}
+			INFO("vertex " << i);
+			CHECK_V3_APPROX(OutPositions[i], P.X, P.Y, P.Z);
+			v3 ExpectedN = Normalize(N.XYZ);
+			CHECK_V3_APPROX(OutNormals[i], ExpectedN.X, ExpectedN.Y, ExpectedN.Z);
+		}
+
+		SkinVerticesDualQuat(DualQuats, Indices, Weights, Positions, Normals, OutPositions, OutNormals, Count);
+		for(uint32_t i = 0; i < Count; ++i)
+		{
+			quat Real0 = DualQuats[Indices[i][0]].Real;
+			v4 Real = {}, Dual = {};
+			for(uint32_t Bone = 0; Bone < 4; ++Bone)
+			{
+				dual_quat Q = DualQuats[Indices[i][Bone]];
+				float W = Dot(Q.Real, Real0) < 0.f ? -Weights[i][Bone] : Weights[i][Bone];
+				Real += W * v4(Q.Real.X(), Q.Real.Y(), Q.Real.Z(), Q.Real.W());
+				Dual += W * v4(Q.Dual.X(), Q.Dual.Y(), Q.Dual.Z(), Q.Dual.W());
+			}
+			float Length = sqrtf(Dot(Real, Real));
+			dual_quat Blend;
+			Blend.Real = Quat(Real.X / Length, Real.Y / Length, Real.Z / Length, Real.W / Length);
+			Blend.Dual = Quat(Dual.X / Length, Dual.Y / Length, Dual.Z / Length, Dual.W / Length);
+			v3 P = TransformPoint(Blend, Positions[i]);
+			v3 N = Rotate(Blend.Real, Normals[i]);
+			INFO("vertex " << i);
+			CHECK_V3_APPROX(OutPositions[i], P.X, P.Y, P.Z);
+			CHECK_V3_APPROX(OutNormals[i], N.X, N.Y, N.Z);
+		}
+
+		// NOTE: A single influence has to match the bone transform in both kernels
+		v4 P = Matrices[3] * v4(Positions[1], 1.f);
+		CHECK_V3_APPROX(OutPositions[1], P.X, P.Y, P.Z);
+
+		v3 InPlace[Count];
+		memcpy(InPlace, Positions, sizeof(Positions));
+		SkinVerticesLinear(Matrices, Indices, Weights, InPlace, nullptr, InPlace, nullptr, Count);
+		SkinVerticesLinear(Matrices, Indices, Weights, Positions, nullptr, OutPositions, nullptr, Count);
+		CHECK(memcmp(InPlace, OutPositions, sizeof(InPlace)) == 0);
+	}
+	SetSimdTier(GetMaxSupportedSimdTier());
+}
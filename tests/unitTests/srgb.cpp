@@ -0,0 +1,133 @@
+
+static f64 SrgbToLinearReference(f64 C)
+{
+	return C <= 0.04045 ? C / 12.92 : pow((C + 0.055) / 1.055, 2.4);
+}
+
+static f64 LinearToSrgbReference(f64 L)
+{
+	return L <= 0.0031308 ? L * 12.92 : 1.055 * pow(L, 1.0 / 2.4) - 0.055;
+}
+
+TEST_CASE("srgb conversions")
+{
+	CHECK(SrgbToLinear(0.f) == 0.f);
+	CHECK(SrgbToLinear(1.f) == doctest::Approx(1.f).epsilon(0.000001));
+	CHECK(LinearToSrgb(1.f) == doctest::Approx(1.f).epsilon(0.000001));
+	CHECK(SrgbToLinear(0.04f) == 0.04f / 12.92f);
+	CHECK(LinearToSrgb(0.003f) == 0.003f * 12.92f);
+	CHECK(SrgbToLinear(-0.5f) == 0.f);
+	CHECK(LinearToSrgb(2.f) == LinearToSrgb(1.f));
+	CHECK(std::isnan(SrgbToLinear(NAN)));
+
+	vec4 Color = SrgbToLinear(Vec4(0.5f, 0.25f, 1.f, 0.5f));
+	CHECK(Color.X() == doctest::Approx(0.21404114f).epsilon(0.00001));
+	CHECK(Color.W() == 0.5f);
+	v4 Back = LinearToSrgb(CastToV4(Color));
+	CHECK_V4(Back, FloatCmp(0.5f), FloatCmp(0.25f), FloatCmp(1.f), 0.5f);
+	CHECK(LinearToSrgb(v4(0.f, 0.f, 0.f, 0.123f)).W == 0.123f);
+
+	f64 MaxError = 0.0;
+	for(u32 i = 0; i <= 100000; ++i)
+	{
+		f32 X = (f32)i / 100000.f;
+		f64 Expected = SrgbToLinearReference(X);
+		MaxError = fmax(MaxError, fabs(SrgbToLinear(X) - Expected) / fmax(Expected, 1e-30));
+		Expected = LinearToSrgbReference(X);
+		MaxError = fmax(MaxError, fabs(LinearToSrgb(X) - Expected) / fmax(Expected, 1e-30));
+	}
+	CHECK(MaxError < 0.000003);
+
+	u32 TableErrors = 0;
+	u32 RoundTripErrors = 0;
+	for(u32 i = 0; i < 256; ++i)
+	{
+		v4u8 Srgb = v4u8((u8)i, (u8)(255 - i), (u8)(i / 2), (u8)i);
+		v4 Linear = V4FromSrgb8(Srgb);
+		TableErrors += Linear.X != (f32)SrgbToLinearReference(i / 255.0);
+		TableErrors += Linear.W != (f32)i / 255.f;
+		TableErrors += !(Vec4FromSrgb8(Srgb).Y() == Linear.Y);
+		v4u8 Packed = PackSrgb8(Linear);
+		RoundTripErrors += Packed.X != Srgb.X || Packed.Y != Srgb.Y || Packed.Z != Srgb.Z || Packed.W != Srgb.W;
+	}
+	CHECK(TableErrors == 0);
+	CHECK(RoundTripErrors == 0);
+
+	// NOTE: Only linear values within the float curve error of a rounding midpoint may land on the other side
+	u32 RoundingErrors = 0;
+	for(u32 i = 0; i <= 100000; ++i)
+	{
+		f32 X = (f32)i / 100000.f;
+		f64 Exact = LinearToSrgbReference(X) * 255.0;
+		u8 Packed = PackSrgb8(v4(X)).X;
+		if(Packed != (u8)nearbyint(Exact))
+			RoundingErrors += fabs(Exact - floor(Exact) - 0.5) > 0.0005;
+	}
+	CHECK(RoundingErrors == 0);
+}
+
+TEST_CASE("srgb arrays match the single value functions")
+{
+	constexpr u32 Count = 1029;
+	v4* In = new v4[Count];
+	v4* Out = new v4[Count];
+	vec4* Vec4sOut = new vec4[Count];
+	v4u8* Pixels = new v4u8[Count];
+	u32 State = 2024;
+	for(u32 i = 0; i < Count; ++i)
+	{
+		for(u32 j = 0; j < 4; ++j)
+		{
+			State = State * 1664525u + 1013904223u;
+			In[i].Elements[j] = (f32)(State >> 8) / (f32)(1 << 23) * 1.2f - 0.1f;
+		}
+	}
+
+	for(u32 Tail = 0; Tail < 4; ++Tail)
+	{
+		u32 N = Count - Tail;
+		INFO("Count: " << N);
+		u32 Mismatches = 0;
+		SrgbToLinearArray(In, Out, N);
+		for(u32 i = 0; i < N; ++i)
+		{
+			v4 Expected = SrgbToLinear(In[i]);
+			Mismatches += memcmp(&Out[i], &Expected, sizeof(v4)) != 0;
+		}
+		LinearToSrgbArray(In, Out, N);
+		for(u32 i = 0; i < N; ++i)
+		{
+			v4 Expected = LinearToSrgb(In[i]);
+			Mismatches += memcmp(&Out[i], &Expected, sizeof(v4)) != 0;
+		}
+		PackSrgb8Array(In, Pixels, N);
+		for(u32 i = 0; i < N; ++i)
+		{
+			v4u8 Expected = PackSrgb8(In[i]);
+			Mismatches += memcmp(&Pixels[i], &Expected, sizeof(v4u8)) != 0;
+		}
+		UnpackSrgb8Array(Pixels, Vec4sOut, N);
+		for(u32 i = 0; i < N; ++i)
+		{
+			v4 Expected = V4FromSrgb8(Pixels[i]);
+			v4 Actual = CastToV4(Vec4sOut[i]);
+			Mismatches += memcmp(&Actual, &Expected, sizeof(v4)) != 0;
+		}
+		CHECK(Mismatches == 0);
+	}
+
+	vec4 Vec4s[2] = {Vec4(0.5f, 0.5f, 0.5f, 0.25f), Vec4(1.f)};
+	SrgbToLinearArray(Vec4s, Vec4sOut, 2);
+	CHECK(Vec4sOut[0].W() == 0.25f);
+	LinearToSrgbArray(Vec4sOut, Vec4sOut, 2);
+	CHECK(Vec4sOut[0].X() == FloatCmp(0.5f));
+	PackSrgb8Array(Vec4s, Pixels, 2);
+	UnpackSrgb8Array(Pixels, Out, 2);
+	CHECK(Pixels[0].W == 64);
+	CHECK(Out[1].X == 1.f);
+
+	delete[] In;
+	delete[] Out;
+	delete[] Vec4sOut;
+	delete[] Pixels;
+}
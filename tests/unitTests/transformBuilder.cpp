@@ -0,0 +1,82 @@
+static void CheckSameMatrix(mat4 Got, mat4 Expected)
+{
+	for(u32 i = 0; i < 16; ++i)
+	{
+		INFO("element " << i);
+		CHECK(Got[i] == doctest::Approx(Expected[i]).epsilon(0.0001));
+	}
+}
+
+TEST_CASE("transform_builder")
+{
+	CheckSameMatrix(Mat4FromTransformBuilder(TransformBuilder()), Mat4Identity());
+
+	{
+		transform_builder B = TransformBuilder();
+		Scale(&B, v3(2.f, 3.f, 4.f));
+		RotateDegrees(&B, 70.f, v3(1.f, 2.f, 3.f));
+		Translate(&B, v3(1.f, 2.f, 3.f));
+		CheckSameMatrix(Mat4FromTransformBuilder(B),
+			Mat4TranslationScaleRotationDegrees(v3(1.f, 2.f, 3.f), v3(2.f, 3.f, 4.f), 70.f, v3(1.f, 2.f, 3.f)));
+	}
+
+	{
+		// NOTE: Translations add in world space like Translate(mat4*, ...), the rest multiplies on the right
+		mat4 M = Mat4Identity();
+		transform_builder B = TransformBuilder();
+		Translate(&M, 5.f, -1.f, 2.f);
+		Translate(&B, 5.f, -1.f, 2.f);
+		RotateRadians(&M, 0.7f, 0.f, 1.f, 0.f);
+		RotateRadians(&B, 0.7f, 0.f, 1.f, 0.f);
+		Translate(&M, Vec3(1.f, 1.f, 1.f));
+		Translate(&B, Vec3(1.f, 1.f, 1.f));
+		RotateDegrees(&M, -40.f, 1.f, 0.5f, 0.f);
+		RotateDegrees(&B, -40.f, 1.f, 0.5f, 0.f);
+		CheckSameMatrix(Mat4FromTransformBuilder(B), M);
+		CHECK_FALSE(B.HasLinear);
+
+		Scale(&B, 2.f);
+		CheckSameMatrix(Mat4FromTransformBuilder(B), M * Mat4Scale(2.f));
+		CHECK_FALSE(B.HasLinear);
+	}
+
+	{
+		// NOTE: A non uniform scale after a rotation doesn't fit into translation, scale and rotation anymore
+		transform_builder B = TransformBuilder();
+		RotateDegrees(&B, 30.f, 0.f, 0.f, 1.f);
+		Scale(&B, 1.f, 2.f, 3.f);
+		RotateDegrees(&B, 45.f, 1.f, 0.f, 0.f);
+		Scale(&B, Vec3(0.5f, 1.f, 1.5f));
+		mat4 Expected = Mat4RotationDegrees(30.f, 0.f, 0.f, 1.f) * Mat4Scale(1.f, 2.f, 3.f) *
+		                Mat4RotationDegrees(45.f, 1.f, 0.f, 0.f) * Mat4Scale(0.5f, 1.f, 1.5f);
+		CheckSameMatrix(Mat4FromTransformBuilder(B), Expected);
+		CHECK(B.HasLinear);
+	}
+
+	{
+		mat4 M = Mat4Translation(1.f, 2.f, 3.f);
+		transform_builder B = TransformBuilder();
+		Translate(&B, 1.f, 2.f, 3.f);
+		RotateDegrees(&M, 20.f, 1.f, 1.f, 0.f);
+		RotateDegrees(&B, 20.f, 1.f, 1.f, 0.f);
+		ShearXAxis(&M, 0.5f, -0.25f);
+		ShearXAxis(&B, 0.5f, -0.25f);
+		ShearYAxis(&M, 0.1f, 0.2f);
+		ShearYAxis(&B, 0.1f, 0.2f);
+		RotateDegrees(&M, 60.f, 0.f, 0.f, 1.f);
+		RotateDegrees(&B, 60.f, 0.f, 0.f, 1.f);
+		ShearZAxis(&M, 0.3f, 0.4f);
+		ShearZAxis(&B, 0.3f, 0.4f);
+		Shear(&M, 0.1f, 0.2f, 0.3f, 0.4f, 0.5f, 0.6f);
+		Shear(&B, 0.1f, 0.2f, 0.3f, 0.4f, 0.5f, 0.6f);
+		CheckSameMatrix(Mat4FromTransformBuilder(B), M);
+	}
+
+	{
+		quat Q = QuatEulerDegrees(10.f, 20.f, 30.f);
+		transform_builder B = TransformBuilder();
+		Rotate(&B, Q);
+		Rotate(&B, Q);
+		CheckSameMatrix(Mat4FromTransformBuilder(B), Mat4FromQuat(Q) * Mat4FromQuat(Q));
+	}
+}
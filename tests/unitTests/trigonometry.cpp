@@ -0,0 +1,159 @@
+
+// NOTE: Distance from the exact result in units of the last place of the float it rounds to
+static double UlpError(float Got, double Exact)
+{
+	float Magnitude = fabsf((float)Exact);
+	float Ulp = Magnitude == 0.f ? nextafterf(0.f, 1.f) : nextafterf(Magnitude, INFINITY) - Magnitude;
+	return fabs((double)Got - Exact) / Ulp;
+}
+
+template<class lanes_fun, class exact_fun>
+static double MaxUlpError4(float Min, float Max, int Count, lanes_fun Lanes, exact_fun Exact)
+{
+	double MaxError = 0.0;
+	for(int i = 0; i < Count; i += 4)
+	{
+		float In[4], Out[4];
+		for(int Lane = 0; Lane < 4; ++Lane)
+			In[Lane] = Min + (Max - Min) * (float)(i + Lane) / (float)Count;
+		_mm_storeu_ps(Out, Lanes(_mm_loadu_ps(In)));
+		for(int Lane = 0; Lane < 4; ++Lane)
+			MaxError = fmax(MaxError, UlpError(Out[Lane], Exact((double)In[Lane])));
+	}
+	return MaxError;
+}
+
+#ifdef __AVX__
+template<class lanes_fun, class exact_fun>
+static double MaxUlpError8(float Min, float Max, int Count, lanes_fun Lanes, exact_fun Exact)
+{
+	double MaxError = 0.0;
+	for(int i = 0; i < Count; i += 8)
+	{
+		float In[8], Out[8];
+		for(int Lane = 0; Lane < 8; ++Lane)
+			In[Lane] = Min + (Max - Min) * (float)(i + Lane) / (float)Count;
+		_mm256_storeu_ps(Out, Lanes(_mm256_loadu_ps(In)));
+		for(int Lane = 0; Lane < 8; ++Lane)
+			MaxError = fmax(MaxError, UlpError(Out[Lane], Exact((double)In[Lane])));
+	}
+	return MaxError;
+}
+#endif
+
+TEST_CASE("vector trigonometry accuracy")
+{
+	const int Count = 200000;
+	auto ExactSin = [](double X){ return sin(X); };
+	auto ExactCos = [](double X){ return cos(X); };
+	auto ExactTan = [](double X){ return tan(X); };
+	auto ExactAsin = [](double X){ return asin(X); };
+	auto ExactAcos = [](double X){ return acos(X); };
+
+	CHECK(MaxUlpError4(-10.f, 10.f, Count, [](__m128 X){ return Sin(X); }, ExactSin) <= 3.0);
+	CHECK(MaxUlpError4(-50000.f, 50000.f, Count, [](__m128 X){ return Sin(X); }, ExactSin) <= 3.0);
+	CHECK(MaxUlpError4(-10.f, 10.f, Count, [](__m128 X){ return Cos(X); }, ExactCos) <= 3.0);
+	CHECK(MaxUlpError4(-50000.f, 50000.f, Count, [](__m128 X){ return Cos(X); }, ExactCos) <= 3.0);
+	CHECK(MaxUlpError4(-1000.f, 1000.f, Count, [](__m128 X){ return Tan(X); }, ExactTan) <= 5.0);
+	CHECK(MaxUlpError4(-1.f, 1.f, Count, [](__m128 X){ return Asin(X); }, ExactAsin) <= 3.0);
+	CHECK(MaxUlpError4(-1.f, 1.f, Count, [](__m128 X){ return Acos(X); }, ExactAcos) <= 2.0);
+
+	CHECK(MaxUlpError4(-50000.f, 50000.f, Count, [](__m128 X){ return FastSin(X); }, ExactSin) <= 28.0);
+	CHECK(MaxUlpError4(-50000.f, 50000.f, Count, [](__m128 X){ return FastCos(X); }, ExactCos) <= 28.0);
+	CHECK(MaxUlpError4(-1000.f, 1000.f, Count, [](__m128 X){ return FastTan(X); }, ExactTan) <= 40.0);
+	CHECK(MaxUlpError4(-1.f, 1.f, Count, [](__m128 X){ return FastAsin(X); }, ExactAsin) <= 33.0);
+	CHECK(MaxUlpError4(-1.f, 1.f, Count, [](__m128 X){ return FastAcos(X); }, ExactAcos) <= 33.0);
+
+	double ScalarSinError = 0.0;
+	double ScalarCosError = 0.0;
+	for(int i = 0; i < Count; ++i)
+	{
+		float X = -1000.f + 2000.f * (float)i / (float)Count;
+		float S, C;
+		SinCos(X, &S, &C);
+		ScalarSinError = fmax(ScalarSinError, UlpError(S, sin((double)X)));
+		ScalarCosError = fmax(ScalarCosError, UlpError(C, cos((double)X)));
+	}
+	CHECK(ScalarSinError <= 3.0);
+	CHECK(ScalarCosError <= 3.0);
+
+	// NOTE: Past the range reduction limit, 3e9 and -4e9 used to overflow the int32 quadrant
+	CHECK(MaxUlpError4(50000.f, 1e6f, Count, [](__m128 X){ return Sin(X); }, ExactSin) <= 3.0);
+	CHECK(MaxUlpError4(-1e10f, 1e10f, Count, [](__m128 X){ return Cos(X); }, ExactCos) <= 3.0);
+	float Large[] = {3e9f, -4e9f, 1e30f, 49999.f};
+	vec4 LargeSin, LargeCos;
+	SinCos(Vec4(Large[0], Large[1], Large[2], Large[3]), &LargeSin, &LargeCos);
+	for(int i = 0; i < 4; ++i)
+	{
+		float S, C;
+		SinCos(Large[i], &S, &C);
+		CHECK(UlpError(LargeSin[i], sin((double)Large[i])) <= 3.0);
+		CHECK(UlpError(LargeCos[i], cos((double)Large[i])) <= 3.0);
+		CHECK(UlpError(S, sin((double)Large[i])) <= 3.0);
+		CHECK(UlpError(C, cos((double)Large[i])) <= 3.0);
+	}
+	CHECK(std::isnan(Sin(Vec4(INFINITY)).X()));
+
+	for(float Other : {1.f, -1.f, 0.37f, -5.f, 1e-3f})
+	{
+		auto ExactYOverOther = [Other](double Y){ return atan2(Y, (double)Other); };
+		auto ExactOtherOverX = [Other](double X){ return atan2((double)Other, X); };
+		__m128 O = _mm_set1_ps(Other);
+		CHECK(MaxUlpError4(-50.f, 50.f, Count, [O](__m128 Y){ return Atan2(Y, O); }, ExactYOverOther) <= 4.0);
+		CHECK(MaxUlpError4(-50.f, 50.f, Count, [O](__m128 X){ return Atan2(O, X); }, ExactOtherOverX) <= 4.0);
+		CHECK(MaxUlpError4(-50.f, 50.f, Count, [O](__m128 Y){ return FastAtan2(Y, O); }, ExactYOverOther) <= 80.0);
+		CHECK(MaxUlpError4(-50.f, 50.f, Count, [O](__m128 X){ return FastAtan2(O, X); }, ExactOtherOverX) <= 80.0);
+	}
+
+#ifdef __AVX__
+	CHECK(MaxUlpError8(-50000.f, 50000.f, Count, [](__m256 X){ return Sin(X); }, ExactSin) <= 3.0);
+	CHECK(MaxUlpError8(-1e10f, 1e10f, Count, [](__m256 X){ return Sin(X); }, ExactSin) <= 3.0);
+	CHECK(MaxUlpError8(-50000.f, 50000.f, Count, [](__m256 X){ return Cos(X); }, ExactCos) <= 3.0);
+	CHECK(MaxUlpError8(-1000.f, 1000.f, Count, [](__m256 X){ return Tan(X); }, ExactTan) <= 5.0);
+	CHECK(MaxUlpError8(-1.f, 1.f, Count, [](__m256 X){ return Asin(X); }, ExactAsin) <= 3.0);
+	CHECK(MaxUlpError8(-1.f, 1.f, Count, [](__m256 X){ return Acos(X); }, ExactAcos) <= 2.0);
+	CHECK(MaxUlpError8(-50.f, 50.f, Count, [](__m256 X){ return Atan2(_mm256_set1_ps(0.37f), X); },
+		[](double X){ return atan2(0.37, X); }) <= 4.0);
+	CHECK(MaxUlpError8(-50000.f, 50000.f, Count, [](__m256 X){ return FastSin(X); }, ExactSin) <= 28.0);
+	CHECK(MaxUlpError8(-50000.f, 50000.f, Count, [](__m256 X){ return FastCos(X); }, ExactCos) <= 28.0);
+	CHECK(MaxUlpError8(-1.f, 1.f, Count, [](__m256 X){ return FastAcos(X); }, ExactAcos) <= 33.0);
+	CHECK(MaxUlpError8(-50.f, 50.f, Count, [](__m256 X){ return FastAtan2(X, _mm256_set1_ps(-5.f)); },
+		[](double Y){ return atan2(Y, -5.0); }) <= 80.0);
+#endif
+}
+
+TEST_CASE("vector trigonometry special values and vector types")
+{
+	vec4 S, C;
+	SinCos(Vec4(0.f, Pi32 / 2.f, Pi32, -Pi32 / 6.f), &S, &C);
+	CHECK(S.X() == 0.f);
+	CHECK(C.X() == 1.f);
+	CHECK_VEC4_APPROX(S, 0.f, 1.f, 0.f, -0.5f);
+	CHECK_VEC4_APPROX(C, 1.f, 0.f, -1.f, 0.866025f);
+
+	float ScalarSin, ScalarCos;
+	SinCos(Pi32 / 3.f, &ScalarSin, &ScalarCos);
+	CHECK(ScalarSin == FloatCmp(0.866025f));
+	CHECK(ScalarCos == FloatCmp(0.5f));
+
+	CHECK_VEC2_APPROX(Sin(Vec2(Pi32 / 2.f, -Pi32 / 2.f)), 1.f, -1.f);
+	CHECK_VEC3_APPROX(Cos(Vec3(0.f, Pi32, Pi32 / 3.f)), 1.f, -1.f, 0.5f);
+	CHECK_VEC3_APPROX(Tan(Vec3(0.f, Pi32 / 4.f, -Pi32 / 4.f)), 0.f, 1.f, -1.f);
+	CHECK_VEC4_APPROX(FastSin(Vec4(Pi32 / 6.f)), 0.5f, 0.5f, 0.5f, 0.5f);
+	CHECK_VEC2_APPROX(FastTan(Vec2(Pi32 / 4.f, 0.f)), 1.f, 0.f);
+
+	CHECK_VEC4(Asin(Vec4(0.f, 1.f, -1.f, 0.5f)), 0.f, Pi32 / 2.f, -Pi32 / 2.f, FloatCmp(Pi32 / 6.f));
+	CHECK_VEC4(Acos(Vec4(1.f, 0.f, -1.f, 0.5f)), 0.f, Pi32 / 2.f, Pi32, FloatCmp(Pi32 / 3.f));
+	CHECK_VEC3_APPROX(FastAsin(Vec3(0.f, 1.f, -0.5f)), 0.f, Pi32 / 2.f, -Pi32 / 6.f);
+	CHECK_VEC3_APPROX(FastAcos(Vec3(1.f, -1.f, 0.5f)), 0.f, Pi32, Pi32 / 3.f);
+
+	vec4 Y = Vec4(0.f, 1.f, 0.f, -1.f);
+	vec4 X = Vec4(1.f, 0.f, -1.f, 0.f);
+	CHECK_VEC4(Atan2(Y, X), 0.f, Pi32 / 2.f, Pi32, -Pi32 / 2.f);
+	CHECK_VEC4_APPROX(FastAtan2(Y, X), 0.f, Pi32 / 2.f, Pi32, -Pi32 / 2.f);
+	CHECK_VEC2(Atan2(Vec2(0.f, -1.f), Vec2(0.f, -1.f)), 0.f, FloatCmp(-3.f * Pi32 / 4.f));
+	CHECK_VEC4(Atan2(Vec4(0.f, -0.f, 0.f, -0.f), Vec4(-0.f, -0.f, 0.f, 0.f)), Pi32, -Pi32, 0.f, -0.f);
+	CHECK(std::signbit(Atan2(Vec4(-0.f), Vec4(0.f)).X()));
+	CHECK_VEC4(FastAtan2(Vec4(0.f, -0.f, 1.f, -1.f), Vec4(-0.f, -0.f, -0.f, -0.f)), Pi32, -Pi32, Pi32 / 2.f, -Pi32 / 2.f);
+	CHECK_VEC3_APPROX(Atan2(Vec3(1.f, -1.f, 1.f), Vec3(1.f, 1.f, -1.f)), Pi32 / 4.f, -Pi32 / 4.f, 3.f * Pi32 / 4.f);
+}
@@ -6,6 +6,7 @@
 
 #include <string>
 #include <cmath>
+#include <cstring>
 
 using namespace fm;
 
@@ -182,6 +183,16 @@ static char binaryOutput[128];
 	CHECK4(_Mat[8] == C, _Mat[9] == G, _Mat[10] == K, _Mat[11] == O); \
 	CHECK4(_Mat[12] == D, _Mat[13] == H, _Mat[14] == L, _Mat[15] == P); }\
 
+#define CHECK_ALL_MATRIX_ENTRIES_APPROX(Mat, A, B, C, D, \
+                                             E, F, G, H, \
+                                             I, J, K, L,\
+                                             M, N, O, P) { \
+	mat4 _Mat = Mat; \
+	CHECK4(_Mat[0] == FloatCmp(A), _Mat[1] == FloatCmp(E), _Mat[2] == FloatCmp(I), _Mat[3] == FloatCmp(M)); \
+	CHECK4(_Mat[4] == FloatCmp(B), _Mat[5] == FloatCmp(F), _Mat[6] == FloatCmp(J), _Mat[7] == FloatCmp(N)); \
+	CHECK4(_Mat[8] == FloatCmp(C), _Mat[9] == FloatCmp(G), _Mat[10] == FloatCmp(K), _Mat[11] == FloatCmp(O)); \
+	CHECK4(_Mat[12] == FloatCmp(D), _Mat[13] == FloatCmp(H), _Mat[14] == FloatCmp(L), _Mat[15] == FloatCmp(P)); }
+
 #define CHECK_MAIN_DIAGONAL_OF_DIAGONAL_MATRIX(Mat, A, B, C, D) {\
 	mat4 _Mat = Mat; \
 	CHECK4(_Mat[0] == A,   _Mat[5] == B, _Mat[10] == C,  _Mat[15] == D);} \
@@ -201,8 +212,23 @@ static char binaryOutput[128];
 #include "v3.cpp"
 #include "v4.cpp"
 #include "rect2.cpp"
+#include "rect2s.cpp"
 #include "mat4.cpp"
+#include "mat3x4.cpp"
+#include "quat.cpp"
+#include "trigonometry.cpp"
+#include "exponentials.cpp"
 #include "vectorCasting.cpp"
 #include "invalidValues.cpp"
 #include "utilityFunctions.cpp"
+#include "simdTiers.cpp"
+#include "vectorPackets.cpp"
+#include "skinning.cpp"
+#include "transformBuilder.cpp"
+#include "alignedContainers.cpp"
+#include "frameArena.cpp"
+#include "halfPrecision.cpp"
+#include "octahedralNormals.cpp"
+#include "normalizedIntegers.cpp"
+#include "srgb.cpp"
 
@@ -131,3 +131,68 @@ TEST_CASE("utility functions")
 		CHECK(DifferenceBetweenDegrees(10, 260) == FloatCmp(110));
 	}
 }
+
+TEST_CASE("Fused multiply-add code paths")
+{
+	// NOTE: With FM_USE_FMA the products are not rounded separately, so results may differ by one rounding
+	{
+		f32 A = 0.1f, B = 7.3f, T = 0.37f;
+#ifdef FM_USE_FMA
+		CHECK(FastLerp(A, B, T) == fmaf(B - A, T, A));
+		CHECK(Lerp(A, B, T) == fmaf(1.f - T, A, T * B));
+#else
+		CHECK(FastLerp(A, B, T) == A + (B - A) * T);
+		CHECK(Lerp(A, B, T) == ((1.f - T) * A) + (T * B));
+#endif
+		f64 Exact = (f64)A + ((f64)B - (f64)A) * (f64)T;
+		CHECK(UlpError(FastLerp(A, B, T), Exact) <= 2.0);
+		CHECK(UlpError(Lerp(A, B, T), Exact) <= 2.0);
+		CHECK(UlpError(Lerp(Vec3(A, B, T), Vec3(B, T, B), T).X(), Exact) <= 2.0);
+		CHECK(UlpError(Lerp(Vec4(A), Vec4(B), T).W(), Exact) <= 2.0);
+		CHECK(UlpError(FastLerp(v3(A, A, A), v3(B, B, B), T).Z, Exact) <= 2.0);
+	}
+
+	{
+		f32 In[16];
+		for(u32 i = 0; i < 16; ++i)
+			In[i] = 0.3f + 0.77f * (f32)i;
+		vec4 A = Vec4(In[0], In[1], In[2], In[3]);
+		vec4 B = Vec4(In[4], In[5], In[6], In[7]);
+		f64 Exact = 0.0;
+		for(u32 i = 0; i < 4; ++i)
+			Exact += (f64)In[i] * (f64)In[i + 4];
+		CHECK(UlpError(Dot(A, B), Exact) <= 2.0);
+		CHECK(UlpError(Dot(Vec3(In[0], In[1], In[2]), Vec3(In[4], In[5], In[6])), Exact - (f64)In[3] * (f64)In[7]) <= 2.0);
+
+		mat4 M = Mat4FromColumns(In[0], In[1], In[2], In[3], In[4], In[5], In[6], In[7],
+		                         In[8], In[9], In[10], In[11], In[12], In[13], In[14], In[15]);
+		vec4 V = Vec4(1.5f, -0.25f, 2.f, 0.7f);
+		f32 VIn[4] = {1.5f, -0.25f, 2.f, 0.7f};
+		vec4 R = M * V;
+		for(u32 Row = 0; Row < 4; ++Row)
+		{
+			f64 ExactRow = 0.0;
+			for(u32 Col = 0; Col < 4; ++Col)
+				ExactRow += (f64)In[Col * 4 + Row] * (f64)VIn[Col];
+			INFO("row " << Row);
+			CHECK(UlpError(R[Row], ExactRow) <= 4.0);
+		}
+	}
+
+	{
+		f64 Angle = 0.8;
+		f64 X = 0.36, Y = -0.48, Z = 0.8;
+		f64 S = sin(Angle), C = cos(Angle), K = 1.0 - C;
+		f64 Exact[16] = {
+			X * X * K + C,     X * Y * K + Z * S, X * Z * K - Y * S, 0.0,
+			Y * X * K - Z * S, Y * Y * K + C,     Y * Z * K + X * S, 0.0,
+			Z * X * K + Y * S, Z * Y * K - X * S, Z * Z * K + C,     0.0,
+			0.0, 0.0, 0.0, 1.0};
+		mat4 M = Mat4RotationRadians((f32)Angle, Vec3(0.36f, -0.48f, 0.8f));
+		for(u32 i = 0; i < 16; ++i)
+		{
+			INFO("element " << i);
+			CHECK(fabs((f64)M[i] - Exact[i]) <= 1e-6);
+		}
+	}
+}
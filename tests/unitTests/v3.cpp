@@ -42,6 +42,18 @@ TEST_CASE_TEMPLATE("v3_base some operations", t, NUMERICAL_TYPES)
 	CHECK_V3(HadamardMul(A, B), 4, 10, 18);
 }
 
+TEST_CASE("v3 in constant expressions")
+{
+	constexpr v3 A(1, 0, 0);
+	constexpr v3 B(v2(0, 1), 0);
+	constexpr v3 C = Cross(A, B);
+	static_assert(C == v3(0, 0, 1));
+	static_assert(Dot(A + B, v3(2, 3, 4)) == 5);
+	static_assert(Lerp(A, B, 0.5f) == v3(0.5f, 0.5f, 0));
+	static_assert(-A * 2.f == v3(-2, 0, 0));
+	CHECK_V3(C, 0, 0, 1);
+}
+
 TEST_CASE("v3 operations")
 {
 	v3 A(2, 3, 4);
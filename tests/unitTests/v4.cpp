@@ -45,6 +45,16 @@ TEST_CASE_TEMPLATE("v4_base some operations", t, NUMERICAL_TYPES)
 	CHECK_V4(HadamardMul(A, B), 5, 12, 21, 32);
 }
 
+TEST_CASE("v4 in constant expressions")
+{
+	constexpr v4 Colors[] = { v4(v3(1, 0, 0), 1), v4(v2(0, 1), v2(0, 1)), v4(0, v3(0, 1, 1)) };
+	constexpr v4 Mixed = Lerp(Colors[0], Colors[2], 0.25f);
+	static_assert(Mixed == v4(0.75f, 0, 0.25f, 1));
+	static_assert(Dot(Colors[0], Colors[1]) == 1);
+	static_assert(v4i(Colors[2] + Colors[1]) == v4i(0, 1, 1, 2));
+	CHECK_V4(Mixed, 0.75f, 0, 0.25f, 1);
+}
+
 TEST_CASE("v4 operations")
 {
 	v4 A(1, 3, 5, -7);
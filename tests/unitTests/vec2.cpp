@@ -56,6 +56,10 @@ TEST_CASE("vec2 operations")
 	CHECK_VEC2(Abs(B), 5.f, 3.f); 
 	CHECK_VEC2_APPROX(Normalize(B), B.X() / sqrt(34.f), B.Y() / sqrt(34.f)); 
 	CHECK(Dot(A, B) == 2.f);
+	CHECK_VEC2(DotSplat(A, B), 2.f, 2.f);
+	CHECK_VEC2(SumSplat(B), -2.f, -2.f);
+	CHECK_VEC2(LengthSquaredSplat(B), 34.f, 34.f);
+	CHECK_VEC2(LengthSplat(Vec2(3.f, -4.f)), 5.f, 5.f);
 	CHECK(SumOfElements(B) == -2.f);
 	CHECK(Length(B) == FloatCmp(sqrt(34.f)));
 	CHECK(LengthSquared(B) == 34.f);
@@ -99,6 +103,11 @@ TEST_CASE("vec2 operations")
 	vec2 H = Vec2(-5.f, 3.f);
 	Normalize(&H);
 	CHECK_VEC2_APPROX(Normalize(B), B.X() / sqrt(34.f), B.Y() / sqrt(34.f)); 
+
+	CHECK_VEC2_APPROX(NormalizeFast(Vec2(3.f, -4.f)), 0.6f, -0.8f);
+	CHECK_VEC2(NormalizeSafe(Vec2(0.f, 8.f)), 0.f, 1.f);
+	CHECK_VEC2(NormalizeSafe(Vec2(0.f, 0.f)), 0.f, 0.f);
+	CHECK_VEC2(NormalizeSafe(Vec2(0.f, 0.f), Vec2(1.f, 0.f)), 1.f, 0.f);
 }
 
 TEST_CASE("vec2 Comparisons")
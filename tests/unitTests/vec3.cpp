@@ -82,6 +82,10 @@ TEST_CASE("vec3 operations")
 	CHECK_VEC3(Cross(Vec3(1.f, 0.f, 0.f), Vec3(0.f, 1.f, 0.f)), 0.f, 0.f, 1.f);
 	CHECK_VEC3(Cross(Vec3(2.f, 3.f, 4.f), Vec3(5.f, 6.f, 7.f)), -3.f, 6.f, -3.f);
 	CHECK(Dot(A, B) == 15.f);
+	CHECK_VEC3(DotSplat(A, B), 15.f, 15.f, 15.f);
+	CHECK_VEC3(SumSplat(B), 4.f, 4.f, 4.f);
+	CHECK_VEC3(LengthSquaredSplat(B), 30.f, 30.f, 30.f);
+	CHECK_VEC3(LengthSplat(Vec3(_mm_setr_ps(2.f, -3.f, 6.f, 50.f))), 7.f, 7.f, 7.f);
 	CHECK(SumOfElements(B) == 4.f);
 	CHECK(Length(B) == FloatCmp(sqrt(30.f)));
 	CHECK(LengthSquared(B) == 30.f);
@@ -132,6 +136,58 @@ TEST_CASE("vec3 operations")
 	CHECK_VEC3_APPROX(Normalize(K), B.X() / sqrt(30), B.Y() / sqrt(30), B.Z() / sqrt(30));
 }
 
+TEST_CASE("vec3 fast, safe and batch normalize")
+{
+	vec3 B = Vec3(-2.f, 5.f, 1.f);
+	vec3 Fast = NormalizeFast(B);
+	vec3 Exact = Normalize(B);
+	CHECK(fabsf(Fast.X() - Exact.X()) < 1e-6f);
+	CHECK(fabsf(Fast.Y() - Exact.Y()) < 1e-6f);
+	CHECK(fabsf(Fast.Z() - Exact.Z()) < 1e-6f);
+	NormalizeFast(&B);
+	CHECK(Length(B) == FloatCmp(1.f));
+
+	// NOTE: W of a vec3 doesn't take part in the length
+	CHECK_VEC3_APPROX(NormalizeFast(Vec3(_mm_setr_ps(3.f, 0.f, 4.f, 100.f))), 0.6f, 0.f, 0.8f);
+	CHECK_VEC3(NormalizeSafe(Vec3(_mm_setr_ps(0.f, 0.f, 0.f, 100.f)), Vec3(0.f, 1.f, 0.f)), 0.f, 1.f, 0.f);
+	CHECK_VEC3(NormalizeSafe(Vec3(0.f, -3.f, 0.f)), 0.f, -1.f, 0.f);
+	CHECK_VEC3(NormalizeSafe(Vec3(1e-30f, 0.f, 0.f)), 0.f, 0.f, 0.f);
+	CHECK_VEC3(NormalizeSafe(Vec3(INFINITY, 0.f, 0.f), Vec3(0.f, 0.f, 1.f)), 0.f, 0.f, 1.f);
+
+	const int Count = 37;
+	v3 In[Count], Out[Count];
+	vec3 InVec[Count], OutVec[Count];
+	for(int i = 0; i < Count; ++i)
+	{
+		In[i] = v3((float)i - 18.f, (float)(i % 5) * 0.5f, 3.f - (float)(i % 7));
+		InVec[i] = Vec3(In[i].X, In[i].Y, In[i].Z);
+	}
+	In[3] = v3(0.f, 0.f, 0.f);
+	InVec[3] = Vec3(0.f, 0.f, 0.f);
+	for(uint32_t Tier = SimdTier_SSE2; Tier <= GetMaxSupportedSimdTier(); ++Tier)
+	{
+		SetSimdTier((simd_tier)Tier);
+		INFO("tier " << GetSimdTierName((simd_tier)Tier));
+		NormalizeArray(In, Out, Count);
+		NormalizeArray(InVec, OutVec, Count);
+		for(int i = 0; i < Count; ++i)
+		{
+			INFO("index " << i);
+			vec3 Expected = i == 3 ? Vec3(0.f, 0.f, 0.f) : Normalize(InVec[i]);
+			CHECK(fabsf(Out[i].X - Expected.X()) < 1e-6f);
+			CHECK(fabsf(Out[i].Y - Expected.Y()) < 1e-6f);
+			CHECK(fabsf(Out[i].Z - Expected.Z()) < 1e-6f);
+			CHECK(OutVec[i] == Vec3(Out[i].X, Out[i].Y, Out[i].Z));
+		}
+		v3 InPlace[Count];
+		memcpy(InPlace, In, sizeof(In));
+		NormalizeArray(InPlace, InPlace, Count);
+		CHECK(memcmp(InPlace, Out, sizeof(Out)) == 0);
+		NormalizeArray(In, Out, 0);
+	}
+	SetSimdTier(GetMaxSupportedSimdTier());
+}
+
 TEST_CASE("vec3 Comparisons")
 {
 	vec3 A = Vec3(1.f, 2.f, 4.f);
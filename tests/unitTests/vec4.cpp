@@ -64,6 +64,10 @@ TEST_CASE("vec4 operations")
 	CHECK_VEC4(Abs(B), 2.f, 4.f, 6.f, 8.f);
 	CHECK_VEC4_APPROX(Normalize(B), B.X() / sqrt(120), B.Y() / sqrt(120), B.Z() / sqrt(120), B.W() / sqrt(120));
 	CHECK(Dot(A, B) == -72.f);
+	CHECK_VEC4(DotSplat(A, B), -72.f, -72.f, -72.f, -72.f);
+	CHECK_VEC4(SumSplat(B), 8.f, 8.f, 8.f, 8.f);
+	CHECK_VEC4(LengthSquaredSplat(B), 120.f, 120.f, 120.f, 120.f);
+	CHECK_VEC4(LengthSplat(Vec4(1.f, 2.f, 2.f, 4.f)), 5.f, 5.f, 5.f, 5.f);
 	CHECK(SumOfElements(B) == 8.f);
 	CHECK(Length(B) == FloatCmp(sqrt(120.f)));
 	CHECK(LengthSquared(B) == 120.f);
@@ -116,6 +120,11 @@ TEST_CASE("vec4 operations")
 	vec4 K = Vec4(2.f, 4.f, -6.f, 8.f);
 	Normalize(&K);
 	CHECK_VEC4_APPROX(K, K.X() / Length(K), K.Y() / Length(K), K.Z() / Length(K), K.W() / Length(K));
+
+	CHECK_VEC4_APPROX(NormalizeFast(Vec4(1.f, 2.f, 3.f, 4.f)), 1.f / sqrtf(30.f), 2.f / sqrtf(30.f), 3.f / sqrtf(30.f), 4.f / sqrtf(30.f));
+	CHECK_VEC4(NormalizeSafe(Vec4(0.f, 0.f, 0.f, -2.f)), 0.f, 0.f, 0.f, -1.f);
+	CHECK_VEC4(NormalizeSafe(Vec4(0.f), Vec4(0.f, 0.f, 0.f, 1.f)), 0.f, 0.f, 0.f, 1.f);
+	CHECK_VEC4(NormalizeSafe(Vec4(NAN, 0.f, 0.f, 0.f), Vec4(1.f, 0.f, 0.f, 0.f)), 1.f, 0.f, 0.f, 0.f);
 }
 
 TEST_CASE("vec4 Comparisons")
@@ -0,0 +1,156 @@
+
+#define CHECK_PACKET_LANES(_Lanes, ...) { \
+	float _Expected[] = {__VA_ARGS__}; \
+	auto _LanesCopy = _Lanes; \
+	float* _Got = (float*)&_LanesCopy; \
+	for(uint32_t _I = 0; _I < FM_ArrayCount(_Expected); ++_I) \
+		CHECK(_Got[_I] == FloatCmp(_Expected[_I])); }
+
+TEST_CASE("v3x4 loads and stores")
+{
+	v3 Arr[4] = {v3(1, 2, 3), v3(4, 5, 6), v3(7, 8, 9), v3(10, 11, 12)};
+	v3x4 P = V3x4FromMemory(Arr);
+	CHECK_PACKET_LANES(P.X, 1, 4, 7, 10);
+	CHECK_PACKET_LANES(P.Y, 2, 5, 8, 11);
+	CHECK_PACKET_LANES(P.Z, 3, 6, 9, 12);
+
+	v3 Out[4];
+	Store(Out, P);
+	for(uint32_t i = 0; i < 4; ++i)
+		CHECK_V3(Out[i], Arr[i].X, Arr[i].Y, Arr[i].Z);
+
+	vec3 VecArr[4] = {Vec3(1, 2, 3), Vec3(4, 5, 6), Vec3(7, 8, 9), Vec3(10, 11, 12)};
+	CHECK(V3x4FromMemory(VecArr) == P);
+	vec3 VecOut[4];
+	Store(VecOut, P);
+	for(uint32_t i = 0; i < 4; ++i)
+		CHECK_VEC3(VecOut[i], Arr[i].X, Arr[i].Y, Arr[i].Z);
+
+	float Xs[] = {1, 4, 7, 10}, Ys[] = {2, 5, 8, 11}, Zs[] = {3, 6, 9, 12};
+	CHECK(V3x4FromSoA(Xs, Ys, Zs) == P);
+
+	CHECK_V3(P.GetV3(2), 7, 8, 9);
+	CHECK_VEC3(P.GetVec3(3), 10, 11, 12);
+	P.Set(1, v3(-1, -2, -3));
+	CHECK_V3(P.GetV3(1), -1, -2, -3);
+	CHECK_V3(P.GetV3(0), 1, 2, 3);
+
+	CHECK(V3x4(Vec3(1, 2, 3)) == V3x4(v3(1, 2, 3)));
+	CHECK(V3x4() == V3x4(0, 0, 0));
+}
+
+TEST_CASE("v3x4 operations match vec3")
+{
+	vec3 A[4] = {Vec3(1, 2, 3), Vec3(-4, 5, 0.5f), Vec3(7, -8, 9), Vec3(0, 11, -2)};
+	vec3 B[4] = {Vec3(3, 1, 2), Vec3(2, 2, 2), Vec3(-1, 0, 4), Vec3(6, -3, 5)};
+	v3x4 PA = V3x4FromMemory(A);
+	v3x4 PB = V3x4FromMemory(B);
+
+	float Dots[4], Lengths[4];
+	_mm_storeu_ps(Dots, Dot(PA, PB));
+	_mm_storeu_ps(Lengths, Length(PA));
+
+	for(uint32_t i = 0; i < 4; ++i)
+	{
+		CHECK(Dots[i] == FloatCmp(Dot(A[i], B[i])));
+		CHECK(Lengths[i] == FloatCmp(Length(A[i])));
+		vec3 Expected;
+		Expected = Cross(A[i], B[i]);
+		CHECK_VEC3_APPROX(Cross(PA, PB).GetVec3(i), Expected.X(), Expected.Y(), Expected.Z());
+		Expected = Normalize(A[i]);
+		CHECK_VEC3_APPROX(Normalize(PA).GetVec3(i), Expected.X(), Expected.Y(), Expected.Z());
+		Expected = Lerp(A[i], B[i], 0.25f);
+		CHECK_VEC3_APPROX(Lerp(PA, PB, 0.25f).GetVec3(i), Expected.X(), Expected.Y(), Expected.Z());
+		Expected = A[i] + B[i] * 2.f - A[i] / 4.f;
+		CHECK_VEC3_APPROX((PA + PB * 2.f - PA / 4.f).GetVec3(i), Expected.X(), Expected.Y(), Expected.Z());
+		Expected = Min(A[i], B[i]);
+		CHECK_VEC3(Min(PA, PB).GetVec3(i), Expected.X(), Expected.Y(), Expected.Z());
+		Expected = Max(A[i], B[i]);
+		CHECK_VEC3(Max(PA, PB).GetVec3(i), Expected.X(), Expected.Y(), Expected.Z());
+		Expected = Abs(-A[i]);
+		CHECK_VEC3(Abs(-PA).GetVec3(i), Expected.X(), Expected.Y(), Expected.Z());
+		Expected = HadamardMul(A[i], B[i]);
+		CHECK_VEC3(HadamardMul(PA, PB).GetVec3(i), Expected.X(), Expected.Y(), Expected.Z());
+	}
+
+	v3x4 Scaled = PA * _mm_setr_ps(1, 2, 3, 4);
+	CHECK_V3(Scaled.GetV3(3), 0, 44, -8);
+
+	v3x4 Mask = GreaterMask(PA, PB);
+	__m128 AllGreater = AllComponentsMask(Mask);
+	CHECK(_mm_movemask_ps(AllGreater) == 0);
+	CHECK(_mm_movemask_ps(Mask.X) == 0b0100);
+	CHECK(_mm_movemask_ps(LesserOrEqualMask(PA, PA).Y) == 0xF);
+
+	v3x4 Picked = Select(_mm_castsi128_ps(_mm_setr_epi32(-1, 0, -1, 0)), PA, PB);
+	CHECK_VEC3(Picked.GetVec3(0), 1, 2, 3);
+	CHECK_VEC3(Picked.GetVec3(1), 2, 2, 2);
+
+	CHECK(PA == PA);
+	CHECK(PA != PB);
+	v3x4 C = PA;
+	C += PB;
+	C -= PB;
+	C *= 2.f;
+	C /= 2.f;
+	CHECK(C == PA);
+}
+
+TEST_CASE("v4x4 loads, stores and operations")
+{
+	v4 Arr[4] = {v4(1, 2, 3, 4), v4(5, 6, 7, 8), v4(9, 10, 11, 12), v4(13, 14, 15, 16)};
+	v4x4 P = V4x4FromMemory(Arr);
+	CHECK_PACKET_LANES(P.X, 1, 5, 9, 13);
+	CHECK_PACKET_LANES(P.W, 4, 8, 12, 16);
+
+	v4 Out[4];
+	Store(Out, P);
+	for(uint32_t i = 0; i < 4; ++i)
+		CHECK_V4(Out[i], Arr[i].X, Arr[i].Y, Arr[i].Z, Arr[i].W);
+
+	vec4 VecOut[4];
+	Store(VecOut, P * 2.f);
+	CHECK_VEC4(VecOut[2], 18, 20, 22, 24);
+	CHECK(V4x4FromMemory(VecOut) == P * 2.f);
+
+	CHECK_PACKET_LANES(Dot(P, P), 30, 174, 446, 846);
+	CHECK_VEC4_APPROX(Normalize(P).GetVec4(0), 1 / sqrtf(30.f), 2 / sqrtf(30.f), 3 / sqrtf(30.f), 4 / sqrtf(30.f));
+	CHECK_V4(Lerp(P, V4x4(0, 0, 0, 0), 0.5f).GetV4(3), 6.5f, 7, 7.5f, 8);
+	CHECK_V4(Clamp(P, V4x4(2, 2, 2, 2), V4x4(10, 10, 10, 10)).GetV4(0), 2, 2, 3, 4);
+	CHECK(_mm_movemask_ps(AllComponentsMask(EqualsMask(P, P))) == 0xF);
+	P.Set(3, Vec4(0, 0, 0, 0));
+	CHECK(V4x4(Vec4(0, 0, 0, 0)).GetV4(1).X == 0);
+	CHECK_V4(P.GetV4(3), 0, 0, 0, 0);
+}
+
+#ifdef __AVX__
+TEST_CASE("v3x8 and v4x8")
+{
+	v3 Arr[8];
+	for(uint32_t i = 0; i < 8; ++i)
+		Arr[i] = v3((float)i, (float)(i * 2), (float)(i * 3));
+	v3x8 P = V3x8FromMemory(Arr);
+	CHECK_PACKET_LANES(P.Y, 0, 2, 4, 6, 8, 10, 12, 14);
+	CHECK(LowerHalf(P) == V3x4FromMemory(Arr));
+	CHECK(UpperHalf(P) == V3x4FromMemory(Arr + 4));
+
+	v3 Out[8];
+	Store(Out, Cross(P, V3x8(0, 0, 1)));
+	for(uint32_t i = 0; i < 8; ++i)
+		CHECK_V3(Out[i], (float)(i * 2), -(float)i, 0);
+
+	CHECK_PACKET_LANES(LengthSquared(P), 0, 14, 56, 126, 224, 350, 504, 686);
+	CHECK(_mm256_movemask_ps(AllComponentsMask(GreaterMask(P, V3x8(3, 3, 3)))) == 0b11110000);
+
+	vec4 VecArr[8];
+	for(uint32_t i = 0; i < 8; ++i)
+		VecArr[i] = Vec4((float)i, 1, 2, 3);
+	v4x8 P4 = V4x8FromMemory(VecArr);
+	CHECK_PACKET_LANES(P4.X, 0, 1, 2, 3, 4, 5, 6, 7);
+	CHECK_VEC4(P4.GetVec4(6), 6, 1, 2, 3);
+	CHECK_PACKET_LANES(Dot(P4, V4x8(1, 1, 1, 1)), 6, 7, 8, 9, 10, 11, 12, 13);
+	vec4 VecOut[8];
+	Store(VecOut, -P4);
+	CHECK_VEC4(VecOut[7], -7, -1, -2, -3);
+}
+#endif